@@ -0,0 +1,330 @@
+// Copyright (C) 2026  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#pragma once
+
+#include "BBTree.txx"
+#include "InterpKernelSpaceFillingCurve.hxx"
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+/*!
+ * Linearized bounding volume hierarchy, answering the same requests than BBTree.
+ *
+ * Contrary to BBTree, that is a pointer tree, all the data are stored in a few contiguous arrays :
+ * - the ids of the elements, permuted so that each leaf is a range of consecutive positions ;
+ * - the bounding boxes of the elements, in the same permuted order and in structure-of-arrays layout
+ *   (all xmin, then all xmax, then all ymin...) ;
+ * - the nodes of the tree, each node having WIDTH children whose bounding boxes are also stored structure-of-arrays
+ *   in the node. So a node is traversed by testing its WIDTH children at once.
+ *
+ * The box tests on the children of a node and on the elements of a leaf are written as branch free loops over
+ * contiguous arrays so that they are vectorized by the compiler (4 or 8 boxes per instruction with AVX/AVX-512).
+ *
+ * The elements are ordered along a Morton (Z-order) curve of the centers of their bounding boxes, using a radix sort,
+ * then the sorted range is recursively split into WIDTH equal parts. The build is thus in O(n), and the only
+ * allocations are the few arrays listed above.
+ *
+ * The elements returned by the requests are the same as the ones returned by BBTree, but in a different order.
+ */
+template <int dim, class ConnType = int>
+class BBTreeFlat
+{
+   public:
+    static const int WIDTH = 4;
+    static const int LEAF_SIZE = 16;
+
+   private:
+    struct Node
+    {
+        double _min[dim][WIDTH];
+        double _max[dim][WIDTH];
+        //! id of the child node, or -1 if the child is a leaf (possibly empty) made of [ _bg, _end ) in _elems
+        ConnType _child[WIDTH];
+        ConnType _bg[WIDTH];
+        ConnType _end[WIDTH];
+    };
+
+   public:
+    /*!
+      Constructor of the flat bounding box tree. Parameters have the same meaning than for BBTree, in order to be able
+      to switch from one to the other.
+      \param bbs pointer to the [xmin1 xmax1 ymin1 ymax1 xmin2 xmax2 ...] array containing the bounding boxes that are
+      to be indexed. Contrary to BBTree, \a bbs is copied and is no longer needed after construction.
+      \param elems array to the indices of the elements contained in the tree, or nullptr for [0, \a nbelems ).
+      \param level unused. Only for compatibility with BBTree constructor.
+      \param nbelems nb of elements in the tree.
+      \param epsilon precision to which points are decided to be coincident, same meaning as for BBTree.
+    */
+    BBTreeFlat(
+        const double *bbs,
+        const ConnType *elems,
+        int /*level*/,
+        ConnType nbelems,
+        double epsilon = BBTREE_DFT_EPSILON
+    )
+        : _nb_elems(nbelems), _epsilon(epsilon)
+    {
+        sortElemsAlongMortonCurve(bbs, elems);
+        _min.resize(dim * _nb_elems);
+        _max.resize(dim * _nb_elems);
+        for (ConnType i = 0; i < _nb_elems; i++)
+            for (int idim = 0; idim < dim; idim++)
+            {
+                _min[idim * _nb_elems + i] = bbs[_elems[i] * 2 * dim + 2 * idim];
+                _max[idim * _nb_elems + i] = bbs[_elems[i] * 2 * dim + 2 * idim + 1];
+            }
+        buildNodes();
+    }
+
+    /*!
+     * Same signature as BBTreeStandAlone, so that the trees can be built by BuildBBTreeWithAdjustmentGen. \a bbs is
+     * released by the caller at the end of the build.
+     */
+    BBTreeFlat(std::unique_ptr<double[]> &&bbs, ConnType nbelems) : BBTreeFlat(bbs.get(), nullptr, 0, nbelems) {}
+
+    /*! returns in \a elems the list of elements potentially intersecting the bounding box pointed to by \a bb
+
+      \param bb pointer to query bounding box
+      \param elems list of elements (given in 0-indexing that is to say in \b C \b mode) intersecting the bounding box
+    */
+    void getIntersectingElems(const double *bb, std::vector<ConnType> &elems) const
+    {
+        traverse(
+            [bb](const double *mins, const double *maxs, std::size_t stride, int nb, bool *hits, double eps)
+            { IntersectBox(bb, mins, maxs, stride, nb, hits, eps); },
+            [&elems, this](ConnType pos) { elems.push_back(_elems[pos]); },
+            -std::abs(_epsilon)
+        );
+    }
+
+    /*!
+     * This method is very close to getIntersectingElems except that it returns number of elems instead of elems
+     * themselves.
+     */
+    ConnType getNbOfIntersectingElems(const double *bb) const
+    {
+        ConnType ret(0);
+        traverse(
+            [bb](const double *mins, const double *maxs, std::size_t stride, int nb, bool *hits, double eps)
+            { IntersectBox(bb, mins, maxs, stride, nb, hits, eps); },
+            [&ret](ConnType) { ret++; },
+            -std::abs(_epsilon)
+        );
+        return ret;
+    }
+
+    /*! returns in \a elems the list of elements potentially containing the point pointed to by \a xx
+      \param xx pointer to query point coords
+      \param elems list of elements (given in 0-indexing) intersecting the bounding box
+    */
+    void getElementsAroundPoint(const double *xx, std::vector<ConnType> &elems) const
+    {
+        traverse(
+            [xx](const double *mins, const double *maxs, std::size_t stride, int nb, bool *hits, double eps)
+            { ContainPoint(xx, mins, maxs, stride, nb, hits, eps); },
+            [&elems, this](ConnType pos) { elems.push_back(_elems[pos]); },
+            std::abs(_epsilon)
+        );
+    }
+
+    ConnType size() const { return _nb_elems; }
+
+   private:
+    /*!
+     * Sets in \a hits[i] for i in [0, \a nb ) if box #i intersects the box \a bb. The min of box #i along dimension
+     * idim is \a mins[idim * \a stride + i]. Same criterion as BBTree.
+     */
+    static void IntersectBox(
+        const double *bb, const double *mins, const double *maxs, std::size_t stride, int nb, bool *hits, double eps
+    )
+    {
+        for (int i = 0; i < nb; i++) hits[i] = true;
+        for (int idim = 0; idim < dim; idim++)
+        {
+            const double bbMin(bb[2 * idim]), bbMax(bb[2 * idim + 1]);
+            const double *mi(mins + idim * stride), *ma(maxs + idim * stride);
+            for (int i = 0; i < nb; i++) hits[i] = hits[i] & !(mi[i] - bbMax > -eps) & !(ma[i] - bbMin < eps);
+        }
+    }
+
+    //! Same as IntersectBox but for point \a xx. Same criterion as BBTree::getElementsAroundPoint.
+    static void ContainPoint(
+        const double *xx, const double *mins, const double *maxs, std::size_t stride, int nb, bool *hits, double eps
+    )
+    {
+        for (int i = 0; i < nb; i++) hits[i] = true;
+        for (int idim = 0; idim < dim; idim++)
+        {
+            const double x(xx[idim]);
+            const double *mi(mins + idim * stride), *ma(maxs + idim * stride);
+            for (int i = 0; i < nb; i++) hits[i] = hits[i] & !(mi[i] - x > eps) & !(ma[i] - x < -eps);
+        }
+    }
+
+    /*!
+     * Depth first traversal of the tree. \a boxTest is applied on the elements of the leaves with the tolerance of
+     * the tree, and on the children of the nodes with the tolerance \a nodeEps, that must be chosen so that the test
+     * on a node never rejects an element that would pass its own test. \a onHit is called with the position in
+     * _elems of each element passing the test.
+     */
+    template <class BOXTEST, class ONHIT>
+    void traverse(BOXTEST boxTest, ONHIT onHit, double nodeEps) const
+    {
+        bool nodeHits[WIDTH], leafHits[LEAF_SIZE];
+        if (_nodes.empty())
+        {
+            traverseLeaf(0, _nb_elems, boxTest, onHit, leafHits);
+            return;
+        }
+        // the depth of the tree is lower than 32 for any realistic number of elements
+        ConnType stack[32 * (WIDTH - 1) + 1];
+        int stackSize(0);
+        stack[stackSize++] = 0;
+        while (stackSize > 0)
+        {
+            const Node &node(_nodes[stack[--stackSize]]);
+            boxTest(&node._min[0][0], &node._max[0][0], WIDTH, WIDTH, nodeHits, nodeEps);
+            for (int k = 0; k < WIDTH; k++)
+            {
+                if (!nodeHits[k])
+                    continue;
+                if (node._child[k] >= 0)
+                    stack[stackSize++] = node._child[k];
+                else
+                    traverseLeaf(node._bg[k], node._end[k], boxTest, onHit, leafHits);
+            }
+        }
+    }
+
+    template <class BOXTEST, class ONHIT>
+    void traverseLeaf(ConnType bg, ConnType end, BOXTEST boxTest, ONHIT onHit, bool *hits) const
+    {
+        for (ConnType pos = bg; pos < end; pos += LEAF_SIZE)
+        {
+            int nb((int)std::min(ConnType(LEAF_SIZE), ConnType(end - pos)));
+            boxTest(_min.data() + pos, _max.data() + pos, (std::size_t)_nb_elems, nb, hits, _epsilon);
+            for (int i = 0; i < nb; i++)
+                if (hits[i])
+                    onHit(pos + i);
+        }
+    }
+
+    /*!
+     * Fills _elems with the ids of elements sorted along a Morton curve of the centers of their bounding boxes.
+     */
+    void sortElemsAlongMortonCurve(const double *bbs, const ConnType *elems)
+    {
+        std::vector<double> centers(dim * _nb_elems);
+        _elems.resize(_nb_elems);
+        for (ConnType i = 0; i < _nb_elems; i++)
+        {
+            _elems[i] = elems ? elems[i] : i;
+            const double *bb(bbs + _elems[i] * 2 * dim);
+            for (int idim = 0; idim < dim; idim++) centers[dim * i + idim] = (bb[2 * idim] + bb[2 * idim + 1]) / 2.;
+        }
+        std::vector<std::uint64_t> codes;
+        INTERP_KERNEL::ComputeMortonCodes<dim>(centers.data(), _nb_elems, codes);
+        INTERP_KERNEL::StableRadixSort(codes, _elems, dim * INTERP_KERNEL::MortonNbOfBitsPerDim<dim>());
+    }
+
+    /*!
+     * Builds the nodes by splitting the sorted elements into WIDTH equal parts, until parts have at most LEAF_SIZE
+     * elements. Nodes are created in depth first order, a node always having a lower id than its children. This is
+     * used to compute the boxes of the children bottom-up by a single reverse loop over the nodes.
+     */
+    void buildNodes()
+    {
+        if (_nb_elems <= LEAF_SIZE)
+            return;
+        _nodes.reserve(2 * (std::size_t)(_nb_elems / LEAF_SIZE) + 1);
+        std::vector<std::pair<ConnType, ConnType> > toBeSplit(1, std::pair<ConnType, ConnType>(0, _nb_elems));
+        std::vector<ConnType> nodeIds(1, 0);
+        _nodes.resize(1);
+        while (!toBeSplit.empty())
+        {
+            std::pair<ConnType, ConnType> range(toBeSplit.back());
+            ConnType nodeId(nodeIds.back());
+            toBeSplit.pop_back();
+            nodeIds.pop_back();
+            ConnType nb(range.second - range.first);
+            for (int k = 0; k < WIDTH; k++)
+            {
+                ConnType bg(range.first + (ConnType)(((std::int64_t)nb * k) / WIDTH));
+                ConnType end(range.first + (ConnType)(((std::int64_t)nb * (k + 1)) / WIDTH));
+                _nodes[nodeId]._bg[k] = bg;
+                _nodes[nodeId]._end[k] = end;
+                if (end - bg <= LEAF_SIZE)
+                    _nodes[nodeId]._child[k] = -1;
+                else
+                {
+                    _nodes[nodeId]._child[k] = (ConnType)_nodes.size();
+                    _nodes.push_back(Node());
+                    toBeSplit.push_back(std::pair<ConnType, ConnType>(bg, end));
+                    nodeIds.push_back(_nodes[nodeId]._child[k]);
+                }
+            }
+        }
+        for (std::size_t nodeId = _nodes.size(); nodeId-- > 0;)
+        {
+            Node &node(_nodes[nodeId]);
+            for (int k = 0; k < WIDTH; k++)
+                for (int idim = 0; idim < dim; idim++)
+                {
+                    double mi(std::numeric_limits<double>::max()), ma(-std::numeric_limits<double>::max());
+                    if (node._child[k] >= 0)
+                    {
+                        const Node &child(_nodes[node._child[k]]);
+                        for (int k2 = 0; k2 < WIDTH; k2++)
+                        {
+                            mi = std::min(mi, child._min[idim][k2]);
+                            ma = std::max(ma, child._max[idim][k2]);
+                        }
+                    }
+                    else
+                    {
+                        const double *mins(_min.data() + idim * _nb_elems), *maxs(_max.data() + idim * _nb_elems);
+                        for (ConnType i = node._bg[k]; i < node._end[k]; i++)
+                        {
+                            mi = std::min(mi, mins[i]);
+                            ma = std::max(ma, maxs[i]);
+                        }
+                    }
+                    node._min[idim][k] = mi;
+                    node._max[idim][k] = ma;
+                }
+        }
+    }
+
+   private:
+    ConnType _nb_elems;
+    double _epsilon;
+    //! ids of the elements, in Morton order
+    std::vector<ConnType> _elems;
+    //! min of the bounding boxes of _elems, structure-of-arrays : _min[idim * _nb_elems + i]
+    std::vector<double> _min;
+    //! max of the bounding boxes of _elems, same layout as _min
+    std::vector<double> _max;
+    //! nodes of the tree, node #0 being the root. Empty if there are less than LEAF_SIZE elements.
+    std::vector<Node> _nodes;
+};
@@ -0,0 +1,180 @@
+// Copyright (C) 2026  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#ifndef __INTERPKERNELSPACEFILLINGCURVE_HXX__
+#define __INTERPKERNELSPACEFILLINGCURVE_HXX__
+
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+
+namespace INTERP_KERNEL
+{
+/*!
+ * Number of bits used per dimension to quantize the coordinates before computing a Morton code of dimension \a dim,
+ * so that the code fits in 63 bits.
+ */
+template <int dim>
+constexpr int
+MortonNbOfBitsPerDim()
+{
+    return 63 / dim < 31 ? 63 / dim : 31;
+}
+
+/*!
+ * Interleaves the \a nbOfBits lowest bits of the \a nbOfDims integers \a x, most significant bits first, the first
+ * axis being the most significant one at each level. \a nbOfBits * \a nbOfDims is expected to be lower than 65. This
+ * is the Morton (Z-order) code of the grid cell of integer coordinates \a x.
+ */
+template <class IntType>
+std::uint64_t
+InterleaveBits(const IntType *x, int nbOfBits, int nbOfDims)
+{
+    std::uint64_t ret(0);
+    for (int b = nbOfBits - 1; b >= 0; b--)
+        for (int i = 0; i < nbOfDims; i++) ret = (ret << 1) | (((std::uint64_t)x[i] >> b) & 1);
+    return ret;
+}
+
+/*!
+ * Converts the \a nbOfDims coordinates \a x, of \a nbOfBits bits each, into the transposed Hilbert index (J. Skilling,
+ * "Programming the Hilbert curve", AIP Conf. Proc. 707, 2004) : once interleaved, its bits are the Hilbert index.
+ */
+inline void
+AxesToTransposedHilbertIndex(std::uint32_t *x, int nbOfBits, int nbOfDims)
+{
+    std::uint32_t m(std::uint32_t(1) << (nbOfBits - 1));
+    for (std::uint32_t q = m; q > 1; q >>= 1)
+    {
+        std::uint32_t p(q - 1);
+        for (int i = 0; i < nbOfDims; i++)
+            if (x[i] & q)
+                x[0] ^= p;
+            else
+            {
+                std::uint32_t t((x[0] ^ x[i]) & p);
+                x[0] ^= t;
+                x[i] ^= t;
+            }
+    }
+    for (int i = 1; i < nbOfDims; i++) x[i] ^= x[i - 1];
+    std::uint32_t t(0);
+    for (std::uint32_t q = m; q > 1; q >>= 1)
+        if (x[nbOfDims - 1] & q)
+            t ^= q - 1;
+    for (int i = 0; i < nbOfDims; i++) x[i] ^= t;
+}
+
+/*!
+ * Returns the Hilbert index of the grid cell of integer coordinates \a x, of \a nbOfBits bits each. \a x is
+ * modified.
+ */
+inline std::uint64_t
+HilbertIndex(std::uint32_t *x, int nbOfBits, int nbOfDims)
+{
+    AxesToTransposedHilbertIndex(x, nbOfBits, nbOfDims);
+    return InterleaveBits(x, nbOfBits, nbOfDims);
+}
+
+/*!
+ * Computes in \a codes the Morton (Z-order) codes of the \a nbOfPts points of dimension \a dim whose coordinates are
+ * given in full interlace mode in \a pts. The coordinates are quantized in the bounding box of the points, so that the
+ * codes only depend on the relative positions of the points. NaN or infinite coordinates are clamped.
+ */
+template <int dim, class ConnType>
+void
+ComputeMortonCodes(const double *pts, ConnType nbOfPts, std::vector<std::uint64_t> &codes)
+{
+    const int NB_OF_BITS_PER_DIM(MortonNbOfBitsPerDim<dim>());
+    const double maxQuantum((double)((std::uint64_t(1) << NB_OF_BITS_PER_DIM) - 1));
+    double lo[dim], scale[dim];
+    for (int idim = 0; idim < dim; idim++)
+    {
+        double mi(std::numeric_limits<double>::max()), ma(-std::numeric_limits<double>::max());
+        for (ConnType i = 0; i < nbOfPts; i++)
+        {
+            mi = std::min(mi, pts[dim * i + idim]);
+            ma = std::max(ma, pts[dim * i + idim]);
+        }
+        lo[idim] = mi;
+        scale[idim] = ma > mi ? maxQuantum / (ma - mi) : 0.;
+    }
+    codes.resize(nbOfPts);
+    for (ConnType i = 0; i < nbOfPts; i++)
+    {
+        std::uint32_t x[dim];
+        for (int idim = 0; idim < dim; idim++)
+        {
+            double q((pts[dim * i + idim] - lo[idim]) * scale[idim]);
+            x[idim] = q > 0. ? (q < maxQuantum ? (std::uint32_t)q : (std::uint32_t)maxQuantum) : 0;
+        }
+        codes[i] = InterleaveBits(x, NB_OF_BITS_PER_DIM, dim);
+    }
+}
+
+/*!
+ * Stable LSD radix sort of \a values using \a keys, of which only the \a nbOfBits lowest bits are significant.
+ * Both vectors are permuted. Passes are on 8 bits digits, and are skipped when all the keys share the same digit.
+ */
+template <class ConnType>
+void
+StableRadixSort(std::vector<std::uint64_t> &keys, std::vector<ConnType> &values, int nbOfBits)
+{
+    std::size_t nb(keys.size());
+    if (nb < 2)
+        return;
+    std::vector<std::uint64_t> keysTmp(nb);
+    std::vector<ConnType> valuesTmp(nb);
+    for (int shift = 0; shift < nbOfBits; shift += 8)
+    {
+        std::size_t count[257] = {0};
+        for (std::size_t i = 0; i < nb; i++) count[((keys[i] >> shift) & 0xFF) + 1]++;
+        if (count[((keys[0] >> shift) & 0xFF) + 1] == nb)
+            continue;
+        for (int d = 0; d < 256; d++) count[d + 1] += count[d];
+        for (std::size_t i = 0; i < nb; i++)
+        {
+            std::size_t dst(count[(keys[i] >> shift) & 0xFF]++);
+            keysTmp[dst] = keys[i];
+            valuesTmp[dst] = values[i];
+        }
+        keys.swap(keysTmp);
+        values.swap(valuesTmp);
+    }
+}
+
+/*!
+ * Returns in \a order the ids of the \a nbOfPts points \a pts (full interlace, dimension \a dim) sorted along a
+ * Morton curve : \a order [ k ] is the id of the k-th point along the curve. Points having the same code are kept in
+ * their initial relative order, so that the result is deterministic.
+ */
+template <int dim, class ConnType>
+void
+SortAlongMortonCurve(const double *pts, ConnType nbOfPts, std::vector<ConnType> &order)
+{
+    std::vector<std::uint64_t> codes;
+    ComputeMortonCodes<dim>(pts, nbOfPts, codes);
+    order.resize(nbOfPts);
+    for (ConnType i = 0; i < nbOfPts; i++) order[i] = i;
+    StableRadixSort(codes, order, dim * MortonNbOfBitsPerDim<dim>());
+}
+}  // namespace INTERP_KERNEL
+
+#endif
@@ -0,0 +1,224 @@
+// Copyright (C) 2026  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#ifndef __INTERPKERNELTHREADPOOL_HXX__
+#define __INTERPKERNELTHREADPOOL_HXX__
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace INTERP_KERNEL
+{
+/*!
+ * Returns the number of threads really used for a requested number of threads \a nbOfThreads.
+ * A value lower or equal to 0 means "as many threads as hardware threads available".
+ */
+inline unsigned int
+GetEffectiveNbOfThreads(int nbOfThreads)
+{
+    if (nbOfThreads > 0)
+        return (unsigned int)nbOfThreads;
+    unsigned int ret(std::thread::hardware_concurrency());
+    return ret > 0 ? ret : 1;
+}
+
+/*!
+ * Chunk scheduler with work stealing used by ParallelForChunks.
+ * Each worker owns a contiguous range of chunk ids that it consumes from the front. When its range is exhausted
+ * a worker steals the back half of the largest remaining range of the other workers. Ranges are protected by
+ * one mutex per worker, which is enough since a chunk is expected to represent a significant amount of work.
+ */
+class WorkStealingRanges
+{
+   public:
+    WorkStealingRanges(std::size_t nbOfChunks, unsigned int nbOfWorkers) : _ranges(nbOfWorkers), _mutexes(nbOfWorkers)
+    {
+        for (unsigned int i = 0; i < nbOfWorkers; i++)
+        {
+            _ranges[i].first = (nbOfChunks * i) / nbOfWorkers;
+            _ranges[i].second = (nbOfChunks * (i + 1)) / nbOfWorkers;
+        }
+    }
+    //! Returns false if there is no more chunk to process. Otherwise \a chunkId is set to the next chunk for \a worker.
+    bool next(unsigned int worker, std::size_t &chunkId)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutexes[worker]);
+            if (_ranges[worker].first < _ranges[worker].second)
+            {
+                chunkId = _ranges[worker].first++;
+                return true;
+            }
+        }
+        return steal(worker, chunkId);
+    }
+
+   private:
+    bool steal(unsigned int worker, std::size_t &chunkId)
+    {
+        for (;;)
+        {
+            unsigned int victim(worker);
+            std::size_t victimSize(0);
+            for (unsigned int i = 0; i < (unsigned int)_ranges.size(); i++)
+            {
+                if (i == worker)
+                    continue;
+                std::lock_guard<std::mutex> lock(_mutexes[i]);
+                std::size_t sz(_ranges[i].second - _ranges[i].first);
+                if (sz > victimSize)
+                {
+                    victim = i;
+                    victimSize = sz;
+                }
+            }
+            if (victimSize == 0)
+                return false;
+            std::size_t stolenBg, stolenEnd;
+            {
+                std::lock_guard<std::mutex> lock(_mutexes[victim]);
+                std::pair<std::size_t, std::size_t> &r(_ranges[victim]);
+                if (r.first >= r.second)
+                    continue;  // victim finished meanwhile, look for another one
+                stolenEnd = r.second;
+                stolenBg = r.second - (r.second - r.first + 1) / 2;
+                r.second = stolenBg;
+            }
+            std::lock_guard<std::mutex> lock(_mutexes[worker]);
+            chunkId = stolenBg;
+            _ranges[worker].first = stolenBg + 1;
+            _ranges[worker].second = stolenEnd;
+            return true;
+        }
+    }
+
+   private:
+    std::vector<std::pair<std::size_t, std::size_t> > _ranges;
+    std::vector<std::mutex> _mutexes;
+};
+
+/*!
+ * Applies \a func on the range [ \a bg, \a end ) split into chunks of \a grain consecutive ids, using \a nbOfThreads
+ * threads. \a func is called as func(chunkBg, chunkEnd, threadId) with threadId in [0, \a nbOfThreads ), so that the
+ * caller can keep one working object per thread. The chunks are dynamically balanced between threads by work
+ * stealing. The calling thread is used as thread #0.
+ * If \a nbOfThreads is lower than 2, or if there is a single chunk, \a func is called once on the whole range in the
+ * calling thread.
+ * The first exception thrown by \a func (if any) is rethrown in the calling thread after all threads have stopped.
+ */
+template <class T, class FUNC>
+void
+ParallelForChunks(unsigned int nbOfThreads, T bg, T end, T grain, FUNC func)
+{
+    if (end <= bg)
+        return;
+    grain = std::max(grain, T(1));
+    std::size_t nbOfChunks((std::size_t)((end - bg + grain - 1) / grain));
+    if (nbOfThreads < 2 || nbOfChunks < 2)
+    {
+        func(bg, end, 0u);
+        return;
+    }
+    nbOfThreads = (unsigned int)std::min((std::size_t)nbOfThreads, nbOfChunks);
+    WorkStealingRanges ranges(nbOfChunks, nbOfThreads);
+    std::exception_ptr firstError;
+    std::mutex errorMutex;
+    bool stop(false);
+    auto worker = [&](unsigned int threadId)
+    {
+        std::size_t chunkId;
+        while (ranges.next(threadId, chunkId))
+        {
+            {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (stop)
+                    return;
+            }
+            T chunkBg(bg + (T)chunkId * grain);
+            T chunkEnd(std::min(end, (T)(chunkBg + grain)));
+            try
+            {
+                func(chunkBg, chunkEnd, threadId);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!firstError)
+                    firstError = std::current_exception();
+                stop = true;
+                return;
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(nbOfThreads - 1);
+    for (unsigned int i = 1; i < nbOfThreads; i++) threads.push_back(std::thread(worker, i));
+    worker(0);
+    for (std::vector<std::thread>::iterator it = threads.begin(); it != threads.end(); it++) (*it).join();
+    if (firstError)
+        std::rethrow_exception(firstError);
+}
+
+/*!
+ * Same as ParallelForChunks but with a static and deterministic partition : the range [ \a bg, \a end ) is split into
+ * exactly \a nbOfParts contiguous parts (some of them possibly empty) and \a func(partBg, partEnd, partId) is called
+ * once per part. This is the scheduling to use when the result depends on the partition, for example reductions
+ * whose partial results are merged in part order.
+ */
+template <class T, class FUNC>
+void
+ParallelForParts(unsigned int nbOfParts, T bg, T end, FUNC func)
+{
+    nbOfParts = std::max(nbOfParts, 1u);
+    T nb(end > bg ? end - bg : T(0));
+    auto partBg = [&](unsigned int i) { return (T)(bg + (T)(((unsigned long long)nb * i) / nbOfParts)); };
+    if (nbOfParts == 1)
+    {
+        func(bg, (T)(bg + nb), 0u);
+        return;
+    }
+    std::exception_ptr firstError;
+    std::mutex errorMutex;
+    auto worker = [&](unsigned int partId)
+    {
+        try
+        {
+            func(partBg(partId), partBg(partId + 1), partId);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!firstError)
+                firstError = std::current_exception();
+        }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(nbOfParts - 1);
+    for (unsigned int i = 1; i < nbOfParts; i++) threads.push_back(std::thread(worker, i));
+    worker(0);
+    for (std::vector<std::thread>::iterator it = threads.begin(); it != threads.end(); it++) (*it).join();
+    if (firstError)
+        std::rethrow_exception(firstError);
+}
+}  // namespace INTERP_KERNEL
+
+#endif
@@ -214,9 +214,13 @@ CellModel::GetCellModel(NormalizedCellType type)
 const std::map<NormalizedCellType, CellModel> &
 CellModel::GetMapOfUniqueInstance()
 {
-    static std::map<NormalizedCellType, CellModel> map_of_unique_instance;
-    if (map_of_unique_instance.empty())
-        BuildUniqueInstance(map_of_unique_instance);
+    // initialized once in a thread-safe way, interpolators may request cell models from several threads
+    static const std::map<NormalizedCellType, CellModel> map_of_unique_instance = []()
+    {
+        std::map<NormalizedCellType, CellModel> ret;
+        BuildUniqueInstance(ret);
+        return ret;
+    }();
     return map_of_unique_instance;
 }
 
@@ -22,6 +22,7 @@
 #include "InterpKernelValue.hxx"
 #include "InterpKernelAsmX86.hxx"
 #include "InterpKernelAutoPtr.hxx"
+#include "InterpKernelThreadPool.hxx"
 
 #include <cctype>
 #include <sstream>
@@ -30,6 +31,7 @@
 #include <iterator>
 #include <iostream>
 #include <algorithm>
+#include <mutex>
 
 using namespace INTERP_KERNEL;
 
@@ -224,6 +226,223 @@ ExprParserOfEval::sortMemory()
             *it = (*it)->deepCopy();
 }
 
+ExprParserOfBlockEval::ExprParserOfBlockEval(const ExprParser &expr) : _nb_of_regs(0), _res_reg(-1)
+{
+    expr.checkForEvaluation();
+    std::vector<int> stck, tempRegs;
+    compile(expr, stck, tempRegs);
+    if (stck.size() != 1)
+        throw INTERP_KERNEL::Exception("ExprParserOfBlockEval : the expression does not lead to a single value !");
+    _res_reg = stck.back();
+}
+
+/*!
+ * Emulates on register ids the stack of ExprParserOfEval::evaluateDoubleInternal. The result of a function is stored
+ * in a temporary register dedicated to its position in the stack, so that the number of registers is bounded by the
+ * number of leaves plus the depth of the stack.
+ */
+void
+ExprParserOfBlockEval::compile(const ExprParser &expr, std::vector<int> &stck, std::vector<int> &tempRegs)
+{
+    if (expr._leaf)
+        stck.push_back(getRegisterOf(expr._leaf));
+    else
+        for (std::vector<ExprParser>::const_iterator iter = expr._sub_expr.begin(); iter != expr._sub_expr.end();
+             iter++)
+            compile(*iter, stck, tempRegs);
+    for (std::vector<Function *>::const_iterator iter = expr._func_btw_sub_expr.begin();
+         iter != expr._func_btw_sub_expr.end();
+         iter++)
+    {
+        int nbOfParams((*iter)->getNbInputParams());
+        if (nbOfParams < 1 || nbOfParams > 3 || (int)stck.size() < nbOfParams)
+            throw INTERP_KERNEL::Exception("ExprParserOfBlockEval::compile : unexpected number of parameters !");
+        Instruction inst;
+        inst._func = *iter;
+        for (int i = 0; i < 3; i++)
+        {
+            inst._args[i] = i < nbOfParams ? stck.back() : inst._args[0];
+            if (i < nbOfParams)
+                stck.pop_back();
+        }
+        std::size_t pos(stck.size());
+        if (tempRegs.size() <= pos)
+            tempRegs.resize(pos + 1, -1);
+        if (tempRegs[pos] < 0)
+            tempRegs[pos] = _nb_of_regs++;
+        inst._res = tempRegs[pos];
+        stck.push_back(inst._res);
+        _instructions.push_back(inst);
+    }
+}
+
+int
+ExprParserOfBlockEval::getRegisterOf(const LeafExpr *leaf)
+{
+    const LeafExprVar *leafC(dynamic_cast<const LeafExprVar *>(leaf));
+    if (leafC && leafC->getFastPos() >= 0)
+    {
+        for (std::vector<std::pair<int, int> >::const_iterator it = _var_regs.begin(); it != _var_regs.end(); it++)
+            if ((*it).second == leafC->getFastPos())
+                return (*it).first;
+        _var_regs.push_back(std::pair<int, int>(_nb_of_regs, leafC->getFastPos()));
+    }
+    else
+        _const_regs.push_back(std::pair<int, double>(_nb_of_regs, leaf->getDoubleValue()));
+    return _nb_of_regs++;
+}
+
+void
+ExprParserOfBlockEval::initRegisters(std::vector<double> &regs) const
+{
+    regs.resize(_nb_of_regs * BLOCK_SIZE);
+    for (std::vector<std::pair<int, double> >::const_iterator it = _const_regs.begin(); it != _const_regs.end(); it++)
+        std::fill(regs.begin() + (*it).first * BLOCK_SIZE, regs.begin() + ((*it).first + 1) * BLOCK_SIZE, (*it).second);
+}
+
+void
+ExprParserOfBlockEval::evaluateBlock(
+    std::size_t nbOfTuples,
+    const double *input,
+    std::size_t inputStride,
+    double *output,
+    std::size_t outputStride,
+    bool isSafe,
+    std::vector<double> &regs
+) const
+{
+    double *regsPtr(regs.data());
+    for (std::vector<std::pair<int, int> >::const_iterator it = _var_regs.begin(); it != _var_regs.end(); it++)
+    {
+        double *reg(regsPtr + (*it).first * BLOCK_SIZE);
+        const double *in(input + (*it).second);
+        for (std::size_t i = 0; i < nbOfTuples; i++) reg[i] = in[i * inputStride];
+    }
+    for (std::vector<Instruction>::const_iterator it = _instructions.begin(); it != _instructions.end(); it++)
+    {
+        const double *args[3] = {
+            regsPtr + (*it)._args[0] * BLOCK_SIZE, regsPtr + (*it)._args[1] * BLOCK_SIZE,
+            regsPtr + (*it)._args[2] * BLOCK_SIZE
+        };
+        double *res(regsPtr + (*it)._res * BLOCK_SIZE);
+        if (isSafe)
+            (*it)._func->operateBlockOfDoubleSafe(nbOfTuples, args, res);
+        else
+            (*it)._func->operateBlockOfDouble(nbOfTuples, args, res);
+    }
+    const double *res(regsPtr + _res_reg * BLOCK_SIZE);
+    for (std::size_t i = 0; i < nbOfTuples; i++) output[i * outputStride] = res[i];
+}
+
+/*!
+ * Evaluates the expression on the \a nbOfTuples tuples of \a input, the i-th tuple starting at
+ * \a input + i * \a inputStride. The result for the i-th tuple is put in \a output [ i * \a outputStride ].
+ * \a output can be equal to \a input.
+ * \param [in] nbOfThreads - number of threads to use. A value lower or equal to 0 means all hardware threads.
+ */
+void
+ExprParserOfBlockEval::evaluate(
+    std::size_t nbOfTuples,
+    const double *input,
+    std::size_t inputStride,
+    double *output,
+    std::size_t outputStride,
+    int nbOfThreads
+) const
+{
+    ParallelForChunks(
+        GetEffectiveNbOfThreads(nbOfThreads),
+        std::size_t(0),
+        nbOfTuples,
+        16 * BLOCK_SIZE,
+        [&](std::size_t bg, std::size_t end, unsigned int)
+        {
+            std::vector<double> regs;
+            initRegisters(regs);
+            for (std::size_t i = bg; i < end; i += BLOCK_SIZE)
+                evaluateBlock(
+                    std::min(BLOCK_SIZE, end - i),
+                    input + i * inputStride,
+                    inputStride,
+                    output + i * outputStride,
+                    outputStride,
+                    false,
+                    regs
+                );
+        }
+    );
+}
+
+/*!
+ * Same as evaluate but with the domain checks of Function::operateStackOfDoubleSafe.
+ * \return the id of the first tuple whose evaluation failed, or \a nbOfTuples if none. In the former case \a errMsg
+ *         contains the error message of this first failure, exactly as if the tuples were evaluated one by one.
+ */
+std::size_t
+ExprParserOfBlockEval::evaluateSafe(
+    std::size_t nbOfTuples,
+    const double *input,
+    std::size_t inputStride,
+    double *output,
+    std::size_t outputStride,
+    int nbOfThreads,
+    std::string &errMsg
+) const
+{
+    std::size_t firstFailure(nbOfTuples);
+    std::mutex failureMutex;
+    ParallelForChunks(
+        GetEffectiveNbOfThreads(nbOfThreads),
+        std::size_t(0),
+        nbOfTuples,
+        16 * BLOCK_SIZE,
+        [&](std::size_t bg, std::size_t end, unsigned int)
+        {
+            std::vector<double> regs;
+            initRegisters(regs);
+            for (std::size_t i = bg; i < end; i += BLOCK_SIZE)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(failureMutex);
+                    if (firstFailure < i)
+                        return;
+                }
+                std::size_t nb(std::min(BLOCK_SIZE, end - i));
+                try
+                {
+                    evaluateBlock(
+                        nb, input + i * inputStride, inputStride, output + i * outputStride, outputStride, true, regs
+                    );
+                }
+                catch (INTERP_KERNEL::Exception &)
+                {
+                    // replay the block tuple by tuple to find the first failing one
+                    for (std::size_t j = i; j < i + nb; j++)
+                    {
+                        try
+                        {
+                            evaluateBlock(
+                                1, input + j * inputStride, inputStride, output + j * outputStride, 1, true, regs
+                            );
+                        }
+                        catch (INTERP_KERNEL::Exception &e)
+                        {
+                            std::lock_guard<std::mutex> lock(failureMutex);
+                            if (j < firstFailure)
+                            {
+                                firstFailure = j;
+                                errMsg = e.what();
+                            }
+                            return;
+                        }
+                    }
+                }
+            }
+        }
+    );
+    return firstFailure;
+}
+
 ExprParser::ExprParser(const std::string &expr, ExprParser *father)
     : _father(father), _is_parsed(false), _leaf(0), _is_parsing_ok(false), _expr(expr)
 {
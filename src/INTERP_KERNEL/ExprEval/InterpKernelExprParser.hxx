@@ -78,6 +78,7 @@ class LeafExprVar : public LeafExpr
     INTERPKERNEL_EXPORT void compileX86_64(std::vector<std::string> &ass) const;
     INTERPKERNEL_EXPORT void fillValue(Value *val) const;
     std::string getVar() const { return _var_name; }
+    int getFastPos() const { return _fast_pos; }
     INTERPKERNEL_EXPORT void prepareExprEvaluation(
         const std::vector<std::string> &vars, int nbOfCompo, int targetNbOfCompo
     ) const;
@@ -145,8 +146,75 @@ class ExprParserOfEval
     std::vector<Function *> _funcs;
 };
 
+class ExprParser;
+
+/*!
+ * Compiled form of a parsed ExprParser, dedicated to the evaluation of the expression on a large number of tuples.
+ * The expression tree is flattened once into a sequence of instructions working on registers of BLOCK_SIZE doubles.
+ * Tuples are then processed by blocks, each instruction being a single call to Function::operateBlockOfDouble on
+ * the whole block. Blocks are distributed over threads.
+ * The ExprParser must have been prepared with ExprParser::prepareExprEvaluationDouble before the construction of
+ * \a this, and must outlive \a this, since the Function instances are shared.
+ */
+class ExprParserOfBlockEval
+{
+   public:
+    INTERPKERNEL_EXPORT ExprParserOfBlockEval(const ExprParser &expr);
+    INTERPKERNEL_EXPORT void evaluate(
+        std::size_t nbOfTuples,
+        const double *input,
+        std::size_t inputStride,
+        double *output,
+        std::size_t outputStride,
+        int nbOfThreads
+    ) const;
+    INTERPKERNEL_EXPORT std::size_t evaluateSafe(
+        std::size_t nbOfTuples,
+        const double *input,
+        std::size_t inputStride,
+        double *output,
+        std::size_t outputStride,
+        int nbOfThreads,
+        std::string &errMsg
+    ) const;
+
+   public:
+    static const std::size_t BLOCK_SIZE = 256;
+
+   private:
+    struct Instruction
+    {
+        const Function *_func;
+        int _args[3];
+        int _res;
+    };
+    void compile(const ExprParser &expr, std::vector<int> &stck, std::vector<int> &tempRegs);
+    int getRegisterOf(const LeafExpr *leaf);
+    void initRegisters(std::vector<double> &regs) const;
+    void evaluateBlock(
+        std::size_t nbOfTuples,
+        const double *input,
+        std::size_t inputStride,
+        double *output,
+        std::size_t outputStride,
+        bool isSafe,
+        std::vector<double> &regs
+    ) const;
+
+   private:
+    //! pairs (register id, id of the input component loaded in it)
+    std::vector<std::pair<int, int> > _var_regs;
+    //! pairs (register id, constant value)
+    std::vector<std::pair<int, double> > _const_regs;
+    std::vector<Instruction> _instructions;
+    int _nb_of_regs;
+    int _res_reg;
+};
+
 class ExprParser
 {
+    friend class ExprParserOfBlockEval;
+
    public:
     INTERPKERNEL_EXPORT ExprParser(ExprParser &&other);
     INTERPKERNEL_EXPORT ExprParser &operator=(ExprParser &&other);
@@ -27,6 +27,23 @@
 
 using namespace INTERP_KERNEL;
 
+namespace
+{
+template <class OP>
+void
+ApplyOnBlock(std::size_t nbOfVals, const double *a, double *res, OP op)
+{
+    for (std::size_t i = 0; i < nbOfVals; i++) res[i] = op(a[i]);
+}
+
+template <class OP>
+void
+ApplyOnBlock(std::size_t nbOfVals, const double *a, const double *b, double *res, OP op)
+{
+    for (std::size_t i = 0; i < nbOfVals; i++) res[i] = op(a[i], b[i]);
+}
+}  // namespace
+
 const char IdentityFunction::REPR[] = "Id";
 
 const char PositiveFunction::REPR[] = "+";
@@ -197,6 +214,24 @@ FunctionsFactory::buildBinaryFuncFromString(char type)
 
 Function::~Function() {}
 
+/*!
+ * Generic implementation relying on operateStackOfDouble, value by value. Subclasses override it with a loop on the
+ * whole block. \a res may be equal to one of the \a args.
+ */
+void
+Function::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    int nbOfParams(getNbInputParams());
+    std::vector<double> stck;
+    for (std::size_t i = 0; i < nbOfVals; i++)
+    {
+        stck.resize(nbOfParams);
+        for (int j = 0; j < nbOfParams; j++) stck[nbOfParams - 1 - j] = args[j][i];
+        operateStackOfDouble(stck);
+        res[i] = stck.back();
+    }
+}
+
 IdentityFunction::~IdentityFunction() {}
 
 void
@@ -220,6 +255,13 @@ IdentityFunction::getRepr() const
     return REPR;
 }
 
+void
+IdentityFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    if (res != args[0])
+        std::copy(args[0], args[0] + nbOfVals, res);
+}
+
 bool
 IdentityFunction::isACall() const
 {
@@ -255,6 +297,13 @@ PositiveFunction::getRepr() const
     return REPR;
 }
 
+void
+PositiveFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    if (res != args[0])
+        std::copy(args[0], args[0] + nbOfVals, res);
+}
+
 bool
 PositiveFunction::isACall() const
 {
@@ -283,6 +332,12 @@ NegateFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = -v;
 }
 
+void
+NegateFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], res, [](double v) { return -v; });
+}
+
 const char *
 NegateFunction::getRepr() const
 {
@@ -317,6 +372,12 @@ CosFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = cos(v);
 }
 
+void
+CosFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], res, [](double v) { return cos(v); });
+}
+
 const char *
 CosFunction::getRepr() const
 {
@@ -351,6 +412,12 @@ SinFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = sin(v);
 }
 
+void
+SinFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], res, [](double v) { return sin(v); });
+}
+
 const char *
 SinFunction::getRepr() const
 {
@@ -385,6 +452,12 @@ TanFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = tan(v);
 }
 
+void
+TanFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], res, [](double v) { return tan(v); });
+}
+
 const char *
 TanFunction::getRepr() const
 {
@@ -419,6 +492,12 @@ ACosFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = acos(v);
 }
 
+void
+ACosFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], res, [](double v) { return acos(v); });
+}
+
 void
 ACosFunction::operateStackOfDoubleSafe(std::vector<double> &stck) const
 {
@@ -428,6 +507,14 @@ ACosFunction::operateStackOfDoubleSafe(std::vector<double> &stck) const
     stck.back() = acos(v);
 }
 
+void
+ACosFunction::operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    if (std::any_of(args[0], args[0] + nbOfVals, [](double v) { return fabs(v) > 1.; }))
+        throw INTERP_KERNEL::Exception("acos on a value which absolute is > 1 !");
+    operateBlockOfDouble(nbOfVals, args, res);
+}
+
 const char *
 ACosFunction::getRepr() const
 {
@@ -462,6 +549,12 @@ ASinFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = asin(v);
 }
 
+void
+ASinFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], res, [](double v) { return asin(v); });
+}
+
 void
 ASinFunction::operateStackOfDoubleSafe(std::vector<double> &stck) const
 {
@@ -471,6 +564,14 @@ ASinFunction::operateStackOfDoubleSafe(std::vector<double> &stck) const
     stck.back() = asin(v);
 }
 
+void
+ASinFunction::operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    if (std::any_of(args[0], args[0] + nbOfVals, [](double v) { return fabs(v) > 1.; }))
+        throw INTERP_KERNEL::Exception("asin on a value which absolute is > 1 !");
+    operateBlockOfDouble(nbOfVals, args, res);
+}
+
 const char *
 ASinFunction::getRepr() const
 {
@@ -505,6 +606,12 @@ ATanFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = atan(v);
 }
 
+void
+ATanFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], res, [](double v) { return atan(v); });
+}
+
 const char *
 ATanFunction::getRepr() const
 {
@@ -539,6 +646,12 @@ CoshFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = cosh(v);
 }
 
+void
+CoshFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], res, [](double v) { return cosh(v); });
+}
+
 const char *
 CoshFunction::getRepr() const
 {
@@ -573,6 +686,12 @@ SinhFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = sinh(v);
 }
 
+void
+SinhFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], res, [](double v) { return sinh(v); });
+}
+
 const char *
 SinhFunction::getRepr() const
 {
@@ -607,6 +726,12 @@ TanhFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = tanh(v);
 }
 
+void
+TanhFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], res, [](double v) { return tanh(v); });
+}
+
 const char *
 TanhFunction::getRepr() const
 {
@@ -641,6 +766,12 @@ SqrtFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = sqrt(v);
 }
 
+void
+SqrtFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], res, [](double v) { return sqrt(v); });
+}
+
 void
 SqrtFunction::operateStackOfDoubleSafe(std::vector<double> &stck) const
 {
@@ -650,6 +781,14 @@ SqrtFunction::operateStackOfDoubleSafe(std::vector<double> &stck) const
     stck.back() = sqrt(v);
 }
 
+void
+SqrtFunction::operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    if (std::any_of(args[0], args[0] + nbOfVals, [](double v) { return v < 0.; }))
+        throw INTERP_KERNEL::Exception("sqrt on a value < 0. !");
+    operateBlockOfDouble(nbOfVals, args, res);
+}
+
 const char *
 SqrtFunction::getRepr() const
 {
@@ -684,6 +823,12 @@ AbsFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = fabs(v);
 }
 
+void
+AbsFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], res, [](double v) { return fabs(v); });
+}
+
 const char *
 AbsFunction::getRepr() const
 {
@@ -716,6 +861,12 @@ ExpFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = std::exp(v);
 }
 
+void
+ExpFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], res, [](double v) { return std::exp(v); });
+}
+
 const char *
 ExpFunction::getRepr() const
 {
@@ -750,6 +901,12 @@ LnFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = std::log(v);
 }
 
+void
+LnFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], res, [](double v) { return std::log(v); });
+}
+
 void
 LnFunction::operateStackOfDoubleSafe(std::vector<double> &stck) const
 {
@@ -759,6 +916,14 @@ LnFunction::operateStackOfDoubleSafe(std::vector<double> &stck) const
     stck.back() = std::log(v);
 }
 
+void
+LnFunction::operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    if (std::any_of(args[0], args[0] + nbOfVals, [](double v) { return v < 0.; }))
+        throw INTERP_KERNEL::Exception("ln on a value < 0. !");
+    operateBlockOfDouble(nbOfVals, args, res);
+}
+
 const char *
 LnFunction::getRepr() const
 {
@@ -793,6 +958,12 @@ LogFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = std::log(v);
 }
 
+void
+LogFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], res, [](double v) { return std::log(v); });
+}
+
 void
 LogFunction::operateStackOfDoubleSafe(std::vector<double> &stck) const
 {
@@ -802,6 +973,14 @@ LogFunction::operateStackOfDoubleSafe(std::vector<double> &stck) const
     stck.back() = std::log(v);
 }
 
+void
+LogFunction::operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    if (std::any_of(args[0], args[0] + nbOfVals, [](double v) { return v < 0.; }))
+        throw INTERP_KERNEL::Exception("log on a value < 0. !");
+    operateBlockOfDouble(nbOfVals, args, res);
+}
+
 const char *
 LogFunction::getRepr() const
 {
@@ -836,6 +1015,12 @@ Log10Function::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = std::log10(v);
 }
 
+void
+Log10Function::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], res, [](double v) { return std::log10(v); });
+}
+
 void
 Log10Function::operateStackOfDoubleSafe(std::vector<double> &stck) const
 {
@@ -845,6 +1030,14 @@ Log10Function::operateStackOfDoubleSafe(std::vector<double> &stck) const
     stck.back() = std::log10(v);
 }
 
+void
+Log10Function::operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    if (std::any_of(args[0], args[0] + nbOfVals, [](double v) { return v < 0.; }))
+        throw INTERP_KERNEL::Exception("log10 on a value < 0. !");
+    operateBlockOfDouble(nbOfVals, args, res);
+}
+
 const char *
 Log10Function::getRepr() const
 {
@@ -900,6 +1093,12 @@ PlusFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = a + stck.back();
 }
 
+void
+PlusFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], args[1], res, [](double a, double b) { return a + b; });
+}
+
 const char *
 PlusFunction::getRepr() const
 {
@@ -949,6 +1148,12 @@ MinusFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = a - stck.back();
 }
 
+void
+MinusFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], args[1], res, [](double a, double b) { return a - b; });
+}
+
 const char *
 MinusFunction::getRepr() const
 {
@@ -989,6 +1194,12 @@ MultFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = a * stck.back();
 }
 
+void
+MultFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], args[1], res, [](double a, double b) { return a * b; });
+}
+
 const char *
 MultFunction::getRepr() const
 {
@@ -1038,6 +1249,12 @@ DivFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = a / stck.back();
 }
 
+void
+DivFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], args[1], res, [](double a, double b) { return a / b; });
+}
+
 void
 DivFunction::operateStackOfDoubleSafe(std::vector<double> &stck) const
 {
@@ -1048,6 +1265,14 @@ DivFunction::operateStackOfDoubleSafe(std::vector<double> &stck) const
     stck.back() = a / stck.back();
 }
 
+void
+DivFunction::operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    if (std::any_of(args[1], args[1] + nbOfVals, [](double v) { return v == 0.; }))
+        throw INTERP_KERNEL::Exception("division by 0. !");
+    operateBlockOfDouble(nbOfVals, args, res);
+}
+
 const char *
 DivFunction::getRepr() const
 {
@@ -1097,6 +1322,12 @@ PowFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = std::pow(a, stck.back());
 }
 
+void
+PowFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], args[1], res, [](double a, double b) { return std::pow(a, b); });
+}
+
 void
 PowFunction::operateStackOfDoubleSafe(std::vector<double> &stck) const
 {
@@ -1108,6 +1339,14 @@ PowFunction::operateStackOfDoubleSafe(std::vector<double> &stck) const
     stck.back() = std::pow(a, b);
 }
 
+void
+PowFunction::operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    if (std::any_of(args[0], args[0] + nbOfVals, [](double v) { return v < 0.; }))
+        throw INTERP_KERNEL::Exception("pow with val < 0. !");
+    operateBlockOfDouble(nbOfVals, args, res);
+}
+
 const char *
 PowFunction::getRepr() const
 {
@@ -1159,6 +1398,12 @@ MaxFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = std::max(stck.back(), a);
 }
 
+void
+MaxFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], args[1], res, [](double a, double b) { return std::max(b, a); });
+}
+
 const char *
 MaxFunction::getRepr() const
 {
@@ -1208,6 +1453,12 @@ MinFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = std::min(stck.back(), a);
 }
 
+void
+MinFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    ApplyOnBlock(nbOfVals, args[0], args[1], res, [](double a, double b) { return std::min(b, a); });
+}
+
 const char *
 MinFunction::getRepr() const
 {
@@ -1258,6 +1509,13 @@ GreaterThanFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = a > b ? std::numeric_limits<double>::max() : -std::numeric_limits<double>::max();
 }
 
+void
+GreaterThanFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    const double trueVal(std::numeric_limits<double>::max());
+    ApplyOnBlock(nbOfVals, args[0], args[1], res, [trueVal](double a, double b) { return a > b ? trueVal : -trueVal; });
+}
+
 const char *
 GreaterThanFunction::getRepr() const
 {
@@ -1308,6 +1566,13 @@ LowerThanFunction::operateStackOfDouble(std::vector<double> &stck) const
     stck.back() = a < b ? std::numeric_limits<double>::max() : -std::numeric_limits<double>::max();
 }
 
+void
+LowerThanFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    const double trueVal(std::numeric_limits<double>::max());
+    ApplyOnBlock(nbOfVals, args[0], args[1], res, [trueVal](double a, double b) { return a < b ? trueVal : -trueVal; });
+}
+
 const char *
 LowerThanFunction::getRepr() const
 {
@@ -1370,6 +1635,14 @@ IfFunction::operateStackOfDouble(std::vector<double> &stck) const
         stck.back() = the;
 }
 
+void
+IfFunction::operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    const double *cond(args[0]), *the(args[1]), *els(args[2]);
+    for (std::size_t i = 0; i < nbOfVals; i++)
+        res[i] = cond[i] == std::numeric_limits<double>::max() ? the[i] : els[i];
+}
+
 void
 IfFunction::operateStackOfDoubleSafe(std::vector<double> &stck) const
 {
@@ -1385,6 +1658,20 @@ IfFunction::operateStackOfDoubleSafe(std::vector<double> &stck) const
         stck.back() = the;
 }
 
+void
+IfFunction::operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const
+{
+    if (std::any_of(
+            args[0],
+            args[0] + nbOfVals,
+            [](double v) { return v != std::numeric_limits<double>::max() && v != -std::numeric_limits<double>::max(); }
+        ))
+        throw INTERP_KERNEL::Exception(
+            "ifFunc : first parameter of ternary func is NOT a consequence of a boolean op !"
+        );
+    operateBlockOfDouble(nbOfVals, args, res);
+}
+
 const char *
 IfFunction::getRepr() const
 {
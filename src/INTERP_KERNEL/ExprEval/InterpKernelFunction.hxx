@@ -25,6 +25,7 @@
 #include "InterpKernelException.hxx"
 
 #include <vector>
+#include <cstddef>
 
 namespace INTERP_KERNEL
 {
@@ -51,6 +52,12 @@ class INTERPKERNEL_EXPORT Function
     virtual void operateX86(std::vector<std::string> &asmb) const = 0;
     virtual void operateStackOfDouble(std::vector<double> &stck) const = 0;
     virtual void operateStackOfDoubleSafe(std::vector<double> &stck) const { operateStackOfDouble(stck); }
+    //! Block counterpart of operateStackOfDouble : \a args [ p ] is the p-th value that would be popped from the stack.
+    virtual void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
+    virtual void operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const
+    {
+        operateBlockOfDouble(nbOfVals, args, res);
+    }
     virtual const char *getRepr() const = 0;
     virtual bool isACall() const = 0;
     virtual Function *deepCopy() const = 0;
@@ -69,6 +76,7 @@ class INTERPKERNEL_EXPORT IdentityFunction : public UnaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     IdentityFunction *deepCopy() const { return new IdentityFunction; }
@@ -84,6 +92,7 @@ class INTERPKERNEL_EXPORT PositiveFunction : public UnaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     PositiveFunction *deepCopy() const { return new PositiveFunction; }
@@ -99,6 +108,7 @@ class INTERPKERNEL_EXPORT NegateFunction : public UnaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     NegateFunction *deepCopy() const { return new NegateFunction; }
@@ -114,6 +124,7 @@ class INTERPKERNEL_EXPORT CosFunction : public UnaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     CosFunction *deepCopy() const { return new CosFunction; }
@@ -129,6 +140,7 @@ class INTERPKERNEL_EXPORT SinFunction : public UnaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     SinFunction *deepCopy() const { return new SinFunction; }
@@ -144,6 +156,7 @@ class INTERPKERNEL_EXPORT TanFunction : public UnaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     TanFunction *deepCopy() const { return new TanFunction; }
@@ -159,7 +172,9 @@ class INTERPKERNEL_EXPORT ACosFunction : public UnaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     void operateStackOfDoubleSafe(std::vector<double> &stck) const;
+    void operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     ACosFunction *deepCopy() const { return new ACosFunction; }
@@ -175,7 +190,9 @@ class INTERPKERNEL_EXPORT ASinFunction : public UnaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     void operateStackOfDoubleSafe(std::vector<double> &stck) const;
+    void operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     ASinFunction *deepCopy() const { return new ASinFunction; }
@@ -191,6 +208,7 @@ class INTERPKERNEL_EXPORT ATanFunction : public UnaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     ATanFunction *deepCopy() const { return new ATanFunction; }
@@ -206,6 +224,7 @@ class INTERPKERNEL_EXPORT CoshFunction : public UnaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     CoshFunction *deepCopy() const { return new CoshFunction; }
@@ -221,6 +240,7 @@ class INTERPKERNEL_EXPORT SinhFunction : public UnaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     SinhFunction *deepCopy() const { return new SinhFunction; }
@@ -236,6 +256,7 @@ class INTERPKERNEL_EXPORT TanhFunction : public UnaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     TanhFunction *deepCopy() const { return new TanhFunction; }
@@ -251,7 +272,9 @@ class INTERPKERNEL_EXPORT SqrtFunction : public UnaryFunction
     void operateX86(std::vector<std::string> &asmb) const;
     void operate(std::vector<Value *> &stck) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     void operateStackOfDoubleSafe(std::vector<double> &stck) const;
+    void operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     SqrtFunction *deepCopy() const { return new SqrtFunction; }
@@ -267,6 +290,7 @@ class INTERPKERNEL_EXPORT AbsFunction : public UnaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     AbsFunction *deepCopy() const { return new AbsFunction; }
@@ -282,6 +306,7 @@ class INTERPKERNEL_EXPORT ExpFunction : public UnaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     ExpFunction *deepCopy() const { return new ExpFunction; }
@@ -297,7 +322,9 @@ class INTERPKERNEL_EXPORT LnFunction : public UnaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     void operateStackOfDoubleSafe(std::vector<double> &stck) const;
+    void operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     LnFunction *deepCopy() const { return new LnFunction; }
@@ -313,7 +340,9 @@ class INTERPKERNEL_EXPORT LogFunction : public UnaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     void operateStackOfDoubleSafe(std::vector<double> &stck) const;
+    void operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     LogFunction *deepCopy() const { return new LogFunction; }
@@ -329,7 +358,9 @@ class INTERPKERNEL_EXPORT Log10Function : public UnaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     void operateStackOfDoubleSafe(std::vector<double> &stck) const;
+    void operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     Log10Function *deepCopy() const { return new Log10Function; }
@@ -351,6 +382,7 @@ class PlusFunction : public BinaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     PlusFunction *deepCopy() const { return new PlusFunction; }
@@ -366,6 +398,7 @@ class INTERPKERNEL_EXPORT MinusFunction : public BinaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     MinusFunction *deepCopy() const { return new MinusFunction; }
@@ -381,6 +414,7 @@ class INTERPKERNEL_EXPORT MultFunction : public BinaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     MultFunction *deepCopy() const { return new MultFunction; }
@@ -396,7 +430,9 @@ class INTERPKERNEL_EXPORT DivFunction : public BinaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     void operateStackOfDoubleSafe(std::vector<double> &stck) const;
+    void operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     DivFunction *deepCopy() const { return new DivFunction; }
@@ -412,7 +448,9 @@ class INTERPKERNEL_EXPORT PowFunction : public BinaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     void operateStackOfDoubleSafe(std::vector<double> &stck) const;
+    void operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     PowFunction *deepCopy() const { return new PowFunction; }
@@ -428,6 +466,7 @@ class INTERPKERNEL_EXPORT MaxFunction : public BinaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     MaxFunction *deepCopy() const { return new MaxFunction; }
@@ -443,6 +482,7 @@ class INTERPKERNEL_EXPORT MinFunction : public BinaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     MinFunction *deepCopy() const { return new MinFunction; }
@@ -458,6 +498,7 @@ class INTERPKERNEL_EXPORT GreaterThanFunction : public BinaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     GreaterThanFunction *deepCopy() const { return new GreaterThanFunction; }
@@ -473,6 +514,7 @@ class INTERPKERNEL_EXPORT LowerThanFunction : public BinaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     LowerThanFunction *deepCopy() const { return new LowerThanFunction; }
@@ -494,7 +536,9 @@ class INTERPKERNEL_EXPORT IfFunction : public TernaryFunction
     void operate(std::vector<Value *> &stck) const;
     void operateX86(std::vector<std::string> &asmb) const;
     void operateStackOfDouble(std::vector<double> &stck) const;
+    void operateBlockOfDouble(std::size_t nbOfVals, const double *const *args, double *res) const;
     void operateStackOfDoubleSafe(std::vector<double> &stck) const;
+    void operateBlockOfDoubleSafe(std::size_t nbOfVals, const double *const *args, double *res) const;
     const char *getRepr() const;
     bool isACall() const;
     IfFunction *deepCopy() const { return new IfFunction; }
@@ -0,0 +1,203 @@
+// Copyright (C) 2026  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "InterpKernelGeo2DLinearPolygonIntersector.hxx"
+#include "InterpKernelGeo2DPrecision.hxx"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace INTERP_KERNEL;
+
+/*!
+ * Returns the area of the intersection of the polygons defined by the \a nbOfNodes1 nodes of \a coords1 and the \a
+ * nbOfNodes2 nodes of \a coords2. The coordinates are interlaced with a stride of \a spaceDim, only the first two are
+ * used. If \a barycenter is not null, it is filled with the barycenter of the intersection.
+ */
+double
+LinearPolygonIntersector::intersectWithAbs(
+    const double *coords1,
+    std::size_t nbOfNodes1,
+    const double *coords2,
+    std::size_t nbOfNodes2,
+    int spaceDim,
+    double *barycenter
+)
+{
+    const double *coords[2] = {coords1, coords2};
+    std::size_t nbOfNodes[2] = {nbOfNodes1, nbOfNodes2};
+    if (barycenter)
+        barycenter[0] = barycenter[1] = 0.;
+    Bounds b;
+    b.prepareForAggregation();
+    for (int pol = 0; pol < 2; pol++)
+        for (std::size_t i = 0; i < nbOfNodes[pol]; i++)
+            b.aggregate(Bounds(
+                coords[pol][i * spaceDim],
+                coords[pol][i * spaceDim],
+                coords[pol][i * spaceDim + 1],
+                coords[pol][i * spaceDim + 1]
+            ));
+    double dimChar(b.getCaracteristicDim()), xBary, yBary;
+    if (nbOfNodes1 < 3 || nbOfNodes2 < 3 || dimChar <= 0.)
+        return 0.;
+    b.getBarycenter(xBary, yBary);
+    for (int pol = 0; pol < 2; pol++)
+    {
+        std::vector<double> &x(_x[pol]), &y(_y[pol]);
+        x.resize(nbOfNodes[pol]);
+        y.resize(nbOfNodes[pol]);
+        double area(0.);
+        for (std::size_t i = 0; i < nbOfNodes[pol]; i++)
+        {
+            x[i] = (coords[pol][i * spaceDim] - xBary) / dimChar;
+            y[i] = (coords[pol][i * spaceDim + 1] - yBary) / dimChar;
+        }
+        for (std::size_t i = 0, j = nbOfNodes[pol] - 1; i < nbOfNodes[pol]; j = i++) area += x[j] * y[i] - x[i] * y[j];
+        _orientation[pol] = area >= 0. ? 1. : -1.;
+    }
+    double area(0.), moment[2] = {0., 0.};
+    addBoundaryInside(0, true, area, moment);
+    addBoundaryInside(1, false, area, moment);
+    area = std::max(area / 2., 0.);
+    if (barycenter && area > std::numeric_limits<double>::min())
+    {
+        barycenter[0] = moment[0] / (6. * area) * dimChar + xBary;
+        barycenter[1] = moment[1] / (6. * area) * dimChar + yBary;
+    }
+    return area * dimChar * dimChar;
+}
+
+/*!
+ * Returns the distance between the segments [ \a a, \a b ] and [ \a c, \a d ] in 2D.
+ */
+double
+LinearPolygonIntersector::DistanceBetweenSegments(const double *a, const double *b, const double *c, const double *d)
+{
+    double abX(b[0] - a[0]), abY(b[1] - a[1]), cdX(d[0] - c[0]), cdY(d[1] - c[1]);
+    double c1((c[0] - a[0]) * abY - (c[1] - a[1]) * abX), d1((d[0] - a[0]) * abY - (d[1] - a[1]) * abX);
+    double a2((a[0] - c[0]) * cdY - (a[1] - c[1]) * cdX), b2((b[0] - c[0]) * cdY - (b[1] - c[1]) * cdX);
+    if (((c1 < 0. && d1 > 0.) || (c1 > 0. && d1 < 0.)) && ((a2 < 0. && b2 > 0.) || (a2 > 0. && b2 < 0.)))
+        return 0.;
+    const double *pts[4] = {a, b, c, d}, *segs[4][2] = {{c, d}, {c, d}, {a, b}, {a, b}};
+    double ret(std::numeric_limits<double>::max());
+    for (int i = 0; i < 4; i++)
+    {
+        const double *p(pts[i]), *s0(segs[i][0]), *s1(segs[i][1]);
+        double sX(s1[0] - s0[0]), sY(s1[1] - s0[1]), len2(sX * sX + sY * sY), t(0.);
+        if (len2 > 0.)
+            t = std::min(1., std::max(0., ((p[0] - s0[0]) * sX + (p[1] - s0[1]) * sY) / len2));
+        ret = std::min(ret, std::hypot(p[0] - s0[0] - t * sX, p[1] - s0[1] - t * sY));
+    }
+    return ret;
+}
+
+/*!
+ * Adds to \a area and \a moment the contributions, in the Green formula, of the parts of the edges of polygon \a pol
+ * lying inside the other polygon. The parts lying on an edge of the other polygon with the same direction are only
+ * taken into account if \a keepOnBoundary is true.
+ */
+void
+LinearPolygonIntersector::addBoundaryInside(int pol, bool keepOnBoundary, double &area, double *moment)
+{
+    const double eps(QuadraticPlanarPrecision::getPrecision());
+    const std::vector<double> &x(_x[pol]), &y(_y[pol]), &xOther(_x[1 - pol]), &yOther(_y[1 - pol]);
+    std::size_t nbOfNodes(x.size()), nbOfNodesOther(xOther.size());
+    for (std::size_t i = 0; i < nbOfNodes; i++)
+    {
+        std::size_t i1((i + 1) % nbOfNodes);
+        double aX(x[i]), aY(y[i]), dX(x[i1] - aX), dY(y[i1] - aY), len(std::hypot(dX, dY));
+        if (len == 0.)
+            continue;
+        // abscissas of the points of the edge where it may enter or leave the other polygon
+        _abscissas.assign({0., 1.});
+        for (std::size_t j = 0; j < nbOfNodesOther; j++)
+        {
+            std::size_t j1((j + 1) % nbOfNodesOther);
+            double cX(xOther[j] - aX), cY(yOther[j] - aY), fX(xOther[j1] - xOther[j]), fY(yOther[j1] - yOther[j]);
+            double t((cX * dX + cY * dY) / (len * len));
+            if (t > 0. && t < 1. && std::fabs(cX * dY - cY * dX) < eps * len)
+                _abscissas.push_back(t);
+            double det(dX * fY - dY * fX);
+            if (std::fabs(det) > eps * len * std::hypot(fX, fY))
+            {
+                double u((cX * dY - cY * dX) / det);
+                t = (cX * fY - cY * fX) / det;
+                if (t > 0. && t < 1. && u >= 0. && u <= 1.)
+                    _abscissas.push_back(t);
+            }
+        }
+        std::sort(_abscissas.begin(), _abscissas.end());
+        for (std::size_t k = 0; k + 1 < _abscissas.size(); k++)
+        {
+            double t0(_abscissas[k]), t1(_abscissas[k + 1]);
+            if (t1 <= t0)
+                continue;
+            Position loc(locate(
+                1 - pol,
+                aX + (t0 + t1) / 2. * dX,
+                aY + (t0 + t1) / 2. * dY,
+                _orientation[pol] * dX,
+                _orientation[pol] * dY
+            ));
+            if (loc == IN || (keepOnBoundary && loc == ON_BOUNDARY_POS))
+            {
+                double x0(aX + t0 * dX), y0(aY + t0 * dY), x1(aX + t1 * dX), y1(aY + t1 * dY);
+                double cross(_orientation[pol] * (x0 * y1 - x1 * y0));
+                area += cross;
+                moment[0] += (x0 + x1) * cross;
+                moment[1] += (y0 + y1) * cross;
+            }
+        }
+    }
+}
+
+/*!
+ * Returns the location of point ( \a x, \a y ) relative to polygon \a pol. If the point is on an edge of \a pol, it
+ * returns ON_BOUNDARY_POS if the direction ( \a dirX, \a dirY ) is the one of the edge once \a pol oriented counter
+ * clockwise, and ON_BOUNDARY_NEG otherwise.
+ */
+Position
+LinearPolygonIntersector::locate(int pol, double x, double y, double dirX, double dirY) const
+{
+    const double eps(QuadraticPlanarPrecision::getPrecision());
+    const std::vector<double> &xPol(_x[pol]), &yPol(_y[pol]);
+    std::size_t nbOfNodes(xPol.size());
+    for (std::size_t j = 0; j < nbOfNodes; j++)
+    {
+        std::size_t j1((j + 1) % nbOfNodes);
+        double cX(x - xPol[j]), cY(y - yPol[j]), fX(xPol[j1] - xPol[j]), fY(yPol[j1] - yPol[j]);
+        double len2(fX * fX + fY * fY);
+        if (len2 == 0.)
+            continue;
+        double u((cX * fX + cY * fY) / len2);
+        if (u >= 0. && u <= 1. && std::fabs(cX * fY - cY * fX) < eps * std::sqrt(len2))
+            return (dirX * fX + dirY * fY) * _orientation[pol] > 0. ? ON_BOUNDARY_POS : ON_BOUNDARY_NEG;
+    }
+    bool isIn(false);
+    for (std::size_t j = 0; j < nbOfNodes; j++)
+    {
+        std::size_t j1((j + 1) % nbOfNodes);
+        if ((yPol[j] > y) != (yPol[j1] > y) &&
+            x < xPol[j] + (y - yPol[j]) * (xPol[j1] - xPol[j]) / (yPol[j1] - yPol[j]))
+            isIn = !isIn;
+    }
+    return isIn ? IN : OUT;
+}
@@ -0,0 +1,66 @@
+// Copyright (C) 2026  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#ifndef __INTERPKERNELGEO2DLINEARPOLYGONINTERSECTOR_HXX__
+#define __INTERPKERNELGEO2DLINEARPOLYGONINTERSECTOR_HXX__
+
+#include "INTERPKERNELDefines.hxx"
+#include "InterpKernelGeo2DBounds.hxx"
+
+#include <vector>
+
+namespace INTERP_KERNEL
+{
+/*!
+ * Intersection of two polygons made of segments only, equivalent to QuadraticPolygon::intersectWithAbs but working
+ * on the coordinates of the nodes : no Node nor Edge is built. The polygons are copied, normalized as
+ * QuadraticPolygon::normalize does, in arrays of x and y kept by the instance, so that no allocation is done once they
+ * are large enough.
+ *
+ * The area is computed with the Green formula on the boundary of the intersection, which is made of the parts of the
+ * edges of each polygon lying inside the other one. A part of edge lying on an edge of the other polygon is counted
+ * once if the two edges have the same direction (the polygons being oriented the same way), and not at all otherwise.
+ * The precision is QuadraticPlanarPrecision::getPrecision(), applied to the normalized coordinates.
+ */
+class INTERPKERNEL_EXPORT LinearPolygonIntersector
+{
+   public:
+    double intersectWithAbs(
+        const double *coords1,
+        std::size_t nbOfNodes1,
+        const double *coords2,
+        std::size_t nbOfNodes2,
+        int spaceDim,
+        double *barycenter = nullptr
+    );
+    static double DistanceBetweenSegments(const double *a, const double *b, const double *c, const double *d);
+
+   private:
+    void addBoundaryInside(int pol, bool keepOnBoundary, double &area, double *moment);
+    Position locate(int pol, double x, double y, double dirX, double dirY) const;
+
+   private:
+    std::vector<double> _x[2];
+    std::vector<double> _y[2];
+    double _orientation[2];
+    std::vector<double> _abscissas;
+};
+}  // namespace INTERP_KERNEL
+
+#endif
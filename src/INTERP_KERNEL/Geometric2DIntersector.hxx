@@ -27,6 +27,7 @@
 #include "PlanarIntersectorP1P1.hxx"
 #include "PlanarIntersectorP1P0Bary.hxx"
 #include "PlanarIntersectorP0P1Bary.hxx"
+#include "InterpKernelGeo2DLinearPolygonIntersector.hxx"
 
 namespace INTERP_KERNEL
 {
@@ -78,6 +79,8 @@ class Geometric2DIntersector
     QuadraticPolygon *buildPolygonBFrom(ConnType cell, int nbOfPoints, NormalizedCellType type);
 
     QuadraticPlanarPrecision _precision;
+    //! Used instead of QuadraticPolygon when the two polygons are linear
+    LinearPolygonIntersector _linear_intersector;
 };
 }  // namespace INTERP_KERNEL
 
@@ -74,6 +74,13 @@ GEO2D_INTERSECTOR::intersectGeometry(ConnType icellT, ConnType icellS, ConnType
     );
     NormalizedCellType tT = PlanarIntersector<MyMeshType, MyMatrix>::_meshT.getTypeOfElement(icellT);
     NormalizedCellType tS = PlanarIntersector<MyMeshType, MyMatrix>::_meshS.getTypeOfElement(icellS);
+    if (!CellModel::GetCellModel(tT).isQuadratic() && !CellModel::GetCellModel(tS).isQuadratic())
+    {
+        double ret = _linear_intersector.intersectWithAbs(
+            CoordsT.data(), CoordsT.size() / SPACEDIM, CoordsS.data(), CoordsS.size() / SPACEDIM, SPACEDIM
+        );
+        return orientation * ret;
+    }
     QuadraticPolygon *p1 = buildPolygonFrom(CoordsT, tT);
     QuadraticPolygon *p2 = buildPolygonFrom(CoordsS, tS);
     double ret = p1->intersectWithAbs(*p2);
@@ -110,6 +117,10 @@ GEO2D_INTERSECTOR::intersectGeometryWithQuadrangle(
     const double *quadrangle, const std::vector<double> &sourceCoords, bool isSourceQuad
 )
 {
+    if (!isSourceQuad)
+        return _linear_intersector.intersectWithAbs(
+            quadrangle, 4, sourceCoords.data(), sourceCoords.size() / SPACEDIM, SPACEDIM
+        );
     std::vector<Node *> nodes(4);
     nodes[0] = new Node(quadrangle[0], quadrangle[1]);
     nodes[1] = new Node(quadrangle[SPACEDIM], quadrangle[SPACEDIM + 1]);
@@ -137,20 +148,13 @@ GEO2D_INTERSECTOR::intersectGeometryGeneral(
     const std::vector<double> &targetCoords, const std::vector<double> &sourceCoords
 )
 {
-    std::size_t nbOfTargetNodes = targetCoords.size() / SPACEDIM;
-    std::vector<Node *> nodes(nbOfTargetNodes);
-    for (std::size_t i = 0; i < nbOfTargetNodes; i++)
-        nodes[i] = new Node(targetCoords[i * SPACEDIM], targetCoords[i * SPACEDIM + 1]);
-    std::size_t nbOfSourceNodes = sourceCoords.size() / SPACEDIM;
-    std::vector<Node *> nodes2(nbOfSourceNodes);
-    for (std::size_t i = 0; i < nbOfSourceNodes; i++)
-        nodes2[i] = new Node(sourceCoords[i * SPACEDIM], sourceCoords[i * SPACEDIM + 1]);
-    QuadraticPolygon *p1 = QuadraticPolygon::BuildLinearPolygon(nodes);
-    QuadraticPolygon *p2 = QuadraticPolygon::BuildLinearPolygon(nodes2);
-    double ret = p1->intersectWithAbs(*p2);
-    delete p1;
-    delete p2;
-    return ret;
+    return _linear_intersector.intersectWithAbs(
+        targetCoords.data(),
+        targetCoords.size() / SPACEDIM,
+        sourceCoords.data(),
+        sourceCoords.size() / SPACEDIM,
+        SPACEDIM
+    );
 }
 
 //================================================================================
@@ -169,24 +173,27 @@ GEO2D_INTERSECTOR::intersectGeoBary(
     const std::vector<double> &targetCell, bool targetCellQuadratic, const double *sourceTria, std::vector<double> &res
 )
 {
-    std::vector<Node *> nodes(3);
-    nodes[0] = new Node(sourceTria[0 * SPACEDIM], sourceTria[0 * SPACEDIM + 1]);
-    nodes[1] = new Node(sourceTria[1 * SPACEDIM], sourceTria[1 * SPACEDIM + 1]);
-    nodes[2] = new Node(sourceTria[2 * SPACEDIM], sourceTria[2 * SPACEDIM + 1]);
-    std::size_t nbOfTargetNodes = targetCell.size() / SPACEDIM;
-    std::vector<Node *> nodes2(nbOfTargetNodes);
-    for (std::size_t i = 0; i < nbOfTargetNodes; i++)
-        nodes2[i] = new Node(targetCell[i * SPACEDIM], targetCell[i * SPACEDIM + 1]);
-    QuadraticPolygon *p1 = QuadraticPolygon::BuildLinearPolygon(nodes);
-    QuadraticPolygon *p2;
+    double barycenter[2], ret;
     if (!targetCellQuadratic)
-        p2 = QuadraticPolygon::BuildLinearPolygon(nodes2);
+        ret = _linear_intersector.intersectWithAbs(
+            sourceTria, 3, targetCell.data(), targetCell.size() / SPACEDIM, SPACEDIM, barycenter
+        );
     else
-        p2 = QuadraticPolygon::BuildArcCirclePolygon(nodes2);
-    double barycenter[2];
-    double ret = p1->intersectWithAbs(*p2, barycenter);
-    delete p1;
-    delete p2;
+    {
+        std::vector<Node *> nodes(3);
+        nodes[0] = new Node(sourceTria[0 * SPACEDIM], sourceTria[0 * SPACEDIM + 1]);
+        nodes[1] = new Node(sourceTria[1 * SPACEDIM], sourceTria[1 * SPACEDIM + 1]);
+        nodes[2] = new Node(sourceTria[2 * SPACEDIM], sourceTria[2 * SPACEDIM + 1]);
+        std::size_t nbOfTargetNodes = targetCell.size() / SPACEDIM;
+        std::vector<Node *> nodes2(nbOfTargetNodes);
+        for (std::size_t i = 0; i < nbOfTargetNodes; i++)
+            nodes2[i] = new Node(targetCell[i * SPACEDIM], targetCell[i * SPACEDIM + 1]);
+        QuadraticPolygon *p1 = QuadraticPolygon::BuildLinearPolygon(nodes);
+        QuadraticPolygon *p2 = QuadraticPolygon::BuildArcCirclePolygon(nodes2);
+        ret = p1->intersectWithAbs(*p2, barycenter);
+        delete p1;
+        delete p2;
+    }
     if (ret > std::numeric_limits<double>::min())
     {
         std::vector<const double *> sourceCell(3);
@@ -28,6 +28,9 @@
 
 namespace INTERP_KERNEL
 {
+template <class MyMeshType, class MyMatrix>
+class Intersector3D;
+
 /**
  * \class Interpolation3D
  * \brief Class used to calculate the volumes of intersection between the elements of two 3D meshes.
@@ -42,6 +45,12 @@ class INTERPKERNEL_EXPORT Interpolation3D : public Interpolation<Interpolation3D
     typename MyMeshType::MyConnType interpolateMeshes(
         const MyMeshType &srcMesh, const MyMeshType &targetMesh, MatrixType &result, const std::string &method
     );
+
+   private:
+    template <class MyMeshType, class MatrixType>
+    Intersector3D<MyMeshType, MatrixType> *buildIntersector(
+        const MyMeshType &srcMesh, const MyMeshType &targetMesh, const std::string &methC
+    ) const;
 };
 }  // namespace INTERP_KERNEL
 
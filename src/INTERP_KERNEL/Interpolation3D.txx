@@ -48,66 +48,34 @@
 #else  // use BBTree class
 
 #include "InterpolationHelper.txx"
+#include "InterpKernelThreadPool.hxx"
 
 #endif
 
+#include <algorithm>
 #include <memory>
 
 namespace INTERP_KERNEL
 {
 /**
- * Calculates the matrix of volumes of intersection between the elements of srcMesh and the elements of targetMesh.
- * The calculation is done in two steps. First a filtering process reduces the number of pairs of elements for which the
- * calculation must be carried out by eliminating pairs that do not intersect based on their bounding boxes. Then, the
- * volume of intersection is calculated by an object of type Intersector3D for the remaining pairs, and entered into the
- * intersection matrix.
- *
- * The matrix is partially sparse : it is a vector of maps of integer - double pairs.
- * It can also be an INTERP_KERNEL::Matrix object.
- * The length of the vector is equal to the number of target elements - for each target element there is a map,
- regardless
- * of whether the element intersects any source elements or not. But in the maps there are only entries for those source
- elements
- * which have a non-zero intersection volume with the target element. The vector has indices running from
- * 0 to (nb target elements - 1), meaning that the map for target element i is stored at index i - 1. In the maps,
- however,
- * the indexing is more natural : the intersection volume of the target element i with source element j is found at
- matrix[i-1][j].
- *
-
- * @param srcMesh     3-dimensional source mesh
- * @param targetMesh  3-dimesional target mesh, containing only tetraedra
- * @param result      matrix in which the result is stored
- *
+ * Builds the Intersector3D instance matching the interpolation method \a methC and the intersection type of the
+ * options. The returned instance is owned by the caller.
+ * An intersector instance holds working data of the target cell being processed, so each thread needs its own one.
  */
 template <class MyMeshType, class MatrixType>
-typename MyMeshType::MyConnType
-Interpolation3D::interpolateMeshes(
-    const MyMeshType &srcMesh, const MyMeshType &targetMesh, MatrixType &result, const std::string &method
-)
+Intersector3D<MyMeshType, MatrixType> *
+Interpolation3D::buildIntersector(
+    const MyMeshType &srcMesh, const MyMeshType &targetMesh, const std::string &methC
+) const
 {
-    using ConnType = typename MyMeshType::MyConnType;
-    // create MeshElement objects corresponding to each element of the two meshes
-    const ConnType numTargetElems = targetMesh.getNumberOfElements();
-
-    LOG(2, "Target mesh has " << numTargetElems << " elements ");
-
-    std::unique_ptr<Intersector3D<MyMeshType, MatrixType>> intersector;
-    std::string methC = InterpolationOptions::filterInterpolationMethod(method);
     if (methC == "P0P0")
     {
         switch (InterpolationOptions::getIntersectionType())
         {
             case Triangulation:
-                intersector.reset(
-                    new PolyhedronIntersectorP0P0<MyMeshType, MatrixType>(targetMesh, srcMesh, getSplittingPolicy())
-                );
-                break;
+                return new PolyhedronIntersectorP0P0<MyMeshType, MatrixType>(targetMesh, srcMesh, getSplittingPolicy());
             case PointLocator:
-                intersector.reset(
-                    new PointLocator3DIntersectorP0P0<MyMeshType, MatrixType>(targetMesh, srcMesh, getPrecision())
-                );
-                break;
+                return new PointLocator3DIntersectorP0P0<MyMeshType, MatrixType>(targetMesh, srcMesh, getPrecision());
             default:
                 throw INTERP_KERNEL::Exception(
                     "Invalid 3D intersection type for P0P0 interp specified : must be Triangle or PointLocator."
@@ -119,15 +87,9 @@ Interpolation3D::interpolateMeshes(
         switch (InterpolationOptions::getIntersectionType())
         {
             case Triangulation:
-                intersector.reset(
-                    new PolyhedronIntersectorP0P1<MyMeshType, MatrixType>(targetMesh, srcMesh, getSplittingPolicy())
-                );
-                break;
+                return new PolyhedronIntersectorP0P1<MyMeshType, MatrixType>(targetMesh, srcMesh, getSplittingPolicy());
             case PointLocator:
-                intersector.reset(
-                    new PointLocator3DIntersectorP0P1<MyMeshType, MatrixType>(targetMesh, srcMesh, getPrecision())
-                );
-                break;
+                return new PointLocator3DIntersectorP0P1<MyMeshType, MatrixType>(targetMesh, srcMesh, getPrecision());
             default:
                 throw INTERP_KERNEL::Exception(
                     "Invalid 3D intersection type for P0P1 interp specified : must be Triangle or PointLocator."
@@ -139,20 +101,13 @@ Interpolation3D::interpolateMeshes(
         switch (InterpolationOptions::getIntersectionType())
         {
             case Triangulation:
-                intersector.reset(
-                    new PolyhedronIntersectorP1P0<MyMeshType, MatrixType>(targetMesh, srcMesh, getSplittingPolicy())
-                );
-                break;
+                return new PolyhedronIntersectorP1P0<MyMeshType, MatrixType>(targetMesh, srcMesh, getSplittingPolicy());
             case PointLocator:
-                intersector.reset(
-                    new PointLocator3DIntersectorP1P0<MyMeshType, MatrixType>(targetMesh, srcMesh, getPrecision())
-                );
-                break;
+                return new PointLocator3DIntersectorP1P0<MyMeshType, MatrixType>(targetMesh, srcMesh, getPrecision());
             case Barycentric:
-                intersector.reset(
-                    new PolyhedronIntersectorP1P0Bary<MyMeshType, MatrixType>(targetMesh, srcMesh, getSplittingPolicy())
+                return new PolyhedronIntersectorP1P0Bary<MyMeshType, MatrixType>(
+                    targetMesh, srcMesh, getSplittingPolicy()
                 );
-                break;
             default:
                 throw INTERP_KERNEL::Exception(
                     "Invalid 3D intersection type for P1P0 interp specified : must be Triangle, PointLocator or "
@@ -165,25 +120,15 @@ Interpolation3D::interpolateMeshes(
         switch (InterpolationOptions::getIntersectionType())
         {
             case Triangulation:
-                intersector.reset(
-                    new PolyhedronIntersectorP1P1<MyMeshType, MatrixType>(targetMesh, srcMesh, getSplittingPolicy())
-                );
-                break;
+                return new PolyhedronIntersectorP1P1<MyMeshType, MatrixType>(targetMesh, srcMesh, getSplittingPolicy());
             case PointLocator:
-                intersector.reset(
-                    new PointLocator3DIntersectorP1P1<MyMeshType, MatrixType>(targetMesh, srcMesh, getPrecision())
-                );
-                break;
+                return new PointLocator3DIntersectorP1P1<MyMeshType, MatrixType>(targetMesh, srcMesh, getPrecision());
             case Barycentric:
-                intersector.reset(
-                    new Barycentric3DIntersectorP1P1<MyMeshType, MatrixType>(targetMesh, srcMesh, getPrecision())
-                );
-                break;
+                return new Barycentric3DIntersectorP1P1<MyMeshType, MatrixType>(targetMesh, srcMesh, getPrecision());
             case MappedBarycentric:
-                intersector.reset(
-                    new MappedBarycentric3DIntersectorP1P1<MyMeshType, MatrixType>(targetMesh, srcMesh, getPrecision())
+                return new MappedBarycentric3DIntersectorP1P1<MyMeshType, MatrixType>(
+                    targetMesh, srcMesh, getPrecision()
                 );
-                break;
             default:
                 throw INTERP_KERNEL::Exception(
                     "Invalid 3D intersection type for P1P1 interp specified : must be Triangle, PointLocator, "
@@ -193,6 +138,49 @@ Interpolation3D::interpolateMeshes(
     }
     else
         throw Exception("Invalid method chosen must be in \"P0P0\", \"P0P1\", \"P1P0\" or \"P1P1\".");
+}
+
+/**
+ * Calculates the matrix of volumes of intersection between the elements of srcMesh and the elements of targetMesh.
+ * The calculation is done in two steps. First a filtering process reduces the number of pairs of elements for which the
+ * calculation must be carried out by eliminating pairs that do not intersect based on their bounding boxes. Then, the
+ * volume of intersection is calculated by an object of type Intersector3D for the remaining pairs, and entered into the
+ * intersection matrix.
+ *
+ * The matrix is partially sparse : it is a vector of maps of integer - double pairs.
+ * It can also be an INTERP_KERNEL::Matrix object.
+ * The length of the vector is equal to the number of target elements - for each target element there is a map,
+ regardless
+ * of whether the element intersects any source elements or not. But in the maps there are only entries for those source
+ elements
+ * which have a non-zero intersection volume with the target element. The vector has indices running from
+ * 0 to (nb target elements - 1), meaning that the map for target element i is stored at index i - 1. In the maps,
+ however,
+ * the indexing is more natural : the intersection volume of the target element i with source element j is found at
+ matrix[i-1][j].
+ *
+
+ * @param srcMesh     3-dimensional source mesh
+ * @param targetMesh  3-dimesional target mesh, containing only tetraedra
+ * @param result      matrix in which the result is stored
+ *
+ */
+template <class MyMeshType, class MatrixType>
+typename MyMeshType::MyConnType
+Interpolation3D::interpolateMeshes(
+    const MyMeshType &srcMesh, const MyMeshType &targetMesh, MatrixType &result, const std::string &method
+)
+{
+    using ConnType = typename MyMeshType::MyConnType;
+    // create MeshElement objects corresponding to each element of the two meshes
+    const ConnType numTargetElems = targetMesh.getNumberOfElements();
+
+    LOG(2, "Target mesh has " << numTargetElems << " elements ");
+
+    std::string methC = InterpolationOptions::filterInterpolationMethod(method);
+    std::unique_ptr<Intersector3D<MyMeshType, MatrixType>> intersector(
+        buildIntersector<MyMeshType, MatrixType>(srcMesh, targetMesh, methC)
+    );
     // create empty maps for all source elements
     result.resize(intersector->getNumberOfRowsOfResMatrix());
 
@@ -340,27 +328,76 @@ Interpolation3D::interpolateMeshes(
     }
 
 #else  // Use BBTree
-    // create BBTree structure
-    BBTreeStandAlone<3, ConnType> tree(BuildBBTree(srcMesh));
-
     // for each target element, get source elements with which to calculate intersection
     // - calculate intersection by calling intersectCells
-    for (ConnType i = 0; i < numTargetElems; ++i)
+    auto intersectTargetCells = [&targetMesh, &result](
+                                    const auto &tree,
+                                    ConnType bg,
+                                    ConnType end,
+                                    Intersector3D<MyMeshType, MatrixType> &intersectorT
+                                )
     {
-        MeshElement<ConnType> trgMeshElem(i, targetMesh);
+        std::vector<ConnType> intersectElems;
+        for (ConnType i = bg; i < end; ++i)
+        {
+            MeshElement<ConnType> trgMeshElem(i, targetMesh);
 
-        const BoundingBox *box = trgMeshElem.getBoundingBox();
+            const BoundingBox *box = trgMeshElem.getBoundingBox();
 
-        // get target bbox in right order
-        double targetBox[6];
-        box->fillInXMinXmaxYminYmaxZminZmaxFormat(targetBox);
+            // get target bbox in right order
+            double targetBox[6];
+            box->fillInXMinXmaxYminYmaxZminZmaxFormat(targetBox);
 
-        std::vector<ConnType> intersectElems;
+            intersectElems.clear();
+            tree.getIntersectingElems(targetBox, intersectElems);
+
+            if (!intersectElems.empty())
+                intersectorT.intersectCells(i, intersectElems, result);
+        }
+    };
 
-        tree.getIntersectingElems(targetBox, intersectElems);
+    // The thread-parallel mode is only available for methods where row i of the result matrix is filled exclusively
+    // by target cell i. Each thread owns the rows of the target cells it processes, so that the result is
+    // bit-identical to the serial one. For P0P1 and P1P1 several target cells accumulate into the same row (a target
+    // node) : the serial loop is kept to preserve the summation order.
+    auto intersectAllTargetCells = [&](const auto &tree)
+    {
+        const unsigned int nbOfThreads = GetEffectiveNbOfThreads(getNbOfThreads());
+        if (nbOfThreads > 1 && (methC == "P0P0" || methC == "P1P0"))
+        {
+            LOG(2, "Computing intersections with " << nbOfThreads << " threads");
+            std::vector<std::unique_ptr<Intersector3D<MyMeshType, MatrixType>>> intersectors(nbOfThreads);
+            intersectors[0] = std::move(intersector);
+            for (unsigned int t = 1; t < nbOfThreads; t++)
+                intersectors[t].reset(buildIntersector<MyMeshType, MatrixType>(srcMesh, targetMesh, methC));
+            // small chunks so that work stealing can balance target cells having many candidates
+            const ConnType grain = std::max(ConnType(1), numTargetElems / ConnType(64 * nbOfThreads));
+            ParallelForChunks(
+                nbOfThreads,
+                ConnType(0),
+                numTargetElems,
+                grain,
+                [&intersectTargetCells, &tree, &intersectors](ConnType bg, ConnType end, unsigned int threadId)
+                { intersectTargetCells(tree, bg, end, *intersectors[threadId]); }
+            );
+            intersector = std::move(intersectors[0]);
+        }
+        else
+            intersectTargetCells(tree, 0, numTargetElems, *intersector);
+    };
 
-        if (!intersectElems.empty())
-            intersector->intersectCells(i, intersectElems, result);
+    // create BBTree structure
+    if (getUseFlatBBTreeStatus())
+    {
+        // The candidates come in Morton order and no longer in the order of BBTree. For P1P0, P0P1 and P1P1, where the
+        // contributions of several cells to a same node are summed, the results can thus differ in the last bits.
+        BBTreeFlat<3, ConnType> tree(BuildBBTreeFlat(srcMesh));
+        intersectAllTargetCells(tree);
+    }
+    else
+    {
+        BBTreeStandAlone<3, ConnType> tree(BuildBBTree(srcMesh));
+        intersectAllTargetCells(tree);
     }
 
 #endif
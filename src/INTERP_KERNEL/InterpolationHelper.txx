@@ -21,6 +21,7 @@
 #pragma once
 
 #include "BBTreeStandAlone.txx"
+#include "BBTreeFlat.txx"
 #include "MeshElement.txx"
 #include "Log.hxx"
 
@@ -73,6 +74,18 @@ BuildBBTree(const MyMeshType &srcMesh)
     );
 }
 
+/*!
+ * Same as BuildBBTree but returns the flat variant of the tree, that owns a copy of the bounding boxes.
+ */
+template <class MyMeshType, int dim = 3>
+BBTreeFlat<dim, typename MyMeshType::MyConnType>
+BuildBBTreeFlat(const MyMeshType &srcMesh)
+{
+    return BuildBBTreeWithAdjustmentGen<MyMeshType, dim, BBTreeFlat<dim, typename MyMeshType::MyConnType>>(
+        srcMesh, [](double *, typename MyMeshType::MyConnType) {}
+    );
+}
+
 template <class MyMeshType, int dim = 3>
 BBTreeClosestStandAlone<dim, typename MyMeshType::MyConnType>
 BuildBBTreeClosest(const MyMeshType &srcMesh)
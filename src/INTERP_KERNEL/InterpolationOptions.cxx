@@ -52,6 +52,10 @@ const char INTERP_KERNEL::InterpolationOptions::ORIENTATION_STR[] = "Orientation
 
 const char INTERP_KERNEL::InterpolationOptions::MEASURE_ABS_STR[] = "MeasureAbs";
 
+const char INTERP_KERNEL::InterpolationOptions::NB_OF_THREADS_STR[] = "NbOfThreads";
+
+const char INTERP_KERNEL::InterpolationOptions::USE_FLAT_BBTREE_STR[] = "UseFlatBBTree";
+
 const char INTERP_KERNEL::InterpolationOptions::INTERSEC_TYPE_STR[] = "IntersectionType";
 
 const char INTERP_KERNEL::InterpolationOptions::SPLITTING_POLICY_STR[] = "SplittingPolicy";
@@ -102,6 +106,8 @@ INTERP_KERNEL::InterpolationOptions::init()
     _orientation = 0;
     _measure_abs = true;
     _splitting_policy = PLANAR_FACE_5;
+    _nb_of_threads = 1;
+    _use_flat_bbtree = false;
 }
 
 std::string
@@ -184,6 +190,16 @@ INTERP_KERNEL::InterpolationOptions::setOptionInt(const std::string &key, int va
         setMeasureAbsStatus(valBool);
         return true;
     }
+    else if (key == NB_OF_THREADS_STR)
+    {
+        setNbOfThreads(value);
+        return true;
+    }
+    else if (key == USE_FLAT_BBTREE_STR)
+    {
+        setUseFlatBBTreeStatus(value != 0);
+        return true;
+    }
     else
         return false;
 }
@@ -320,6 +336,8 @@ INTERP_KERNEL::InterpolationOptions::printOptions() const
     oss << "Orientation : " << _orientation << std::endl;
     oss << "Measure abs : " << _measure_abs << std::endl;
     oss << "Splitting policy : " << getSplittingPolicyRepr() << std::endl;
+    oss << "Nb of threads : " << _nb_of_threads << std::endl;
+    oss << "Use flat BBTree : " << _use_flat_bbtree << std::endl;
     oss << "****************************" << std::endl;
     return oss.str();
 }
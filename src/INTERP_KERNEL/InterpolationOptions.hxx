@@ -98,6 +98,10 @@ class INTERPKERNEL_EXPORT InterpolationOptions : public FEInterpolationOptionsAb
     int _orientation;
     bool _measure_abs;
     SplittingPolicy _splitting_policy;
+    //! number of threads used by the interpolators supporting it. 1 is serial, 0 means all hardware threads.
+    int _nb_of_threads;
+    //! if true the 3D interpolators locate the source cells with BBTreeFlat instead of BBTree
+    bool _use_flat_bbtree;
     FEInterpolationOptions _fe_options;
 
    public:
@@ -139,6 +143,12 @@ class INTERPKERNEL_EXPORT InterpolationOptions : public FEInterpolationOptionsAb
     bool getMeasureAbsStatus() const { return _measure_abs; }
     void setMeasureAbsStatus(bool newStatus) { _measure_abs = newStatus; }
 
+    int getNbOfThreads() const { return _nb_of_threads; }
+    void setNbOfThreads(int nbOfThreads) { _nb_of_threads = nbOfThreads; }
+
+    bool getUseFlatBBTreeStatus() const { return _use_flat_bbtree; }
+    void setUseFlatBBTreeStatus(bool newStatus) { _use_flat_bbtree = newStatus; }
+
     // FE part
 
     const FEInterpolationOptions &getFEOptions() const { return _fe_options; }
@@ -204,6 +214,8 @@ class INTERPKERNEL_EXPORT InterpolationOptions : public FEInterpolationOptionsAb
     static const char DO_ROTATE_STR[];
     static const char ORIENTATION_STR[];
     static const char MEASURE_ABS_STR[];
+    static const char NB_OF_THREADS_STR[];
+    static const char USE_FLAT_BBTREE_STR[];
     static const char INTERSEC_TYPE_STR[];
     static const char SPLITTING_POLICY_STR[];
     static const char TRIANGULATION_INTERSECT2D_STR[];
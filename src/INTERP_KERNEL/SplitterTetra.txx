@@ -1379,7 +1379,7 @@ SplitterTetra2<MyMeshTypeT, MyMeshTypeS>::splitConvex(
     unsigned nbOfSons = cellModelCell.getNumberOfSons2(rawCellConn, rawNbCellNodes);
 
     // indices of nodes of a son
-    static std::vector<ConnType> allNodeIndices;  // == 0,1,2,...,nbOfCellNodes-1
+    thread_local std::vector<ConnType> allNodeIndices;  // == 0,1,2,...,nbOfCellNodes-1
     while (allNodeIndices.size() < (std::size_t)nbOfCellNodes)
         allNodeIndices.push_back(static_cast<ConnType>(allNodeIndices.size()));
     std::vector<ConnType> classicFaceNodes(4);
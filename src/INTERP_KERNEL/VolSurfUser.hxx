@@ -48,6 +48,30 @@ computeBarycenter2(
     NormalizedCellType type, const ConnType *connec, mcIdType lgth, const double *coords, int spaceDim, double *res
 );
 
+template <class ConnType, NumberingPolicy numPolConn>
+bool
+computeVolSurfOfCellsOfType(
+    NormalizedCellType type,
+    const ConnType *connec,
+    mcIdType stride,
+    mcIdType nbOfCells,
+    const double *coords,
+    int spaceDim,
+    double *res
+);
+
+template <class ConnType, NumberingPolicy numPolConn>
+bool
+computeBarycenterOfCellsOfType(
+    NormalizedCellType type,
+    const ConnType *connec,
+    mcIdType stride,
+    mcIdType nbOfCells,
+    const double *coords,
+    int spaceDim,
+    double *res
+);
+
 double INTERPKERNEL_EXPORT
 OrthoDistanceFromPtToPlaneInSpaceDim3(const double *p, const double *p1, const double *p2, const double *p3);
 
@@ -607,6 +607,298 @@ computeBarycenter2(
     throw INTERP_KERNEL::Exception("Invalid spaceDim specified for compute barycenter : must be 1, 2 or 3");
 }
 
+/*!
+ * Measure of a linear cell of type \a TYPE, whose \a NB_OF_NODES nodes have been gathered in a contiguous array of
+ * \a SPACEDIM doubles per node. Only the types having a fixed number of nodes and a closed formula are specialized.
+ */
+template <NormalizedCellType TYPE>
+class GatheredCellVolSurf
+{
+};
+
+template <>
+class GatheredCellVolSurf<NORM_SEG2>
+{
+   public:
+    static const int NB_OF_NODES = 2;
+    template <int SPACEDIM>
+    static double compute(const double *pts)
+    {
+        return calculateLgthForSeg2(pts, pts + SPACEDIM, SPACEDIM);
+    }
+};
+
+template <>
+class GatheredCellVolSurf<NORM_TRI3>
+{
+   public:
+    static const int NB_OF_NODES = 3;
+    template <int SPACEDIM>
+    static double compute(const double *pts)
+    {
+        return calculateAreaForTria(pts, pts + SPACEDIM, pts + 2 * SPACEDIM, SPACEDIM);
+    }
+};
+
+template <>
+class GatheredCellVolSurf<NORM_QUAD4>
+{
+   public:
+    static const int NB_OF_NODES = 4;
+    template <int SPACEDIM>
+    static double compute(const double *pts)
+    {
+        return calculateAreaForQuad(pts, pts + SPACEDIM, pts + 2 * SPACEDIM, pts + 3 * SPACEDIM, SPACEDIM);
+    }
+};
+
+template <>
+class GatheredCellVolSurf<NORM_TETRA4>
+{
+   public:
+    static const int NB_OF_NODES = 4;
+    template <int SPACEDIM>
+    static double compute(const double *pts)
+    {
+        return calculateVolumeForTetra(pts, pts + SPACEDIM, pts + 2 * SPACEDIM, pts + 3 * SPACEDIM);
+    }
+};
+
+template <>
+class GatheredCellVolSurf<NORM_PYRA5>
+{
+   public:
+    static const int NB_OF_NODES = 5;
+    template <int SPACEDIM>
+    static double compute(const double *pts)
+    {
+        return calculateVolumeForPyra(
+            pts, pts + SPACEDIM, pts + 2 * SPACEDIM, pts + 3 * SPACEDIM, pts + 4 * SPACEDIM
+        );
+    }
+};
+
+template <>
+class GatheredCellVolSurf<NORM_PENTA6>
+{
+   public:
+    static const int NB_OF_NODES = 6;
+    template <int SPACEDIM>
+    static double compute(const double *pts)
+    {
+        return calculateVolumeForPenta(
+            pts, pts + SPACEDIM, pts + 2 * SPACEDIM, pts + 3 * SPACEDIM, pts + 4 * SPACEDIM, pts + 5 * SPACEDIM
+        );
+    }
+};
+
+template <>
+class GatheredCellVolSurf<NORM_HEXA8>
+{
+   public:
+    static const int NB_OF_NODES = 8;
+    template <int SPACEDIM>
+    static double compute(const double *pts)
+    {
+        return calculateVolumeForHexa(
+            pts,
+            pts + SPACEDIM,
+            pts + 2 * SPACEDIM,
+            pts + 3 * SPACEDIM,
+            pts + 4 * SPACEDIM,
+            pts + 5 * SPACEDIM,
+            pts + 6 * SPACEDIM,
+            pts + 7 * SPACEDIM
+        );
+    }
+};
+
+/*!
+ * Copies the coordinates of the \a NB_OF_NODES nodes of \a connec into \a pts. The trip counts being known at compile
+ * time, the loops are unrolled and the gather can be vectorized.
+ */
+template <int NB_OF_NODES, int SPACEDIM, class ConnType, NumberingPolicy numPol>
+inline void
+gatherNodesOfCell(const ConnType *connec, const double *coords, double *pts)
+{
+    for (int i = 0; i < NB_OF_NODES; i++)
+    {
+        const double *pt(coords + SPACEDIM * OTT<ConnType, numPol>::coo2C(connec[i]));
+        for (int j = 0; j < SPACEDIM; j++) pts[SPACEDIM * i + j] = pt[j];
+    }
+}
+
+template <NormalizedCellType TYPE, int SPACEDIM, class ConnType, NumberingPolicy numPol>
+void
+computeVolSurfOfCellsOfTypeT(
+    const ConnType *connec, mcIdType stride, mcIdType nbOfCells, const double *coords, double *res
+)
+{
+    const int NB_OF_NODES = GatheredCellVolSurf<TYPE>::NB_OF_NODES;
+    double pts[NB_OF_NODES * SPACEDIM];
+    for (mcIdType i = 0; i < nbOfCells; i++, connec += stride)
+    {
+        gatherNodesOfCell<NB_OF_NODES, SPACEDIM, ConnType, numPol>(connec, coords, pts);
+        res[i] = GatheredCellVolSurf<TYPE>::template compute<SPACEDIM>(pts);
+    }
+}
+
+template <NormalizedCellType TYPE, int SPACEDIM, class ConnType, NumberingPolicy numPol>
+void
+computeBarycenterOfCellsOfTypeT(
+    const ConnType *connec, mcIdType stride, mcIdType nbOfCells, const double *coords, double *res
+)
+{
+    const int NB_OF_NODES = GatheredCellVolSurf<TYPE>::NB_OF_NODES;
+    for (mcIdType i = 0; i < nbOfCells; i++, connec += stride, res += SPACEDIM)
+        computeBarycenter<ConnType, numPol, SPACEDIM>(TYPE, connec, NB_OF_NODES, coords, res);
+}
+
+/*!
+ * Calls \a caller.run<TYPE>() with \a type as template parameter. Returns false, without calling it, if there is no
+ * specialized kernel for \a type in \a SPACEDIM.
+ */
+template <int SPACEDIM, class KERNELCALLER>
+bool
+dispatchCellsOfType(NormalizedCellType type, KERNELCALLER caller)
+{
+    switch (type)
+    {
+        case NORM_SEG2:
+            caller.template run<NORM_SEG2>();
+            return true;
+        case NORM_TRI3:
+            if (SPACEDIM == 1)
+                return false;
+            caller.template run<NORM_TRI3>();
+            return true;
+        case NORM_QUAD4:
+            if (SPACEDIM == 1)
+                return false;
+            caller.template run<NORM_QUAD4>();
+            return true;
+        case NORM_TETRA4:
+            if (SPACEDIM != 3)
+                return false;
+            caller.template run<NORM_TETRA4>();
+            return true;
+        case NORM_PYRA5:
+            if (SPACEDIM != 3)
+                return false;
+            caller.template run<NORM_PYRA5>();
+            return true;
+        case NORM_PENTA6:
+            if (SPACEDIM != 3)
+                return false;
+            caller.template run<NORM_PENTA6>();
+            return true;
+        case NORM_HEXA8:
+            if (SPACEDIM != 3)
+                return false;
+            caller.template run<NORM_HEXA8>();
+            return true;
+        default:
+            return false;
+    }
+}
+
+template <int SPACEDIM, class ConnType, NumberingPolicy numPol, bool BARYCENTER>
+class CellsOfTypeKernelCaller
+{
+   public:
+    CellsOfTypeKernelCaller(
+        const ConnType *connec, mcIdType stride, mcIdType nbOfCells, const double *coords, double *res
+    )
+        : _connec(connec), _stride(stride), _nb_of_cells(nbOfCells), _coords(coords), _res(res)
+    {
+    }
+    template <NormalizedCellType TYPE>
+    void run() const
+    {
+        if (BARYCENTER)
+            computeBarycenterOfCellsOfTypeT<TYPE, SPACEDIM, ConnType, numPol>(
+                _connec, _stride, _nb_of_cells, _coords, _res
+            );
+        else
+            computeVolSurfOfCellsOfTypeT<TYPE, SPACEDIM, ConnType, numPol>(
+                _connec, _stride, _nb_of_cells, _coords, _res
+            );
+    }
+
+   private:
+    const ConnType *_connec;
+    mcIdType _stride;
+    mcIdType _nb_of_cells;
+    const double *_coords;
+    double *_res;
+};
+
+/*!
+ * Batched version of computeVolSurfOfCell2 for \a nbOfCells cells of the same type \a type, the nodes of the i-th cell
+ * starting at \a connec + i * \a stride. Each (type, space dimension) has its own kernel, which gathers the
+ * coordinates of the nodes of a cell before applying the formula of computeVolSurfOfCell : the results are the same.
+ * \return false if there is no such kernel for \a type and \a spaceDim, \a res being left untouched. The caller
+ *         has then to fall back on computeVolSurfOfCell2.
+ */
+template <class ConnType, NumberingPolicy numPolConn>
+bool
+computeVolSurfOfCellsOfType(
+    NormalizedCellType type,
+    const ConnType *connec,
+    mcIdType stride,
+    mcIdType nbOfCells,
+    const double *coords,
+    int spaceDim,
+    double *res
+)
+{
+    if (spaceDim == 3)
+        return dispatchCellsOfType<3>(
+            type, CellsOfTypeKernelCaller<3, ConnType, numPolConn, false>(connec, stride, nbOfCells, coords, res)
+        );
+    if (spaceDim == 2)
+        return dispatchCellsOfType<2>(
+            type, CellsOfTypeKernelCaller<2, ConnType, numPolConn, false>(connec, stride, nbOfCells, coords, res)
+        );
+    if (spaceDim == 1)
+        return dispatchCellsOfType<1>(
+            type, CellsOfTypeKernelCaller<1, ConnType, numPolConn, false>(connec, stride, nbOfCells, coords, res)
+        );
+    return false;
+}
+
+/*!
+ * Batched version of computeBarycenter2, see computeVolSurfOfCellsOfType. Here the kernels do not gather the nodes :
+ * the type being a template parameter, the formula of computeBarycenter is selected once per call and not per cell.
+ * \a res is filled with \a spaceDim values per cell.
+ */
+template <class ConnType, NumberingPolicy numPolConn>
+bool
+computeBarycenterOfCellsOfType(
+    NormalizedCellType type,
+    const ConnType *connec,
+    mcIdType stride,
+    mcIdType nbOfCells,
+    const double *coords,
+    int spaceDim,
+    double *res
+)
+{
+    if (spaceDim == 3)
+        return dispatchCellsOfType<3>(
+            type, CellsOfTypeKernelCaller<3, ConnType, numPolConn, true>(connec, stride, nbOfCells, coords, res)
+        );
+    if (spaceDim == 2)
+        return dispatchCellsOfType<2>(
+            type, CellsOfTypeKernelCaller<2, ConnType, numPolConn, true>(connec, stride, nbOfCells, coords, res)
+        );
+    if (spaceDim == 1)
+        return dispatchCellsOfType<1>(
+            type, CellsOfTypeKernelCaller<1, ConnType, numPolConn, true>(connec, stride, nbOfCells, coords, res)
+        );
+    return false;
+}
+
 template <int SPACEDIM>
 void
 ComputeTriangleHeight(const double *PA, const double *PB, const double *PC, double *res)
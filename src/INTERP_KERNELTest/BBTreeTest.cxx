@@ -20,6 +20,7 @@
 #include "BBTreeTest.hxx"
 #include <iostream>
 #include <vector>
+#include <algorithm>
 #include "DirectedBoundingBox.hxx"
 
 namespace INTERP_TEST
@@ -85,6 +86,87 @@ BBTreeTest::test_BBTree()
     delete[] bbox;
 }
 
+/**
+ * Same requests as test_BBTree on the flat variant, then checks on a bigger 3D grid of overlapping boxes, restricted to
+ * a subset of the elements, that the flat tree returns the same elements as BBTree.
+ */
+void
+BBTreeTest::test_BBTreeFlat()
+{
+    const int N = 10;
+    std::vector<double> bbox(4 * N * N);
+    for (int i = 0; i < N; i++)
+        for (int j = 0; j < N; j++)
+        {
+            bbox[4 * (i * N + j)] = i;
+            bbox[4 * (i * N + j) + 1] = i + 1;
+            bbox[4 * (i * N + j) + 2] = j;
+            bbox[4 * (i * N + j) + 3] = j + 1;
+        }
+    BBTreeFlat<2> tree(bbox.data(), 0, 0, N * N);
+    std::vector<int> elems;
+    double bbox1[4] = {-2.0, -1.0, 0.0, 1.0};
+    tree.getIntersectingElems(bbox1, elems);
+    CPPUNIT_ASSERT_EQUAL(0, (int)elems.size());
+    elems.clear();
+    double bbox2[4] = {2.5, 3.5, 0.5, 1.5};
+    tree.getIntersectingElems(bbox2, elems);
+    CPPUNIT_ASSERT_EQUAL(4, (int)elems.size());
+    CPPUNIT_ASSERT_EQUAL(4, tree.getNbOfIntersectingElems(bbox2));
+    elems.clear();
+    double bbox3[4] = {5.0, 6.0, 7.0, 9.0};
+    tree.getIntersectingElems(bbox3, elems);
+    CPPUNIT_ASSERT_EQUAL(2, (int)elems.size());
+    elems.clear();
+    double xx[2] = {1.0, 1.0};
+    tree.getElementsAroundPoint(xx, elems);
+    std::sort(elems.begin(), elems.end());
+    CPPUNIT_ASSERT(elems == std::vector<int>({0, 1, 10, 11}));
+
+    // 3D : cubes of size 1.5 with a step of 1, so that each cube overlaps its neighbours
+    const int M = 12;
+    std::vector<double> bbox3D(6 * M * M * M);
+    std::vector<int> subset;
+    for (int i = 0; i < M * M * M; i++)
+    {
+        int ijk[3] = {i % M, (i / M) % M, i / (M * M)};
+        for (int d = 0; d < 3; d++)
+        {
+            bbox3D[6 * i + 2 * d] = ijk[d];
+            bbox3D[6 * i + 2 * d + 1] = ijk[d] + 1.5;
+        }
+        if (i % 3 != 1)
+            subset.push_back(i);
+    }
+    BBTree<3> ref(bbox3D.data(), subset.data(), 0, (int)subset.size(), -1e-12);
+    BBTreeFlat<3> flat(bbox3D.data(), subset.data(), 0, (int)subset.size(), -1e-12);
+    std::vector<int> elemsRef, elemsFlat;
+    for (int q = 0; q < 100; q++)
+    {
+        double bb[6], pt[3];
+        for (int d = 0; d < 3; d++)
+        {
+            bb[2 * d] = ((q * (d + 3) * 7) % 130) / 10. - 0.5;
+            bb[2 * d + 1] = bb[2 * d] + (q % 4) * 0.5;
+            pt[d] = ((q * (d + 5) * 11) % 135) / 10. - 0.25;
+        }
+        elemsRef.clear();
+        elemsFlat.clear();
+        ref.getIntersectingElems(bb, elemsRef);
+        flat.getIntersectingElems(bb, elemsFlat);
+        std::sort(elemsRef.begin(), elemsRef.end());
+        std::sort(elemsFlat.begin(), elemsFlat.end());
+        CPPUNIT_ASSERT(elemsRef == elemsFlat);
+        elemsRef.clear();
+        elemsFlat.clear();
+        ref.getElementsAroundPoint(pt, elemsRef);
+        flat.getElementsAroundPoint(pt, elemsFlat);
+        std::sort(elemsRef.begin(), elemsRef.end());
+        std::sort(elemsFlat.begin(), elemsFlat.end());
+        CPPUNIT_ASSERT(elemsRef == elemsFlat);
+    }
+}
+
 void
 BBTreeTest::test_DirectedBB_3D()
 {
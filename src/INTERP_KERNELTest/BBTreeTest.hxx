@@ -24,6 +24,7 @@
 
 #include "InterpKernelTestExport.hxx"
 #include "BBTree.txx"
+#include "BBTreeFlat.txx"
 
 namespace INTERP_TEST
 {
@@ -36,6 +37,7 @@ class INTERPKERNELTEST_EXPORT BBTreeTest : public CppUnit::TestFixture
 {
     CPPUNIT_TEST_SUITE(BBTreeTest);
     CPPUNIT_TEST(test_BBTree);
+    CPPUNIT_TEST(test_BBTreeFlat);
     CPPUNIT_TEST(test_DirectedBB_1D);
     CPPUNIT_TEST(test_DirectedBB_2D);
     CPPUNIT_TEST(test_DirectedBB_3D);
@@ -48,6 +50,7 @@ class INTERPKERNELTEST_EXPORT BBTreeTest : public CppUnit::TestFixture
 
     // tests
     void test_BBTree();
+    void test_BBTreeFlat();
     void test_DirectedBB_1D();
     void test_DirectedBB_2D();
     void test_DirectedBB_3D();
@@ -725,3 +725,57 @@ ExprEvalInterpTest::testInterpreter6()
     CPPUNIT_ASSERT_EQUAL(1, (int)stackOfVal.size());
     CPPUNIT_ASSERT_DOUBLES_EQUAL(13.333333333333333, stackOfVal.back(), 1e-14);
 }
+
+/*!
+ * Test focusing on block evaluator : results must be the same than the fast evaluator, tuple by tuple.
+ */
+void
+ExprEvalInterpTest::testInterpreter7()
+{
+    const char *exprs[] = {"x", "3.5", "x*x/2", "1.2/(7.-2.*cos(x/3))", "if(x>0.5,-6,7.)", "max(x,y)-min(y,2.)",
+                           "x*IVec-2*cos(y/3.)*JVec", "(x+2)^y", "-x+(+y)", "sqrt(x)+y"};
+    const std::size_t nbOfTuples(1000);  // more than 3 blocks, not a multiple of the block size
+    std::vector<double> input(2 * nbOfTuples);
+    for (std::size_t i = 0; i < 2 * nbOfTuples; i++) input[i] = 0.01 * (double)i - 3. * (double)(i % 2);
+    std::vector<std::string> vv(2);
+    vv[0] = "x";
+    vv[1] = "y";
+    double aa[2];
+    std::vector<double> stackOfVal;
+    for (std::size_t i = 0; i < sizeof(exprs) / sizeof(exprs[0]); i++)
+    {
+        INTERP_KERNEL::ExprParser expr(exprs[i]);
+        expr.parse();
+        expr.prepareExprEvaluationDouble(vv, 2, 2, 1, aa, aa + 2);
+        expr.prepareFastEvaluator();
+        INTERP_KERNEL::ExprParserOfBlockEval blockEval(expr);
+        std::vector<double> res(nbOfTuples), resMT(nbOfTuples);
+        blockEval.evaluate(nbOfTuples, &input[0], 2, &res[0], 1, 1);
+        blockEval.evaluate(nbOfTuples, &input[0], 2, &resMT[0], 1, 3);
+        for (std::size_t j = 0; j < nbOfTuples; j++)
+        {
+            std::copy(&input[2 * j], &input[2 * j] + 2, aa);
+            stackOfVal.clear();
+            expr.evaluateDoubleInternal(stackOfVal);
+            CPPUNIT_ASSERT_EQUAL(stackOfVal.back(), res[j]);
+            CPPUNIT_ASSERT_EQUAL(stackOfVal.back(), resMT[j]);
+        }
+    }
+    // safe mode : the first failing tuple is reported, whatever the number of threads
+    INTERP_KERNEL::ExprParser expr("sqrt(7.005-x)+1./(y+2.)");
+    expr.parse();
+    expr.prepareExprEvaluationDouble(vv, 2, 1, 0, aa, aa + 2);
+    INTERP_KERNEL::ExprParserOfBlockEval blockEval(expr);
+    std::vector<double> res(nbOfTuples);
+    std::string errMsg;
+    CPPUNIT_ASSERT_EQUAL(std::size_t(351), blockEval.evaluateSafe(nbOfTuples, &input[0], 2, &res[0], 1, 1, errMsg));
+    CPPUNIT_ASSERT_EQUAL(std::string("sqrt on a value < 0. !"), errMsg);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(351), blockEval.evaluateSafe(nbOfTuples, &input[0], 2, &res[0], 1, 4, errMsg));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(150), blockEval.evaluateSafe(150, &input[0], 2, &res[0], 1, 1, errMsg));
+    INTERP_KERNEL::ExprParser expr2("y+1./x");
+    expr2.parse();
+    expr2.prepareExprEvaluationDouble(vv, 2, 1, 0, aa, aa + 2);
+    INTERP_KERNEL::ExprParserOfBlockEval blockEval2(expr2);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), blockEval2.evaluateSafe(nbOfTuples, &input[0], 2, &res[0], 1, 2, errMsg));
+    CPPUNIT_ASSERT_EQUAL(std::string("division by 0. !"), errMsg);
+}
@@ -41,6 +41,7 @@ class INTERPKERNELTEST_EXPORT ExprEvalInterpTest : public CppUnit::TestFixture
     CPPUNIT_TEST(testInterpreter4);
     CPPUNIT_TEST(testInterpreter5);
     CPPUNIT_TEST(testInterpreter6);
+    CPPUNIT_TEST(testInterpreter7);
     CPPUNIT_TEST_SUITE_END();
 
    public:
@@ -56,6 +57,7 @@ class INTERPKERNELTEST_EXPORT ExprEvalInterpTest : public CppUnit::TestFixture
     void testInterpreter4();
     void testInterpreter5();
     void testInterpreter6();
+    void testInterpreter7();
     void testInterpreterUnit0();
     void testInterpreterUnit1();
 };
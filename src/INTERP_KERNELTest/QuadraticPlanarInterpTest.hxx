@@ -111,6 +111,7 @@ class INTERPKERNELTEST_EXPORT QuadraticPlanarInterpTest : public CppUnit::TestFi
     CPPUNIT_TEST(checkGetMiddleOfPoints);
     CPPUNIT_TEST(checkGetMiddleOfPointsOriented);
     CPPUNIT_TEST(checkArcArcIntersection1);
+    CPPUNIT_TEST(checkLinearPolygonIntersector);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -206,6 +207,7 @@ class INTERPKERNELTEST_EXPORT QuadraticPlanarInterpTest : public CppUnit::TestFi
     void checkGetMiddleOfPoints();
     void checkGetMiddleOfPointsOriented();
     void checkArcArcIntersection1();
+    void checkLinearPolygonIntersector();
 
    private:
     INTERP_KERNEL::QuadraticPolygon *buildQuadraticPolygonCoarseInfo(const double *coords, const int *conn, int lgth);
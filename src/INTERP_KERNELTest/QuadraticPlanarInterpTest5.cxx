@@ -23,6 +23,7 @@
 #include "InterpKernelGeo2DElementaryEdge.hxx"
 #include "InterpKernelGeo2DEdgeArcCircle.hxx"
 #include "InterpKernelGeo2DEdgeLin.hxx"
+#include "InterpKernelGeo2DLinearPolygonIntersector.hxx"
 
 #include <cmath>
 #include <sstream>
@@ -2264,4 +2265,77 @@ QuadraticPlanarInterpTest::checkGetMiddleOfPointsOriented()
     }
 }
 
+/*!
+ * LinearPolygonIntersector is expected to give the same areas and barycenters as QuadraticPolygon, including when the
+ * polygons share edges or nodes, or are not oriented the same way.
+ */
+void
+QuadraticPlanarInterpTest::checkLinearPolygonIntersector()
+{
+    INTERP_KERNEL::QuadraticPlanarPrecision::setPrecision(1e-12);
+    const double square[8] = {0., 0., 1., 0., 1., 1., 0., 1.};
+    const std::vector<std::vector<double> > others = {
+        {0., 0., 1., 0., 1., 1., 0., 1.},                   // identical
+        {1., 0., 2., 0., 2., 1., 1., 1.},                   // common edge
+        {1., 1., 2., 1., 2., 2., 1., 2.},                   // common node
+        {0.5, 0., 1.5, 0., 1.5, 1., 0.5, 1.},               // overlapping edges
+        {0.2, 0., 0.7, 0., 0.7, 0.5, 0.2, 0.5},             // part of an edge
+        {0.2, 0.2, 0.7, 0.2, 0.7, 0.5, 0.2, 0.5},           // inside
+        {0.5, 0.5, 0.5, 1.5, 1.5, 1.5, 1.5, 0.5},           // clockwise
+        {0.5, -0.5, 1.5, 0.5, 0.5, 1.5, -0.5, 0.5},         // crossing
+        {-1., -1., 2., -1., 2., 2., -1., 2.},               // containing
+        {0., 0., 2., 0., 2., 1., 1., 1., 1., 2., 0., 2.}};  // non convex
+    LinearPolygonIntersector intersector;
+    for (const std::vector<double> &other : others)
+    {
+        std::vector<Node *> nodes1, nodes2;
+        for (int i = 0; i < 4; i++) nodes1.push_back(new Node(square[2 * i], square[2 * i + 1]));
+        for (std::size_t i = 0; i < other.size() / 2; i++) nodes2.push_back(new Node(other[2 * i], other[2 * i + 1]));
+        QuadraticPolygon *pol1(QuadraticPolygon::BuildLinearPolygon(nodes1));
+        QuadraticPolygon *pol2(QuadraticPolygon::BuildLinearPolygon(nodes2));
+        double bary[2], baryRef[2];
+        double areaRef(pol1->intersectWithAbs(*pol2, baryRef));
+        delete pol1;
+        delete pol2;
+        double area(intersector.intersectWithAbs(square, 4, other.data(), other.size() / 2, 2, bary));
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(areaRef, area, 1e-14);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(baryRef[0], bary[0], 1e-14);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(baryRef[1], bary[1], 1e-14);
+    }
+    // degenerate pairs, checked against the exact intersection : QuadraticPolygon may differ here
+    struct DegenerateCase
+    {
+        std::vector<double> coords;
+        double area, baryX, baryY;
+    };
+    const std::vector<DegenerateCase> degenerates = {
+        {{0., 0., 1., 0.5, 0.5, 1.}, 0.375, 0.5, 0.5},                              // shared node, inside
+        {{0., 0., 1., 0., 1., 1.}, 0.5, 2. / 3., 1. / 3.},                          // two shared nodes
+        {{0., 0., -1., 0., -1., -1.}, 0., 0., 0.},                                  // shared node, outside
+        {{0.5, 0., 1.5, -1., 1.5, 1.}, 0.125, 5. / 6., 1. / 6.},                    // node on an edge
+        {{0.25, 0., 0.75, 0., 0.5, 0.5}, 0.125, 0.5, 1. / 6.},                      // colinear, part of an edge
+        {{-0.5, 0., 0.5, 0., 0., 0.5}, 0.125, 1. / 6., 1. / 6.},                    // colinear, beyond a node
+        {{0.25, 0., 0.5, -0.5, 0.75, 0.}, 0., 0., 0.},                              // colinear, outside
+        {{0.5, 0., 1., 0., 1.5, 0., 1.5, 1., 1., 1., 0.5, 1.}, 0.5, 0.75, 0.5},     // overlapping edges, with nodes
+        {{0., 0., 0.5, 0., 1., 0., 1., 0.5, 1., 1., 0., 1.}, 1., 0.5, 0.5},         // identical, more nodes
+        {{0.5, 0.5, 1.5, 0.5, 1.5, 0.5, 0.5, 1.5}, 0.25, 0.75, 0.75},               // repeated node
+        {{0., 0.5, 1., 0.5, 1., 0.5, 0., 0.5}, 0., 0., 0.},                         // flat
+        {{1. + 1e-13, 0., 2., 0., 2., 1., 1. - 1e-13, 1.}, 0., 0., 0.},             // almost a common edge
+        {{0.5, 1e-13, 1.5, -1., 1.5, 1.}, 0.125, 5. / 6., 1. / 6.}};                // node almost on an edge
+    for (const DegenerateCase &degenerate : degenerates)
+    {
+        double bary[2];
+        double area(intersector.intersectWithAbs(
+            square, 4, degenerate.coords.data(), degenerate.coords.size() / 2, 2, bary
+        ));
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(degenerate.area, area, 1e-12);
+        if (degenerate.area > 0.)
+        {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(degenerate.baryX, bary[0], 1e-12);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(degenerate.baryY, bary[1], 1e-12);
+        }
+    }
+    INTERP_KERNEL::QuadraticPlanarPrecision::setPrecision(1e-14);
+}
+
 }  // namespace INTERP_TEST
@@ -28,6 +28,7 @@
 #include "OrientationInverter.hxx"
 #include "InterpKernelAutoPtr.hxx"
 #include "VolSurfUser.txx"
+#include "InterpKernelThreadPool.hxx"
 
 using namespace MEDCoupling;
 
@@ -311,11 +312,14 @@ MEDCoupling1GTUMesh::checkTypeConsistencyAndContig(
 
 void
 MEDCoupling1GTUMesh::writeVTKLL(
-    std::ostream &ofs, const std::string &cellData, const std::string &pointData, DataArrayByte *byteData
+    std::ostream &ofs,
+    const std::string &cellData,
+    const std::string &pointData,
+    MEDCouplingVTKAppendedData *appendedData
 ) const
 {
     MCAuto<MEDCouplingUMesh> m = buildUnstructured();
-    m->writeVTKLL(ofs, cellData, pointData, byteData);
+    m->writeVTKLL(ofs, cellData, pointData, appendedData);
 }
 
 std::string
@@ -1103,6 +1107,98 @@ MEDCoupling1SGTUMesh::computeIsoBarycenterOfNodesPerCell() const
     return ret.retn();
 }
 
+/*!
+ * Same as MEDCouplingUMesh::computeCellCenterOfMass, without building the unstructured mesh if the geometric type of
+ * \a this has a batched kernel (see INTERP_KERNEL::computeBarycenterOfCellsOfType). The cells are then split among the
+ * threads allowed by MEDCouplingGetNbOfThreads.
+ */
+DataArrayDouble *
+MEDCoupling1SGTUMesh::computeCellCenterOfMass() const
+{
+    checkFullyDefined();
+    const mcIdType GRAIN = 4096;
+    int spaceDim(getSpaceDimension());
+    mcIdType nbOfCells(getNumberOfCells()), nbOfNodesPerCell(getNumberOfNodesPerCell());
+    const mcIdType *conn(_conn->begin());
+    const double *coords(_coords->begin());
+    MCAuto<DataArrayDouble> ret(DataArrayDouble::New());
+    ret->alloc(nbOfCells, spaceDim);
+    ret->copyStringInfoFrom(*getCoords());
+    double *retPtr(ret->getPointer());
+    // an empty range tells if there is a kernel for the type of this
+    if (!INTERP_KERNEL::computeBarycenterOfCellsOfType<mcIdType, INTERP_KERNEL::ALL_C_MODE>(
+            getCellModelEnum(), conn, nbOfNodesPerCell, 0, coords, spaceDim, retPtr
+        ))
+        return MEDCoupling1GTUMesh::computeCellCenterOfMass();
+    INTERP_KERNEL::ParallelForChunks(
+        INTERP_KERNEL::GetEffectiveNbOfThreads(MEDCouplingGetNbOfThreads()),
+        mcIdType(0),
+        nbOfCells,
+        GRAIN,
+        [&](mcIdType bg, mcIdType end, unsigned int)
+        {
+            INTERP_KERNEL::computeBarycenterOfCellsOfType<mcIdType, INTERP_KERNEL::ALL_C_MODE>(
+                getCellModelEnum(),
+                conn + bg * nbOfNodesPerCell,
+                nbOfNodesPerCell,
+                end - bg,
+                coords,
+                spaceDim,
+                retPtr + bg * spaceDim
+            );
+        }
+    );
+    return ret.retn();
+}
+
+/*!
+ * Same as MEDCouplingUMesh::getMeasureField, without building the unstructured mesh if the geometric type of \a this
+ * has a batched kernel (see INTERP_KERNEL::computeVolSurfOfCellsOfType).
+ */
+MEDCouplingFieldDouble *
+MEDCoupling1SGTUMesh::getMeasureField(bool isAbs) const
+{
+    checkFullyDefined();
+    const mcIdType GRAIN = 4096;
+    int spaceDim(getSpaceDimension());
+    mcIdType nbOfCells(getNumberOfCells()), nbOfNodesPerCell(getNumberOfNodesPerCell());
+    const mcIdType *conn(_conn->begin());
+    const double *coords(_coords->begin());
+    MCAuto<DataArrayDouble> arr(DataArrayDouble::New());
+    arr->alloc(nbOfCells, 1);
+    double *arrPtr(arr->getPointer());
+    if (!INTERP_KERNEL::computeVolSurfOfCellsOfType<mcIdType, INTERP_KERNEL::ALL_C_MODE>(
+            getCellModelEnum(), conn, nbOfNodesPerCell, 0, coords, spaceDim, arrPtr
+        ))
+        return MEDCoupling1GTUMesh::getMeasureField(isAbs);
+    INTERP_KERNEL::ParallelForChunks(
+        INTERP_KERNEL::GetEffectiveNbOfThreads(MEDCouplingGetNbOfThreads()),
+        mcIdType(0),
+        nbOfCells,
+        GRAIN,
+        [&](mcIdType bg, mcIdType end, unsigned int)
+        {
+            INTERP_KERNEL::computeVolSurfOfCellsOfType<mcIdType, INTERP_KERNEL::ALL_C_MODE>(
+                getCellModelEnum(),
+                conn + bg * nbOfNodesPerCell,
+                nbOfNodesPerCell,
+                end - bg,
+                coords,
+                spaceDim,
+                arrPtr + bg
+            );
+            if (isAbs)
+                std::transform(arrPtr + bg, arrPtr + end, arrPtr + bg, [](double c) { return fabs(c); });
+        }
+    );
+    MCAuto<MEDCouplingFieldDouble> ret(MEDCouplingFieldDouble::New(ON_CELLS, ONE_TIME));
+    ret->setName(std::string("MeasureOfMesh_") + getName());
+    ret->setArray(arr);
+    ret->setMesh(this);
+    ret->synchronizeTimeWithMesh();
+    return ret.retn();
+}
+
 void
 MEDCoupling1SGTUMesh::renumberCells(const mcIdType *old2NewBg, bool check)
 {
@@ -57,7 +57,10 @@ class MEDCoupling1GTUMesh : public MEDCouplingPointSet
         const std::vector<mcIdType> &code, const std::vector<const DataArrayIdType *> &idsPerType
     ) const;
     MEDCOUPLING_EXPORT void writeVTKLL(
-        std::ostream &ofs, const std::string &cellData, const std::string &pointData, DataArrayByte *byteData
+        std::ostream &ofs,
+        const std::string &cellData,
+        const std::string &pointData,
+        MEDCouplingVTKAppendedData *appendedData
     ) const;
     MEDCOUPLING_EXPORT std::string getVTKDataSetType() const;
     MEDCOUPLING_EXPORT std::string getVTKFileExtension() const;
@@ -167,6 +170,8 @@ class MEDCoupling1SGTUMesh : public MEDCoupling1GTUMesh
     MEDCOUPLING_EXPORT std::string simpleRepr() const;
     MEDCOUPLING_EXPORT std::string advancedRepr() const;
     MEDCOUPLING_EXPORT DataArrayDouble *computeIsoBarycenterOfNodesPerCell() const;
+    MEDCOUPLING_EXPORT DataArrayDouble *computeCellCenterOfMass() const;
+    MEDCOUPLING_EXPORT MEDCouplingFieldDouble *getMeasureField(bool isAbs) const;
     MEDCOUPLING_EXPORT void renumberCells(const mcIdType *old2NewBg, bool check = true);
     MEDCOUPLING_EXPORT MEDCouplingMesh *mergeMyselfWith(const MEDCouplingMesh *other) const;
     MEDCOUPLING_EXPORT MEDCouplingUMesh *buildUnstructured() const;
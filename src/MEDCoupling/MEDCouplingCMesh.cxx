@@ -1079,7 +1079,10 @@ MEDCouplingCMesh::unserialization(
 
 void
 MEDCouplingCMesh::writeVTKLL(
-    std::ostream &ofs, const std::string &cellData, const std::string &pointData, DataArrayByte *byteData
+    std::ostream &ofs,
+    const std::string &cellData,
+    const std::string &pointData,
+    MEDCouplingVTKAppendedData *appendedData
 ) const
 {
     std::ostringstream extent;
@@ -1105,13 +1108,13 @@ MEDCouplingCMesh::writeVTKLL(
     for (int i = 0; i < 3; i++)
     {
         if (thisArr[i])
-            thisArr[i]->writeVTK(ofs, 8, "Array", byteData);
+            thisArr[i]->writeVTK(ofs, 8, "Array", appendedData);
         else
         {
             MCAuto<DataArrayDouble> coo = DataArrayDouble::New();
             coo->alloc(1, 1);
             coo->setIJ(0, 0, 0.);
-            coo->writeVTK(ofs, 8, "Array", byteData);
+            coo->writeVTK(ofs, 8, "Array", appendedData);
         }
     }
     ofs << "      </Coordinates>\n";
@@ -110,7 +110,10 @@ class MEDCouplingCMesh : public MEDCouplingStructuredMesh
     MEDCouplingCMesh(const MEDCouplingCMesh &other, bool deepCpy);
     ~MEDCouplingCMesh();
     void writeVTKLL(
-        std::ostream &ofs, const std::string &cellData, const std::string &pointData, DataArrayByte *byteData
+        std::ostream &ofs,
+        const std::string &cellData,
+        const std::string &pointData,
+        MEDCouplingVTKAppendedData *appendedData
     ) const;
     std::string getVTKDataSetType() const;
 
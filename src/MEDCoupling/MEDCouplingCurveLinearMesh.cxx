@@ -1165,7 +1165,10 @@ MEDCouplingCurveLinearMesh::unserialization(
 
 void
 MEDCouplingCurveLinearMesh::writeVTKLL(
-    std::ostream &ofs, const std::string &cellData, const std::string &pointData, DataArrayByte *byteData
+    std::ostream &ofs,
+    const std::string &cellData,
+    const std::string &pointData,
+    MEDCouplingVTKAppendedData *appendedData
 ) const
 {
     std::ostringstream extent;
@@ -1187,11 +1190,11 @@ MEDCouplingCurveLinearMesh::writeVTKLL(
     ofs << "      </CellData>\n";
     ofs << "      <Points>\n";
     if (getSpaceDimension() == 3)
-        _coords->writeVTK(ofs, 8, "Points", byteData);
+        _coords->writeVTK(ofs, 8, "Points", appendedData);
     else
     {
         MCAuto<DataArrayDouble> coo = _coords->changeNbOfComponents(3, 0.);
-        coo->writeVTK(ofs, 8, "Points", byteData);
+        coo->writeVTK(ofs, 8, "Points", appendedData);
     }
     ofs << "      </Points>\n";
     ofs << "    </Piece>\n";
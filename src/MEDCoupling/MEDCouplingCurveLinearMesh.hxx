@@ -116,7 +116,10 @@ class MEDCouplingCurveLinearMesh : public MEDCouplingStructuredMesh
     MEDCouplingCurveLinearMesh(const MEDCouplingCurveLinearMesh &other, bool deepCpy);
     ~MEDCouplingCurveLinearMesh();
     void writeVTKLL(
-        std::ostream &ofs, const std::string &cellData, const std::string &pointData, DataArrayByte *byteData
+        std::ostream &ofs,
+        const std::string &cellData,
+        const std::string &pointData,
+        MEDCouplingVTKAppendedData *appendedData
     ) const;
     std::string getVTKDataSetType() const;
 
@@ -32,6 +32,7 @@
 #include "MEDCouplingVoronoi.hxx"
 #include "MEDCouplingNatureOfField.hxx"
 #include "MEDCouplingMemArray.txx"
+#include "MEDCouplingVTKWriter.hxx"
 
 #include "InterpKernelAutoPtr.hxx"
 #include "InterpKernelGaussCoords.hxx"
@@ -41,6 +42,7 @@
 #include <limits>
 #include <algorithm>
 #include <functional>
+#include <memory>
 
 using namespace MEDCoupling;
 
@@ -3246,53 +3248,64 @@ MEDCouplingFieldDouble::WriteVTK(
 {
     if (fs.empty())
         return std::string();
+    const MEDCouplingMesh *m(CheckFieldsForVTK(fs));
+    std::string ret(m->getVTKFileNameOf(fileName));
+    std::unique_ptr<MEDCouplingVTKAppendedData> appendedData;
+    if (isBinary)
+        appendedData.reset(new MEDCouplingVTKAppendedData(false));
+    std::ostringstream coss, noss;
+    for (std::vector<const MEDCouplingFieldDouble *>::const_iterator it = fs.begin(); it != fs.end(); it++)
+        (*it)->getArray()->writeVTK(
+            (*it)->getTypeOfField() == ON_CELLS ? coss : noss, 8, (*it)->getName(), appendedData.get()
+        );
+    m->writeVTKAdvanced(ret, coss.str(), noss.str(), appendedData.get());
+    return ret;
+}
+
+/// @cond INTERNAL
+/*!
+ * Checks that the non empty series of fields  fs can be written in a VTK file and returns the mesh they lie on.
+ * \sa WriteVTK
+ */
+const MEDCouplingMesh *
+MEDCouplingFieldDouble::CheckFieldsForVTK(const std::vector<const MEDCouplingFieldDouble *> &fs)
+{
     std::size_t nfs = fs.size();
-    if (!fs[0])
+    if (nfs == 0 || !fs[0])
         throw INTERP_KERNEL::Exception("MEDCouplingFieldDouble::WriteVTK : 1st instance of field is NULL !");
     const MEDCouplingMesh *m = fs[0]->getMesh();
     if (!m)
         throw INTERP_KERNEL::Exception("MEDCouplingFieldDouble::WriteVTK : 1st instance of field lies on NULL mesh !");
     for (std::size_t i = 1; i < nfs; i++)
-        if (fs[i]->getMesh() != m)
+        if (!fs[i] || fs[i]->getMesh() != m)
             throw INTERP_KERNEL::Exception(
                 "MEDCouplingFieldDouble::WriteVTK : Fields are not lying on a same mesh ! Expected by VTK ! "
                 "MEDCouplingFieldDouble::setMesh or MEDCouplingFieldDouble::changeUnderlyingMesh can help to that."
             );
-    if (!m)
-        throw INTERP_KERNEL::Exception(
-            "MEDCouplingFieldDouble::WriteVTK : Fields are lying on a same mesh but it is empty !"
-        );
-    std::string ret(m->getVTKFileNameOf(fileName));
-    MCAuto<DataArrayByte> byteArr;
-    if (isBinary)
-    {
-        byteArr = DataArrayByte::New();
-        byteArr->alloc(0, 1);
-    }
-    std::ostringstream coss, noss;
     for (std::size_t i = 0; i < nfs; i++)
     {
         const MEDCouplingFieldDouble *cur = fs[i];
-        std::string name(cur->getName());
-        if (name.empty())
+        if (cur->getName().empty())
         {
             std::ostringstream oss;
             oss << "MEDCouplingFieldDouble::WriteVTK : Field in pos #" << i << " has no name !";
             throw INTERP_KERNEL::Exception(oss.str());
         }
         TypeOfField typ = cur->getTypeOfField();
-        if (typ == ON_CELLS)
-            cur->getArray()->writeVTK(coss, 8, cur->getName(), byteArr);
-        else if (typ == ON_NODES)
-            cur->getArray()->writeVTK(noss, 8, cur->getName(), byteArr);
-        else
+        if (typ != ON_CELLS && typ != ON_NODES)
             throw INTERP_KERNEL::Exception(
                 "MEDCouplingFieldDouble::WriteVTK : only node and cell fields supported for the moment !"
             );
+        if (!cur->getArray())
+        {
+            std::ostringstream oss;
+            oss << "MEDCouplingFieldDouble::WriteVTK : Field in pos #" << i << " has no array !";
+            throw INTERP_KERNEL::Exception(oss.str());
+        }
     }
-    m->writeVTKAdvanced(ret, coss.str(), noss.str(), byteArr);
-    return ret;
+    return m;
 }
+/// @endcond
 
 MCAuto<MEDCouplingFieldDouble>
 MEDCouplingFieldDouble::voronoizeGen(const Voronizer *vor, double eps) const
@@ -203,6 +203,11 @@ class MEDCouplingFieldDouble : public MEDCouplingFieldT<double>
     MEDCOUPLING_EXPORT static std::string WriteVTK(
         const std::string &fileName, const std::vector<const MEDCouplingFieldDouble *> &fs, bool isBinary = true
     );
+    /// @cond INTERNAL
+    MEDCOUPLING_EXPORT static const MEDCouplingMesh *CheckFieldsForVTK(
+        const std::vector<const MEDCouplingFieldDouble *> &fs
+    );
+    /// @endcond
     std::string getClassName() const override { return std::string("MEDCouplingFieldDouble"); }
 
    public:
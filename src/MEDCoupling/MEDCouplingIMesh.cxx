@@ -1653,7 +1653,10 @@ MEDCouplingIMesh::unserialization(
 
 void
 MEDCouplingIMesh::writeVTKLL(
-    std::ostream &ofs, const std::string &cellData, const std::string &pointData, DataArrayByte *byteData
+    std::ostream &ofs,
+    const std::string &cellData,
+    const std::string &pointData,
+    MEDCouplingVTKAppendedData *appendedData
 ) const
 {
     checkConsistencyLight();
@@ -165,7 +165,10 @@ class MEDCouplingIMesh : public MEDCouplingStructuredMesh
     MEDCouplingIMesh(const MEDCouplingIMesh &other, bool deepCopy);
     ~MEDCouplingIMesh();
     void writeVTKLL(
-        std::ostream &ofs, const std::string &cellData, const std::string &pointData, DataArrayByte *byteData
+        std::ostream &ofs,
+        const std::string &cellData,
+        const std::string &pointData,
+        MEDCouplingVTKAppendedData *appendedData
     ) const;
     std::string getVTKDataSetType() const;
     bool isEqualWithoutConsideringStrInternal(const MEDCouplingMesh *other, double prec, std::string &reason) const;
@@ -1136,11 +1136,14 @@ MEDCouplingMappedExtrudedMesh::unserialization(
 
 void
 MEDCouplingMappedExtrudedMesh::writeVTKLL(
-    std::ostream &ofs, const std::string &cellData, const std::string &pointData, DataArrayByte *byteData
+    std::ostream &ofs,
+    const std::string &cellData,
+    const std::string &pointData,
+    MEDCouplingVTKAppendedData *appendedData
 ) const
 {
     MCAuto<MEDCouplingUMesh> m = buildUnstructured();
-    m->writeVTKLL(ofs, cellData, pointData, byteData);
+    m->writeVTKLL(ofs, cellData, pointData, appendedData);
 }
 
 void
@@ -175,7 +175,10 @@ class MEDCouplingMappedExtrudedMesh : public MEDCouplingMesh
     void computeBaryCenterOfFace(const std::vector<mcIdType> &nodalConnec, mcIdType lev1DId);
     ~MEDCouplingMappedExtrudedMesh();
     void writeVTKLL(
-        std::ostream &ofs, const std::string &cellData, const std::string &pointData, DataArrayByte *byteData
+        std::ostream &ofs,
+        const std::string &cellData,
+        const std::string &pointData,
+        MEDCouplingVTKAppendedData *appendedData
     ) const;
     std::string getVTKDataSetType() const;
 
@@ -147,7 +147,7 @@ DenseMatrix::transpose()
     const MemArray<double> &mem(getData()->accessToMemArray());
     double *pt(mem.toNoInterlace(getNumberOfCols()));
     std::copy(pt, pt + getNbOfElems(), getData()->getPointer());  // declareAsNew done here automatically by getPointer
-    free(pt);
+    MEDCouplingArrayFree(pt, nullptr);
     std::swap(_nb_rows, _nb_cols);
     updateTime();
 }
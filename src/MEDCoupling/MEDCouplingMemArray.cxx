@@ -19,6 +19,7 @@
 // Author : Anthony Geay (EDF R&D)
 
 #include "MEDCouplingMemArray.txx"
+#include "MEDCouplingVTKWriter.hxx"
 
 #include "BBTreeClosest.txx"
 #include "InterpKernelBBoxDistance.txx"
@@ -31,14 +32,32 @@
 #include "InterpKernelAutoPtr.hxx"
 #include "InterpKernelGeo2DNode.hxx"
 #include "InterpKernelGeo2DEdgeLin.hxx"
+#include "InterpKernelSpaceFillingCurve.hxx"
 
+#include <map>
 #include <set>
 #include <cmath>
+#include <mutex>
+#include <memory>
+#include <atomic>
+#include <cstdint>
 #include <limits>
 #include <numeric>
 #include <algorithm>
 #include <functional>
 
+#ifdef WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 typedef double (*MYFUNCPTR)(double);
 
 using namespace MEDCoupling;
@@ -71,41 +90,585 @@ MEDCoupling::DACheckNbOfTuplesAndComp(
     da->checkNbOfTuplesAndComp(nbOfTuples, nbOfCompo, msg);
 }
 
+namespace
+{
+//! A mapped region, that starts on a page boundary before the data.
+struct MappedRegion
+{
+    void *_base;
+    std::size_t _length;
+};
+
+/*!
+ * Mapped regions, by address of their data. The deallocators of MemArray can't rely on their parameter, which may be
+ * replaced (see the numpy interface), so that the regions are registered here.
+ */
+std::mutex MAPPED_REGIONS_MUTEX;
+std::map<void *, MappedRegion> MAPPED_REGIONS;
+}  // namespace
+
+/*!
+ * Maps in memory the \a nbOfBytes bytes of file \a fileName starting at byte \a offsetInBytes, and returns the address
+ * of the first of them. The mapping is read-only if \a copyOnWrite is false, and private copy-on-write otherwise.
+ * The mapping is released by MEDCouplingUnmapFile called on the returned address.
+ */
+void *
+MEDCoupling::MEDCouplingMapFile(
+    const std::string &fileName, std::size_t offsetInBytes, std::size_t nbOfBytes, bool copyOnWrite
+)
+{
+    if (nbOfBytes == 0)
+        THROW_IK_EXCEPTION("MEDCouplingMapFile : empty region requested for file \"" << fileName << "\" !");
+#ifdef WIN32
+    HANDLE file(CreateFileA(
+        fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL
+    ));
+    if (file == INVALID_HANDLE_VALUE)
+        THROW_IK_EXCEPTION("MEDCouplingMapFile : unable to open file \"" << fileName << "\" !");
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || (std::size_t)fileSize.QuadPart < offsetInBytes + nbOfBytes)
+    {
+        CloseHandle(file);
+        THROW_IK_EXCEPTION("MEDCouplingMapFile : requested region is beyond the end of file \"" << fileName << "\" !");
+    }
+    SYSTEM_INFO sysInfo;
+    GetSystemInfo(&sysInfo);
+    std::size_t alignedOffset(offsetInBytes - offsetInBytes % sysInfo.dwAllocationGranularity);
+    std::size_t length(offsetInBytes + nbOfBytes - alignedOffset);
+    HANDLE mapping(CreateFileMappingA(file, NULL, copyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, NULL));
+    CloseHandle(file);
+    if (!mapping)
+        THROW_IK_EXCEPTION("MEDCouplingMapFile : unable to create file mapping for file \"" << fileName << "\" !");
+    void *base(MapViewOfFile(
+        mapping,
+        copyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ,
+        (DWORD)((unsigned long long)alignedOffset >> 32),
+        (DWORD)(alignedOffset & 0xFFFFFFFF),
+        length
+    ));
+    CloseHandle(mapping);  // the view keeps the mapping alive
+    if (!base)
+        THROW_IK_EXCEPTION("MEDCouplingMapFile : unable to map for file \"" << fileName << "\" !");
+#else
+    int fd(open(fileName.c_str(), O_RDONLY));
+    if (fd < 0)
+        THROW_IK_EXCEPTION("MEDCouplingMapFile : unable to open file \"" << fileName << "\" !");
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || (std::size_t)fileStat.st_size < offsetInBytes + nbOfBytes)
+    {
+        close(fd);
+        THROW_IK_EXCEPTION("MEDCouplingMapFile : requested region is beyond the end of file \"" << fileName << "\" !");
+    }
+    std::size_t pageSize((std::size_t)sysconf(_SC_PAGESIZE));
+    std::size_t alignedOffset(offsetInBytes - offsetInBytes % pageSize);
+    std::size_t length(offsetInBytes + nbOfBytes - alignedOffset);
+    void *base(mmap(
+        NULL,
+        length,
+        copyOnWrite ? PROT_READ | PROT_WRITE : PROT_READ,
+        copyOnWrite ? MAP_PRIVATE : MAP_SHARED,
+        fd,
+        (off_t)alignedOffset
+    ));
+    close(fd);  // the mapping keeps the file alive
+    if (base == MAP_FAILED)
+        THROW_IK_EXCEPTION("MEDCouplingMapFile : unable to map for file \"" << fileName << "\" !");
+#endif
+    void *ret(reinterpret_cast<char *>(base) + (offsetInBytes - alignedOffset));
+    std::lock_guard<std::mutex> lock(MAPPED_REGIONS_MUTEX);
+    MAPPED_REGIONS[ret] = {base, length};
+    return ret;
+}
+
+/*!
+ * Deallocator of arrays built by MemArray::useMappedFile.
+ */
+void
+MEDCoupling::MEDCouplingUnmapFile(void *pt, void * /*param*/)
+{
+    MappedRegion region;
+    {
+        std::lock_guard<std::mutex> lock(MAPPED_REGIONS_MUTEX);
+        std::map<void *, MappedRegion>::iterator it(MAPPED_REGIONS.find(pt));
+        if (it == MAPPED_REGIONS.end())
+            return;
+        region = (*it).second;
+        MAPPED_REGIONS.erase(it);
+    }
+#ifdef WIN32
+    UnmapViewOfFile(region._base);
+#else
+    munmap(region._base, region._length);
+#endif
+}
+
+namespace
+{
+//! Stored just before each buffer returned by MEDCouplingArrayAlloc, to be able to release it.
+struct ArrayBufferHeader
+{
+    MemArrayAllocator *_allocator;
+    void *_raw;
+    std::size_t _raw_size;
+};
+
+class MallocArrayAllocator : public MemArrayAllocator
+{
+   public:
+    void *allocate(std::size_t nbOfBytes) { return malloc(nbOfBytes); }
+    void deallocate(void *pt, std::size_t /*nbOfBytes*/) { free(pt); }
+};
+
+/*!
+ * Blocks released by a thread, sorted by size class (block of class k has a size of 2^k bytes). They are reused by the
+ * next allocations of the same thread.
+ */
+class ThreadLocalPoolCache
+{
+   public:
+    static const int MAX_SIZE_CLASS = 22;
+    static const std::size_t MAX_CACHED_BYTES = std::size_t(64) << 20;
+
+   public:
+    ThreadLocalPoolCache() : _cached_bytes(0) {}
+    ~ThreadLocalPoolCache();
+    void *pop(int sizeClass);
+    bool push(void *pt, int sizeClass);
+
+   private:
+    std::vector<void *> _blocks[MAX_SIZE_CLASS + 1];
+    std::size_t _cached_bytes;
+};
+
+//! Set at the destruction of the cache of the thread : blocks released later on are directly freed.
+thread_local bool POOL_CACHE_DESTROYED = false;
+thread_local ThreadLocalPoolCache POOL_CACHE;
+
+ThreadLocalPoolCache::~ThreadLocalPoolCache()
+{
+    for (int i = 0; i <= MAX_SIZE_CLASS; i++)
+        for (std::vector<void *>::const_iterator it = _blocks[i].begin(); it != _blocks[i].end(); it++) free(*it);
+    POOL_CACHE_DESTROYED = true;
+}
+
+void *
+ThreadLocalPoolCache::pop(int sizeClass)
+{
+    if (_blocks[sizeClass].empty())
+        return 0;
+    void *ret(_blocks[sizeClass].back());
+    _blocks[sizeClass].pop_back();
+    _cached_bytes -= std::size_t(1) << sizeClass;
+    return ret;
+}
+
+bool
+ThreadLocalPoolCache::push(void *pt, int sizeClass)
+{
+    std::size_t sz(std::size_t(1) << sizeClass);
+    if (_cached_bytes + sz > MAX_CACHED_BYTES)
+        return false;
+    _blocks[sizeClass].push_back(pt);
+    _cached_bytes += sz;
+    return true;
+}
+
+/*!
+ * Recycles the blocks up to 4 MiB in a per thread cache (at most 64 MiB per thread), instead of giving them back to
+ * the system allocator. Intended for the short lived arrays created in loops.
+ */
+class ThreadLocalPoolArrayAllocator : public MemArrayAllocator
+{
+   public:
+    void *allocate(std::size_t nbOfBytes);
+    void deallocate(void *pt, std::size_t nbOfBytes);
+
+   private:
+    static int SizeClass(std::size_t nbOfBytes);
+};
+
+int
+ThreadLocalPoolArrayAllocator::SizeClass(std::size_t nbOfBytes)
+{
+    int ret(6);
+    while ((std::size_t(1) << ret) < nbOfBytes && ret <= ThreadLocalPoolCache::MAX_SIZE_CLASS) ret++;
+    return ret;
+}
+
+void *
+ThreadLocalPoolArrayAllocator::allocate(std::size_t nbOfBytes)
+{
+    int sizeClass(SizeClass(nbOfBytes));
+    if (sizeClass > ThreadLocalPoolCache::MAX_SIZE_CLASS)
+        return malloc(nbOfBytes);
+    void *ret(POOL_CACHE_DESTROYED ? 0 : POOL_CACHE.pop(sizeClass));
+    return ret ? ret : malloc(std::size_t(1) << sizeClass);
+}
+
+void
+ThreadLocalPoolArrayAllocator::deallocate(void *pt, std::size_t nbOfBytes)
+{
+    int sizeClass(SizeClass(nbOfBytes));
+    if (sizeClass > ThreadLocalPoolCache::MAX_SIZE_CLASS || POOL_CACHE_DESTROYED || !POOL_CACHE.push(pt, sizeClass))
+        free(pt);
+}
+
+//! Null means MemArrayAllocator::GetDefault().
+std::atomic<MemArrayAllocator *> ARRAY_ALLOCATOR(0);
+}  // namespace
+
+/*!
+ * Returns the allocator based on malloc/free, used by default.
+ */
+MemArrayAllocator *
+MemArrayAllocator::GetDefault()
+{
+    static MemArrayAllocator *ret(new MallocArrayAllocator);  // never deleted : buffers may be released at exit
+    return ret;
+}
+
+/*!
+ * Returns the allocator recycling the released buffers in a cache local to the releasing thread.
+ * \sa MEDCouplingSetArrayPoolEnabled
+ */
+MemArrayAllocator *
+MemArrayAllocator::GetThreadLocalPool()
+{
+    static MemArrayAllocator *ret(new ThreadLocalPoolArrayAllocator);
+    return ret;
+}
+
+/*!
+ * Allocates a buffer of \a nbOfBytes bytes aligned on MEDCOUPLING_ARRAY_ALIGNMENT bytes, using the current allocator
+ * (see MEDCouplingSetArrayAllocator). The buffer must be released with MEDCouplingArrayFree (it is the deallocator
+ * of DeallocType::ALIGNED_DEALLOC).
+ * \throw If the allocation fails.
+ */
+void *
+MEDCoupling::MEDCouplingArrayAlloc(std::size_t nbOfBytes)
+{
+    MemArrayAllocator *allocator(MEDCouplingGetArrayAllocator());
+    std::size_t rawSize(nbOfBytes + sizeof(ArrayBufferHeader) + MEDCOUPLING_ARRAY_ALIGNMENT - 1);
+    void *raw(allocator->allocate(rawSize));
+    if (!raw)
+        THROW_IK_EXCEPTION("MEDCouplingArrayAlloc : unable to allocate " << nbOfBytes << " bytes !");
+    std::uintptr_t ret(reinterpret_cast<std::uintptr_t>(raw) + sizeof(ArrayBufferHeader));
+    ret = (ret + MEDCOUPLING_ARRAY_ALIGNMENT - 1) & ~std::uintptr_t(MEDCOUPLING_ARRAY_ALIGNMENT - 1);
+    ArrayBufferHeader *header(reinterpret_cast<ArrayBufferHeader *>(ret) - 1);
+    header->_allocator = allocator;
+    header->_raw = raw;
+    header->_raw_size = rawSize;
+    return reinterpret_cast<void *>(ret);
+}
+
+/*!
+ * Releases a buffer allocated by MEDCouplingArrayAlloc, whatever the current allocator. \a param is ignored.
+ */
+void
+MEDCoupling::MEDCouplingArrayFree(void *pt, void * /*param*/)
+{
+    if (!pt)
+        return;
+    ArrayBufferHeader *header(reinterpret_cast<ArrayBufferHeader *>(pt) - 1);
+    header->_allocator->deallocate(header->_raw, header->_raw_size);
+}
+
+MemArrayAllocator *
+MEDCoupling::MEDCouplingGetArrayAllocator()
+{
+    MemArrayAllocator *ret(ARRAY_ALLOCATOR.load());
+    return ret ? ret : MemArrayAllocator::GetDefault();
+}
+
+/*!
+ * Sets the allocator used for the next buffers allocated by MemArray. A null \a allocator restores the default one.
+ * Buffers already allocated are released by the allocator that allocated them.
+ */
+void
+MEDCoupling::MEDCouplingSetArrayAllocator(MemArrayAllocator *allocator)
+{
+    ARRAY_ALLOCATOR.store(allocator);
+}
+
+/*!
+ * Switches between the default allocator and the thread local pool (MemArrayAllocator::GetThreadLocalPool).
+ */
+void
+MEDCoupling::MEDCouplingSetArrayPoolEnabled(bool enabled)
+{
+    MEDCouplingSetArrayAllocator(enabled ? MemArrayAllocator::GetThreadLocalPool() : 0);
+}
+
+namespace
+{
+/*!
+ * Uniform grid indexing a set of points, used to find the points closer than \a eps (infinite norm) to a given point.
+ * The cells are at least 2 * \a eps wide, and small enough to hold a few points for evenly spread points. Only the non
+ * empty cells are stored, sorted by the Morton code of their integer coordinates : a cell is found by dichotomy, and
+ * cells close in space are close in memory. The coordinates are copied in the order of the cells, point ids being
+ * ascending inside a cell. Once built, the grid is read only and can be shared by threads.
+ *
+ * The cell size comes from the bounding box, so a few points far from the others gather all the others in a few cells.
+ * The points of a cell holding more than MAX_NB_OF_PTS_PER_CELL points are thus indexed by a BBTreePts, so that a
+ * request stays in O(log n) whatever the distribution of the points.
+ */
+template <int SPACEDIM>
+class CoincidentPointsGrid
+{
+   public:
+    CoincidentPointsGrid(const double *pts, mcIdType nbOfPts, double eps);
+    bool getPointsAround(
+        const double *pt, mcIdType minId, std::size_t maxNbOfCandidates, std::size_t maxNbOfPts,
+        std::vector<mcIdType> &ids
+    ) const;
+
+   private:
+    std::uint64_t cellCoordinate(int idim, double x) const;
+    bool isClose(mcIdType pos, const double *pt) const;
+
+   private:
+    static const int NB_OF_BITS_PER_DIM = INTERP_KERNEL::MortonNbOfBitsPerDim<SPACEDIM>();
+    static const mcIdType MAX_NB_OF_PTS_PER_CELL = 64;
+    double _eps;
+    double _eps_request;
+    double _lo[SPACEDIM];
+    double _inv_cell_size[SPACEDIM];
+    std::vector<std::uint64_t> _cell_codes;
+    std::vector<mcIdType> _cell_index;
+    std::vector<mcIdType> _ids;
+    std::vector<double> _pts;
+    //! for each cell, the tree indexing its points if they are too many, in the positions local to the cell
+    std::vector<std::unique_ptr<BBTreePts<SPACEDIM, mcIdType> > > _trees;
+};
+
+template <int SPACEDIM>
+CoincidentPointsGrid<SPACEDIM>::CoincidentPointsGrid(const double *pts, mcIdType nbOfPts, double eps)
+    : _eps(eps), _eps_request(eps * (1. + 1e-12))
+{
+    // about 4 cells per point and per axis for evenly spread points, and integer coordinates on NB_OF_BITS_PER_DIM bits
+    const double maxCoord((double)((std::uint64_t(1) << NB_OF_BITS_PER_DIM) - 1));
+    double nbOfCellsPerDim(std::min(maxCoord, 4. * std::ceil(std::pow((double)nbOfPts, 1. / SPACEDIM))));
+    for (int idim = 0; idim < SPACEDIM; idim++)
+    {
+        double mi(std::numeric_limits<double>::max()), ma(-std::numeric_limits<double>::max());
+        for (mcIdType i = 0; i < nbOfPts; i++)
+        {
+            double x(pts[SPACEDIM * i + idim]);
+            if (std::isfinite(x))
+            {
+                mi = std::min(mi, x);
+                ma = std::max(ma, x);
+            }
+        }
+        if (mi > ma)
+            mi = ma = 0.;
+        double cellSize(std::max(2. * eps, (ma - mi) / nbOfCellsPerDim));
+        _lo[idim] = mi;
+        _inv_cell_size[idim] = cellSize > 0. && std::isfinite(cellSize) ? 1. / cellSize : 0.;
+    }
+    std::vector<std::uint64_t> codes(nbOfPts);
+    ArrayParallelFor(
+        nbOfPts,
+        ARRAY_OPS_GRAIN,
+        [&](std::size_t bg, std::size_t end)
+        {
+            std::uint64_t cell[SPACEDIM];
+            for (std::size_t i = bg; i < end; i++)
+            {
+                for (int idim = 0; idim < SPACEDIM; idim++) cell[idim] = cellCoordinate(idim, pts[SPACEDIM * i + idim]);
+                codes[i] = INTERP_KERNEL::InterleaveBits(cell, NB_OF_BITS_PER_DIM, SPACEDIM);
+            }
+        }
+    );
+    _ids.resize(nbOfPts);
+    std::iota(_ids.begin(), _ids.end(), 0);
+    INTERP_KERNEL::StableRadixSort(codes, _ids, SPACEDIM * NB_OF_BITS_PER_DIM);
+    _pts.resize(SPACEDIM * nbOfPts);
+    _cell_index.push_back(0);
+    for (mcIdType i = 0; i < nbOfPts; i++)
+    {
+        std::copy(pts + SPACEDIM * _ids[i], pts + SPACEDIM * (_ids[i] + 1), _pts.begin() + SPACEDIM * i);
+        if (i == nbOfPts - 1 || codes[i + 1] != codes[i])
+        {
+            _cell_codes.push_back(codes[i]);
+            _cell_index.push_back(i + 1);
+        }
+    }
+    _trees.resize(_cell_codes.size());
+    for (std::size_t cellId = 0; cellId < _cell_codes.size(); cellId++)
+    {
+        mcIdType nbOfPtsInCell(_cell_index[cellId + 1] - _cell_index[cellId]);
+        if (nbOfPtsInCell > MAX_NB_OF_PTS_PER_CELL)
+            _trees[cellId].reset(new BBTreePts<SPACEDIM, mcIdType>(
+                _pts.data() + SPACEDIM * _cell_index[cellId], nullptr, 0, nbOfPtsInCell, _eps_request
+            ));
+    }
+}
+
+template <int SPACEDIM>
+std::uint64_t
+CoincidentPointsGrid<SPACEDIM>::cellCoordinate(int idim, double x) const
+{
+    const std::uint64_t maxCoord((std::uint64_t(1) << NB_OF_BITS_PER_DIM) - 1);
+    double q((x - _lo[idim]) * _inv_cell_size[idim]);
+    if (!(q > 0.))  // NaN included
+        return 0;
+    return q < (double)maxCoord ? (std::uint64_t)q : maxCoord;
+}
+
+//! \a pos is the position of the point in the order of the cells
+template <int SPACEDIM>
+bool
+CoincidentPointsGrid<SPACEDIM>::isClose(mcIdType pos, const double *pt) const
+{
+    const double *p(_pts.data() + SPACEDIM * pos);
+    bool ret(true);
+    for (int idim = 0; idim < SPACEDIM; idim++) ret = ret && std::abs(p[idim] - pt[idim]) <= _eps;
+    return ret;
+}
+
+/*!
+ * Appends to \a ids, in ascending order, the ids not lower than \a minId of the points p such that
+ * |p[k] - pt[k]| <= eps for each k. The search is given up, \a ids is left unchanged and false is returned, as soon as
+ * more than \a maxNbOfCandidates points have been examined or more than \a maxNbOfPts points have been found.
+ */
+template <int SPACEDIM>
+bool
+CoincidentPointsGrid<SPACEDIM>::getPointsAround(
+    const double *pt, mcIdType minId, std::size_t maxNbOfCandidates, std::size_t maxNbOfPts,
+    std::vector<mcIdType> &ids
+) const
+{
+    std::size_t sz(ids.size()), nbOfCandidates(0);
+    std::uint64_t lo[SPACEDIM], hi[SPACEDIM], cell[SPACEDIM];
+    for (int idim = 0; idim < SPACEDIM; idim++)
+    {
+        lo[idim] = cellCoordinate(idim, pt[idim] - _eps_request);
+        hi[idim] = cellCoordinate(idim, pt[idim] + _eps_request);
+        cell[idim] = lo[idim];
+    }
+    for (bool isLastCell = false; !isLastCell;)
+    {
+        std::uint64_t code(INTERP_KERNEL::InterleaveBits(cell, NB_OF_BITS_PER_DIM, SPACEDIM));
+        std::vector<std::uint64_t>::const_iterator it(std::lower_bound(_cell_codes.begin(), _cell_codes.end(), code));
+        if (it != _cell_codes.end() && *it == code)
+        {
+            std::size_t cellId(std::distance(_cell_codes.begin(), it));
+            if (_trees[cellId])
+            {  // the tree returns the positions in the cell of the points close to pt, up to the rounding errors
+                std::size_t bg(ids.size()), nb(ids.size());
+                _trees[cellId]->getElementsAroundPoint(pt, ids);
+                nbOfCandidates += ids.size() - bg;
+                for (std::size_t j = bg; j < ids.size(); j++)
+                {
+                    mcIdType i(_cell_index[cellId] + ids[j]);
+                    if (isClose(i, pt) && _ids[i] >= minId)
+                        ids[nb++] = _ids[i];
+                }
+                ids.resize(nb);
+            }
+            else
+                for (mcIdType i = _cell_index[cellId]; i < _cell_index[cellId + 1]; i++)
+                {
+                    if (isClose(i, pt) && _ids[i] >= minId)
+                        ids.push_back(_ids[i]);
+                    if (++nbOfCandidates > maxNbOfCandidates || ids.size() - sz > maxNbOfPts)
+                        break;
+                }
+            if (nbOfCandidates > maxNbOfCandidates || ids.size() - sz > maxNbOfPts)
+            {
+                ids.resize(sz);
+                return false;
+            }
+        }
+        int idim(0);
+        for (; idim < SPACEDIM && cell[idim] == hi[idim]; idim++) cell[idim] = lo[idim];
+        isLastCell = idim == SPACEDIM;
+        if (!isLastCell)
+            cell[idim]++;
+    }
+    std::sort(ids.begin() + sz, ids.end());
+    return true;
+}
+}  // namespace
+
+/*!
+ * The neighbours of the points are first computed in parallel with a CoincidentPointsGrid, then the groups are built
+ * sequentially in the ascending order of the ids, the points already put in a group being skipped. Points lying in
+ * dense clusters would waste memory if their neighbours were computed before knowing whether they are skipped : they
+ * are deferred to the sequential pass.
+ */
 template <int SPACEDIM>
 void
 DataArrayDouble::findCommonTuplesAlg(
     const double *bbox, mcIdType nbNodes, mcIdType limitNodeId, double prec, DataArrayIdType *c, DataArrayIdType *cI
 ) const
 {
+    const mcIdType GRAIN(4096);
+    const std::size_t MAX_NB_OF_CANDIDATES(1024), MAX_NB_OF_NEIGHBOURS(64);
     const double *coordsPtr = getConstPointer();
-    BBTreePts<SPACEDIM, mcIdType> myTree(bbox, 0, 0, nbNodes, prec);
+    CoincidentPointsGrid<SPACEDIM> grid(bbox, nbNodes, std::abs(prec));
+    // nbOfNeighbours[i] is -1 for a deferred point. The neighbours are stored by chunk, in ascending order of ids.
+    std::vector<mcIdType> nbOfNeighbours(nbNodes);
+    std::vector<std::vector<mcIdType> > neighbours(((std::size_t)nbNodes + GRAIN - 1) / GRAIN);
+    INTERP_KERNEL::ParallelForChunks(
+        INTERP_KERNEL::GetEffectiveNbOfThreads(MEDCouplingGetNbOfThreads()),
+        (mcIdType)0,
+        nbNodes,
+        GRAIN,
+        [&](mcIdType bg, mcIdType end, unsigned int)
+        {
+            std::vector<mcIdType> &chunkNeighbours(neighbours[bg / GRAIN]);
+            for (mcIdType i = bg; i < end; i++)
+            {
+                std::size_t sz(chunkNeighbours.size());
+                const double *pt(coordsPtr + i * SPACEDIM);
+                if (!grid.getPointsAround(pt, limitNodeId, MAX_NB_OF_CANDIDATES, MAX_NB_OF_NEIGHBOURS, chunkNeighbours))
+                {
+                    nbOfNeighbours[i] = -1;
+                    continue;
+                }
+                std::vector<mcIdType>::iterator it(std::find(chunkNeighbours.begin() + sz, chunkNeighbours.end(), i));
+                if (it != chunkNeighbours.end())
+                    chunkNeighbours.erase(it);
+                nbOfNeighbours[i] = ToIdType(chunkNeighbours.size() - sz);
+            }
+        }
+    );
     std::vector<bool> isDone(nbNodes);
+    std::vector<mcIdType> deferredNeighbours;
+    std::size_t chunkId(0), pos(0);
     for (mcIdType i = 0; i < nbNodes; i++)
     {
-        if (!isDone[i])
+        const mcIdType *commonNodesBg(0), *commonNodesEnd(0);
+        if (nbOfNeighbours[i] > 0)
         {
-            std::vector<mcIdType> intersectingElems;
-            myTree.getElementsAroundPoint(coordsPtr + i * SPACEDIM, intersectingElems);
-            if (intersectingElems.size() > 1)
+            while (pos == neighbours[chunkId].size())
             {
-                std::vector<mcIdType> commonNodes;
-                for (std::vector<mcIdType>::const_iterator it = intersectingElems.begin();
-                     it != intersectingElems.end();
-                     it++)
-                    if (*it != i)
-                        if (*it >= limitNodeId)
-                        {
-                            commonNodes.push_back(*it);
-                            isDone[*it] = true;
-                        }
-                if (!commonNodes.empty())
-                {
-                    cI->pushBackSilent(cI->back() + ToIdType(commonNodes.size()) + 1);
-                    c->pushBackSilent(i);
-                    c->insertAtTheEnd(commonNodes.begin(), commonNodes.end());
-                }
+                chunkId++;
+                pos = 0;
             }
+            commonNodesBg = neighbours[chunkId].data() + pos;
+            commonNodesEnd = commonNodesBg + nbOfNeighbours[i];
+            pos += nbOfNeighbours[i];
+        }
+        else if (nbOfNeighbours[i] < 0 && !isDone[i])
+        {
+            deferredNeighbours.clear();
+            const std::size_t NO_LIMIT(std::numeric_limits<std::size_t>::max());
+            grid.getPointsAround(coordsPtr + i * SPACEDIM, limitNodeId, NO_LIMIT, NO_LIMIT, deferredNeighbours);
+            deferredNeighbours.erase(
+                std::remove(deferredNeighbours.begin(), deferredNeighbours.end(), i), deferredNeighbours.end()
+            );
+            commonNodesBg = deferredNeighbours.data();
+            commonNodesEnd = commonNodesBg + deferredNeighbours.size();
         }
+        if (isDone[i] || commonNodesBg == commonNodesEnd)
+            continue;
+        for (const mcIdType *it = commonNodesBg; it != commonNodesEnd; it++) isDone[*it] = true;
+        cI->pushBackSilent(cI->back() + ToIdType(commonNodesEnd - commonNodesBg) + 1);
+        c->pushBackSilent(i);
+        c->insertAtTheEnd(commonNodesBg, commonNodesEnd);
     }
 }
 
@@ -988,45 +1551,81 @@ DataArrayDouble::isMonotonic(bool increasing, double eps) const
     }
 }
 
+/*!
+ * \param [in] tupleIds - if not null, only these tuples are written, in this order. They are read on the fly from
+ *              \a this if \a appendedData is not null.
+ */
 void
 DataArrayDouble::writeVTK(
-    std::ostream &ofs, mcIdType indent, const std::string &nameInFile, DataArrayByte *byteArr
+    std::ostream &ofs,
+    mcIdType indent,
+    const std::string &nameInFile,
+    MEDCouplingVTKAppendedData *appendedData,
+    const DataArrayIdType *tupleIds
 ) const
 {
-    static const char SPACE[4] = {' ', ' ', ' ', ' '};
     checkAllocated();
-    std::string idt(indent, ' ');
-    ofs.precision(17);
-    ofs << idt << "<DataArray type=\"Float32\" Name=\"" << nameInFile << "\" NumberOfComponents=\""
-        << getNumberOfComponents() << "\"";
-    //
+    if (tupleIds && !appendedData)
+    {
+        MCAuto<DataArrayDouble> part(selectByTupleIdSafe(tupleIds->begin(), tupleIds->end()));
+        part->writeVTK(ofs, indent, nameInFile, appendedData);
+        return;
+    }
+    std::size_t nbOfCompo(getNumberOfComponents());
+    if (tupleIds)
+    {
+        tupleIds->checkAllocated();
+        if (!tupleIds->empty() &&
+            (tupleIds->getMinValueInArray() < 0 || tupleIds->getMaxValueInArray() >= getNumberOfTuples()))
+            throw INTERP_KERNEL::Exception("DataArrayDouble::writeVTK : a tuple id is out of range !");
+    }
+    std::ostringstream compoNames;
     bool areAllEmpty(true);
     for (std::vector<std::string>::const_iterator it = _info_on_compo.begin(); it != _info_on_compo.end(); it++)
         if (!(*it).empty())
             areAllEmpty = false;
     if (!areAllEmpty)
         for (std::size_t i = 0; i < _info_on_compo.size(); i++)
-            ofs << " ComponentName" << i << "=\"" << _info_on_compo[i] << "\"";
+            compoNames << " ComponentName" << i << "=\"" << _info_on_compo[i] << "\"";
     //
-    if (byteArr)
+    if (appendedData)
     {
-        ofs << " format=\"appended\" offset=\"" << byteArr->getNumberOfTuples() << "\">";
-        INTERP_KERNEL::AutoPtr<float> tmp(new float[getNbOfElems()]);
-        float *pt(tmp);
-        // to make Visual C++ happy : instead of std::copy(begin(),end(),(float *)tmp);
-        for (const double *src = begin(); src != end(); src++, pt++) *pt = float(*src);
-        const char *data(reinterpret_cast<const char *>((float *)tmp));
-        std::size_t sz(getNbOfElems() * sizeof(float));
-        byteArr->insertAtTheEnd(data, data + sz);
-        byteArr->insertAtTheEnd(SPACE, SPACE + 4);
-    }
-    else
-    {
-        ofs << " RangeMin=\"" << getMinValueInArray() << "\" RangeMax=\"" << getMaxValueInArray()
-            << "\" format=\"ascii\">\n"
-            << idt;
-        std::copy(begin(), end(), std::ostream_iterator<double>(ofs, " "));
+        const double *src(begin());
+        const mcIdType *ids(tupleIds ? tupleIds->begin() : nullptr);
+        appendedData->keepAlive(this);
+        if (tupleIds)
+            appendedData->keepAlive(tupleIds);
+        appendedData->appendDataArray(
+            ofs,
+            indent,
+            "Float32",
+            nameInFile,
+            nbOfCompo,
+            sizeof(float),
+            tupleIds ? tupleIds->getNbOfElems() * nbOfCompo : getNbOfElems(),
+            nullptr,
+            [src, ids, nbOfCompo](std::size_t bg, std::size_t end, char *out)
+            {
+                float *pt(reinterpret_cast<float *>(out));
+                // to make Visual C++ happy : instead of std::copy(src+bg,src+end,pt);
+                if (ids)
+                    for (std::size_t i = bg; i < end; i++, pt++)
+                        *pt = float(src[ids[i / nbOfCompo] * nbOfCompo + i % nbOfCompo]);
+                else
+                    for (std::size_t i = bg; i < end; i++, pt++) *pt = float(src[i]);
+            },
+            compoNames.str()
+        );
+        return;
     }
+    std::string idt(indent, ' ');
+    ofs.precision(17);
+    ofs << idt << "<DataArray type=\"Float32\" Name=\"" << nameInFile << "\" NumberOfComponents=\""
+        << getNumberOfComponents() << "\"" << compoNames.str();
+    ofs << " RangeMin=\"" << getMinValueInArray() << "\" RangeMax=\"" << getMaxValueInArray()
+        << "\" format=\"ascii\">\n"
+        << idt;
+    std::copy(begin(), end(), std::ostream_iterator<double>(ofs, " "));
     ofs << std::endl << idt << "</DataArray>\n";
 }
 
@@ -1203,6 +1802,8 @@ DataArrayDouble::areIncludedInMe(const DataArrayDouble *other, double prec, Data
  *
  * This method is typically used by MEDCouplingPointSet::findCommonNodes() and
  * MEDCouplingUMesh::mergeNodes().
+ * The search uses the threads allowed by MEDCouplingGetNbOfThreads(), the result does not depend on their number.
+ * In each group, the tuple ids following the first one are in ascending order.
  *  \param [in] prec - minimal absolute distance between two tuples (infinite norm) at which they are
  *              considered not coincident.
  *  \param [in] limitTupleId - limit tuple id. If all tuples within a group of coincident
@@ -1567,27 +2168,62 @@ DataArrayDouble::getMinMaxPerComponent(double *bounds) const
 {
     checkAllocated();
     std::size_t dim = getNumberOfComponents();
+    std::vector<double> init(2 * dim);
     for (std::size_t idim = 0; idim < dim; idim++)
     {
-        bounds[idim * 2] = std::numeric_limits<double>::max();
-        bounds[idim * 2 + 1] = -std::numeric_limits<double>::max();
+        init[idim * 2] = std::numeric_limits<double>::max();
+        init[idim * 2 + 1] = -std::numeric_limits<double>::max();
     }
     const double *ptr = getConstPointer();
-    mcIdType nbOfTuples = getNumberOfTuples();
-    for (mcIdType i = 0; i < nbOfTuples; i++)
+    auto merge = [dim](std::vector<double> a, const std::vector<double> &b)
     {
         for (std::size_t idim = 0; idim < dim; idim++)
         {
-            if (bounds[idim * 2] > ptr[i * dim + idim])
-            {
-                bounds[idim * 2] = ptr[i * dim + idim];
-            }
-            if (bounds[idim * 2 + 1] < ptr[i * dim + idim])
-            {
-                bounds[idim * 2 + 1] = ptr[i * dim + idim];
-            }
+            a[idim * 2] = std::min(a[idim * 2], b[idim * 2]);
+            a[idim * 2 + 1] = std::max(a[idim * 2 + 1], b[idim * 2 + 1]);
         }
-    }
+        return a;
+    };
+    std::vector<double> ret(ArrayBlockReduce(
+        getNumberOfTuples(),
+        ARRAY_REDUCTION_BLOCK / std::max(dim, std::size_t(1)),
+        init,
+        [ptr, dim, &init](std::size_t bg, std::size_t end)
+        {
+            std::vector<double> b(init);
+            for (std::size_t i = bg; i < end; i++)
+                for (std::size_t idim = 0; idim < dim; idim++)
+                {
+                    if (b[idim * 2] > ptr[i * dim + idim])
+                        b[idim * 2] = ptr[i * dim + idim];
+                    if (b[idim * 2 + 1] < ptr[i * dim + idim])
+                        b[idim * 2 + 1] = ptr[i * dim + idim];
+                }
+            return b;
+        },
+        merge
+    ));
+    std::copy(ret.begin(), ret.end(), bounds);
+}
+
+/*!
+ * Returns the min and max values of \a this one-component array, using the threads allowed by
+ * MEDCouplingGetNbOfThreads. If \a this is empty, std::numeric_limits<double>::max() and its opposite are returned.
+ *  \throw If \a this is not allocated or has not one component.
+ *  \sa getMinMaxPerComponent
+ */
+void
+DataArrayDouble::getMinMaxValues(double &minValue, double &maxValue) const
+{
+    checkAllocated();
+    if (getNumberOfComponents() != 1)
+        throw INTERP_KERNEL::Exception(
+            "DataArrayDouble::getMinMaxValues : must be applied on DataArrayDouble with only one component !"
+        );
+    double bounds[2];
+    getMinMaxPerComponent(bounds);
+    minValue = bounds[0];
+    maxValue = bounds[1];
 }
 
 /*!
@@ -1799,7 +2435,7 @@ DataArrayDouble::getAverageValue() const
             "DataArrayDouble::getAverageValue : array exists but number of tuples must be > 0 !"
         );
     const double *vals = getConstPointer();
-    double ret = std::accumulate(vals, vals + nbOfTuples, 0.);
+    double ret(ArrayDeterministicSum(nbOfTuples, [vals](std::size_t i) { return vals[i]; }));
     return ret / FromIdType<double>(nbOfTuples);
 }
 
@@ -1813,10 +2449,8 @@ double
 DataArrayDouble::norm2() const
 {
     checkAllocated();
-    double ret = 0.;
-    std::size_t nbOfElems = getNbOfElems();
     const double *pt = getConstPointer();
-    for (std::size_t i = 0; i < nbOfElems; i++, pt++) ret += (*pt) * (*pt);
+    double ret(ArrayDeterministicSum(getNbOfElems(), [pt](std::size_t i) { return pt[i] * pt[i]; }));
     return sqrt(ret);
 }
 
@@ -1832,16 +2466,19 @@ double
 DataArrayDouble::normMax() const
 {
     checkAllocated();
-    double ret(-1.);
-    std::size_t nbOfElems(getNbOfElems());
     const double *pt(getConstPointer());
-    for (std::size_t i = 0; i < nbOfElems; i++, pt++)
-    {
-        double val(std::abs(*pt));
-        if (val > ret)
-            ret = val;
-    }
-    return ret;
+    return ArrayBlockReduce(
+        getNbOfElems(),
+        ARRAY_REDUCTION_BLOCK,
+        -1.,
+        [pt](std::size_t bg, std::size_t end)
+        {
+            double ret(-1.);
+            for (std::size_t i = bg; i < end; i++) ret = std::max(ret, std::abs(pt[i]));
+            return ret;
+        },
+        [](double a, double b) { return std::max(a, b); }
+    );
 }
 
 /*!
@@ -1880,20 +2517,24 @@ double
 DataArrayDouble::normMin() const
 {
     checkAllocated();
-    double ret(std::numeric_limits<double>::max());
-    std::size_t nbOfElems(getNbOfElems());
     const double *pt(getConstPointer());
-    for (std::size_t i = 0; i < nbOfElems; i++, pt++)
-    {
-        double val(std::abs(*pt));
-        if (val < ret)
-            ret = val;
-    }
-    return ret;
+    return ArrayBlockReduce(
+        getNbOfElems(),
+        ARRAY_REDUCTION_BLOCK,
+        std::numeric_limits<double>::max(),
+        [pt](std::size_t bg, std::size_t end)
+        {
+            double ret(std::numeric_limits<double>::max());
+            for (std::size_t i = bg; i < end; i++) ret = std::min(ret, std::abs(pt[i]));
+            return ret;
+        },
+        [](double a, double b) { return std::min(a, b); }
+    );
 }
 
 /*!
- * Accumulates values of each component of \a this array.
+ * Accumulates values of each component of \a this array. The sums are computed by blocks of tuples merged in a fixed
+ * order, so that the result does not depend on the number of threads (see MEDCouplingSetNbOfThreads).
  *  \param [out] res - an array of length \a this->getNumberOfComponents(), allocated
  *         by the caller, that is filled by this method with sum value for each
  *         component.
@@ -1906,9 +2547,29 @@ DataArrayDouble::accumulate(double *res) const
     const double *ptr = getConstPointer();
     mcIdType nbTuple(getNumberOfTuples());
     std::size_t nbComps(getNumberOfComponents());
-    std::fill(res, res + nbComps, 0.);
-    for (mcIdType i = 0; i < nbTuple; i++)
-        std::transform(ptr + i * nbComps, ptr + (i + 1) * nbComps, res, res, std::plus<double>());
+    if (nbComps == 1)
+    {
+        res[0] = ArrayDeterministicSum(nbTuple, [ptr](std::size_t i) { return ptr[i]; });
+        return;
+    }
+    std::vector<double> ret(ArrayBlockReduce(
+        nbTuple,
+        ARRAY_REDUCTION_BLOCK / std::max(nbComps, std::size_t(1)),
+        std::vector<double>(nbComps, 0.),
+        [ptr, nbComps](std::size_t bg, std::size_t end)
+        {
+            std::vector<double> sum(nbComps, 0.);
+            for (std::size_t i = bg; i < end; i++)
+                for (std::size_t j = 0; j < nbComps; j++) sum[j] += ptr[i * nbComps + j];
+            return sum;
+        },
+        [](std::vector<double> a, const std::vector<double> &b)
+        {
+            std::transform(a.begin(), a.end(), b.begin(), a.begin(), std::plus<double>());
+            return a;
+        }
+    ));
+    std::copy(ret.begin(), ret.end(), res);
 }
 
 /*!
@@ -2067,9 +2728,7 @@ DataArrayDouble::accumulate(std::size_t compId) const
         throw INTERP_KERNEL::Exception(
             "DataArrayDouble::accumulate : Invalid compId specified : No such nb of components !"
         );
-    double ret = 0.;
-    for (mcIdType i = 0; i < nbTuple; i++) ret += ptr[i * nbComps + compId];
-    return ret;
+    return ArrayDeterministicSum(nbTuple, [ptr, nbComps, compId](std::size_t i) { return ptr[i * nbComps + compId]; });
 }
 
 /*!
@@ -2752,12 +3411,19 @@ DataArrayDouble::magnitude() const
     ret->alloc(nbOfTuple, 1);
     const double *src = getConstPointer();
     double *dest = ret->getPointer();
-    for (mcIdType i = 0; i < nbOfTuple; i++, dest++)
-    {
-        double sum = 0.;
-        for (std::size_t j = 0; j < nbOfComp; j++, src++) sum += (*src) * (*src);
-        *dest = sqrt(sum);
-    }
+    ArrayParallelFor(
+        nbOfTuple,
+        std::max(ARRAY_OPS_GRAIN / std::max(nbOfComp, std::size_t(1)), std::size_t(1)),
+        [src, dest, nbOfComp](std::size_t bg, std::size_t end)
+        {
+            for (std::size_t i = bg; i < end; i++)
+            {
+                double sum = 0.;
+                for (std::size_t j = 0; j < nbOfComp; j++) sum += src[i * nbOfComp + j] * src[i * nbOfComp + j];
+                dest[i] = sqrt(sum);
+            }
+        }
+    );
     return ret;
 }
 
@@ -3207,44 +3873,24 @@ DataArrayDouble::applyFunc(const std::string &func, bool isSafe) const
     std::vector<std::string> vars2(vars.begin(), vars.end());
     double buff, *ptrToFill(newArr->getPointer());
     const double *ptr(begin());
-    std::vector<double> stck;
     expr.prepareExprEvaluationDouble(vars2, 1, 1, 0, &buff, &buff + 1);
-    expr.prepareFastEvaluator();
+    INTERP_KERNEL::ExprParserOfBlockEval blockEval(expr);
+    std::size_t nbOfVals(nbOfTuples * nbOfComp);
     if (!isSafe)
-    {
-        for (mcIdType i = 0; i < nbOfTuples; i++)
-        {
-            for (std::size_t iComp = 0; iComp < nbOfComp; iComp++, ptr++, ptrToFill++)
-            {
-                buff = *ptr;
-                expr.evaluateDoubleInternal(stck);
-                *ptrToFill = stck.back();
-                stck.pop_back();
-            }
-        }
-    }
+        blockEval.evaluate(nbOfVals, ptr, 1, ptrToFill, 1, MEDCouplingGetNbOfThreads());
     else
     {
-        for (mcIdType i = 0; i < nbOfTuples; i++)
+        std::string errMsg;
+        std::size_t failure(
+            blockEval.evaluateSafe(nbOfVals, ptr, 1, ptrToFill, 1, MEDCouplingGetNbOfThreads(), errMsg)
+        );
+        if (failure != nbOfVals)
         {
-            for (std::size_t iComp = 0; iComp < nbOfComp; iComp++, ptr++, ptrToFill++)
-            {
-                buff = *ptr;
-                try
-                {
-                    expr.evaluateDoubleInternalSafe(stck);
-                }
-                catch (INTERP_KERNEL::Exception &e)
-                {
-                    std::ostringstream oss;
-                    oss << "For tuple # " << i << " component # " << iComp << " with value (";
-                    oss << buff;
-                    oss << ") : Evaluation of function failed !" << e.what();
-                    throw INTERP_KERNEL::Exception(oss.str().c_str());
-                }
-                *ptrToFill = stck.back();
-                stck.pop_back();
-            }
+            std::ostringstream oss;
+            oss << "For tuple # " << failure / nbOfComp << " component # " << failure % nbOfComp << " with value (";
+            oss << ptr[failure];
+            oss << ") : Evaluation of function failed !" << errMsg;
+            throw INTERP_KERNEL::Exception(oss.str().c_str());
         }
     }
     return newArr.retn();
@@ -3298,44 +3944,24 @@ DataArrayDouble::applyFuncOnThis(const std::string &func, bool isSafe)
     std::vector<std::string> vars2(vars.begin(), vars.end());
     double buff, *ptrToFill(getPointer());
     const double *ptr(begin());
-    std::vector<double> stck;
     expr.prepareExprEvaluationDouble(vars2, 1, 1, 0, &buff, &buff + 1);
-    expr.prepareFastEvaluator();
+    INTERP_KERNEL::ExprParserOfBlockEval blockEval(expr);
+    std::size_t nbOfVals(nbOfTuples * nbOfComp);
     if (!isSafe)
-    {
-        for (mcIdType i = 0; i < nbOfTuples; i++)
-        {
-            for (std::size_t iComp = 0; iComp < nbOfComp; iComp++, ptr++, ptrToFill++)
-            {
-                buff = *ptr;
-                expr.evaluateDoubleInternal(stck);
-                *ptrToFill = stck.back();
-                stck.pop_back();
-            }
-        }
-    }
+        blockEval.evaluate(nbOfVals, ptr, 1, ptrToFill, 1, MEDCouplingGetNbOfThreads());
     else
     {
-        for (mcIdType i = 0; i < nbOfTuples; i++)
+        std::string errMsg;
+        std::size_t failure(
+            blockEval.evaluateSafe(nbOfVals, ptr, 1, ptrToFill, 1, MEDCouplingGetNbOfThreads(), errMsg)
+        );
+        if (failure != nbOfVals)
         {
-            for (std::size_t iComp = 0; iComp < nbOfComp; iComp++, ptr++, ptrToFill++)
-            {
-                buff = *ptr;
-                try
-                {
-                    expr.evaluateDoubleInternalSafe(stck);
-                }
-                catch (INTERP_KERNEL::Exception &e)
-                {
-                    std::ostringstream oss;
-                    oss << "For tuple # " << i << " component # " << iComp << " with value (";
-                    oss << buff;
-                    oss << ") : Evaluation of function failed !" << e.what();
-                    throw INTERP_KERNEL::Exception(oss.str().c_str());
-                }
-                *ptrToFill = stck.back();
-                stck.pop_back();
-            }
+            std::ostringstream oss;
+            oss << "For tuple # " << failure / nbOfComp << " component # " << failure % nbOfComp << " with value (";
+            oss << ptr[failure];
+            oss << ") : Evaluation of function failed !" << errMsg;
+            throw INTERP_KERNEL::Exception(oss.str().c_str());
         }
     }
 }
@@ -3412,47 +4038,34 @@ DataArrayDouble::applyFuncNamedCompo(
     MCAuto<DataArrayDouble> newArr(DataArrayDouble::New());
     newArr->alloc(nbOfTuples, nbOfComp);
     INTERP_KERNEL::AutoPtr<double> buff(new double[oldNbOfComp]);
-    double *buffPtr(buff), *ptrToFill;
-    std::vector<double> stck;
+    double *buffPtr(buff);
+    const double *ptr(getConstPointer());
     for (std::size_t iComp = 0; iComp < nbOfComp; iComp++)
     {
         expr.prepareExprEvaluationDouble(
             varsOrder2, (int)oldNbOfComp, (int)nbOfComp, (int)iComp, buffPtr, buffPtr + oldNbOfComp
         );
-        expr.prepareFastEvaluator();
-        const double *ptr(getConstPointer());
-        ptrToFill = newArr->getPointer() + iComp;
+        INTERP_KERNEL::ExprParserOfBlockEval blockEval(expr);
+        double *ptrToFill(newArr->getPointer() + iComp);
         if (!isSafe)
-        {
-            for (mcIdType i = 0; i < nbOfTuples; i++, ptrToFill += nbOfComp, ptr += oldNbOfComp)
-            {
-                std::copy(ptr, ptr + oldNbOfComp, buffPtr);
-                expr.evaluateDoubleInternal(stck);
-                *ptrToFill = stck.back();
-                stck.pop_back();
-            }
-        }
+            blockEval.evaluate(nbOfTuples, ptr, oldNbOfComp, ptrToFill, nbOfComp, MEDCouplingGetNbOfThreads());
         else
         {
-            for (mcIdType i = 0; i < nbOfTuples; i++, ptrToFill += nbOfComp, ptr += oldNbOfComp)
+            std::string errMsg;
+            std::size_t failure(blockEval.evaluateSafe(
+                nbOfTuples, ptr, oldNbOfComp, ptrToFill, nbOfComp, MEDCouplingGetNbOfThreads(), errMsg
+            ));
+            if (failure != (std::size_t)nbOfTuples)
             {
-                std::copy(ptr, ptr + oldNbOfComp, buffPtr);
-                try
-                {
-                    expr.evaluateDoubleInternalSafe(stck);
-                    *ptrToFill = stck.back();
-                    stck.pop_back();
-                }
-                catch (INTERP_KERNEL::Exception &e)
-                {
-                    std::ostringstream oss;
-                    oss << "For tuple # " << i << " with value (";
-                    std::copy(
-                        ptr + oldNbOfComp * i, ptr + oldNbOfComp * (i + 1), std::ostream_iterator<double>(oss, ", ")
-                    );
-                    oss << ") : Evaluation of function failed !" << e.what();
-                    throw INTERP_KERNEL::Exception(oss.str().c_str());
-                }
+                std::ostringstream oss;
+                oss << "For tuple # " << failure << " with value (";
+                std::copy(
+                    ptr + oldNbOfComp * failure,
+                    ptr + oldNbOfComp * (failure + 1),
+                    std::ostream_iterator<double>(oss, ", ")
+                );
+                oss << ") : Evaluation of function failed !" << errMsg;
+                throw INTERP_KERNEL::Exception(oss.str().c_str());
             }
         }
     }
@@ -3681,12 +4294,19 @@ DataArrayDouble::Dot(const DataArrayDouble *a1, const DataArrayDouble *a2)
     ret->alloc(nbOfTuple, 1);
     double *retPtr = ret->getPointer();
     const double *a1Ptr = a1->begin(), *a2Ptr(a2->begin());
-    for (mcIdType i = 0; i < nbOfTuple; i++)
-    {
-        double sum = 0.;
-        for (std::size_t j = 0; j < nbOfComp; j++) sum += a1Ptr[i * nbOfComp + j] * a2Ptr[i * nbOfComp + j];
-        retPtr[i] = sum;
-    }
+    ArrayParallelFor(
+        nbOfTuple,
+        std::max(ARRAY_OPS_GRAIN / std::max(nbOfComp, std::size_t(1)), std::size_t(1)),
+        [a1Ptr, a2Ptr, retPtr, nbOfComp](std::size_t bg, std::size_t end)
+        {
+            for (std::size_t i = bg; i < end; i++)
+            {
+                double sum = 0.;
+                for (std::size_t j = 0; j < nbOfComp; j++) sum += a1Ptr[i * nbOfComp + j] * a2Ptr[i * nbOfComp + j];
+                retPtr[i] = sum;
+            }
+        }
+    );
     ret->setInfoOnComponent(0, a1->getInfoOnComponent(0));
     ret->setName(a1->getName());
     return ret;
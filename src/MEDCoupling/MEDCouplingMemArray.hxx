@@ -89,6 +89,41 @@ class MEDCouplingPointer
     const T *_external;
 };
 
+MEDCOUPLING_EXPORT void *
+MEDCouplingMapFile(const std::string &fileName, std::size_t offsetInBytes, std::size_t nbOfBytes, bool copyOnWrite);
+MEDCOUPLING_EXPORT void
+MEDCouplingUnmapFile(void *pt, void *param);
+
+//! Alignment, in bytes, of the buffers allocated by MemArray.
+const std::size_t MEDCOUPLING_ARRAY_ALIGNMENT = 64;
+
+/*!
+ * Source of the raw memory of the buffers allocated by MemArray (see MEDCouplingSetArrayAllocator). Implementations
+ * do not have to deal with alignment, and must be thread safe. An allocator must outlive the buffers it allocated.
+ */
+class MEDCOUPLING_EXPORT MemArrayAllocator
+{
+   public:
+    virtual void *allocate(std::size_t nbOfBytes) = 0;
+    virtual void deallocate(void *pt, std::size_t nbOfBytes) = 0;
+    virtual ~MemArrayAllocator() {}
+
+   public:
+    static MemArrayAllocator *GetDefault();
+    static MemArrayAllocator *GetThreadLocalPool();
+};
+
+MEDCOUPLING_EXPORT void *
+MEDCouplingArrayAlloc(std::size_t nbOfBytes);
+MEDCOUPLING_EXPORT void
+MEDCouplingArrayFree(void *pt, void *param);
+MEDCOUPLING_EXPORT MemArrayAllocator *
+MEDCouplingGetArrayAllocator();
+MEDCOUPLING_EXPORT void
+MEDCouplingSetArrayAllocator(MemArrayAllocator *allocator);
+MEDCOUPLING_EXPORT void
+MEDCouplingSetArrayPoolEnabled(bool enabled);
+
 template <class T>
 class MemArray
 {
@@ -96,13 +131,22 @@ class MemArray
     typedef void (*Deallocator)(void *, void *);
 
    public:
-    MemArray() : _nb_of_elem(0), _nb_of_elem_alloc(0), _ownership(false), _dealloc(0), _param_for_deallocator(0) {}
+    MemArray()
+        : _nb_of_elem(0),
+          _nb_of_elem_alloc(0),
+          _nb_of_allocs(0),
+          _ownership(false),
+          _dealloc(0),
+          _param_for_deallocator(0)
+    {
+    }
     MemArray(const MemArray<T> &other);
     bool isNull() const { return _pointer.isNull(); }
     const T *getConstPointerLoc(std::size_t offset) const { return _pointer.getConstPointerLoc(offset); }
     const T *getConstPointer() const { return _pointer.getConstPointer(); }
     std::size_t getNbOfElem() const { return _nb_of_elem; }
     std::size_t getNbOfElemAllocated() const { return _nb_of_elem_alloc; }
+    std::size_t getNbOfAllocations() const { return _nb_of_allocs; }
     T *getPointer() { return _pointer.getPointer(); }
     MemArray<T> &operator=(const MemArray<T> &other);
     T operator[](std::size_t id) const { return _pointer.getConstPointer()[id]; }
@@ -122,6 +166,7 @@ class MemArray
     void reAlloc(std::size_t newNbOfElements);
     void useArray(const T *array, bool ownership, DeallocType type, std::size_t nbOfElem);
     void useExternalArrayWithRWAccess(const T *array, std::size_t nbOfElem);
+    void useMappedFile(const std::string &fileName, std::size_t offsetInBytes, std::size_t nbOfElem, bool copyOnWrite);
     void writeOnPlace(std::size_t id, T element0, const T *others, std::size_t sizeOfOthers);
     template <class InputIterator>
     void insertAtTheEnd(InputIterator first, InputIterator last);
@@ -129,6 +174,7 @@ class MemArray
     T popBack();
     void pack() const;
     bool isDeallocatorCalled() const { return _ownership; }
+    bool isMemoryMapped() const { return _ownership && _dealloc == MEDCouplingUnmapFile; }
     Deallocator getDeallocator() const { return _dealloc; }
     void setSpecificDeallocator(Deallocator dealloc) { _dealloc = dealloc; }
     void setParameterForDeallocator(void *param) { _param_for_deallocator = param; }
@@ -148,6 +194,8 @@ class MemArray
    private:
     std::size_t _nb_of_elem;
     std::size_t _nb_of_elem_alloc;
+    //! Number of buffers allocated by \a this since its creation, to spot the arrays reallocated too often.
+    std::size_t _nb_of_allocs;
     bool _ownership;
     MEDCouplingPointer<T> _pointer;
     Deallocator _dealloc;
@@ -166,6 +214,7 @@ class DataArrayTools
 
 class DataArray;
 class DataArrayByte;
+class MEDCouplingVTKAppendedData;
 
 MEDCOUPLING_EXPORT void
 DACheckNbOfTuplesAndComp(const DataArray *da, mcIdType nbOfTuples, std::size_t nbOfCompo, const std::string &msg);
@@ -327,6 +376,15 @@ class MEDCOUPLING_EXPORT_TEMPLATE DataArrayTemplate : public DataArray
     void alloc(std::size_t nbOfTuple, std::size_t nbOfCompo = 1);
     void useArray(const T *array, bool ownership, DeallocType type, std::size_t nbOfTuple, std::size_t nbOfCompo);
     void useExternalArrayWithRWAccess(const T *array, std::size_t nbOfTuple, std::size_t nbOfCompo);
+    void useMappedFile(
+        const std::string &fileName,
+        std::size_t offsetInBytes,
+        std::size_t nbOfTuple,
+        std::size_t nbOfCompo,
+        bool copyOnWrite = false
+    );
+    bool isMemoryMapped() const { return _mem.isMemoryMapped(); }
+    std::size_t getNbOfAllocations() const { return _mem.getNbOfAllocations(); }
     T getIJSafe(std::size_t tupleId, std::size_t compoId) const;
     T getIJ(std::size_t tupleId, std::size_t compoId) const { return _mem[tupleId * _info_on_compo.size() + compoId]; }
     void setIJ(std::size_t tupleId, std::size_t compoId, T newVal)
@@ -623,7 +681,13 @@ class MEDCOUPLING_EXPORT DataArrayDouble : public DataArrayTemplateFP<double>
     DataArrayDouble *buildNewEmptyInstance() const { return DataArrayDouble::New(); }
     void checkMonotonic(bool increasing, double eps) const;
     bool isMonotonic(bool increasing, double eps) const;
-    void writeVTK(std::ostream &ofs, mcIdType indent, const std::string &nameInFile, DataArrayByte *byteArr) const;
+    void writeVTK(
+        std::ostream &ofs,
+        mcIdType indent,
+        const std::string &nameInFile,
+        MEDCouplingVTKAppendedData *appendedData,
+        const DataArrayIdType *tupleIds = nullptr
+    ) const;
     void reprCppStream(const std::string &varName, std::ostream &stream) const;
     void reprQuickOverview(std::ostream &stream) const;
     void reprQuickOverviewData(std::ostream &stream, std::size_t maxNbOfByteInRepr) const;
@@ -663,6 +727,7 @@ class MEDCOUPLING_EXPORT DataArrayDouble : public DataArrayTemplateFP<double>
     DataArrayDoubleIterator *iterator();
     void checkNoNullValues() const;
     void getMinMaxPerComponent(double *bounds) const;
+    void getMinMaxValues(double &minValue, double &maxValue) const;
     DataArrayDouble *computeBBoxPerTuple(double epsilon = 0.0) const;
     void computeTupleIdsNearTuples(
         const DataArrayDouble *other, double eps, DataArrayIdType *&c, DataArrayIdType *&cI
@@ -826,7 +891,7 @@ class MEDCOUPLING_EXPORT_TEMPLATE DataArrayDiscrete : public DataArrayTemplateCl
         mcIdType indent,
         const std::string &type,
         const std::string &nameInFile,
-        DataArrayByte *byteArr
+        MEDCouplingVTKAppendedData *appendedData
     ) const;
     void transformWithIndArr(const T *indArrBg, const T *indArrEnd);
     void transformWithIndArr(const MapKeyVal<T, T> &m);
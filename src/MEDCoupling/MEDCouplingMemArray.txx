@@ -22,6 +22,7 @@
 #define __PARAMEDMEM_MEDCOUPLINGMEMARRAY_TXX__
 
 #include "MEDCouplingMemArray.hxx"
+#include "MEDCouplingVTKWriter.hxx"
 #include "NormalizedUnstructuredMesh.hxx"
 #include "InterpKernelException.hxx"
 #include "InterpolationUtils.hxx"
@@ -30,6 +31,7 @@
 #include "MCAuto.hxx"
 #include "MEDCouplingMap.txx"
 #include "BBTreeDiscrete.txx"
+#include "InterpKernelThreadPool.hxx"
 
 #include <set>
 #include <sstream>
@@ -44,6 +46,130 @@
 
 namespace MEDCoupling
 {
+//! Number of elements processed by a task of the multi-threaded element-wise operations on arrays.
+const std::size_t ARRAY_OPS_GRAIN = 1 << 16;
+//! Number of elements of the blocks whose partial results are merged in block order by the reductions on arrays.
+const std::size_t ARRAY_REDUCTION_BLOCK = 1 << 12;
+//! Number of independent partial results of ArrayLaneSum.
+const int ARRAY_NB_OF_LANES = 8;
+
+/*!
+ * Calls \a func(bg,end) on chunks of [0, \a nbOfItems ) using the threads allowed by MEDCouplingGetNbOfThreads.
+ * \a grain is the size of a chunk : below 2 * \a grain items everything is done in the calling thread.
+ */
+template <class FUNC>
+void
+ArrayParallelFor(std::size_t nbOfItems, std::size_t grain, FUNC func)
+{
+    INTERP_KERNEL::ParallelForChunks(
+        INTERP_KERNEL::GetEffectiveNbOfThreads(MEDCouplingGetNbOfThreads()),
+        std::size_t(0),
+        nbOfItems,
+        grain,
+        [&func](std::size_t bg, std::size_t end, unsigned int) { func(bg, end); }
+    );
+}
+
+/*!
+ * Returns the sum of \a func(i) for i in [ \a bg, \a end ). Consecutive terms go to ARRAY_NB_OF_LANES independent
+ * partial sums, merged at the end in a fixed order : the loop is vectorized by the compiler without reordering the
+ * operations in a way that depends on the compiler or on the target.
+ */
+template <class FUNC>
+double
+ArrayLaneSum(std::size_t bg, std::size_t end, FUNC func)
+{
+    double lanes[ARRAY_NB_OF_LANES] = {0.};
+    std::size_t i(bg);
+    for (; i + ARRAY_NB_OF_LANES <= end; i += ARRAY_NB_OF_LANES)
+        for (int k = 0; k < ARRAY_NB_OF_LANES; k++) lanes[k] += func(i + k);
+    for (int k = 0; i < end; i++, k++) lanes[k] += func(i);
+    for (int width = ARRAY_NB_OF_LANES / 2; width > 0; width /= 2)
+        for (int k = 0; k < width; k++) lanes[k] += lanes[k + width];
+    return lanes[0];
+}
+
+/*!
+ * Reduction on [0, \a nbOfItems ) : the range is split in blocks of \a itemsPerBlock items, whose partial results
+ * \a blockFunc(bg,end) are computed possibly in parallel, and then merged in block order using \a merge, starting from
+ * \a init. The result does not depend on the number of threads.
+ */
+template <class R, class BLOCKFUNC, class MERGE>
+R
+ArrayBlockReduce(std::size_t nbOfItems, std::size_t itemsPerBlock, R init, BLOCKFUNC blockFunc, MERGE merge)
+{
+    itemsPerBlock = std::max(itemsPerBlock, std::size_t(1));
+    std::size_t nbOfBlocks((nbOfItems + itemsPerBlock - 1) / itemsPerBlock);
+    std::vector<R> partials(nbOfBlocks, init);
+    ArrayParallelFor(
+        nbOfBlocks,
+        std::max(ARRAY_OPS_GRAIN / itemsPerBlock, std::size_t(1)),
+        [&](std::size_t bg, std::size_t end)
+        {
+            for (std::size_t b = bg; b < end; b++)
+                partials[b] = blockFunc(b * itemsPerBlock, std::min(nbOfItems, (b + 1) * itemsPerBlock));
+        }
+    );
+    R ret(init);
+    for (typename std::vector<R>::const_iterator it = partials.begin(); it != partials.end(); it++)
+        ret = merge(ret, *it);
+    return ret;
+}
+
+/*!
+ * Returns the sum of \a func(i) for i in [0, \a nbOfItems ), computed by ArrayLaneSum on blocks of
+ * ARRAY_REDUCTION_BLOCK terms merged in block order : the result only depends on \a nbOfItems.
+ */
+template <class FUNC>
+double
+ArrayDeterministicSum(std::size_t nbOfItems, FUNC func)
+{
+    return ArrayBlockReduce(
+        nbOfItems,
+        ARRAY_REDUCTION_BLOCK,
+        0.,
+        [&func](std::size_t bg, std::size_t end) { return ArrayLaneSum(bg, end, func); },
+        std::plus<double>()
+    );
+}
+
+/*!
+ * Element-wise operation on arrays of \a nbOfTuples tuples of \a nbOfComp components : \a res = FCT( \a a1, \a a2 ),
+ * where the shape of \a a2 is given by \a a2Mode : 0 for the same shape as \a a1, 1 for one component, 2 for one
+ * tuple. \a res can be \a a1.
+ */
+template <class T, class FCT>
+void
+ArrayTransform(const T *a1, const T *a2, T *res, std::size_t nbOfTuples, std::size_t nbOfComp, int a2Mode)
+{
+    FCT fct;
+    std::size_t grain(std::max(ARRAY_OPS_GRAIN / std::max(nbOfComp, std::size_t(1)), std::size_t(1)));
+    ArrayParallelFor(
+        nbOfTuples,
+        grain,
+        [&](std::size_t bg, std::size_t end)
+        {
+            const T *in(a1 + bg * nbOfComp);
+            T *out(res + bg * nbOfComp);
+            if (a2Mode == 0)
+            {
+                const T *in2(a2 + bg * nbOfComp);
+                for (std::size_t i = 0; i < (end - bg) * nbOfComp; i++) out[i] = fct(in[i], in2[i]);
+            }
+            else if (a2Mode == 1)
+            {
+                for (std::size_t i = bg; i < end; i++, in += nbOfComp, out += nbOfComp)
+                    for (std::size_t j = 0; j < nbOfComp; j++) out[j] = fct(in[j], a2[i]);
+            }
+            else
+            {
+                for (std::size_t i = bg; i < end; i++, in += nbOfComp, out += nbOfComp)
+                    for (std::size_t j = 0; j < nbOfComp; j++) out[j] = fct(in[j], a2[j]);
+            }
+        }
+    );
+}
+
 template <class T>
 void
 MEDCouplingPointer<T>::setInternal(T *pointer)
@@ -62,14 +188,20 @@ MEDCouplingPointer<T>::setExternal(const T *pointer)
 
 template <class T>
 MemArray<T>::MemArray(const MemArray<T> &other)
-    : _nb_of_elem(0), _nb_of_elem_alloc(0), _ownership(false), _dealloc(0), _param_for_deallocator(0)
+    : _nb_of_elem(0),
+      _nb_of_elem_alloc(0),
+      _nb_of_allocs(0),
+      _ownership(false),
+      _dealloc(0),
+      _param_for_deallocator(0)
 {
     if (!other._pointer.isNull())
     {
         _nb_of_elem_alloc = other._nb_of_elem;
-        T *pointer = (T *)malloc(_nb_of_elem_alloc * sizeof(T));
+        T *pointer = (T *)MEDCouplingArrayAlloc(_nb_of_elem_alloc * sizeof(T));
         std::copy(other._pointer.getConstPointer(), other._pointer.getConstPointer() + other._nb_of_elem, pointer);
-        useArray(pointer, true, DeallocType::C_DEALLOC, other._nb_of_elem);
+        useArray(pointer, true, DeallocType::ALIGNED_DEALLOC, other._nb_of_elem);
+        _nb_of_allocs = 1;
     }
 }
 
@@ -100,6 +232,45 @@ MemArray<T>::useExternalArrayWithRWAccess(const T *array, std::size_t nbOfElem)
     _dealloc = CPPDeallocator;
 }
 
+/*!
+ * Makes \a this point to the \a nbOfElem elements stored in file \a fileName from byte \a offsetInBytes, using a memory
+ * mapping. Nothing is read at this point : pages are loaded on first access, and are shared with the other processes
+ * mapping the same file.
+ * If \a copyOnWrite is false the mapping is read-only, and \a this is seen as an external array (any attempt to get a
+ * writable pointer throws). Otherwise \a this can be modified, modified pages being private to the calling process :
+ * the file itself is never modified.
+ * The mapping is released by the deallocator MEDCouplingUnmapFile, or as soon as \a this is reallocated. This
+ * deallocator has no DeallocType : it can only be set here, on a region registered by MEDCouplingMapFile.
+ */
+template <class T>
+void
+MemArray<T>::useMappedFile(
+    const std::string &fileName, std::size_t offsetInBytes, std::size_t nbOfElem, bool copyOnWrite
+)
+{
+    if (offsetInBytes % alignof(T) != 0)
+        THROW_IK_EXCEPTION(
+            "MemArray::useMappedFile : offset " << offsetInBytes << " in file \"" << fileName
+                                                << "\" is not a multiple of the alignment of the type !"
+        );
+    if (nbOfElem == 0)
+    {
+        alloc(0);
+        return;
+    }
+    T *pt(reinterpret_cast<T *>(MEDCouplingMapFile(fileName, offsetInBytes, nbOfElem * sizeof(T), copyOnWrite)));
+    destroy();
+    _nb_of_elem = nbOfElem;
+    _nb_of_elem_alloc = nbOfElem;
+    if (copyOnWrite)
+        _pointer.setInternal(pt);
+    else
+        _pointer.setExternal(pt);
+    _ownership = true;
+    _dealloc = MEDCouplingUnmapFile;
+    _param_for_deallocator = 0;
+}
+
 template <class T>
 void
 MemArray<T>::writeOnPlace(std::size_t id, T element0, const T *others, std::size_t sizeOfOthers)
@@ -334,6 +505,7 @@ MemArray<T>::fillWithValue(const T &val)
     std::fill(pt, pt + _nb_of_elem, val);
 }
 
+//! the returned buffer is to be released by MEDCouplingArrayFree
 template <class T>
 T *
 MemArray<T>::fromNoInterlace(std::size_t nbOfComp) const
@@ -342,13 +514,14 @@ MemArray<T>::fromNoInterlace(std::size_t nbOfComp) const
         throw INTERP_KERNEL::Exception("MemArray<T>::fromNoInterlace : number of components must be > 0 !");
     const T *pt = _pointer.getConstPointer();
     std::size_t nbOfTuples = _nb_of_elem / nbOfComp;
-    T *ret = (T *)malloc(_nb_of_elem * sizeof(T));
+    T *ret = (T *)MEDCouplingArrayAlloc(_nb_of_elem * sizeof(T));
     T *w = ret;
     for (std::size_t i = 0; i < nbOfTuples; i++)
         for (std::size_t j = 0; j < nbOfComp; j++, w++) *w = pt[j * nbOfTuples + i];
     return ret;
 }
 
+//! the returned buffer is to be released by MEDCouplingArrayFree
 template <class T>
 T *
 MemArray<T>::toNoInterlace(std::size_t nbOfComp) const
@@ -357,7 +530,7 @@ MemArray<T>::toNoInterlace(std::size_t nbOfComp) const
         throw INTERP_KERNEL::Exception("MemArray<T>::toNoInterlace : number of components must be > 0 !");
     const T *pt = _pointer.getConstPointer();
     std::size_t nbOfTuples = _nb_of_elem / nbOfComp;
-    T *ret = (T *)malloc(_nb_of_elem * sizeof(T));
+    T *ret = (T *)MEDCouplingArrayAlloc(_nb_of_elem * sizeof(T));
     T *w = ret;
     for (std::size_t i = 0; i < nbOfComp; i++)
         for (std::size_t j = 0; j < nbOfTuples; j++, w++) *w = pt[j * nbOfComp + i];
@@ -411,9 +584,10 @@ MemArray<T>::alloc(std::size_t nbOfElements)
     destroy();
     _nb_of_elem = nbOfElements;
     _nb_of_elem_alloc = nbOfElements;
-    _pointer.setInternal((T *)malloc(_nb_of_elem_alloc * sizeof(T)));
+    _pointer.setInternal((T *)MEDCouplingArrayAlloc(_nb_of_elem_alloc * sizeof(T)));
+    _nb_of_allocs++;
     _ownership = true;
-    _dealloc = CDeallocator;
+    _dealloc = MEDCouplingArrayFree;
 }
 
 /*!
@@ -432,7 +606,7 @@ MemArray<T>::reserve(std::size_t newNbOfElements)
 {
     if (_nb_of_elem_alloc == newNbOfElements)
         return;
-    T *pointer = (T *)malloc(newNbOfElements * sizeof(T));
+    T *pointer = (T *)MEDCouplingArrayAlloc(newNbOfElements * sizeof(T));
     std::copy(
         _pointer.getConstPointer(),
         _pointer.getConstPointer() + std::min<std::size_t>(_nb_of_elem, newNbOfElements),
@@ -445,8 +619,9 @@ MemArray<T>::reserve(std::size_t newNbOfElements)
     _pointer.setInternal(pointer);
     _nb_of_elem = std::min<std::size_t>(_nb_of_elem, newNbOfElements);
     _nb_of_elem_alloc = newNbOfElements;
+    _nb_of_allocs++;
     _ownership = true;
-    _dealloc = CDeallocator;
+    _dealloc = MEDCouplingArrayFree;
     _param_for_deallocator = 0;
 }
 
@@ -463,7 +638,7 @@ MemArray<T>::reAlloc(std::size_t newNbOfElements)
 {
     if (_nb_of_elem == newNbOfElements)
         return;
-    T *pointer = (T *)malloc(newNbOfElements * sizeof(T));
+    T *pointer = (T *)MEDCouplingArrayAlloc(newNbOfElements * sizeof(T));
     std::copy(
         _pointer.getConstPointer(),
         _pointer.getConstPointer() + std::min<std::size_t>(_nb_of_elem, newNbOfElements),
@@ -476,8 +651,9 @@ MemArray<T>::reAlloc(std::size_t newNbOfElements)
     _pointer.setInternal(pointer);
     _nb_of_elem = newNbOfElements;
     _nb_of_elem_alloc = newNbOfElements;
+    _nb_of_allocs++;
     _ownership = true;
-    _dealloc = CDeallocator;
+    _dealloc = MEDCouplingArrayFree;
     _param_for_deallocator = 0;
 }
 
@@ -516,6 +692,8 @@ MemArray<T>::BuildFromType(DeallocType type)
             return CDeallocator;
         case DeallocType::C_DEALLOC_WITH_OFFSET:
             return COffsetDeallocator;
+        case DeallocType::ALIGNED_DEALLOC:
+            return MEDCouplingArrayFree;
         default:
             throw INTERP_KERNEL::Exception("Invalid deallocation requested ! Unrecognized enum DeallocType !");
     }
@@ -801,7 +979,7 @@ template <class T>
 std::size_t
 DataArrayTemplate<T>::getHeapMemorySizeWithoutChildren() const
 {
-    std::size_t sz(_mem.getNbOfElemAllocated());
+    std::size_t sz(_mem.isMemoryMapped() ? 0 : _mem.getNbOfElemAllocated());  // mapped pages are not in the heap
     sz *= sizeof(T);
     return DataArray::getHeapMemorySizeWithoutChildren() + sz;
 }
@@ -831,7 +1009,8 @@ DataArrayTemplate<T>::alloc(std::size_t nbOfTuple, std::size_t nbOfCompo)
  *  \param [in] ownership - if \a true, \a array will be deallocated at destruction of \a this.
  *  \param [in] type - specifies how to deallocate \a array. If \a type == MEDCoupling::CPP_DEALLOC,
  *                     \c delete [] \c array; will be called. If \a type == MEDCoupling::C_DEALLOC,
- *                     \c free(\c array ) will be called.
+ *                     \c free(\c array ) will be called. If \a type == MEDCoupling::ALIGNED_DEALLOC, \a array
+ *                     must have been allocated by MEDCouplingArrayAlloc.
  *  \param [in] nbOfTuple - new number of tuples in \a this.
  *  \param [in] nbOfCompo - new number of components in \a this.
  */
@@ -855,6 +1034,31 @@ DataArrayTemplate<T>::useExternalArrayWithRWAccess(const T *array, std::size_t n
     declareAsNew();
 }
 
+/*!
+ * Makes \a this use, without any copy, the \a nbOfTuple * \a nbOfCompo values stored in binary form (native
+ * endianness, full interlace) in file \a fileName from byte \a offsetInBytes. The file is memory mapped, so that
+ * opening a huge file is immediate and that several processes mapping the same file share the same physical pages.
+ *  \param [in] copyOnWrite - if false (default) \a this is read-only. If true \a this can be modified, but the
+ *              modifications are private to the calling process and are never written in the file.
+ *  \throw If the file can't be opened or is too small.
+ *  \throw If \a offsetInBytes is not a multiple of the alignment of T.
+ *  \sa MemArray::useMappedFile
+ */
+template <class T>
+void
+DataArrayTemplate<T>::useMappedFile(
+    const std::string &fileName,
+    std::size_t offsetInBytes,
+    std::size_t nbOfTuple,
+    std::size_t nbOfCompo,
+    bool copyOnWrite
+)
+{
+    _mem.useMappedFile(fileName, offsetInBytes, nbOfTuple * nbOfCompo, copyOnWrite);
+    _info_on_compo.resize(nbOfCompo);
+    declareAsNew();
+}
+
 /*!
  * Returns a value located at specified tuple and component.
  * This method is equivalent to DataArrayTemplate<T>::getIJ() except that validity of
@@ -2979,8 +3183,14 @@ DataArrayTemplateClassic<T>::applyLin(T a, T b, std::size_t compoId)
         throw INTERP_KERNEL::Exception(oss.str().c_str());
     }
     T *ptr(this->getPointer() + compoId);
-    mcIdType nbOfTuple = this->getNumberOfTuples();
-    for (mcIdType i = 0; i < nbOfTuple; i++, ptr += nbOfComp) *ptr = a * (*ptr) + b;
+    ArrayParallelFor(
+        this->getNumberOfTuples(),
+        std::max(ARRAY_OPS_GRAIN / nbOfComp, std::size_t(1)),
+        [ptr, nbOfComp, a, b](std::size_t bg, std::size_t end)
+        {
+            for (std::size_t i = bg; i < end; i++) ptr[i * nbOfComp] = a * ptr[i * nbOfComp] + b;
+        }
+    );
     this->declareAsNew();
 }
 
@@ -2997,8 +3207,14 @@ DataArrayTemplateClassic<T>::applyLin(T a, T b)
 {
     this->checkAllocated();
     T *ptr(this->getPointer());
-    std::size_t nbOfElems(this->getNbOfElems());
-    for (std::size_t i = 0; i < nbOfElems; i++, ptr++) *ptr = a * (*ptr) + b;
+    ArrayParallelFor(
+        this->getNbOfElems(),
+        ARRAY_OPS_GRAIN,
+        [ptr, a, b](std::size_t bg, std::size_t end)
+        {
+            for (std::size_t i = bg; i < end; i++) ptr[i] = a * ptr[i] + b;
+        }
+    );
     this->declareAsNew();
 }
 
@@ -3043,19 +3259,13 @@ DataArrayTemplateClassic<T>::somethingEqual(const typename Traits<T>::ArrayType
     {
         if (nbOfComp == nbOfComp2)
         {
-            std::transform(this->begin(), this->end(), other->begin(), this->getPointer(), FCT());
+            T *ptr(this->getPointer());
+            ArrayTransform<T, FCT>(ptr, other->begin(), ptr, nbOfTuple, nbOfComp, 0);
         }
         else if (nbOfComp2 == 1)
         {
             T *ptr(this->getPointer());
-            const T *ptrc(other->begin());
-            for (mcIdType i = 0; i < nbOfTuple; i++)
-                std::transform(
-                    ptr + i * nbOfComp,
-                    ptr + (i + 1) * nbOfComp,
-                    ptr + i * nbOfComp,
-                    std::bind(FCT(), std::placeholders::_1, *ptrc++)
-                );
+            ArrayTransform<T, FCT>(ptr, other->begin(), ptr, nbOfTuple, nbOfComp, 1);
         }
         else
             throw INTERP_KERNEL::Exception(msg);
@@ -3065,9 +3275,7 @@ DataArrayTemplateClassic<T>::somethingEqual(const typename Traits<T>::ArrayType
         if (nbOfComp2 == nbOfComp)
         {
             T *ptr(this->getPointer());
-            const T *ptrc(other->begin());
-            for (mcIdType i = 0; i < nbOfTuple; i++)
-                std::transform(ptr + i * nbOfComp, ptr + (i + 1) * nbOfComp, ptrc, ptr + i * nbOfComp, FCT());
+            ArrayTransform<T, FCT>(ptr, other->begin(), ptr, nbOfTuple, nbOfComp, 2);
         }
         else
             throw INTERP_KERNEL::Exception(msg);
@@ -3190,7 +3398,7 @@ DivSub(const typename Traits<T>::ArrayType *a1, const typename Traits<T>::ArrayT
         {
             MCAuto<typename Traits<T>::ArrayType> ret(Traits<T>::ArrayType::New());
             ret->alloc(nbOfTuple2, nbOfComp1);
-            std::transform(a1->begin(), a1->end(), a2->begin(), ret->getPointer(), FCT());
+            ArrayTransform<T, FCT>(a1->begin(), a2->begin(), ret->getPointer(), nbOfTuple1, nbOfComp1, 0);
             ret->copyStringInfoFrom(*a1);
             return ret.retn();
         }
@@ -3198,15 +3406,7 @@ DivSub(const typename Traits<T>::ArrayType *a1, const typename Traits<T>::ArrayT
         {
             MCAuto<typename Traits<T>::ArrayType> ret(Traits<T>::ArrayType::New());
             ret->alloc(nbOfTuple1, nbOfComp1);
-            const T *a2Ptr(a2->begin()), *a1Ptr(a1->begin());
-            T *res(ret->getPointer());
-            for (mcIdType i = 0; i < nbOfTuple1; i++)
-                res = std::transform(
-                    a1Ptr + i * nbOfComp1,
-                    a1Ptr + (i + 1) * nbOfComp1,
-                    res,
-                    std::bind(FCT(), std::placeholders::_1, a2Ptr[i])
-                );
+            ArrayTransform<T, FCT>(a1->begin(), a2->begin(), ret->getPointer(), nbOfTuple1, nbOfComp1, 1);
             ret->copyStringInfoFrom(*a1);
             return ret.retn();
         }
@@ -3221,10 +3421,7 @@ DivSub(const typename Traits<T>::ArrayType *a1, const typename Traits<T>::ArrayT
         a1->checkNbOfComps(nbOfComp2, "Nb of components mismatch for array Divide !");
         MCAuto<typename Traits<T>::ArrayType> ret(Traits<T>::ArrayType::New());
         ret->alloc(nbOfTuple1, nbOfComp1);
-        const T *a1ptr = a1->begin(), *a2ptr(a2->begin());
-        T *pt(ret->getPointer());
-        for (mcIdType i = 0; i < nbOfTuple1; i++)
-            pt = std::transform(a1ptr + i * nbOfComp1, a1ptr + (i + 1) * nbOfComp1, a2ptr, pt, FCT());
+        ArrayTransform<T, FCT>(a1->begin(), a2->begin(), ret->getPointer(), nbOfTuple1, nbOfComp1, 2);
         ret->copyStringInfoFrom(*a1);
         return ret.retn();
     }
@@ -3317,7 +3514,7 @@ MulAdd(const typename Traits<T>::ArrayType *a1, const typename Traits<T>::ArrayT
         {
             ret = Traits<T>::ArrayType::New();
             ret->alloc(nbOfTuple, nbOfComp);
-            std::transform(a1->begin(), a1->end(), a2->begin(), ret->getPointer(), FCT());
+            ArrayTransform<T, FCT>(a1->begin(), a2->begin(), ret->getPointer(), nbOfTuple, nbOfComp, 0);
             ret->copyStringInfoFrom(*a1);
         }
         else
@@ -3342,16 +3539,7 @@ MulAdd(const typename Traits<T>::ArrayType *a1, const typename Traits<T>::ArrayT
             {
                 ret = Traits<T>::ArrayType::New();
                 ret->alloc(nbOfTuple, nbOfCompMax);
-                const T *aMinPtr(aMin->begin());
-                const T *aMaxPtr(aMax->begin());
-                T *res = ret->getPointer();
-                for (mcIdType i = 0; i < nbOfTuple; i++)
-                    res = std::transform(
-                        aMaxPtr + i * nbOfCompMax,
-                        aMaxPtr + (i + 1) * nbOfCompMax,
-                        res,
-                        std::bind(FCT(), std::placeholders::_1, aMinPtr[i])
-                    );
+                ArrayTransform<T, FCT>(aMax->begin(), aMin->begin(), ret->getPointer(), nbOfTuple, nbOfCompMax, 1);
                 ret->copyStringInfoFrom(*aMax);
             }
             else
@@ -3365,12 +3553,9 @@ MulAdd(const typename Traits<T>::ArrayType *a1, const typename Traits<T>::ArrayT
             mcIdType nbOfTupleMax = std::max(nbOfTuple, nbOfTuple2);
             const typename Traits<T>::ArrayType *aMin(nbOfTuple > nbOfTuple2 ? a2 : a1);
             const typename Traits<T>::ArrayType *aMax(nbOfTuple > nbOfTuple2 ? a1 : a2);
-            const T *aMinPtr(aMin->begin()), *aMaxPtr(aMax->begin());
             ret = Traits<T>::ArrayType::New();
             ret->alloc(nbOfTupleMax, nbOfComp);
-            T *res(ret->getPointer());
-            for (mcIdType i = 0; i < nbOfTupleMax; i++)
-                res = std::transform(aMaxPtr + i * nbOfComp, aMaxPtr + (i + 1) * nbOfComp, aMinPtr, res, FCT());
+            ArrayTransform<T, FCT>(aMax->begin(), aMin->begin(), ret->getPointer(), nbOfTupleMax, nbOfComp, 2);
             ret->copyStringInfoFrom(*aMax);
         }
         else
@@ -3635,12 +3820,17 @@ DataArrayTemplateClassic<T>::Meld(const std::vector<const typename Traits<T>::Ar
     typename Traits<T>::ArrayType *ret(Traits<T>::ArrayType::New());
     ret->alloc(nbOfTuples, totalNbOfComp);
     T *retPtr(ret->getPointer());
-    for (mcIdType i = 0; i < nbOfTuples; i++)
-        for (std::size_t j = 0; j < a.size(); j++)
+    ArrayParallelFor(
+        nbOfTuples,
+        std::max(ARRAY_OPS_GRAIN / std::max(totalNbOfComp, std::size_t(1)), std::size_t(1)),
+        [&](std::size_t bg, std::size_t end)
         {
-            retPtr = std::copy(pts[j], pts[j] + nbc[j], retPtr);
-            pts[j] += nbc[j];
+            T *w(retPtr + bg * totalNbOfComp);
+            for (std::size_t i = bg; i < end; i++)
+                for (std::size_t j = 0; j < pts.size(); j++)
+                    w = std::copy(pts[j] + i * nbc[j], pts[j] + (i + 1) * nbc[j], w);
         }
+    );
     std::size_t k = 0;
     for (std::size_t i = 0; i < a.size(); i++)
         for (std::size_t j = 0; j < nbc[i]; j++, k++) ret->setInfoOnComponent(k, a[i]->getInfoOnComponent(j));
@@ -3665,7 +3855,7 @@ DataArrayTemplateClassic<T>::fromNoInterlace() const
         throw INTERP_KERNEL::Exception("DataArrayDouble::fromNoInterlace : Not defined array !");
     T *tab(this->_mem.fromNoInterlace(this->getNumberOfComponents()));
     MCAuto<typename Traits<T>::ArrayType> ret(Traits<T>::ArrayType::New());
-    ret->useArray(tab, true, DeallocType::C_DEALLOC, this->getNumberOfTuples(), this->getNumberOfComponents());
+    ret->useArray(tab, true, DeallocType::ALIGNED_DEALLOC, this->getNumberOfTuples(), this->getNumberOfComponents());
     return ret.retn();
 }
 
@@ -3687,7 +3877,7 @@ DataArrayTemplateClassic<T>::toNoInterlace() const
         throw INTERP_KERNEL::Exception("DataArrayDouble::toNoInterlace : Not defined array !");
     T *tab(this->_mem.toNoInterlace(this->getNumberOfComponents()));
     MCAuto<typename Traits<T>::ArrayType> ret(Traits<T>::ArrayType::New());
-    ret->useArray(tab, true, DeallocType::C_DEALLOC, this->getNumberOfTuples(), this->getNumberOfComponents());
+    ret->useArray(tab, true, DeallocType::ALIGNED_DEALLOC, this->getNumberOfTuples(), this->getNumberOfComponents());
     return ret.retn();
 }
 
@@ -3716,7 +3906,7 @@ DataArrayTemplateClassic<T>::meldWith(const typename Traits<T>::ArrayType *other
         throw INTERP_KERNEL::Exception("DataArrayDouble::meldWith : mismatch of number of tuples !");
     std::size_t nbOfComp1 = this->getNumberOfComponents();
     std::size_t nbOfComp2 = other->getNumberOfComponents();
-    T *newArr = (T *)malloc((nbOfTuples * (nbOfComp1 + nbOfComp2)) * sizeof(T));
+    T *newArr = (T *)MEDCouplingArrayAlloc((nbOfTuples * (nbOfComp1 + nbOfComp2)) * sizeof(T));
     T *w = newArr;
     const T *inp1(this->begin()), *inp2(other->begin());
     for (mcIdType i = 0; i < nbOfTuples; i++, inp1 += nbOfComp1, inp2 += nbOfComp2)
@@ -3724,7 +3914,7 @@ DataArrayTemplateClassic<T>::meldWith(const typename Traits<T>::ArrayType *other
         w = std::copy(inp1, inp1 + nbOfComp1, w);
         w = std::copy(inp2, inp2 + nbOfComp2, w);
     }
-    this->useArray(newArr, true, DeallocType::C_DEALLOC, nbOfTuples, nbOfComp1 + nbOfComp2);
+    this->useArray(newArr, true, DeallocType::ALIGNED_DEALLOC, nbOfTuples, nbOfComp1 + nbOfComp2);
     std::vector<std::size_t> compIds(nbOfComp2);
     for (std::size_t i = 0; i < nbOfComp2; i++) compIds[i] = nbOfComp1 + i;
     this->copyPartOfStringInfoFrom2(compIds, *other);
@@ -4604,38 +4794,51 @@ DataArrayDiscrete<T>::reprQuickOverviewData(std::ostream &stream, std::size_t ma
 template <class T>
 void
 DataArrayDiscrete<T>::writeVTK(
-    std::ostream &ofs, mcIdType indent, const std::string &type, const std::string &nameInFile, DataArrayByte *byteArr
+    std::ostream &ofs,
+    mcIdType indent,
+    const std::string &type,
+    const std::string &nameInFile,
+    MEDCouplingVTKAppendedData *appendedData
 ) const
 {
-    static const char SPACE[4] = {' ', ' ', ' ', ' '};
     this->checkAllocated();
-    std::string idt(indent, ' ');
-    ofs << idt << "<DataArray type=\"" << type << "\" Name=\"" << nameInFile << "\" NumberOfComponents=\""
-        << this->getNumberOfComponents() << "\"";
-    if (byteArr)
+    if (appendedData)
     {
-        ofs << " format=\"appended\" offset=\"" << byteArr->getNumberOfTuples() << "\">";
+        const T *src(this->begin());
+        std::size_t nbOfCompo(this->getNumberOfComponents()), nbOfElems(this->getNbOfElems());
+        appendedData->keepAlive(this);
         if (std::string(type) == Traits<T>::VTKReprStr)
-        {
-            const char *data(reinterpret_cast<const char *>(this->begin()));
-            std::size_t sz(this->getNbOfElems() * sizeof(T));
-            byteArr->insertAtTheEnd(data, data + sz);
-            byteArr->insertAtTheEnd(SPACE, SPACE + 4);
-        }
+            appendedData->appendDataArray(
+                ofs,
+                indent,
+                type,
+                nameInFile,
+                nbOfCompo,
+                sizeof(T),
+                nbOfElems,
+                reinterpret_cast<const char *>(src),
+                MEDCouplingVTKAppendedData::FillFunction()
+            );
         else if (std::string(type) == "Int8")
-        {
-            INTERP_KERNEL::AutoPtr<char> tmp(new char[this->getNbOfElems()]);
-            copyCast(this->begin(), this->end(), (char *)tmp);
-            byteArr->insertAtTheEnd((char *)tmp, (char *)tmp + this->getNbOfElems());
-            byteArr->insertAtTheEnd(SPACE, SPACE + 4);
-        }
+            appendedData->appendDataArray<char>(
+                ofs,
+                indent,
+                type,
+                nameInFile,
+                nbOfCompo,
+                nbOfElems,
+                [src](std::size_t bg, std::size_t end, char *out) { copyCast(src + bg, src + end, out); }
+            );
         else if (std::string(type) == "UInt8")
-        {
-            INTERP_KERNEL::AutoPtr<unsigned char> tmp(new unsigned char[this->getNbOfElems()]);
-            copyCast(this->begin(), this->end(), (unsigned char *)tmp);
-            byteArr->insertAtTheEnd((unsigned char *)tmp, (unsigned char *)tmp + this->getNbOfElems());
-            byteArr->insertAtTheEnd(SPACE, SPACE + 4);
-        }
+            appendedData->appendDataArray<unsigned char>(
+                ofs,
+                indent,
+                type,
+                nameInFile,
+                nbOfCompo,
+                nbOfElems,
+                [src](std::size_t bg, std::size_t end, unsigned char *out) { copyCast(src + bg, src + end, out); }
+            );
         else
         {
             std::ostringstream oss;
@@ -4643,14 +4846,15 @@ DataArrayDiscrete<T>::writeVTK(
                 << ", Int8 and UInt8 supported !";
             throw INTERP_KERNEL::Exception(oss.str());
         }
+        return;
     }
-    else
-    {
-        ofs << " RangeMin=\"" << this->getMinValueInArray() << "\" RangeMax=\"" << this->getMaxValueInArray()
-            << "\" format=\"ascii\">\n"
-            << idt;
-        std::copy(this->begin(), this->end(), std::ostream_iterator<T>(ofs, " "));
-    }
+    std::string idt(indent, ' ');
+    ofs << idt << "<DataArray type=\"" << type << "\" Name=\"" << nameInFile << "\" NumberOfComponents=\""
+        << this->getNumberOfComponents() << "\"";
+    ofs << " RangeMin=\"" << this->getMinValueInArray() << "\" RangeMax=\"" << this->getMaxValueInArray()
+        << "\" format=\"ascii\">\n"
+        << idt;
+    std::copy(this->begin(), this->end(), std::ostream_iterator<T>(ofs, " "));
     ofs << std::endl << idt << "</DataArray>\n";
 }
 
@@ -6774,11 +6978,11 @@ DataArrayDiscrete<T>::computeOffsetsFull()
     if (this->getNumberOfComponents() != 1)
         throw INTERP_KERNEL::Exception("DataArrayInt::computeOffsetsFull : only single component allowed !");
     std::size_t nbOfElements = this->getNumberOfTuples();
-    T *ret = (T *)malloc((nbOfElements + 1) * sizeof(T));
+    T *ret = (T *)MEDCouplingArrayAlloc((nbOfElements + 1) * sizeof(T));
     const T *work = this->getConstPointer();
     ret[0] = 0;
     for (std::size_t i = 0; i < nbOfElements; i++) ret[i + 1] = work[i] + ret[i];
-    this->useArray(ret, true, DeallocType::C_DEALLOC, nbOfElements + 1, 1);
+    this->useArray(ret, true, DeallocType::ALIGNED_DEALLOC, nbOfElements + 1, 1);
     this->declareAsNew();
 }
 
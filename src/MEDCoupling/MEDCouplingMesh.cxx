@@ -24,12 +24,14 @@
 #include "MEDCouplingFieldDouble.hxx"
 #include "MEDCouplingFieldDiscretization.hxx"
 #include "MCAuto.hxx"
+#include "MEDCouplingVTKWriter.hxx"
 
 #include <set>
 #include <cmath>
 #include <sstream>
 #include <fstream>
 #include <iterator>
+#include <memory>
 
 using namespace MEDCoupling;
 
@@ -783,13 +785,10 @@ MEDCouplingMesh::writeVTK(const std::string &fileName, bool isBinary) const
     std::string ret(getVTKFileNameOf(fileName));
     //
     std::string cda, pda;
-    MCAuto<DataArrayByte> byteArr;
+    std::unique_ptr<MEDCouplingVTKAppendedData> appendedData;
     if (isBinary)
-    {
-        byteArr = DataArrayByte::New();
-        byteArr->alloc(0, 1);
-    }
-    writeVTKAdvanced(ret, cda, pda, byteArr);
+        appendedData.reset(new MEDCouplingVTKAppendedData(false));
+    writeVTKAdvanced(ret, cda, pda, appendedData.get());
     return ret;
 }
 
@@ -818,31 +817,28 @@ MEDCouplingMesh::getVTKFileNameOf(const std::string &fileName) const
 /// @cond INTERNAL
 void
 MEDCouplingMesh::writeVTKAdvanced(
-    const std::string &fileName, const std::string &cda, const std::string &pda, DataArrayByte *byteData
+    const std::string &fileName,
+    const std::string &cda,
+    const std::string &pda,
+    MEDCouplingVTKAppendedData *appendedData
 ) const
 {
-    std::ofstream ofs(fileName.c_str());
-    ofs << "<VTKFile type=\"" << getVTKDataSetType() << "\" version=\"0.1\" byte_order=\"" << MEDCouplingByteOrderStr()
-        << "\">\n";
-    writeVTKLL(ofs, cda, pda, byteData);
-    if (byteData)
-    {
-        ofs << "<AppendedData encoding=\"raw\">\n_1234";
-        ofs << std::flush;
-        ofs.close();
-        std::ofstream ofs2(fileName.c_str(), std::ios_base::binary | std::ios_base::app);
-        ofs2.write(byteData->begin(), byteData->getNbOfElems());
-        ofs2 << std::flush;
-        ofs2.close();
-        std::ofstream ofs3(fileName.c_str(), std::ios_base::app);
-        ofs3 << "\n</AppendedData>\n</VTKFile>\n";
-        ofs3.close();
-    }
-    else
+    std::ostringstream oss;
+    oss << "<VTKFile type=\"" << getVTKDataSetType() << "\" version=\"0.1\" byte_order=\"" << MEDCouplingByteOrderStr()
+        << "\"";
+    if (appendedData)
+        oss << appendedData->getVTKFileAttributes();
+    oss << ">\n";
+    if (appendedData)
     {
-        ofs << "</VTKFile>\n";
-        ofs.close();
+        writeVTKLL(oss, cda, pda, appendedData);
+        appendedData->write(fileName, oss.str());
+        return;
     }
+    std::ofstream ofs(fileName.c_str());
+    ofs << oss.str();
+    writeVTKLL(ofs, cda, pda, appendedData);
+    ofs << "</VTKFile>\n";
 }
 
 void
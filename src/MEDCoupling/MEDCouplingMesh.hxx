@@ -49,6 +49,7 @@ typedef enum
 
 class DataArrayIdType;
 class DataArrayByte;
+class MEDCouplingVTKAppendedData;
 class DataArrayDouble;
 class MEDCouplingUMesh;
 class MEDCouplingFieldDouble;
@@ -230,14 +231,20 @@ class MEDCouplingMesh : public RefCountObject, public TimeLabel
     MEDCOUPLING_EXPORT virtual std::string getVTKFileExtension() const = 0;
     /// @cond INTERNAL
     MEDCOUPLING_EXPORT void writeVTKAdvanced(
-        const std::string &fileName, const std::string &cda, const std::string &pda, DataArrayByte *byteData
+        const std::string &fileName,
+        const std::string &cda,
+        const std::string &pda,
+        MEDCouplingVTKAppendedData *appendedData
     ) const;
     MEDCOUPLING_EXPORT static void SplitExtension(
         const std::string &fileName, std::string &baseName, std::string &extension
     );
     /// @endcond
     MEDCOUPLING_EXPORT virtual void writeVTKLL(
-        std::ostream &ofs, const std::string &cellData, const std::string &pointData, DataArrayByte *byteData
+        std::ostream &ofs,
+        const std::string &cellData,
+        const std::string &pointData,
+        MEDCouplingVTKAppendedData *appendedData
     ) const = 0;
     MEDCOUPLING_EXPORT virtual void reprQuickOverview(std::ostream &stream) const = 0;
 
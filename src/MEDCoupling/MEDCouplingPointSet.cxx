@@ -28,8 +28,12 @@
 #include "InterpKernelGeo2DNode.hxx"
 #include "DirectedBoundingBox.hxx"
 #include "InterpKernelAutoPtr.hxx"
+#include "InterpKernelThreadPool.hxx"
+#include "InterpKernelSpaceFillingCurve.hxx"
 
 #include <cmath>
+#include <cstdint>
+#include <functional>
 #include <limits>
 #include <numeric>
 #include <sstream>
@@ -495,6 +499,28 @@ MEDCouplingPointSet::renumberNodesCenter(const mcIdType *newNodeNumbers, mcIdTyp
     renumberNodesInConn(newNodeNumbers);
 }
 
+/*!
+ * Renumbers the nodes of \a this along the space filling curve \a curve, so that nodes close to each other in space
+ * are also close in memory, which speeds up the algorithms fetching the nodes cell by cell.
+ *  \param [in] curve - the space filling curve, see ComputeSpaceFillingCurveRenumbering.
+ *  \return DataArrayIdType * - a new array, in "Old to New" mode, passed to renumberNodes. The caller is to delete
+ *          this array using decrRef() as it is no more needed.
+ *  \throw If the coordinates array is not set.
+ *  \throw If the nodal connectivity of cells is not defined.
+ *  \sa ComputeSpaceFillingCurveRenumbering, MEDCouplingUMesh::sortCellsAlongSpaceFillingCurve
+ */
+DataArrayIdType *
+MEDCouplingPointSet::renumberNodesAlongSpaceFillingCurve(SpaceFillingCurve curve)
+{
+    if (!_coords)
+        throw INTERP_KERNEL::Exception(
+            "MEDCouplingPointSet::renumberNodesAlongSpaceFillingCurve : no coords specified !"
+        );
+    MCAuto<DataArrayIdType> ret(ComputeSpaceFillingCurveRenumbering(_coords, curve));
+    renumberNodes(ret->begin(), getNumberOfNodes());
+    return ret.retn();
+}
+
 /*!
  * Computes the minimum box bounding all nodes. The edges of the box are parallel to
  * the Cartesian coordinate axes. The bounding box is described by coordinates of its
@@ -1151,6 +1177,79 @@ MEDCouplingPointSet::ComputeNbOfInteractionsWithSrcCells(
     return tbbox->computeNbOfInteractionsWith(sbbox, eps);
 }
 
+/*!
+ * Returns the renumbering array, in "Old to New" mode, that sorts the points \a pts along the space filling curve \a
+ * curve. The bounding box of \a pts is covered by a regular grid of 2^b cells in each direction, b being the largest
+ * number of bits such that the key of a grid cell holds in 64 bits, and the points are sorted by the keys of their grid
+ * cells, then by their ids. The keys are computed using the threads allowed by MEDCouplingGetNbOfThreads, and sorted
+ * by a stable radix sort, the result not depending on the number of threads.
+ * Contrary to SFC_MORTON, SFC_HILBERT never jumps between grid cells that are not adjacent, which gives a better
+ * locality for a slightly higher cost.
+ *
+ * \param [in] pts - the points to sort, with any number of components lower than 65.
+ * \param [in] curve - the space filling curve.
+ * \return DataArrayIdType * - a new array of \a pts->getNumberOfTuples() ids, to be deallocated by the caller.
+ * \throw If \a pts is null or not allocated.
+ * \throw If \a pts has no component or more than 64.
+ * \sa renumberNodesAlongSpaceFillingCurve, MEDCouplingUMesh::sortCellsAlongSpaceFillingCurve
+ */
+DataArrayIdType *
+MEDCouplingPointSet::ComputeSpaceFillingCurveRenumbering(const DataArrayDouble *pts, SpaceFillingCurve curve)
+{
+    const mcIdType GRAIN = 16384;
+    if (!pts)
+        throw INTERP_KERNEL::Exception("MEDCouplingPointSet::ComputeSpaceFillingCurveRenumbering : null input array !");
+    pts->checkAllocated();
+    int nbOfDims((int)pts->getNumberOfComponents());
+    if (nbOfDims < 1 || nbOfDims > 64)
+        throw INTERP_KERNEL::Exception(
+            "MEDCouplingPointSet::ComputeSpaceFillingCurveRenumbering : number of components must be in [1,64] !"
+        );
+    if (curve != SFC_MORTON && curve != SFC_HILBERT)
+        throw INTERP_KERNEL::Exception("MEDCouplingPointSet::ComputeSpaceFillingCurveRenumbering : unknown curve !");
+    mcIdType nbOfPts(pts->getNumberOfTuples());
+    MCAuto<DataArrayIdType> ret(DataArrayIdType::New());
+    ret->alloc(nbOfPts, 1);
+    if (nbOfPts == 0)
+        return ret.retn();
+    int nbOfBits(std::min(32, 64 / nbOfDims));
+    std::vector<double> bounds(2 * nbOfDims);
+    pts->getMinMaxPerComponent(bounds.data());
+    double extent(0.);
+    for (int i = 0; i < nbOfDims; i++) extent = std::max(extent, bounds[2 * i + 1] - bounds[2 * i]);
+    // the same scale in all the directions so that the grid cells are cubes
+    double maxCoord((double)((std::uint64_t(1) << nbOfBits) - 1)), scale(extent > 0. ? maxCoord / extent : 0.);
+    const double *ptsPtr(pts->begin());
+    std::vector<std::uint64_t> keys(nbOfPts);
+    unsigned int nbOfThreads(INTERP_KERNEL::GetEffectiveNbOfThreads(MEDCouplingGetNbOfThreads()));
+    INTERP_KERNEL::ParallelForChunks(
+        nbOfThreads,
+        (mcIdType)0,
+        nbOfPts,
+        GRAIN,
+        [&](mcIdType bg, mcIdType end, unsigned int)
+        {
+            std::vector<std::uint32_t> x(nbOfDims);
+            for (mcIdType i = bg; i < end; i++)
+            {
+                for (int j = 0; j < nbOfDims; j++)
+                {
+                    double v((ptsPtr[i * nbOfDims + j] - bounds[2 * j]) * scale);
+                    x[j] = v > 0. ? (std::uint32_t)std::min(v, maxCoord) : 0;  // also for NaN
+                }
+                keys[i] = curve == SFC_HILBERT ? INTERP_KERNEL::HilbertIndex(x.data(), nbOfBits, nbOfDims)
+                                               : INTERP_KERNEL::InterleaveBits(x.data(), nbOfBits, nbOfDims);
+            }
+        }
+    );
+    std::vector<mcIdType> n2o(nbOfPts);
+    std::iota(n2o.begin(), n2o.end(), 0);
+    INTERP_KERNEL::StableRadixSort(keys, n2o, nbOfBits * nbOfDims);
+    mcIdType *retPtr(ret->getPointer());
+    for (mcIdType i = 0; i < nbOfPts; i++) retPtr[n2o[i]] = i;
+    return ret.retn();
+}
+
 /*!
  * Creates a new MEDCouplingMesh containing a part of cells of \a this mesh. The new
  * mesh shares a coordinates array with \a this one. The cells to include to the
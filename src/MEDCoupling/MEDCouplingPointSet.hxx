@@ -38,6 +38,13 @@ namespace MEDCoupling
 class DataArrayIdType;
 class DataArrayDouble;
 
+//! The space filling curves along which nodes or cells can be renumbered
+typedef enum
+{
+    SFC_MORTON = 0,
+    SFC_HILBERT = 1
+} SpaceFillingCurve;
+
 /*!
  * This class is abstract and not instanciable.
  * MEDCoupling::MEDCouplingUMesh class inherits from this class.
@@ -135,6 +142,9 @@ class MEDCouplingPointSet : public MEDCouplingMesh
     MEDCOUPLING_EXPORT static DataArrayIdType *ComputeNbOfInteractionsWithSrcCells(
         const MEDCouplingPointSet *srcMesh, const MEDCouplingPointSet *trgMesh, double eps
     );
+    MEDCOUPLING_EXPORT static DataArrayIdType *ComputeSpaceFillingCurveRenumbering(
+        const DataArrayDouble *pts, SpaceFillingCurve curve
+    );
     MEDCOUPLING_EXPORT MEDCouplingMesh *buildPart(const mcIdType *start, const mcIdType *end) const;
     MEDCOUPLING_EXPORT MEDCouplingMesh *buildPartAndReduceNodes(
         const mcIdType *start, const mcIdType *end, DataArrayIdType *&arr
@@ -191,6 +201,7 @@ class MEDCouplingPointSet : public MEDCouplingMesh
     MEDCOUPLING_EXPORT virtual void renumberNodesWithOffsetInConn(mcIdType offset) = 0;
     MEDCOUPLING_EXPORT virtual void renumberNodes(const mcIdType *newNodeNumbers, mcIdType newNbOfNodes);
     MEDCOUPLING_EXPORT virtual void renumberNodesCenter(const mcIdType *newNodeNumbers, mcIdType newNbOfNodes);
+    MEDCOUPLING_EXPORT DataArrayIdType *renumberNodesAlongSpaceFillingCurve(SpaceFillingCurve curve = SFC_HILBERT);
     MEDCOUPLING_EXPORT virtual bool isEmptyMesh(const std::vector<mcIdType> &tinyInfo) const = 0;
     MEDCOUPLING_EXPORT virtual void invertOrientationOfAllCells() = 0;
     MEDCOUPLING_EXPORT virtual void checkFullyDefined() const = 0;
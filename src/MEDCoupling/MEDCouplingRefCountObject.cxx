@@ -94,6 +94,64 @@ MEDCoupling::IsCXX11Compiled()
     return true;
 }
 
+static std::atomic<int> MEDCOUPLING_NB_OF_THREADS(1);
+
+//! Innermost MEDCouplingNbOfThreadsScope alive in the calling thread, if any.
+static thread_local const MEDCouplingNbOfThreadsScope *MEDCOUPLING_NB_OF_THREADS_SCOPE(0);
+
+/*!
+ * Returns the number of threads that the multi-threaded algorithms of MEDCoupling are allowed to use : the one of the
+ * innermost MEDCouplingNbOfThreadsScope alive in the calling thread if any, the global one otherwise.
+ * \sa MEDCouplingSetNbOfThreads
+ */
+int
+MEDCoupling::MEDCouplingGetNbOfThreads()
+{
+    if (MEDCOUPLING_NB_OF_THREADS_SCOPE)
+        return MEDCOUPLING_NB_OF_THREADS_SCOPE->getNbOfThreads();
+    return MEDCOUPLING_NB_OF_THREADS;
+}
+
+/*!
+ * Sets the number of threads that the multi-threaded algorithms of MEDCoupling are allowed to use. Default is 1, that
+ * is to say that everything is done in the calling thread. A value lower or equal to 0 means as many threads as
+ * hardware threads.
+ */
+void
+MEDCoupling::MEDCouplingSetNbOfThreads(int nbOfThreads)
+{
+    MEDCOUPLING_NB_OF_THREADS = nbOfThreads;
+}
+
+MEDCouplingNbOfThreadsScope::MEDCouplingNbOfThreadsScope(int nbOfThreads)
+    : _nb_of_threads(nbOfThreads), _previous(MEDCOUPLING_NB_OF_THREADS_SCOPE), _active(true)
+{
+    MEDCOUPLING_NB_OF_THREADS_SCOPE = this;
+}
+
+/*!
+ * Gives back the control of the number of threads to the enclosing scope, or to the global setting. Scopes must be
+ * released in the reverse order of their creation.
+ */
+void
+MEDCouplingNbOfThreadsScope::release()
+{
+    if (!_active)
+        return;
+    if (MEDCOUPLING_NB_OF_THREADS_SCOPE != this)
+        throw INTERP_KERNEL::Exception(
+            "MEDCouplingNbOfThreadsScope::release : scopes must be released in the reverse order of their creation !"
+        );
+    MEDCOUPLING_NB_OF_THREADS_SCOPE = _previous;
+    _active = false;
+}
+
+MEDCouplingNbOfThreadsScope::~MEDCouplingNbOfThreadsScope()
+{
+    if (_active && MEDCOUPLING_NB_OF_THREADS_SCOPE == this)
+        MEDCOUPLING_NB_OF_THREADS_SCOPE = _previous;
+}
+
 //=
 
 std::string
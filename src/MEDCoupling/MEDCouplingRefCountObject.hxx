@@ -35,7 +35,8 @@ enum class DeallocType
 {
     C_DEALLOC = 2,
     CPP_DEALLOC = 3,
-    C_DEALLOC_WITH_OFFSET = 4
+    C_DEALLOC_WITH_OFFSET = 4,
+    ALIGNED_DEALLOC = 6
 };
 
 //! The various spatial discretization of a field
@@ -76,6 +77,38 @@ MEDCOUPLING_EXPORT const char *
 MEDCouplingByteOrderStr();
 MEDCOUPLING_EXPORT bool
 IsCXX11Compiled();
+MEDCOUPLING_EXPORT int
+MEDCouplingGetNbOfThreads();
+MEDCOUPLING_EXPORT void
+MEDCouplingSetNbOfThreads(int nbOfThreads);
+
+/*!
+ * Overrides, in the calling thread and for the lifetime of \a this, the number of threads set by
+ * MEDCouplingSetNbOfThreads. This allows to choose the execution policy of a single call :
+ * \code
+ * {
+ *     MEDCouplingNbOfThreadsScope scope(0);  // all the hardware threads
+ *     MCAuto<DataArrayDouble> res(DataArrayDouble::Add(a1, a2));
+ * }
+ * \endcode
+ */
+class MEDCOUPLING_EXPORT MEDCouplingNbOfThreadsScope
+{
+   public:
+    MEDCouplingNbOfThreadsScope(int nbOfThreads);
+    ~MEDCouplingNbOfThreadsScope();
+    int getNbOfThreads() const { return _nb_of_threads; }
+    void release();
+
+   private:
+    MEDCouplingNbOfThreadsScope(const MEDCouplingNbOfThreadsScope &);
+    MEDCouplingNbOfThreadsScope &operator=(const MEDCouplingNbOfThreadsScope &);
+
+   private:
+    int _nb_of_threads;
+    const MEDCouplingNbOfThreadsScope *_previous;
+    bool _active;
+};
 
 class MEDCOUPLING_EXPORT BigMemoryObject
 {
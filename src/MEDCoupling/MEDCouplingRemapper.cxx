@@ -40,11 +40,206 @@
 #include "Interpolation1D0D.txx"
 #include "InterpolationCU.txx"
 #include "InterpolationCC.txx"
+#include "InterpKernelThreadPool.hxx"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
 
 using namespace MEDCoupling;
 
+namespace
+{
+const char PREPARED_STATE_MAGIC[] = "MEDCouplingRemapperPreparedState";
+const std::uint32_t PREPARED_STATE_VERSION = 1;
+//! written as is, to detect a file written on a machine of different endianness
+const std::uint32_t PREPARED_STATE_BYTE_ORDER = 0x01020304;
+
+/*!
+ * Returns a hash of the geometry and the topology of \a mesh, computed on its serialization. Its name, description,
+ * time and the info on its components are not taken into account.
+ */
+std::uint64_t
+ComputeMeshFingerprint(const MEDCouplingMesh *mesh)
+{
+    std::uint64_t ret(14695981039346656037ULL);
+    auto hashBytes = [&ret](const void *data, std::size_t nbOfBytes)
+    {
+        const unsigned char *bytes(reinterpret_cast<const unsigned char *>(data));
+        std::size_t i(0);
+        for (std::uint64_t word; i + sizeof(word) <= nbOfBytes; i += sizeof(word))
+        {
+            std::memcpy(&word, bytes + i, sizeof(word));
+            ret = (ret ^ word) * 1099511628211ULL;
+        }
+        for (; i < nbOfBytes; i++) ret = (ret ^ bytes[i]) * 1099511628211ULL;
+        ret = (ret ^ nbOfBytes) * 1099511628211ULL;
+    };
+    MCAuto<MEDCouplingMesh> clone(mesh->clone(false));
+    clone->setTime(0., 0, 0);
+    std::vector<double> tinyInfoD;
+    std::vector<mcIdType> tinyInfo;
+    std::vector<std::string> littleStrings;
+    clone->getTinySerializationInformation(tinyInfoD, tinyInfo, littleStrings);
+    hashBytes(tinyInfo.data(), tinyInfo.size() * sizeof(mcIdType));
+    hashBytes(tinyInfoD.data(), tinyInfoD.size() * sizeof(double));
+    DataArrayIdType *a1(nullptr);
+    DataArrayDouble *a2(nullptr);
+    clone->serialize(a1, a2);
+    MCAuto<DataArrayIdType> a1Safe(a1);
+    MCAuto<DataArrayDouble> a2Safe(a2);
+    if (a1)
+        hashBytes(a1->begin(), a1->getNbOfElems() * sizeof(mcIdType));
+    if (a2)
+        hashBytes(a2->begin(), a2->getNbOfElems() * sizeof(double));
+    return ret;
+}
+
+template <class T>
+void
+WriteValues(std::ostream &os, const T *values, std::size_t nbOfValues)
+{
+    os.write(reinterpret_cast<const char *>(values), (std::streamsize)(nbOfValues * sizeof(T)));
+}
+
+template <class T>
+void
+WriteValue(std::ostream &os, T value)
+{
+    WriteValues(os, &value, 1);
+}
+
+template <class T>
+void
+WriteVector(std::ostream &os, const std::vector<T> &values)
+{
+    WriteValue<std::uint64_t>(os, values.size());
+    WriteValues(os, values.data(), values.size());
+}
+
+void
+WriteString(std::ostream &os, const std::string &str)
+{
+    WriteValue<std::uint64_t>(os, str.size());
+    WriteValues(os, str.data(), str.size());
+}
+
+/*!
+ * Reader of a prepared state file, checking its header at construction and throwing as soon as the file is shorter
+ * than expected. The size of an array is checked against the number of bytes left in the file before allocating it,
+ * so that a corrupted size is reported as such. The ids are read with the size they were written with, to load on a
+ * build with 32 bits ids a file written with 64 bits ids and conversely.
+ */
+class PreparedStateReader
+{
+   public:
+    PreparedStateReader(const std::string &fileName) : _file_name(fileName), _ifs(fileName.c_str(), std::ios::binary)
+    {
+        if (!_ifs)
+            throwError("impossible to open file for reading");
+        _ifs.seekg(0, std::ios::end);
+        _file_size = (std::uint64_t)_ifs.tellg();
+        _ifs.seekg(0, std::ios::beg);
+        char magic[sizeof(PREPARED_STATE_MAGIC)];
+        readValues(magic, sizeof(magic));
+        if (std::memcmp(magic, PREPARED_STATE_MAGIC, sizeof(magic)) != 0)
+            throwError("not a prepared state");
+        if (readValue<std::uint32_t>() != PREPARED_STATE_VERSION)
+            throwError("unsupported version");
+        if (readValue<std::uint32_t>() != PREPARED_STATE_BYTE_ORDER)
+            throwError("unsupported byte order");
+        _id_size = readValue<std::uint32_t>();
+        if (_id_size != sizeof(std::int32_t) && _id_size != sizeof(std::int64_t))
+            throwError("invalid size of ids");
+    }
+    template <class T>
+    void readValues(T *values, std::size_t nbOfValues)
+    {
+        if (!_ifs.read(reinterpret_cast<char *>(values), (std::streamsize)(nbOfValues * sizeof(T))))
+            throwError("unexpected end of file");
+    }
+    template <class T>
+    T readValue()
+    {
+        T ret;
+        readValues(&ret, 1);
+        return ret;
+    }
+    template <class T>
+    void readVector(std::vector<T> &values)
+    {
+        values.resize(readSize(sizeof(T)));
+        readValues(values.data(), values.size());
+    }
+    void readIds(std::vector<mcIdType> &ids)
+    {
+        ids.resize(readSize(_id_size));
+        if (_id_size == sizeof(mcIdType))
+            readValues(ids.data(), ids.size());
+        else if (_id_size == sizeof(std::int32_t))
+            readIdsAs<std::int32_t>(ids);
+        else
+            readIdsAs<std::int64_t>(ids);
+    }
+    std::string readString()
+    {
+        std::string ret(readSize(1), '\0');
+        readValues(&ret[0], ret.size());
+        return ret;
+    }
+    void throwError(const std::string &reason) const
+    {
+        std::ostringstream oss;
+        oss << "MEDCouplingRemapper::loadPreparedState : " << reason << " in file \"" << _file_name << "\" !";
+        throw INTERP_KERNEL::Exception(oss.str());
+    }
+
+   private:
+    //! reads the number of values of an array, each one taking \a sizeOfValue bytes in the file
+    std::size_t readSize(std::size_t sizeOfValue)
+    {
+        std::uint64_t ret(readValue<std::uint64_t>());
+        std::uint64_t nbOfBytesLeft(_file_size - (std::uint64_t)_ifs.tellg());
+        if (ret > nbOfBytesLeft / sizeOfValue || ret > (std::uint64_t)std::numeric_limits<mcIdType>::max())
+            throwError("invalid size of array");
+        return (std::size_t)ret;
+    }
+    template <class I>
+    void readIdsAs(std::vector<mcIdType> &ids)
+    {
+        std::vector<I> tmp(ids.size());
+        readValues(tmp.data(), tmp.size());
+        for (std::size_t i = 0; i < tmp.size(); i++)
+        {
+            std::int64_t id(tmp[i]);
+            if (id < std::numeric_limits<mcIdType>::min() || id > std::numeric_limits<mcIdType>::max())
+                throwError("id out of range");
+            ids[i] = (mcIdType)tmp[i];
+        }
+    }
+
+   private:
+    std::string _file_name;
+    std::ifstream _ifs;
+    std::uint64_t _file_size = 0;
+    std::uint32_t _id_size = sizeof(mcIdType);
+};
+}  // namespace
+
 MEDCouplingRemapper::MEDCouplingRemapper()
-    : _src_ft(0), _target_ft(0), _interp_matrix_pol(IK_ONLY_PREFERED), _nature_of_deno(NoNature), _time_deno_update(0)
+    : _src_ft(0),
+      _target_ft(0),
+      _interp_matrix_pol(IK_ONLY_PREFERED),
+      _nature_of_deno(NoNature),
+      _time_deno_update(0),
+      _measure_abs_deno(true),
+      _src_mesh_deno(nullptr, 0),
+      _trg_mesh_deno(nullptr, 0),
+      _matrix_view_up_to_date(true),
+      _nb_of_cols(0),
+      _measure_abs_measures{true, true}
 {
 }
 
@@ -149,6 +344,193 @@ MEDCouplingRemapper::setCrudeMatrixEx(
     synchronizeSizeOfSideMatricesAfterMatrixComputation(srcNbElem);
 }
 
+/*!
+ * Saves in the binary file \a fileName the state of \a this computed by prepare, prepareEx or setCrudeMatrix(Ex), so
+ * that a later run can restore it with loadPreparedState(Ex) instead of computing it again. The file contains :
+ *
+ * - the discretizations of the source and target sides, and the interpolation options including the finite element
+ *   ones (except the print level and the number of threads, that have no impact on the matrix),
+ * - a fingerprint of the source and target meshes, hash of their geometry and of their topology,
+ * - the crude matrix in CSR format,
+ * - the denominators of all the natures : the sums of the rows and of the columns of the matrix, and the measures of
+ *   the source and target entities (computed with the current measure abs status).
+ *
+ * The values are written in the byte order of the machine.
+ *
+ * \param [in] fileName the name of the file, overwritten if it exists.
+ * \throw If prepare has not been called.
+ * \throw If the file can't be written.
+ * \sa loadPreparedState, loadPreparedStateEx
+ */
+void
+MEDCouplingRemapper::savePreparedState(const std::string &fileName) const
+{
+    checkPrepare();
+    updateRowSumAndColSum();
+    const std::vector<double> &srcMeasures(getMeasuresForDeno(_src_ft, 0));
+    const std::vector<double> &trgMeasures(getMeasuresForDeno(_target_ft, 1));
+    std::ofstream ofs(fileName.c_str(), std::ios::binary);
+    if (!ofs)
+    {
+        std::ostringstream oss;
+        oss << "MEDCouplingRemapper::savePreparedState : impossible to open file \"" << fileName << "\" for writing !";
+        throw INTERP_KERNEL::Exception(oss.str());
+    }
+    WriteValues(ofs, PREPARED_STATE_MAGIC, sizeof(PREPARED_STATE_MAGIC));
+    WriteValue(ofs, PREPARED_STATE_VERSION);
+    WriteValue(ofs, PREPARED_STATE_BYTE_ORDER);
+    WriteValue<std::uint32_t>(ofs, sizeof(mcIdType));
+    WriteString(ofs, _src_ft->getDiscretization()->getStringRepr());
+    WriteString(ofs, _target_ft->getDiscretization()->getStringRepr());
+    WriteValue<std::int32_t>(ofs, _interp_matrix_pol);
+    WriteValue<std::int32_t>(ofs, getIntersectionType());
+    WriteValue<std::int32_t>(ofs, getSplittingPolicy());
+    WriteValue<std::int32_t>(ofs, getOrientation());
+    WriteValue<std::int32_t>(ofs, getDoRotate());
+    WriteValue<std::int32_t>(ofs, getMeasureAbsStatus());
+    const INTERP_KERNEL::FEInterpolationOptions &feOptions(getFEOptions());
+    WriteValue<std::int32_t>(ofs, feOptions.getProjectionOnSurfStatus());
+    WriteValue<std::int32_t>(ofs, feOptions.getMaxDistanceStatus());
+    WriteValue(ofs, getPrecision());
+    WriteValue(ofs, getMedianPlane());
+    WriteValue(ofs, getBoundingBoxAdjustment());
+    WriteValue(ofs, getBoundingBoxAdjustmentAbs());
+    WriteValue(ofs, getMaxDistance3DSurfIntersect());
+    WriteValue(ofs, getMinDotBtwPlane3DSurfIntersect());
+    WriteValue(ofs, feOptions.getProjectionMaxDistance());
+    WriteValue(ofs, ComputeMeshFingerprint(_src_ft->getMesh()));
+    WriteValue(ofs, ComputeMeshFingerprint(_target_ft->getMesh()));
+    WriteValue<std::int64_t>(ofs, _nb_of_cols);
+    WriteVector(ofs, _matrix_indptr);
+    WriteVector(ofs, _matrix_indices);
+    WriteVector(ofs, _matrix_values);
+    WriteVector(ofs, _row_sum);
+    WriteVector(ofs, _col_sum);
+    WriteValue<std::int32_t>(ofs, _measure_abs_measures[0]);
+    WriteVector(ofs, srcMeasures);
+    WriteValue<std::int32_t>(ofs, _measure_abs_measures[1]);
+    WriteVector(ofs, trgMeasures);
+    if (!ofs.flush())
+    {
+        std::ostringstream oss;
+        oss << "MEDCouplingRemapper::savePreparedState : error while writing file \"" << fileName << "\" !";
+        throw INTERP_KERNEL::Exception(oss.str());
+    }
+}
+
+/*!
+ * Same as loadPreparedStateEx with the field templates built from \a srcMesh, \a targetMesh and the discretizations
+ * stored in \a fileName, as prepare does.
+ *
+ * \sa savePreparedState, loadPreparedStateEx
+ */
+void
+MEDCouplingRemapper::loadPreparedState(
+    const std::string &fileName, const MEDCouplingMesh *srcMesh, const MEDCouplingMesh *targetMesh
+)
+{
+    PreparedStateReader reader(fileName);
+    std::string srcMethod(reader.readString()), targetMethod(reader.readString());
+    MCAuto<MEDCouplingFieldTemplate> src, target;
+    BuildFieldTemplatesFrom(srcMesh, targetMesh, BuildMethodFrom(srcMethod, targetMethod), src, target);
+    loadPreparedStateEx(fileName, src, target);
+}
+
+/*!
+ * Restores the state saved by savePreparedState in the binary file \a fileName : the crude matrix, the interpolation
+ * options (except the print level and the number of threads) and the denominators. After this call, \a this is in the
+ * same state as after prepareEx(\a src, \a target), without computing the matrix again. \a this is left unchanged if
+ * an exception is thrown.
+ *
+ * \param [in] fileName the file written by savePreparedState.
+ * \param [in] src is the field template source side.
+ * \param [in] target is the field template target side.
+ * \throw If the file can't be read or is not a prepared state written on a machine of the same byte order.
+ * \throw If the discretizations of \a src and \a target are not the ones of the file.
+ * \throw If the fingerprint of the mesh of \a src or \a target is not the one of the file, which means that the saved
+ *        matrix is not valid for them.
+ * \sa savePreparedState, loadPreparedState
+ */
+void
+MEDCouplingRemapper::loadPreparedStateEx(
+    const std::string &fileName, const MEDCouplingFieldTemplate *src, const MEDCouplingFieldTemplate *target
+)
+{
+    if (!src || !target || !src->getMesh() || !target->getMesh())
+        throw INTERP_KERNEL::Exception(
+            "MEDCouplingRemapper::loadPreparedStateEx : presence of NULL field template or NULL mesh !"
+        );
+    PreparedStateReader reader(fileName);
+    std::string srcMethod(reader.readString()), targetMethod(reader.readString());
+    if (srcMethod != src->getDiscretization()->getStringRepr() ||
+        targetMethod != target->getDiscretization()->getStringRepr())
+        reader.throwError("method " + srcMethod + targetMethod + " not consistent with the given field templates");
+    INTERP_KERNEL::InterpolationOptions options(*this);
+    InterpolationMatrixPolicy interpMatrixPol((InterpolationMatrixPolicy)reader.readValue<std::int32_t>());
+    options.setIntersectionType((INTERP_KERNEL::IntersectionType)reader.readValue<std::int32_t>());
+    options.setSplittingPolicy((INTERP_KERNEL::SplittingPolicy)reader.readValue<std::int32_t>());
+    options.setOrientation(reader.readValue<std::int32_t>());
+    options.setDoRotate(reader.readValue<std::int32_t>() != 0);
+    options.setMeasureAbsStatus(reader.readValue<std::int32_t>() != 0);
+    options.setProjectionOnSurfStatus(reader.readValue<std::int32_t>() != 0);
+    options.setMaxDistanceStatus(reader.readValue<std::int32_t>() != 0);
+    options.setPrecision(reader.readValue<double>());
+    options.setMedianPlane(reader.readValue<double>());
+    options.setBoundingBoxAdjustment(reader.readValue<double>());
+    options.setBoundingBoxAdjustmentAbs(reader.readValue<double>());
+    options.setMaxDistance3DSurfIntersect(reader.readValue<double>());
+    options.setMinDotBtwPlane3DSurfIntersect(reader.readValue<double>());
+    options.setProjectionMaxDistance(reader.readValue<double>());
+    if (reader.readValue<std::uint64_t>() != ComputeMeshFingerprint(src->getMesh()))
+        reader.throwError("source mesh different from the one used to compute the matrix");
+    if (reader.readValue<std::uint64_t>() != ComputeMeshFingerprint(target->getMesh()))
+        reader.throwError("target mesh different from the one used to compute the matrix");
+    mcIdType nbOfCols(ToIdType(reader.readValue<std::int64_t>()));
+    std::vector<mcIdType> indptr, indices;
+    std::vector<double> values, rowSum, colSum, measures[2];
+    bool measureAbs[2];
+    reader.readIds(indptr);
+    reader.readIds(indices);
+    reader.readVector(values);
+    reader.readVector(rowSum);
+    reader.readVector(colSum);
+    for (int side = 0; side < 2; side++)
+    {
+        measureAbs[side] = reader.readValue<std::int32_t>() != 0;
+        reader.readVector(measures[side]);
+    }
+    mcIdType nbOfRows(ToIdType(indptr.size()) - 1);
+    if (nbOfRows != target->getNumberOfTuplesExpected() || nbOfCols != src->getNumberOfTuplesExpected())
+        reader.throwError("size of matrix not consistent with the given field templates");
+    if (indptr[0] != 0 || indptr.back() != ToIdType(indices.size()) || values.size() != indices.size() ||
+        !std::is_sorted(indptr.begin(), indptr.end()))
+        reader.throwError("invalid CSR matrix");
+    for (std::vector<mcIdType>::const_iterator it = indices.begin(); it != indices.end(); it++)
+        if (*it < 0 || *it >= nbOfCols)
+            reader.throwError("invalid CSR matrix");
+    if (ToIdType(rowSum.size()) != nbOfRows || ToIdType(colSum.size()) != nbOfCols ||
+        ToIdType(measures[0].size()) != nbOfCols || ToIdType(measures[1].size()) != nbOfRows)
+        reader.throwError("invalid denominators");
+    restartUsing(src, target);
+    copyOptions(options);
+    _interp_matrix_pol = interpMatrixPol;
+    _nb_of_cols = nbOfCols;
+    _matrix_indptr.swap(indptr);
+    _matrix_indices.swap(indices);
+    _matrix_values.swap(values);
+    invalidateCSRDerivedData();
+    _row_sum.swap(rowSum);
+    _col_sum.swap(colSum);
+    const MEDCouplingMesh *meshes[2] = {src->getMesh(), target->getMesh()};
+    for (int side = 0; side < 2; side++)
+    {
+        meshes[side]->updateTime();
+        _measures[side].swap(measures[side]);
+        _mesh_measures[side] = std::make_pair(meshes[side], meshes[side]->getTimeOfThis());
+        _measure_abs_measures[side] = measureAbs[side];
+    }
+}
+
 int
 MEDCouplingRemapper::prepareInterpKernelOnly()
 {
@@ -303,7 +685,7 @@ MEDCouplingRemapper::reverseTransfer(
         tmp->alloc(srcField->getNumberOfTuplesExpected(), trgNbOfCompo);
         srcField->setArray(tmp);
     }
-    computeDeno(srcField->getNature(), srcField, targetField);
+    computeDeno(srcField->getNature(), srcField, targetField, true);
     double *resPointer(srcField->getArray()->getPointer());
     const double *inputPointer = targetField->getArray()->getConstPointer();
     computeReverseProduct(inputPointer, (int)trgNbOfCompo, dftValue, resPointer);
@@ -362,6 +744,114 @@ MEDCouplingRemapper::reverseTransferField(const MEDCouplingFieldDouble *targetFi
     return ret;
 }
 
+/*!
+ * Transfers several source fields at once. This method gives the same values as
+ * MEDCoupling::MEDCouplingRemapper::transferField called on each field of \a srcFields, but the fields of a same
+ * nature are interleaved by blocks of a few components, and each block is multiplied by the interpolation matrix in a
+ * single pass. The matrix is thus read a few times instead of once per field.
+ *
+ * \param [in] srcFields the source fields. They must all lie on the source support given to prepare. They can have
+ * different natures and different numbers of components.
+ * \param [in] dftValue same meaning as in MEDCoupling::MEDCouplingRemapper::transferField.
+ * \return the destination fields in the same order as \a srcFields, to be deallocated by the caller.
+ *
+ * \sa transferField
+ */
+std::vector<MEDCouplingFieldDouble *>
+MEDCouplingRemapper::transferFields(const std::vector<const MEDCouplingFieldDouble *> &srcFields, double dftValue)
+{
+    // maximal number of components multiplied in one pass over the matrix. Fields are interleaved by blocks of this
+    // size : beyond, the interleaving costs more than what is saved on the product.
+    const std::size_t MAX_NB_OF_COMPO_PER_PRODUCT = 8;
+    checkPrepare();
+    std::string srcRepr(_src_ft->getDiscretization()->getStringRepr());
+    mcIdType nbOfSrcTuples(_src_ft->getNumberOfTuplesExpected());
+    mcIdType nbOfTrgTuples(_target_ft->getNumberOfTuplesExpected());
+    // fields are grouped by nature, in the order of first appearance, because each nature has its own denominators
+    std::vector<NatureOfField> natures;
+    std::vector<std::vector<std::size_t> > fieldsPerNature;
+    for (std::size_t i = 0; i < srcFields.size(); i++)
+    {
+        const MEDCouplingFieldDouble *f(srcFields[i]);
+        if (!f)
+            throw INTERP_KERNEL::Exception("MEDCouplingRemapper::transferFields : a field in input vector is NULL !");
+        f->checkConsistencyLight();
+        if (srcRepr != f->getDiscretization()->getStringRepr())
+            throw INTERP_KERNEL::Exception("Incoherency with prepare call for source field");
+        if (f->getNumberOfTuplesExpected() != nbOfSrcTuples)
+        {
+            std::ostringstream oss;
+            oss << "MEDCouplingRemapper::transferFields : field #" << i << " has " << f->getNumberOfTuplesExpected()
+                << " tuples whereas " << nbOfSrcTuples << " are expected on the source support given to prepare !";
+            throw INTERP_KERNEL::Exception(oss.str().c_str());
+        }
+        std::size_t pos(std::find(natures.begin(), natures.end(), f->getNature()) - natures.begin());
+        if (pos == natures.size())
+        {
+            natures.push_back(f->getNature());
+            fieldsPerNature.emplace_back();
+        }
+        fieldsPerNature[pos].push_back(i);
+    }
+    std::vector<MCAuto<MEDCouplingFieldDouble> > ret(srcFields.size());
+    for (std::size_t n = 0; n < natures.size(); n++)
+    {
+        const std::vector<std::size_t> &ids(fieldsPerNature[n]);
+        for (std::size_t i : ids)
+        {
+            ret[i] = MEDCouplingFieldDouble::New(*_target_ft, srcFields[i]->getTimeDiscretization());
+            ret[i]->setNature(natures[n]);
+            MCAuto<DataArrayDouble> arr(DataArrayDouble::New());
+            arr->alloc(nbOfTrgTuples, srcFields[i]->getNumberOfComponents());
+            ret[i]->setArray(arr);
+        }
+        computeDeno(natures[n], srcFields[ids[0]], ret[ids[0]], false);
+        std::vector<double> input, output;
+        for (std::size_t bg = 0, end = 0; bg < ids.size(); bg = end)
+        {
+            std::vector<const double *> inputPtrs;
+            std::vector<double *> outputPtrs;
+            std::vector<std::size_t> nbOfCompos;
+            std::size_t nbOfCompo(0);
+            for (end = bg; end < ids.size(); end++)
+            {
+                std::size_t nbc(srcFields[ids[end]]->getNumberOfComponents());
+                if (end > bg && nbOfCompo + nbc > MAX_NB_OF_COMPO_PER_PRODUCT)
+                    break;
+                inputPtrs.push_back(srcFields[ids[end]]->getArray()->begin());
+                outputPtrs.push_back(ret[ids[end]]->getArray()->getPointer());
+                nbOfCompos.push_back(nbc);
+                nbOfCompo += nbc;
+            }
+            if (end == bg + 1)
+            {
+                computeProduct(inputPtrs[0], (int)nbOfCompo, true, dftValue, outputPtrs[0]);
+                continue;
+            }
+            // fields [bg,end) are interleaved so that the values read for a coefficient are contiguous
+            input.resize(nbOfSrcTuples * nbOfCompo);
+            output.resize(nbOfTrgTuples * nbOfCompo);
+            for (std::size_t i = 0, offset = 0; i < inputPtrs.size(); offset += nbOfCompos[i++])
+            {
+                const double *pt(inputPtrs[i]);
+                for (std::size_t t = 0; t < (std::size_t)nbOfSrcTuples; t++)
+                    for (std::size_t c = 0; c < nbOfCompos[i]; c++) input[t * nbOfCompo + offset + c] = *pt++;
+            }
+            computeProduct(input.data(), (int)nbOfCompo, true, dftValue, output.data());
+            for (std::size_t i = 0, offset = 0; i < outputPtrs.size(); offset += nbOfCompos[i++])
+            {
+                double *pt(outputPtrs[i]);
+                for (std::size_t t = 0; t < (std::size_t)nbOfTrgTuples; t++)
+                    for (std::size_t c = 0; c < nbOfCompos[i]; c++) *pt++ = output[t * nbOfCompo + offset + c];
+            }
+        }
+        for (std::size_t i : ids) ret[i]->copyAllTinyAttrFrom(srcFields[i]);
+    }
+    std::vector<MEDCouplingFieldDouble *> ret2(ret.size());
+    for (std::size_t i = 0; i < ret.size(); i++) ret2[i] = ret[i].retn();
+    return ret2;
+}
+
 /*!
  * This method does nothing more than inherited INTERP_KERNEL::InterpolationOptions::setOptionInt method. This method
  * is here only for automatic CORBA generators.
@@ -919,7 +1409,7 @@ MEDCouplingRemapper::prepareInterpKernelOnlyUC()
             );
     }
     ReverseMatrix(res, target_mesh->getNumberOfCells(), _matrix);
-    nullifiedTinyCoeffInCrudeMatrixAbs(0.);
+    RemoveNullCoeffs(_matrix);
     //
     synchronizeSizeOfSideMatricesAfterMatrixComputation(src_mesh->getNumberOfCells());
     return 1;
@@ -980,7 +1470,7 @@ MEDCouplingRemapper::prepareInterpKernelOnlyCU()
                 "MEDCouplingRemapper::prepareInterpKernelOnlyCU : only dimension 1 2 or 3 supported !"
             );
     }
-    nullifiedTinyCoeffInCrudeMatrixAbs(0.);
+    RemoveNullCoeffs(_matrix);
     //
     synchronizeSizeOfSideMatricesAfterMatrixComputation(src_mesh->getNumberOfCells());
     return 1;
@@ -1039,7 +1529,7 @@ MEDCouplingRemapper::prepareInterpKernelOnlyCC()
                 "MEDCouplingRemapper::prepareInterpKernelOnlyCC : only dimension 1 2 or 3 supported !"
             );
     }
-    nullifiedTinyCoeffInCrudeMatrixAbs(0.);
+    RemoveNullCoeffs(_matrix);
     //
     synchronizeSizeOfSideMatricesAfterMatrixComputation(src_mesh->getNumberOfCells());
     return 1;
@@ -1237,16 +1727,106 @@ MEDCouplingRemapper::checkPrepare() const
         );
 }
 
+/*!
+ * Called at the end of each matrix computation. The matrix computed in \a _matrix is moved into its CSR storage, and
+ * all the data depending on the matrix (denominators, transposed pattern) are invalidated.
+ */
 void
 MEDCouplingRemapper::synchronizeSizeOfSideMatricesAfterMatrixComputation(mcIdType nbOfColsInMatrix)
 {
-    _deno_multiply.clear();
-    _deno_multiply.resize(_matrix.size());
-    _deno_reverse_multiply.clear();
-    _deno_reverse_multiply.resize(nbOfColsInMatrix);
+    _nb_of_cols = nbOfColsInMatrix;
+    buildCSRFromCrudeMatrix();
+    invalidateCSRDerivedData();
+}
+
+/*!
+ * Converts the matrix under construction \a _matrix into the CSR arrays. \a _matrix is released afterwards.
+ */
+void
+MEDCouplingRemapper::buildCSRFromCrudeMatrix()
+{
+    std::size_t nbOfRows(_matrix.size()), nnz(0);
+    for (std::vector<std::map<mcIdType, double> >::const_iterator it = _matrix.begin(); it != _matrix.end(); it++)
+        nnz += (*it).size();
+    _matrix_indptr.resize(nbOfRows + 1);
+    _matrix_indices.resize(nnz);
+    _matrix_values.resize(nnz);
+    _matrix_indptr.shrink_to_fit();
+    _matrix_indices.shrink_to_fit();
+    _matrix_values.shrink_to_fit();
+    mcIdType pos(0), row(0);
+    _matrix_indptr[0] = 0;
+    for (std::vector<std::map<mcIdType, double> >::const_iterator it = _matrix.begin(); it != _matrix.end();
+         it++, row++)
+    {
+        for (std::map<mcIdType, double>::const_iterator it2 = (*it).begin(); it2 != (*it).end(); it2++, pos++)
+        {
+            _matrix_indices[pos] = (*it2).first;
+            _matrix_values[pos] = (*it2).second;
+        }
+        _matrix_indptr[row + 1] = pos;
+    }
+    std::vector<std::map<mcIdType, double> >().swap(_matrix);
+    _matrix_view_up_to_date = false;
+}
+
+/*!
+ * To be called each time the CSR matrix is modified. The denominators, the transposed pattern and the compatibility
+ * view returned by getCrudeMatrix will be recomputed on demand.
+ */
+void
+MEDCouplingRemapper::invalidateCSRDerivedData()
+{
+    _nature_of_deno = NoNature;
+    std::vector<double>().swap(_coeffs_multiply);
+    std::vector<double>().swap(_coeffs_reverse_multiply);
+    std::vector<double>().swap(_row_sum);
+    std::vector<double>().swap(_col_sum);
+    std::vector<mcIdType>().swap(_reverse_indptr);
+    std::vector<mcIdType>().swap(_reverse_indices);
+    std::vector<mcIdType>().swap(_reverse_entries);
+    std::vector<std::map<mcIdType, double> >().swap(_matrix);
+    _matrix_view_up_to_date = false;
     declareAsNew();
 }
 
+/*!
+ * Builds the pattern of the transposed of the CSR matrix by counting sort. Inside a row of the transposed matrix the
+ * entries are sorted by increasing target id, which is the order in which the reverse product accumulates them.
+ */
+void
+MEDCouplingRemapper::buildReversePattern()
+{
+    std::size_t nnz(_matrix_values.size());
+    mcIdType nbOfRows(ToIdType(_matrix_indptr.size()) - 1);
+    _reverse_indptr.assign(_nb_of_cols + 1, 0);
+    _reverse_indices.resize(nnz);
+    _reverse_entries.resize(nnz);
+    for (std::size_t k = 0; k < nnz; k++) _reverse_indptr[_matrix_indices[k] + 1]++;
+    std::partial_sum(_reverse_indptr.begin(), _reverse_indptr.end(), _reverse_indptr.begin());
+    std::vector<mcIdType> cursor(_reverse_indptr.begin(), _reverse_indptr.end() - 1);
+    for (mcIdType i = 0; i < nbOfRows; i++)
+        for (mcIdType k = _matrix_indptr[i]; k < _matrix_indptr[i + 1]; k++)
+        {
+            mcIdType pos(cursor[_matrix_indices[k]]++);
+            _reverse_indices[pos] = i;
+            _reverse_entries[pos] = k;
+        }
+}
+
+/*!
+ * Returns the number of parts in which the rows of the products are split between threads. Small products are kept
+ * serial.
+ */
+unsigned int
+MEDCouplingRemapper::getNbOfPartsForProduct(int nbOfCompo) const
+{
+    const std::size_t MIN_WORK_FOR_THREADS = 1 << 16;
+    if (_matrix_values.size() * (std::size_t)nbOfCompo < MIN_WORK_FOR_THREADS)
+        return 1;
+    return INTERP_KERNEL::GetEffectiveNbOfThreads(getNbOfThreads());
+}
+
 /*!
  * This method builds a code considering already set field discretization int \a this : \a _src_ft and \a _target_ft.
  * This method returns 3 information (2 in output parameters and 1 in return).
@@ -1312,9 +1892,17 @@ MEDCouplingRemapper::releaseData(bool matrixSuppression)
     _target_ft = 0;
     if (matrixSuppression)
     {
-        _matrix.clear();
-        _deno_multiply.clear();
-        _deno_reverse_multiply.clear();
+        std::vector<mcIdType>().swap(_matrix_indptr);
+        std::vector<mcIdType>().swap(_matrix_indices);
+        std::vector<double>().swap(_matrix_values);
+        _nb_of_cols = 0;
+        invalidateCSRDerivedData();
+        _matrix_view_up_to_date = true;
+        for (int side = 0; side < 2; side++)
+        {
+            std::vector<double>().swap(_measures[side]);
+            _mesh_measures[side] = std::make_pair(nullptr, 0);
+        }
     }
 }
 
@@ -1375,7 +1963,7 @@ MEDCouplingRemapper::transferUnderground(
         tmp->alloc(targetField->getNumberOfTuples(), srcNbOfCompo);
         targetField->setArray(tmp);
     }
-    computeDeno(srcField->getNature(), srcField, targetField);
+    computeDeno(srcField->getNature(), srcField, targetField, false);
     double *resPointer(targetField->getArray()->getPointer());
     const double *inputPointer(srcField->getArray()->getConstPointer());
     computeProduct(inputPointer, (int)srcNbOfCompo, isDftVal, dftValue, resPointer);
@@ -1383,183 +1971,166 @@ MEDCouplingRemapper::transferUnderground(
 
 void
 MEDCouplingRemapper::computeDeno(
-    NatureOfField nat, const MEDCouplingFieldDouble *srcField, const MEDCouplingFieldDouble *trgField
+    NatureOfField nat, const MEDCouplingFieldDouble *srcField, const MEDCouplingFieldDouble *trgField, bool reverse
 )
 {
     if (nat == NoNature)
-        return computeDenoFromScratch(nat, srcField, trgField);
+        return computeDenoFromScratch(nat, srcField, trgField, reverse);
     else if (nat != _nature_of_deno)
-        return computeDenoFromScratch(nat, srcField, trgField);
+        return computeDenoFromScratch(nat, srcField, trgField, reverse);
     else if (nat == _nature_of_deno && _time_deno_update != getTimeOfThis())
-        return computeDenoFromScratch(nat, srcField, trgField);
+        return computeDenoFromScratch(nat, srcField, trgField, reverse);
+    else if (_measure_abs_deno != getMeasureAbsStatus())
+        return computeDenoFromScratch(nat, srcField, trgField, reverse);
+    const MEDCouplingMesh *srcMesh(srcField->getMesh()), *trgMesh(trgField->getMesh());
+    srcMesh->updateTime();
+    trgMesh->updateTime();
+    if (_src_mesh_deno != std::make_pair(srcMesh, srcMesh->getTimeOfThis()) ||
+        _trg_mesh_deno != std::make_pair(trgMesh, trgMesh->getTimeOfThis()))
+        return computeDenoFromScratch(nat, srcField, trgField, reverse);
+    if (reverse && (_reverse_indptr.empty() || _coeffs_reverse_multiply.size() != _matrix_values.size()))
+        return computeDenoFromScratch(nat, srcField, trgField, reverse);
 }
 
+/*!
+ * Folds the denominators of nature \a nat into the coefficients of the CSR matrix : \a _coeffs_multiply for the
+ * transfer and, if \a reverse is true, \a _coeffs_reverse_multiply for the reverse transfer. Each coefficient is
+ * divided either by a denominator attached to its row (target entity) or to its column (source entity).
+ */
 void
 MEDCouplingRemapper::computeDenoFromScratch(
-    NatureOfField nat, const MEDCouplingFieldDouble *srcField, const MEDCouplingFieldDouble *trgField
+    NatureOfField nat, const MEDCouplingFieldDouble *srcField, const MEDCouplingFieldDouble *trgField, bool reverse
 )
 {
     _nature_of_deno = nat;
+    std::vector<double> deno, denoR;
+    const double *rowDenoPtr(nullptr), *colDenoPtr(nullptr);
+    // Intensive natures divide the coefficients of the transfer by a row denominator, extensive ones by a column one.
+    // This is the opposite for the reverse transfer.
+    bool isIntensive(nat == IntensiveMaximum || nat == IntensiveConservation);
     switch (_nature_of_deno)
     {
         case IntensiveMaximum:
-        {
-            ComputeRowSumAndColSum(_matrix, _deno_multiply, _deno_reverse_multiply);
-            break;
-        }
-        case ExtensiveMaximum:
-        {
-            MEDCouplingFieldDouble *deno =
-                srcField->getDiscretization()->getMeasureField(srcField->getMesh(), getMeasureAbsStatus());
-            MEDCouplingFieldDouble *denoR =
-                trgField->getDiscretization()->getMeasureField(trgField->getMesh(), getMeasureAbsStatus());
-            const double *denoPtr = deno->getArray()->getConstPointer();
-            const double *denoRPtr = denoR->getArray()->getConstPointer();
-            if (trgField->getMesh()->getMeshDimension() == -1)
-            {
-                double *denoRPtr2 = denoR->getArray()->getPointer();
-                denoRPtr2[0] = std::accumulate(denoPtr, denoPtr + deno->getNumberOfTuples(), 0.);
-            }
-            if (srcField->getMesh()->getMeshDimension() == -1)
-            {
-                double *denoPtr2 = deno->getArray()->getPointer();
-                denoPtr2[0] = std::accumulate(denoRPtr, denoRPtr + denoR->getNumberOfTuples(), 0.);
-            }
-            int idx = 0;
-            for (std::vector<std::map<mcIdType, double> >::const_iterator iter1 = _matrix.begin();
-                 iter1 != _matrix.end();
-                 iter1++, idx++)
-                for (std::map<mcIdType, double>::const_iterator iter2 = (*iter1).begin(); iter2 != (*iter1).end();
-                     iter2++)
-                {
-                    _deno_multiply[idx][(*iter2).first] = denoPtr[(*iter2).first];
-                    _deno_reverse_multiply[(*iter2).first][idx] = denoRPtr[idx];
-                }
-            deno->decrRef();
-            denoR->decrRef();
-            break;
-        }
         case ExtensiveConservation:
         {
-            ComputeColSumAndRowSum(_matrix, _deno_multiply, _deno_reverse_multiply);
+            updateRowSumAndColSum();
+            rowDenoPtr = _row_sum.data();
+            colDenoPtr = _col_sum.data();
             break;
         }
+        case ExtensiveMaximum:
         case IntensiveConservation:
         {
-            MEDCouplingFieldDouble *deno =
-                trgField->getDiscretization()->getMeasureField(trgField->getMesh(), getMeasureAbsStatus());
-            MEDCouplingFieldDouble *denoR =
-                srcField->getDiscretization()->getMeasureField(srcField->getMesh(), getMeasureAbsStatus());
-            const double *denoPtr = deno->getArray()->getConstPointer();
-            const double *denoRPtr = denoR->getArray()->getConstPointer();
+            // deno is applied to the transfer and denoR to the reverse transfer
+            int side(nat == ExtensiveMaximum ? 0 : 1);
+            const MEDCouplingFieldDouble *f(side == 0 ? srcField : trgField), *fR(side == 0 ? trgField : srcField);
+            deno = getMeasuresForDeno(f, side);
+            denoR = getMeasuresForDeno(fR, 1 - side);
             if (trgField->getMesh()->getMeshDimension() == -1)
-            {
-                double *denoRPtr2 = denoR->getArray()->getPointer();
-                denoRPtr2[0] = std::accumulate(denoPtr, denoPtr + deno->getNumberOfTuples(), 0.);
-            }
+                denoR[0] = std::accumulate(deno.begin(), deno.end(), 0.);
             if (srcField->getMesh()->getMeshDimension() == -1)
-            {
-                double *denoPtr2 = deno->getArray()->getPointer();
-                denoPtr2[0] = std::accumulate(denoRPtr, denoRPtr + denoR->getNumberOfTuples(), 0.);
-            }
-            mcIdType idx = 0;
-            for (std::vector<std::map<mcIdType, double> >::const_iterator iter1 = _matrix.begin();
-                 iter1 != _matrix.end();
-                 iter1++, idx++)
-                for (std::map<mcIdType, double>::const_iterator iter2 = (*iter1).begin(); iter2 != (*iter1).end();
-                     iter2++)
-                {
-                    _deno_multiply[idx][(*iter2).first] = denoPtr[idx];
-                    _deno_reverse_multiply[(*iter2).first][idx] = denoRPtr[(*iter2).first];
-                }
-            deno->decrRef();
-            denoR->decrRef();
+                deno[0] = std::accumulate(denoR.begin(), denoR.end(), 0.);
+            rowDenoPtr = isIntensive ? deno.data() : denoR.data();
+            colDenoPtr = isIntensive ? denoR.data() : deno.data();
             break;
         }
         case NoNature:
             throw INTERP_KERNEL::Exception("No nature specified ! Select one !");
     }
+    mcIdType nbOfRows(ToIdType(_matrix_indptr.size()) - 1);
+    _coeffs_multiply.resize(_matrix_values.size());
+    for (mcIdType i = 0; i < nbOfRows; i++)
+        for (mcIdType k = _matrix_indptr[i]; k < _matrix_indptr[i + 1]; k++)
+            _coeffs_multiply[k] = _matrix_values[k] / (isIntensive ? rowDenoPtr[i] : colDenoPtr[_matrix_indices[k]]);
+    std::vector<double>().swap(_coeffs_reverse_multiply);
+    if (reverse)
+    {
+        if (_reverse_indptr.empty())
+            buildReversePattern();
+        _coeffs_reverse_multiply.resize(_matrix_values.size());
+        for (mcIdType j = 0; j < _nb_of_cols; j++)
+            for (mcIdType p = _reverse_indptr[j]; p < _reverse_indptr[j + 1]; p++)
+                _coeffs_reverse_multiply[p] = _matrix_values[_reverse_entries[p]] /
+                                              (isIntensive ? colDenoPtr[j] : rowDenoPtr[_reverse_indices[p]]);
+    }
+    _time_deno_update = getTimeOfThis();
+    _measure_abs_deno = getMeasureAbsStatus();
+    const MEDCouplingMesh *srcMesh(srcField->getMesh()), *trgMesh(trgField->getMesh());
+    srcMesh->updateTime();
+    trgMesh->updateTime();
+    _src_mesh_deno = std::make_pair(srcMesh, srcMesh->getTimeOfThis());
+    _trg_mesh_deno = std::make_pair(trgMesh, trgMesh->getTimeOfThis());
 }
 
+/*!
+ * Sparse matrix vector product of the CSR matrix (with denominators folded in) by \a inputPointer. Rows are
+ * independent so they are dispatched between threads, without any impact on the result.
+ */
 void
 MEDCouplingRemapper::computeProduct(
     const double *inputPointer, int inputNbOfCompo, bool isDftVal, double dftValue, double *resPointer
 )
 {
-    int idx = 0;
-    double *tmp = new double[inputNbOfCompo];
-    for (std::vector<std::map<mcIdType, double> >::const_iterator iter1 = _matrix.begin(); iter1 != _matrix.end();
-         iter1++, idx++)
+    const mcIdType *indptr(_matrix_indptr.data()), *indices(_matrix_indices.data());
+    const double *coeffs(_coeffs_multiply.data());
+    std::size_t nbOfCompo(inputNbOfCompo);
+    auto product = [=](mcIdType bg, mcIdType end, unsigned int)
     {
-        if ((*iter1).empty())
-        {
-            if (isDftVal)
-                std::fill(resPointer + idx * inputNbOfCompo, resPointer + (idx + 1) * inputNbOfCompo, dftValue);
-            continue;
-        }
-        else
-            std::fill(resPointer + idx * inputNbOfCompo, resPointer + (idx + 1) * inputNbOfCompo, 0.);
-        std::map<mcIdType, double>::const_iterator iter3 = _deno_multiply[idx].begin();
-        for (std::map<mcIdType, double>::const_iterator iter2 = (*iter1).begin(); iter2 != (*iter1).end();
-             iter2++, iter3++)
+        for (mcIdType i = bg; i < end; i++)
         {
-            std::transform(
-                inputPointer + (*iter2).first * inputNbOfCompo,
-                inputPointer + ((*iter2).first + 1) * inputNbOfCompo,
-                tmp,
-                std::bind(std::multiplies<double>(), std::placeholders::_1, (*iter2).second / (*iter3).second)
-            );
-            std::transform(
-                tmp,
-                tmp + inputNbOfCompo,
-                resPointer + idx * inputNbOfCompo,
-                resPointer + idx * inputNbOfCompo,
-                std::plus<double>()
-            );
+            double *res(resPointer + i * nbOfCompo);
+            if (indptr[i] == indptr[i + 1])
+            {
+                if (isDftVal)
+                    std::fill(res, res + nbOfCompo, dftValue);
+                continue;
+            }
+            std::fill(res, res + nbOfCompo, 0.);
+            for (mcIdType k = indptr[i]; k < indptr[i + 1]; k++)
+            {
+                const double *in(inputPointer + indices[k] * nbOfCompo);
+                const double coeff(coeffs[k]);
+                for (std::size_t c = 0; c < nbOfCompo; c++) res[c] += in[c] * coeff;
+            }
         }
-    }
-    delete[] tmp;
+    };
+    INTERP_KERNEL::ParallelForParts(
+        getNbOfPartsForProduct(inputNbOfCompo), mcIdType(0), ToIdType(_matrix_indptr.size()) - 1, product
+    );
 }
 
+/*!
+ * Sparse matrix vector product of the transposed CSR matrix (with reverse denominators folded in) by \a inputPointer.
+ * Source entities not reached by any target entity are set to \a dftValue.
+ */
 void
 MEDCouplingRemapper::computeReverseProduct(
     const double *inputPointer, int inputNbOfCompo, double dftValue, double *resPointer
 )
 {
-    std::vector<bool> isReached(_deno_reverse_multiply.size(), false);
-    mcIdType idx = 0;
-    double *tmp = new double[inputNbOfCompo];
-    std::fill(resPointer, resPointer + inputNbOfCompo * _deno_reverse_multiply.size(), 0.);
-    for (std::vector<std::map<mcIdType, double> >::const_iterator iter1 = _matrix.begin(); iter1 != _matrix.end();
-         iter1++, idx++)
+    const mcIdType *indptr(_reverse_indptr.data()), *indices(_reverse_indices.data());
+    const double *coeffs(_coeffs_reverse_multiply.data());
+    std::size_t nbOfCompo(inputNbOfCompo);
+    auto product = [=](mcIdType bg, mcIdType end, unsigned int)
     {
-        for (std::map<mcIdType, double>::const_iterator iter2 = (*iter1).begin(); iter2 != (*iter1).end(); iter2++)
+        for (mcIdType j = bg; j < end; j++)
         {
-            isReached[(*iter2).first] = true;
-            std::transform(
-                inputPointer + idx * inputNbOfCompo,
-                inputPointer + (idx + 1) * inputNbOfCompo,
-                tmp,
-                std::bind(
-                    std::multiplies<double>(),
-                    std::placeholders::_1,
-                    (*iter2).second / _deno_reverse_multiply[(*iter2).first][idx]
-                )
-            );
-            std::transform(
-                tmp,
-                tmp + inputNbOfCompo,
-                resPointer + ((*iter2).first) * inputNbOfCompo,
-                resPointer + ((*iter2).first) * inputNbOfCompo,
-                std::plus<double>()
-            );
+            double *res(resPointer + j * nbOfCompo);
+            if (indptr[j] == indptr[j + 1])
+            {
+                std::fill(res, res + nbOfCompo, dftValue);
+                continue;
+            }
+            std::fill(res, res + nbOfCompo, 0.);
+            for (mcIdType p = indptr[j]; p < indptr[j + 1]; p++)
+            {
+                const double *in(inputPointer + indices[p] * nbOfCompo);
+                const double coeff(coeffs[p]);
+                for (std::size_t c = 0; c < nbOfCompo; c++) res[c] += in[c] * coeff;
+            }
         }
-    }
-    delete[] tmp;
-    idx = 0;
-    for (std::vector<bool>::const_iterator iter3 = isReached.begin(); iter3 != isReached.end(); iter3++, idx++)
-        if (!*iter3)
-            std::fill(resPointer + idx * inputNbOfCompo, resPointer + (idx + 1) * inputNbOfCompo, dftValue);
+    };
+    INTERP_KERNEL::ParallelForParts(getNbOfPartsForProduct(inputNbOfCompo), mcIdType(0), _nb_of_cols, product);
 }
 
 void
@@ -1577,64 +2148,73 @@ MEDCouplingRemapper::ReverseMatrix(
             matOut[(*iter2).first][id] = (*iter2).second;
 }
 
+/*!
+ * Removes from \a matrix the entries whose coefficient is exactly 0. To be used on the matrix under construction,
+ * before it is converted into the CSR arrays.
+ */
 void
-MEDCouplingRemapper::ComputeRowSumAndColSum(
-    const std::vector<std::map<mcIdType, double> > &matrixDeno,
-    std::vector<std::map<mcIdType, double> > &deno,
-    std::vector<std::map<mcIdType, double> > &denoReverse
-)
+MEDCouplingRemapper::RemoveNullCoeffs(std::vector<std::map<mcIdType, double> > &matrix)
 {
-    std::map<mcIdType, double> values;
-    mcIdType idx = 0;
-    for (std::vector<std::map<mcIdType, double> >::const_iterator iter1 = matrixDeno.begin(); iter1 != matrixDeno.end();
-         iter1++, idx++)
-    {
-        double sum = 0.;
-        for (std::map<mcIdType, double>::const_iterator iter2 = (*iter1).begin(); iter2 != (*iter1).end(); iter2++)
+    for (std::vector<std::map<mcIdType, double> >::iterator it = matrix.begin(); it != matrix.end(); it++)
+        for (std::map<mcIdType, double>::iterator it2 = (*it).begin(); it2 != (*it).end();)
         {
-            sum += (*iter2).second;
-            values[(*iter2).first] += (*iter2).second;
+            if ((*it2).second == 0.)
+                it2 = (*it).erase(it2);
+            else
+                it2++;
         }
-        for (std::map<mcIdType, double>::const_iterator iter2 = (*iter1).begin(); iter2 != (*iter1).end(); iter2++)
-            deno[idx][(*iter2).first] = sum;
-    }
-    idx = 0;
-    for (std::vector<std::map<mcIdType, double> >::const_iterator iter1 = matrixDeno.begin(); iter1 != matrixDeno.end();
-         iter1++, idx++)
-    {
-        for (std::map<mcIdType, double>::const_iterator iter2 = (*iter1).begin(); iter2 != (*iter1).end(); iter2++)
-            denoReverse[(*iter2).first][idx] = values[(*iter2).first];
-    }
 }
 
+/*!
+ * Computes the sum of the coefficients of each row and of each column of the CSR matrix. Sums are accumulated in
+ * increasing column order inside a row and in increasing row order inside a column.
+ */
 void
-MEDCouplingRemapper::ComputeColSumAndRowSum(
-    const std::vector<std::map<mcIdType, double> > &matrixDeno,
-    std::vector<std::map<mcIdType, double> > &deno,
-    std::vector<std::map<mcIdType, double> > &denoReverse
-)
+MEDCouplingRemapper::computeRowSumAndColSum(std::vector<double> &rowSum, std::vector<double> &colSum) const
 {
-    std::map<mcIdType, double> values;
-    mcIdType idx = 0;
-    for (std::vector<std::map<mcIdType, double> >::const_iterator iter1 = matrixDeno.begin(); iter1 != matrixDeno.end();
-         iter1++, idx++)
+    mcIdType nbOfRows(ToIdType(_matrix_indptr.size()) - 1);
+    rowSum.assign(nbOfRows, 0.);
+    colSum.assign(_nb_of_cols, 0.);
+    for (mcIdType i = 0; i < nbOfRows; i++)
     {
         double sum = 0.;
-        for (std::map<mcIdType, double>::const_iterator iter2 = (*iter1).begin(); iter2 != (*iter1).end(); iter2++)
+        for (mcIdType k = _matrix_indptr[i]; k < _matrix_indptr[i + 1]; k++)
         {
-            sum += (*iter2).second;
-            values[(*iter2).first] += (*iter2).second;
+            sum += _matrix_values[k];
+            colSum[_matrix_indices[k]] += _matrix_values[k];
         }
-        for (std::map<mcIdType, double>::const_iterator iter2 = (*iter1).begin(); iter2 != (*iter1).end(); iter2++)
-            denoReverse[(*iter2).first][idx] = sum;
+        rowSum[i] = sum;
     }
-    idx = 0;
-    for (std::vector<std::map<mcIdType, double> >::const_iterator iter1 = matrixDeno.begin(); iter1 != matrixDeno.end();
-         iter1++, idx++)
+}
+
+/*!
+ * Computes \a _row_sum and \a _col_sum if they have been reset since the last change of the CSR matrix.
+ */
+void
+MEDCouplingRemapper::updateRowSumAndColSum() const
+{
+    if (_row_sum.size() + 1 != _matrix_indptr.size() || ToIdType(_col_sum.size()) != _nb_of_cols)
+        computeRowSumAndColSum(_row_sum, _col_sum);
+}
+
+/*!
+ * Returns the measures of the entities of \a f, which is on the source side if \a side is 0 and on the target side if
+ * it is 1. They are kept until the mesh of \a f or the measure abs status change.
+ */
+const std::vector<double> &
+MEDCouplingRemapper::getMeasuresForDeno(const MEDCouplingField *f, int side) const
+{
+    const MEDCouplingMesh *mesh(f->getMesh());
+    mesh->updateTime();
+    std::pair<const MEDCouplingMesh *, std::size_t> meshTime(mesh, mesh->getTimeOfThis());
+    if (_mesh_measures[side] != meshTime || _measure_abs_measures[side] != getMeasureAbsStatus())
     {
-        for (std::map<mcIdType, double>::const_iterator iter2 = (*iter1).begin(); iter2 != (*iter1).end(); iter2++)
-            deno[idx][(*iter2).first] = values[(*iter2).first];
+        MCAuto<MEDCouplingFieldDouble> measures(f->getDiscretization()->getMeasureField(mesh, getMeasureAbsStatus()));
+        _measures[side].assign(measures->getArray()->begin(), measures->getArray()->end());
+        _mesh_measures[side] = meshTime;
+        _measure_abs_measures[side] = getMeasureAbsStatus();
     }
+    return _measures[side];
 }
 
 void
@@ -1689,6 +2269,20 @@ MEDCouplingRemapper::PrintMatrix(const std::vector<std::map<mcIdType, double> >
 const std::vector<std::map<mcIdType, double> > &
 MEDCouplingRemapper::getCrudeMatrix() const
 {
+    if (!_matrix_view_up_to_date)
+    {
+        // the matrix is stored in CSR format. The returned view is built on demand and kept until the matrix changes.
+        mcIdType nbOfRows(std::max(ToIdType(_matrix_indptr.size()) - 1, mcIdType(0)));
+        _matrix.resize(nbOfRows);
+        for (mcIdType i = 0; i < nbOfRows; i++)
+        {
+            std::map<mcIdType, double> &row(_matrix[i]);
+            row.clear();
+            for (mcIdType k = _matrix_indptr[i]; k < _matrix_indptr[i + 1]; k++)
+                row.insert(row.end(), std::pair<const mcIdType, double>(_matrix_indices[k], _matrix_values[k]));
+        }
+        _matrix_view_up_to_date = true;
+    }
     return _matrix;
 }
 
@@ -1698,7 +2292,7 @@ MEDCouplingRemapper::getCrudeMatrix() const
 mcIdType
 MEDCouplingRemapper::getNumberOfColsOfMatrix() const
 {
-    return ToIdType(_deno_reverse_multiply.size());
+    return _nb_of_cols;
 }
 
 /*!
@@ -1719,22 +2313,30 @@ int
 MEDCouplingRemapper::nullifiedTinyCoeffInCrudeMatrixAbs(double maxValAbs)
 {
     int ret = 0;
-    std::vector<std::map<mcIdType, double> > matrixNew(_matrix.size());
-    mcIdType i = 0;
-    for (std::vector<std::map<mcIdType, double> >::const_iterator it1 = _matrix.begin(); it1 != _matrix.end();
-         it1++, i++)
+    mcIdType nbOfRows(ToIdType(_matrix_indptr.size()) - 1), pos(0);
+    for (mcIdType i = 0; i < nbOfRows; i++)
     {
-        std::map<mcIdType, double> &rowNew = matrixNew[i];
-        for (std::map<mcIdType, double>::const_iterator it2 = (*it1).begin(); it2 != (*it1).end(); it2++)
+        mcIdType bg(_matrix_indptr[i]), end(_matrix_indptr[i + 1]);
+        _matrix_indptr[i] = pos;
+        for (mcIdType k = bg; k < end; k++)
         {
-            if (fabs((*it2).second) > maxValAbs)
-                rowNew[(*it2).first] = (*it2).second;
+            if (fabs(_matrix_values[k]) > maxValAbs)
+            {
+                _matrix_indices[pos] = _matrix_indices[k];
+                _matrix_values[pos++] = _matrix_values[k];
+            }
             else
                 ret++;
         }
     }
+    if (nbOfRows >= 0)
+        _matrix_indptr[nbOfRows] = pos;
     if (ret > 0)
-        _matrix = matrixNew;
+    {
+        _matrix_indices.resize(pos);
+        _matrix_values.resize(pos);
+        invalidateCSRDerivedData();
+    }
     return ret;
 }
 
@@ -1771,9 +2373,8 @@ double
 MEDCouplingRemapper::getMaxValueInCrudeMatrix() const
 {
     double ret = 0.;
-    for (std::vector<std::map<mcIdType, double> >::const_iterator it1 = _matrix.begin(); it1 != _matrix.end(); it1++)
-        for (std::map<mcIdType, double>::const_iterator it2 = (*it1).begin(); it2 != (*it1).end(); it2++)
-            if (fabs((*it2).second) > ret)
-                ret = fabs((*it2).second);
+    for (std::vector<double>::const_iterator it = _matrix_values.begin(); it != _matrix_values.end(); it++)
+        if (fabs(*it) > ret)
+            ret = fabs(*it);
     return ret;
 }
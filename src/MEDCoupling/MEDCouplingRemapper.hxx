@@ -36,6 +36,7 @@
 namespace MEDCoupling
 {
 class MEDCouplingMesh;
+class MEDCouplingField;
 class MEDCouplingFieldDouble;
 class MEDCouplingFieldTemplate;
 }  // namespace MEDCoupling
@@ -68,11 +69,21 @@ class MEDCOUPLINGREMAPPER_EXPORT MEDCouplingRemapper : public TimeLabel, public
         const MEDCouplingFieldTemplate *target,
         const std::vector<std::map<mcIdType, double> > &m
     );
+    void savePreparedState(const std::string &fileName) const;
+    void loadPreparedState(
+        const std::string &fileName, const MEDCouplingMesh *srcMesh, const MEDCouplingMesh *targetMesh
+    );
+    void loadPreparedStateEx(
+        const std::string &fileName, const MEDCouplingFieldTemplate *src, const MEDCouplingFieldTemplate *target
+    );
     void transfer(const MEDCouplingFieldDouble *srcField, MEDCouplingFieldDouble *targetField, double dftValue);
     void partialTransfer(const MEDCouplingFieldDouble *srcField, MEDCouplingFieldDouble *targetField);
     void reverseTransfer(MEDCouplingFieldDouble *srcField, const MEDCouplingFieldDouble *targetField, double dftValue);
     MEDCouplingFieldDouble *transferField(const MEDCouplingFieldDouble *srcField, double dftValue);
     MEDCouplingFieldDouble *reverseTransferField(const MEDCouplingFieldDouble *targetField, double dftValue);
+    std::vector<MEDCouplingFieldDouble *> transferFields(
+        const std::vector<const MEDCouplingFieldDouble *> &srcFields, double dftValue
+    );
     bool setOptionInt(const std::string &key, int value);
     bool setOptionDouble(const std::string &key, double value);
     bool setOptionString(const std::string &key, const std::string &value);
@@ -120,10 +131,16 @@ class MEDCOUPLINGREMAPPER_EXPORT MEDCouplingRemapper : public TimeLabel, public
     void transferUnderground(
         const MEDCouplingFieldDouble *srcField, MEDCouplingFieldDouble *targetField, bool isDftVal, double dftValue
     );
-    void computeDeno(NatureOfField nat, const MEDCouplingFieldDouble *srcField, const MEDCouplingFieldDouble *trgField);
+    void computeDeno(
+        NatureOfField nat, const MEDCouplingFieldDouble *srcField, const MEDCouplingFieldDouble *trgField, bool reverse
+    );
     void computeDenoFromScratch(
-        NatureOfField nat, const MEDCouplingFieldDouble *srcField, const MEDCouplingFieldDouble *trgField
+        NatureOfField nat, const MEDCouplingFieldDouble *srcField, const MEDCouplingFieldDouble *trgField, bool reverse
     );
+    void buildCSRFromCrudeMatrix();
+    void buildReversePattern();
+    void invalidateCSRDerivedData();
+    unsigned int getNbOfPartsForProduct(int nbOfCompo) const;
     void computeProduct(
         const double *inputPointer, int inputNbOfCompo, bool isDftVal, double dftValue, double *resPointer
     );
@@ -141,26 +158,47 @@ class MEDCOUPLINGREMAPPER_EXPORT MEDCouplingRemapper : public TimeLabel, public
         mcIdType nbColsMatIn,
         std::vector<std::map<mcIdType, double> > &matOut
     );
-    static void ComputeRowSumAndColSum(
-        const std::vector<std::map<mcIdType, double> > &matrixDeno,
-        std::vector<std::map<mcIdType, double> > &deno,
-        std::vector<std::map<mcIdType, double> > &denoReverse
-    );
-    static void ComputeColSumAndRowSum(
-        const std::vector<std::map<mcIdType, double> > &matrixDeno,
-        std::vector<std::map<mcIdType, double> > &deno,
-        std::vector<std::map<mcIdType, double> > &denoReverse
-    );
+    static void RemoveNullCoeffs(std::vector<std::map<mcIdType, double> > &matrix);
+    void computeRowSumAndColSum(std::vector<double> &rowSum, std::vector<double> &colSum) const;
+    void updateRowSumAndColSum() const;
+    const std::vector<double> &getMeasuresForDeno(const MEDCouplingField *f, int side) const;
 
    private:
     MCAuto<MEDCouplingFieldTemplate> _src_ft;
     MCAuto<MEDCouplingFieldTemplate> _target_ft;
     InterpolationMatrixPolicy _interp_matrix_pol;
     NatureOfField _nature_of_deno;
-    unsigned int _time_deno_update;
-    std::vector<std::map<mcIdType, double> > _matrix;
-    std::vector<std::map<mcIdType, double> > _deno_multiply;
-    std::vector<std::map<mcIdType, double> > _deno_reverse_multiply;
+    std::size_t _time_deno_update;
+    bool _measure_abs_deno;
+    std::pair<const MEDCouplingMesh *, std::size_t> _src_mesh_deno;
+    std::pair<const MEDCouplingMesh *, std::size_t> _trg_mesh_deno;
+    //! matrix under construction during prepare. After prepare it is only a view of the CSR matrix built on demand
+    //! by getCrudeMatrix.
+    mutable std::vector<std::map<mcIdType, double> > _matrix;
+    mutable bool _matrix_view_up_to_date;
+    //! crude matrix in compressed sparse row format : one row per target entity, columns are source entities.
+    std::vector<mcIdType> _matrix_indptr;
+    std::vector<mcIdType> _matrix_indices;
+    std::vector<double> _matrix_values;
+    mcIdType _nb_of_cols;
+    //! _matrix_values divided by the denominators of _nature_of_deno : coefficients used by transfer.
+    std::vector<double> _coeffs_multiply;
+    //! pattern of the transposed crude matrix (one row per source entity) built on first reverse transfer.
+    //! _reverse_entries gives for each coefficient of the transposed matrix its position in _matrix_values.
+    std::vector<mcIdType> _reverse_indptr;
+    std::vector<mcIdType> _reverse_indices;
+    std::vector<mcIdType> _reverse_entries;
+    //! transposed _matrix_values divided by the reverse denominators of _nature_of_deno : used by reverseTransfer.
+    std::vector<double> _coeffs_reverse_multiply;
+    //! sums of the rows and of the columns of the CSR matrix, used as denominators by some natures. Reset with the
+    //! matrix.
+    mutable std::vector<double> _row_sum;
+    mutable std::vector<double> _col_sum;
+    //! measures of the source (0) and target (1) entities used as denominators by the other natures, with the mesh and
+    //! its time, and the measure abs status they were computed with.
+    mutable std::vector<double> _measures[2];
+    mutable std::pair<const MEDCouplingMesh *, std::size_t> _mesh_measures[2];
+    mutable bool _measure_abs_measures[2];
 };
 }  // namespace MEDCoupling
 
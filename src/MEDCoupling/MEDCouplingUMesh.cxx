@@ -29,6 +29,8 @@
 #include "PointLocatorAlgos.txx"
 #include "BBTree.txx"
 #include "BBTreeDst.txx"
+#include "InterpKernelThreadPool.hxx"
+#include "InterpKernelSpaceFillingCurve.hxx"
 #include "SplitterTetra.hxx"
 #include "DiameterCalculator.hxx"
 #include "DirectedBoundingBox.hxx"
@@ -42,8 +44,10 @@
 #include "InterpKernelGeo2DEdgeArcCircle.hxx"
 #include "InterpKernelGeo2DQuadraticPolygon.hxx"
 #include "OrientationInverter.hxx"
+#include "MEDCouplingVTKWriter.hxx"
 #include "MEDCouplingUMesh_internal.hxx"
 
+#include <atomic>
 #include <functional>
 #include <sstream>
 #include <fstream>
@@ -52,6 +56,7 @@
 #include <cstring>
 #include <limits>
 #include <list>
+#include <mutex>
 #include <set>
 
 using namespace MEDCoupling;
@@ -147,9 +152,41 @@ std::size_t
 MEDCouplingUMesh::getHeapMemorySizeWithoutChildren() const
 {
     std::size_t ret(MEDCouplingPointSet::getHeapMemorySizeWithoutChildren());
+    if (_topology_cache)
+        ret += _topology_cache->getHeapMemorySize();
     return ret;
 }
 
+/*!
+ * Enables or disables the cache of the topology derived from \a this : reverse nodal connectivity, descending
+ * connectivity, neighbors of cells, bounding boxes of cells and BBTree used for point location. The cache is disabled
+ * by default. Once enabled, the first call to getReverseNodalConnectivity, buildDescendingConnectivity,
+ * computeNeighborsOfCells or getBoundingBoxForBBTree stores its result, and the following calls return a copy of it
+ * as long as \a this, its coordinates and its connectivity are not modified. Any modification (see updateTime) drops
+ * all the cached entries. The memory used by the cache is reported by getHeapMemorySize.
+ *  \param [in] enabled - if false, the cache is released.
+ * \sa clearTopologyCache, isTopologyCacheEnabled
+ */
+void
+MEDCouplingUMesh::setTopologyCacheEnabled(bool enabled)
+{
+    if (!enabled)
+        _topology_cache.reset();
+    else if (!_topology_cache)
+        _topology_cache.reset(new MEDCouplingUMeshTopologyCache);
+}
+
+/*!
+ * Releases the entries of the topology cache of \a this, which stays enabled if it was.
+ * \sa setTopologyCacheEnabled
+ */
+void
+MEDCouplingUMesh::clearTopologyCache() const
+{
+    if (_topology_cache)
+        _topology_cache->clear();
+}
+
 std::vector<const BigMemoryObject *>
 MEDCouplingUMesh::getDirectChildrenWithNull() const
 {
@@ -682,7 +719,7 @@ MEDCouplingUMesh::checkFastEquivalWith(const MEDCouplingMesh *other, double prec
  *        [ \a revNodalIndx[1], \a revNodalIndx[2] ) and the cell ids are
  *        \a revNodal[ \a revNodalIndx[1] ], \a revNodal[ \a revNodalIndx[1] + 1], ...
  *        Number of cells sharing the *i*-th node is
- *        \a revNodalIndx[ *i*+1 ] - \a revNodalIndx[ *i* ].
+ *        \a revNodalIndx[ *i*+1 ] - \a revNodalIndx[ *i* ]. The cells sharing a node are sorted by ascending id.
  * \throw If the coordinates array is not set.
  * \throw If the nodal connectivity of cells is not defined.
  *
@@ -693,47 +730,134 @@ MEDCouplingUMesh::checkFastEquivalWith(const MEDCouplingMesh *other, double prec
  */
 void
 MEDCouplingUMesh::getReverseNodalConnectivity(DataArrayIdType *revNodal, DataArrayIdType *revNodalIndx) const
+{
+    getReverseNodalConnectivity(revNodal, revNodalIndx, true);
+}
+
+/*!
+ * Same as getReverseNodalConnectivity(DataArrayIdType *, DataArrayIdType *) const, except that the order of the
+ * cells sharing a node can be left unspecified. If the topology cache is enabled, the sorted result is cached and
+ * returned whatever \a sorted.
+ * The reverse nodal connectivity is computed by a counting sort, using the threads allowed by
+ * MEDCouplingGetNbOfThreads. With several threads, the cells are dispatched to the nodes in an arbitrary order.
+ * \param [in] sorted - if true, the cells sharing a node are sorted by ascending id, which costs a sort of the cells
+ *        of each node when several threads are used. If false, their order depends on the threads scheduling.
+ * \sa getReverseNodalConnectivity
+ */
+void
+MEDCouplingUMesh::getReverseNodalConnectivity(
+    DataArrayIdType *revNodal, DataArrayIdType *revNodalIndx, bool sorted
+) const
 {
     checkFullyDefined();
-    mcIdType nbOfNodes(getNumberOfNodes());
+    if (!_topology_cache)
+    {
+        computeReverseNodalConnectivity(revNodal, revNodalIndx, sorted);
+        return;
+    }
+    std::size_t time(MEDCouplingUMeshTopologyCache::TimeOf(this));
+    std::vector<MCAuto<DataArrayIdType> > cached;
+    if (!_topology_cache->get(time, MEDCouplingUMeshTopologyCache::REVERSE_NODAL, cached))
+    {
+        cached.push_back(DataArrayIdType::New());
+        cached.push_back(DataArrayIdType::New());
+        computeReverseNodalConnectivity(cached[0], cached[1], true);
+        _topology_cache->set(time, MEDCouplingUMeshTopologyCache::REVERSE_NODAL, cached);
+    }
+    revNodal->deepCopyFrom(*cached[0]);
+    revNodalIndx->deepCopyFrom(*cached[1]);
+}
+
+void
+MEDCouplingUMesh::computeReverseNodalConnectivity(
+    DataArrayIdType *revNodal, DataArrayIdType *revNodalIndx, bool sorted
+) const
+{
+    const mcIdType GRAIN = 4096;
+    mcIdType nbOfNodes(getNumberOfNodes()), nbOfCells(getNumberOfCells());
+    const mcIdType *conn(_nodal_connec->begin()), *connIndex(_nodal_connec_index->begin());
+    unsigned int nbOfThreads(INTERP_KERNEL::GetEffectiveNbOfThreads(MEDCouplingGetNbOfThreads()));
     mcIdType *revNodalIndxPtr = (mcIdType *)malloc((nbOfNodes + 1) * sizeof(mcIdType));
     revNodalIndx->useArray(revNodalIndxPtr, true, DeallocType::C_DEALLOC, nbOfNodes + 1, 1);
     std::fill(revNodalIndxPtr, revNodalIndxPtr + nbOfNodes + 1, 0);
-    const mcIdType *conn(_nodal_connec->begin()), *connIndex(_nodal_connec_index->begin());
-    mcIdType nbOfCells(getNumberOfCells()), nbOfEltsInRevNodal(0);
-    for (mcIdType eltId = 0; eltId < nbOfCells; eltId++)
-    {
-        const mcIdType *strtNdlConnOfCurCell(conn + connIndex[eltId] + 1),
-            *endNdlConnOfCurCell(conn + connIndex[eltId + 1]);
-        for (const mcIdType *iter = strtNdlConnOfCurCell; iter != endNdlConnOfCurCell; iter++)
-            if (*iter >= 0)  // for polyhedrons
-            {
-                nbOfEltsInRevNodal++;
-                revNodalIndxPtr[(*iter) + 1]++;
-            }
+    if (nbOfThreads < 2 || nbOfCells < 2 * GRAIN)
+    {
+        for (mcIdType eltId = 0; eltId < nbOfCells; eltId++)
+            for (const mcIdType *iter = conn + connIndex[eltId] + 1; iter != conn + connIndex[eltId + 1]; iter++)
+                if (*iter >= 0)  // for polyhedrons
+                    revNodalIndxPtr[(*iter) + 1]++;
+        std::partial_sum(revNodalIndxPtr, revNodalIndxPtr + nbOfNodes + 1, revNodalIndxPtr);
+        mcIdType nbOfEltsInRevNodal(revNodalIndxPtr[nbOfNodes]);
+        mcIdType *revNodalPtr = (mcIdType *)malloc(nbOfEltsInRevNodal * sizeof(mcIdType));
+        revNodal->useArray(revNodalPtr, true, DeallocType::C_DEALLOC, nbOfEltsInRevNodal, 1);
+        // revNodalIndxPtr[i] is used as the insertion position in the group of node #i-1, then shifted back
+        for (mcIdType eltId = 0; eltId < nbOfCells; eltId++)
+            for (const mcIdType *iter = conn + connIndex[eltId] + 1; iter != conn + connIndex[eltId + 1]; iter++)
+                if (*iter >= 0)
+                    revNodalPtr[revNodalIndxPtr[*iter]++] = eltId;
+        std::copy_backward(revNodalIndxPtr, revNodalIndxPtr + nbOfNodes, revNodalIndxPtr + nbOfNodes + 1);
+        revNodalIndxPtr[0] = 0;
+        return;
     }
-    std::transform(
-        revNodalIndxPtr + 1,
-        revNodalIndxPtr + nbOfNodes + 1,
-        revNodalIndxPtr,
-        revNodalIndxPtr + 1,
-        std::plus<mcIdType>()
+    // one atomic counter per node rather than one histogram per thread : the memory stays proportional to the mesh
+    std::unique_ptr<std::atomic<mcIdType>[]> cursors(new std::atomic<mcIdType>[nbOfNodes]);
+    INTERP_KERNEL::ParallelForChunks(
+        nbOfThreads,
+        mcIdType(0),
+        nbOfNodes,
+        GRAIN,
+        [&](mcIdType bg, mcIdType end, unsigned int)
+        {
+            for (mcIdType i = bg; i < end; i++) cursors[i].store(0, std::memory_order_relaxed);
+        }
     );
-    mcIdType *revNodalPtr = (mcIdType *)malloc(nbOfEltsInRevNodal * sizeof(mcIdType));
-    revNodal->useArray(revNodalPtr, true, DeallocType::C_DEALLOC, nbOfEltsInRevNodal, 1);
-    std::fill(revNodalPtr, revNodalPtr + nbOfEltsInRevNodal, -1);
-    for (mcIdType eltId = 0; eltId < nbOfCells; eltId++)
+    INTERP_KERNEL::ParallelForChunks(
+        nbOfThreads,
+        mcIdType(0),
+        nbOfCells,
+        GRAIN,
+        [&](mcIdType bg, mcIdType end, unsigned int)
+        {
+            for (mcIdType eltId = bg; eltId < end; eltId++)
+                for (const mcIdType *iter = conn + connIndex[eltId] + 1; iter != conn + connIndex[eltId + 1]; iter++)
+                    if (*iter >= 0)
+                        cursors[*iter].fetch_add(1, std::memory_order_relaxed);
+        }
+    );
+    for (mcIdType i = 0; i < nbOfNodes; i++)
     {
-        const mcIdType *strtNdlConnOfCurCell = conn + connIndex[eltId] + 1;
-        const mcIdType *endNdlConnOfCurCell = conn + connIndex[eltId + 1];
-        for (const mcIdType *iter = strtNdlConnOfCurCell; iter != endNdlConnOfCurCell; iter++)
-            if (*iter >= 0)  // for polyhedrons
-                *std::find_if(
-                    revNodalPtr + revNodalIndxPtr[*iter],
-                    revNodalPtr + revNodalIndxPtr[*iter + 1],
-                    std::bind(std::equal_to<mcIdType>(), std::placeholders::_1, -1)
-                ) = eltId;
+        revNodalIndxPtr[i + 1] = revNodalIndxPtr[i] + cursors[i].load(std::memory_order_relaxed);
+        cursors[i].store(revNodalIndxPtr[i], std::memory_order_relaxed);
     }
+    mcIdType nbOfEltsInRevNodal(revNodalIndxPtr[nbOfNodes]);
+    mcIdType *revNodalPtr = (mcIdType *)malloc(nbOfEltsInRevNodal * sizeof(mcIdType));
+    revNodal->useArray(revNodalPtr, true, DeallocType::C_DEALLOC, nbOfEltsInRevNodal, 1);
+    INTERP_KERNEL::ParallelForChunks(
+        nbOfThreads,
+        mcIdType(0),
+        nbOfCells,
+        GRAIN,
+        [&](mcIdType bg, mcIdType end, unsigned int)
+        {
+            for (mcIdType eltId = bg; eltId < end; eltId++)
+                for (const mcIdType *iter = conn + connIndex[eltId] + 1; iter != conn + connIndex[eltId + 1]; iter++)
+                    if (*iter >= 0)
+                        revNodalPtr[cursors[*iter].fetch_add(1, std::memory_order_relaxed)] = eltId;
+        }
+    );
+    if (!sorted)
+        return;
+    INTERP_KERNEL::ParallelForChunks(
+        nbOfThreads,
+        mcIdType(0),
+        nbOfNodes,
+        GRAIN,
+        [&](mcIdType bg, mcIdType end, unsigned int)
+        {
+            for (mcIdType i = bg; i < end; i++)
+                std::sort(revNodalPtr + revNodalIndxPtr[i], revNodalPtr + revNodalIndxPtr[i + 1]);
+        }
+    );
 }
 
 /*!
@@ -778,6 +902,7 @@ MEDCouplingUMesh::getReverseNodalConnectivity(DataArrayIdType *revNodal, DataArr
  *  \ref cpp_mcumesh_buildDescendingConnectivity "Here is a C++ example".<br>
  *  \ref  py_mcumesh_buildDescendingConnectivity "Here is a Python example".
  *  \endif
+ *  The computation uses the threads allowed by MEDCouplingGetNbOfThreads, the result does not depend on their number.
  * \sa buildDescendingConnectivity2, buildDescendingConnectivityCrude
  */
 MEDCouplingUMesh *
@@ -785,9 +910,41 @@ MEDCouplingUMesh::buildDescendingConnectivity(
     DataArrayIdType *desc, DataArrayIdType *descIndx, DataArrayIdType *revDesc, DataArrayIdType *revDescIndx
 ) const
 {
-    return buildDescendingConnectivityGen<MinusOneSonsGenerator>(
-        desc, descIndx, revDesc, revDescIndx, MEDCouplingFastNbrer
-    );
+    if (!_topology_cache)
+        return buildDescendingConnectivityGen<MinusOneSonsGenerator>(
+            desc, descIndx, revDesc, revDescIndx, MEDCouplingFastNbrer
+        );
+    if (!desc || !descIndx || !revDesc || !revDescIndx)
+        throw INTERP_KERNEL::Exception(
+            "MEDCouplingUMesh::buildDescendingConnectivity : present of a null pointer in input !"
+        );
+    checkConnectivityFullyDefined();
+    std::size_t time(MEDCouplingUMeshTopologyCache::TimeOf(this));
+    std::vector<MCAuto<DataArrayIdType> > cached;
+    if (!_topology_cache->get(time, MEDCouplingUMeshTopologyCache::DESCENDING, cached))
+    {
+        MCAuto<MEDCouplingUMesh> ret(buildDescendingConnectivityGen<MinusOneSonsGenerator>(
+            desc, descIndx, revDesc, revDescIndx, MEDCouplingFastNbrer
+        ));
+        cached.push_back(desc->deepCopy());
+        cached.push_back(descIndx->deepCopy());
+        cached.push_back(revDesc->deepCopy());
+        cached.push_back(revDescIndx->deepCopy());
+        cached.push_back(ret->getNodalConnectivity()->deepCopy());
+        cached.push_back(ret->getNodalConnectivityIndex()->deepCopy());
+        _topology_cache->set(time, MEDCouplingUMeshTopologyCache::DESCENDING, cached);
+        return ret.retn();
+    }
+    desc->deepCopyFrom(*cached[0]);
+    descIndx->deepCopyFrom(*cached[1]);
+    revDesc->deepCopyFrom(*cached[2]);
+    revDescIndx->deepCopyFrom(*cached[3]);
+    MCAuto<DataArrayIdType> conn(cached[4]->deepCopy()), connI(cached[5]->deepCopy());
+    MCAuto<MEDCouplingUMesh> ret(MEDCouplingUMesh::New(getName(), getMeshDimension() - 1));
+    ret->setCoords(getCoords());
+    ret->setConnectivity(conn, connI, true);
+    ret->copyTinyInfoFrom(this);
+    return ret.retn();
 }
 
 /*!
@@ -1044,6 +1201,18 @@ MEDCouplingUMesh::buildDescendingConnectivity2(
 void
 MEDCouplingUMesh::computeNeighborsOfCells(DataArrayIdType *&neighbors, DataArrayIdType *&neighborsIndx) const
 {
+    std::size_t time(0);
+    if (_topology_cache)
+    {
+        time = MEDCouplingUMeshTopologyCache::TimeOf(this);
+        std::vector<MCAuto<DataArrayIdType> > cached;
+        if (_topology_cache->get(time, MEDCouplingUMeshTopologyCache::NEIGHBORS, cached))
+        {
+            neighbors = cached[0]->deepCopy();
+            neighborsIndx = cached[1]->deepCopy();
+            return;
+        }
+    }
     MCAuto<DataArrayIdType> desc = DataArrayIdType::New();
     MCAuto<DataArrayIdType> descIndx = DataArrayIdType::New();
     MCAuto<DataArrayIdType> revDesc = DataArrayIdType::New();
@@ -1051,6 +1220,13 @@ MEDCouplingUMesh::computeNeighborsOfCells(DataArrayIdType *&neighbors, DataArray
     MCAuto<MEDCouplingUMesh> meshDM1 = buildDescendingConnectivity(desc, descIndx, revDesc, revDescIndx);
     meshDM1 = 0;
     ComputeNeighborsOfCellsAdv(desc, descIndx, revDesc, revDescIndx, neighbors, neighborsIndx);
+    if (_topology_cache)
+    {
+        std::vector<MCAuto<DataArrayIdType> > cached;
+        cached.push_back(neighbors->deepCopy());
+        cached.push_back(neighborsIndx->deepCopy());
+        _topology_cache->set(time, MEDCouplingUMeshTopologyCache::NEIGHBORS, cached);
+    }
 }
 
 /**
@@ -4142,6 +4318,7 @@ MEDCouplingUMesh::setConnectivity(DataArrayIdType *conn, DataArrayIdType *connIn
 /*!
  * Copy constructor. If 'deepCopy' is false \a this is a shallow copy of other.
  * If 'deeCpy' is true all arrays (coordinates and connectivities) are deeply copied.
+ * The topology cache is not copied : if it is enabled in \a other, it is enabled and empty in \a this.
  */
 MEDCouplingUMesh::MEDCouplingUMesh(const MEDCouplingUMesh &other, bool deepCpy)
     : MEDCouplingPointSet(other, deepCpy),
@@ -4154,6 +4331,8 @@ MEDCouplingUMesh::MEDCouplingUMesh(const MEDCouplingUMesh &other, bool deepCpy)
         _nodal_connec = other._nodal_connec->performCopyOrIncrRef(deepCpy);
     if (other._nodal_connec_index)
         _nodal_connec_index = other._nodal_connec_index->performCopyOrIncrRef(deepCpy);
+    if (other._topology_cache)
+        _topology_cache.reset(new MEDCouplingUMeshTopologyCache);
 }
 
 MEDCouplingUMesh::~MEDCouplingUMesh()
@@ -4318,6 +4497,8 @@ MEDCouplingUMesh::unserialization(
  * For 1D cells, the returned field contains lengths.<br>
  * For 2D cells, the returned field contains areas.<br>
  * For 3D cells, the returned field contains volumes.
+ * The consecutive cells of a same linear type are processed by a kernel specialized for this type (see
+ * INTERP_KERNEL::computeVolSurfOfCellsOfType), using the threads allowed by MEDCouplingGetNbOfThreads.
  *  \param [in] isAbs - if \c true, the computed cell volume does not reflect cell
  *         orientation, i.e. the volume is always positive.
  *  \return MEDCouplingFieldDouble * - a new instance of MEDCouplingFieldDouble on cells
@@ -4341,22 +4522,32 @@ MEDCouplingUMesh::getMeasureField(bool isAbs) const
     field->synchronizeTimeWithMesh();
     if (getMeshDimension() != -1)
     {
-        mcIdType ipt;
-        INTERP_KERNEL::NormalizedCellType type;
         int dim_space = getSpaceDimension();
         const double *coords = getCoords()->getConstPointer();
         const mcIdType *connec = getNodalConnectivity()->getConstPointer();
         const mcIdType *connec_index = getNodalConnectivityIndex()->getConstPointer();
-        for (mcIdType iel = 0; iel < nbelem; iel++)
-        {
-            ipt = connec_index[iel];
-            type = (INTERP_KERNEL::NormalizedCellType)connec[ipt];
-            area_vol[iel] = INTERP_KERNEL::computeVolSurfOfCell2<mcIdType, INTERP_KERNEL::ALL_C_MODE>(
-                type, connec + ipt + 1, connec_index[iel + 1] - ipt - 1, coords, dim_space
-            );
-        }
-        if (isAbs)
-            std::transform(area_vol, area_vol + nbelem, area_vol, [](double c) { return fabs(c); });
+        ForEachRangeOfCellsOfSameType(
+            this,
+            [&](INTERP_KERNEL::NormalizedCellType type, mcIdType bg, mcIdType end, mcIdType stride)
+            {
+                bool batched(
+                    stride != 0 &&
+                    INTERP_KERNEL::computeVolSurfOfCellsOfType<mcIdType, INTERP_KERNEL::ALL_C_MODE>(
+                        type, connec + connec_index[bg] + 1, stride, end - bg, coords, dim_space, area_vol + bg
+                    )
+                );
+                if (!batched)
+                    for (mcIdType iel = bg; iel < end; iel++)
+                    {
+                        mcIdType ipt(connec_index[iel]);
+                        area_vol[iel] = INTERP_KERNEL::computeVolSurfOfCell2<mcIdType, INTERP_KERNEL::ALL_C_MODE>(
+                            type, connec + ipt + 1, connec_index[iel + 1] - ipt - 1, coords, dim_space
+                        );
+                    }
+                if (isAbs)
+                    std::transform(area_vol + bg, area_vol + end, area_vol + bg, [](double c) { return fabs(c); });
+            }
+        );
     }
     else
     {
@@ -5497,6 +5688,70 @@ MEDCouplingUMesh::getCellsContainingPoints(
     );
 }
 
+/*!
+ * Finds, for each point of \a pts, one cell in contact with the ball centered on this point and of radius \a eps.
+ * This method is intended for points moving from one call to the other, like particles or probes : if cell
+ * \a cellIdsGuess [ *i* ] (typically the result of the previous call) contains the *i*-th point it is returned
+ * without any search. Otherwise the smallest id of the cells containing the point is returned, as
+ * getCellContainingPoint() does. The points not found in their guessed cell are located by batch, like in
+ * getCellsContainingPoints(), and the search structure is not even built if all points are in their guessed cell.
+ * See MEDCouplingSetNbOfThreads to use several threads.
+ *  \param [in] pts - the points to locate. Its number of components must be equal to \a this->getSpaceDimension().
+ *  \param [in] eps - ball radius (i.e. the precision), same meaning as in getCellsContainingPoints().
+ *  \param [in] cellIdsGuess - if not null, an array with one component and as many tuples as \a pts, giving the
+ *         guessed cell of each point. Negative values mean no guess.
+ *  \return DataArrayIdType * - a new array with one component and as many tuples as \a pts, giving the cell
+ *         found for each point, or -1 if the point is in no cell. The caller is to delete this array using decrRef()
+ *         as it is no more needed.
+ *  \throw If the coordinates array is not set.
+ *  \throw If \a this->getMeshDimension() != \a this->getSpaceDimension().
+ *  \throw If \a pts is not allocated or if its number of components is not equal to the space dimension.
+ *  \throw If \a cellIdsGuess is not null and is not allocated or has not one component and as many tuples as \a pts.
+ *  \sa getCellsContainingPoints, getCellContainingPoint
+ */
+DataArrayIdType *
+MEDCouplingUMesh::getCellContainingPoints(
+    const DataArrayDouble *pts, double eps, const DataArrayIdType *cellIdsGuess
+) const
+{
+    if (!pts)
+        throw INTERP_KERNEL::Exception("MEDCouplingUMesh::getCellContainingPoints : null input points !");
+    pts->checkAllocated();
+    checkFullyDefined();
+    int spaceDim(getSpaceDimension()), mDim(getMeshDimension());
+    if (pts->getNumberOfComponents() != (std::size_t)spaceDim)
+        throw INTERP_KERNEL::Exception(
+            "MEDCouplingUMesh::getCellContainingPoints : number of components of points must be equal to the space "
+            "dimension !"
+        );
+    mcIdType nbOfPoints(pts->getNumberOfTuples());
+    const mcIdType *guess(nullptr);
+    if (cellIdsGuess)
+    {
+        cellIdsGuess->checkAllocated();
+        if (cellIdsGuess->getNumberOfComponents() != 1 || cellIdsGuess->getNumberOfTuples() != nbOfPoints)
+            throw INTERP_KERNEL::Exception(
+                "MEDCouplingUMesh::getCellContainingPoints : guess array must have one component and as many tuples "
+                "as points !"
+            );
+        guess = cellIdsGuess->begin();
+    }
+    if (spaceDim != mDim || spaceDim < 1 || spaceDim > 3)
+        throw INTERP_KERNEL::Exception(
+            "MEDCouplingUMesh::getCellContainingPoints : only managed for meshDim == spaceDim in [1,2,3] !"
+        );
+    MCAuto<DataArrayIdType> ret(DataArrayIdType::New());
+    ret->alloc(nbOfPoints, 1);
+    const double *coords(_coords->begin());
+    if (spaceDim == 3)
+        getCellContainingPointsAlg<3>(coords, pts->begin(), nbOfPoints, eps, guess, ret->getPointer());
+    else if (spaceDim == 2)
+        getCellContainingPointsAlg<2>(coords, pts->begin(), nbOfPoints, eps, guess, ret->getPointer());
+    else
+        getCellContainingPointsAlg<1>(coords, pts->begin(), nbOfPoints, eps, guess, ret->getPointer());
+    return ret.retn();
+}
+
 /*!
  * Behaves like MEDCouplingMesh::getCellsContainingPoints for cells in \a this that are linear.
  * For quadratic cells in \a this, this method behaves by just considering linear part of cells.
@@ -7120,10 +7375,26 @@ MEDCouplingUMesh::computeDiameterField() const
  *
  * \throw If \a this is not fully set (coordinates and connectivity).
  * \throw If a cell in \a this has no valid nodeId.
- * \sa MEDCouplingUMesh::getBoundingBoxForBBTreeFast, MEDCouplingUMesh::getBoundingBoxForBBTree2DQuadratic
+ * \sa MEDCouplingUMesh::getBoundingBoxForBBTreeFast, MEDCouplingUMesh::getBoundingBoxForBBTree2DQuadratic,
+ *     MEDCouplingUMesh::setTopologyCacheEnabled
  */
 DataArrayDouble *
 MEDCouplingUMesh::getBoundingBoxForBBTree(double arcDetEps) const
+{
+    if (!_topology_cache)
+        return computeBoundingBoxForBBTree(arcDetEps);
+    std::size_t time(MEDCouplingUMeshTopologyCache::TimeOf(this));
+    MCAuto<DataArrayDouble> cached;
+    if (!_topology_cache->getBoundingBox(time, arcDetEps, cached))
+    {
+        cached = computeBoundingBoxForBBTree(arcDetEps);
+        _topology_cache->setBoundingBox(time, arcDetEps, cached);
+    }
+    return cached->deepCopy();
+}
+
+DataArrayDouble *
+MEDCouplingUMesh::computeBoundingBoxForBBTree(double arcDetEps) const
 {
     int mDim(getMeshDimension()), sDim(getSpaceDimension());
     if ((mDim == 3 && sDim == 3) || (mDim == 2 && sDim == 3) || (mDim == 1 && sDim == 1) ||
@@ -7706,6 +7977,30 @@ MEDCouplingUMesh::sortCellsInMEDFileFrmt()
     return ret.retn();
 }
 
+/*!
+ * Permutes the cells of \a this along the space filling curve \a curve going through their iso barycenters, so that
+ * cells close to each other in space are also close in memory. Combined with renumberNodesAlongSpaceFillingCurve, this
+ * speeds up the algorithms going through the cells and fetching their nodes, such as the BBTree queries and the
+ * interpolation.
+ * The cells are no longer sorted by type. A later call to sortCellsInMEDFileFrmt restores this order required by the
+ * MED file format, keeping the order along the curve inside each type.
+ *  \param [in] curve - the space filling curve, see MEDCouplingPointSet::ComputeSpaceFillingCurveRenumbering.
+ *  \return DataArrayIdType * - a new array, in "Old to New" mode, passed to renumberCells. The caller is to delete
+ *          this array using decrRef() as it is no more needed.
+ *  \throw If the coordinates array is not set.
+ *  \throw If the nodal connectivity of cells is not defined.
+ *  \sa MEDCouplingPointSet::renumberNodesAlongSpaceFillingCurve
+ */
+DataArrayIdType *
+MEDCouplingUMesh::sortCellsAlongSpaceFillingCurve(SpaceFillingCurve curve)
+{
+    checkFullyDefined();
+    MCAuto<DataArrayDouble> bary(computeIsoBarycenterOfNodesPerCell());
+    MCAuto<DataArrayIdType> ret(ComputeSpaceFillingCurveRenumbering(bary, curve));
+    renumberCells(ret->begin(), false);
+    return ret.retn();
+}
+
 /*!
  * This methods checks that cells are sorted by their types.
  * This method makes asumption (no check) that connectivity is correctly set before calling.
@@ -8299,6 +8594,8 @@ MEDCouplingUMesh::mergeMyselfWith(const MEDCouplingMesh *other) const
  * Beware also that for quadratic meshes, degenerated arc of circles are turned into linear edges for the computation.
  * This happens with a default detection precision of eps=1.0e-14. If you need control over this use
  * computeCellCenterOfMassWithPrecision().
+ * The consecutive cells of a same linear type are processed by a kernel specialized for this type (see
+ * INTERP_KERNEL::computeBarycenterOfCellsOfType), using the threads allowed by MEDCouplingGetNbOfThreads.
  *  \return DataArrayDouble * - a new instance of DataArrayDouble, of size \a
  *          this->getNumberOfCells() tuples per \a this->getSpaceDimension()
  *          components. The caller is to delete this array using decrRef() as it is
@@ -8320,14 +8617,24 @@ MEDCouplingUMesh::computeCellCenterOfMass() const
     const mcIdType *nodal = _nodal_connec->begin();
     const mcIdType *nodalI = _nodal_connec_index->begin();
     const double *coor = _coords->begin();
-    for (mcIdType i = 0; i < nbOfCells; i++)
-    {
-        INTERP_KERNEL::NormalizedCellType type = (INTERP_KERNEL::NormalizedCellType)nodal[nodalI[i]];
-        INTERP_KERNEL::computeBarycenter2<mcIdType, INTERP_KERNEL::ALL_C_MODE>(
-            type, nodal + nodalI[i] + 1, nodalI[i + 1] - nodalI[i] - 1, coor, spaceDim, ptToFill
-        );
-        ptToFill += spaceDim;
-    }
+    ForEachRangeOfCellsOfSameType(
+        this,
+        [&](INTERP_KERNEL::NormalizedCellType type, mcIdType bg, mcIdType end, mcIdType stride)
+        {
+            bool batched(
+                stride != 0 &&
+                INTERP_KERNEL::computeBarycenterOfCellsOfType<mcIdType, INTERP_KERNEL::ALL_C_MODE>(
+                    type, nodal + nodalI[bg] + 1, stride, end - bg, coor, spaceDim, ptToFill + bg * spaceDim
+                )
+            );
+            if (batched)
+                return;
+            for (mcIdType i = bg; i < end; i++)
+                INTERP_KERNEL::computeBarycenter2<mcIdType, INTERP_KERNEL::ALL_C_MODE>(
+                    type, nodal + nodalI[i] + 1, nodalI[i + 1] - nodalI[i] - 1, coor, spaceDim, ptToFill + i * spaceDim
+                );
+        }
+    );
     return ret.retn();
 }
 
@@ -9600,111 +9907,160 @@ MEDCouplingUMesh::generateGraph() const
 
 void
 MEDCouplingUMesh::writeVTKLL(
-    std::ostream &ofs, const std::string &cellData, const std::string &pointData, DataArrayByte *byteData
+    std::ostream &ofs,
+    const std::string &cellData,
+    const std::string &pointData,
+    MEDCouplingVTKAppendedData *appendedData
 ) const
 {
-    mcIdType nbOfCells = getNumberOfCells();
+    writeVTKPartLL(ofs, 0, getNumberOfCells(), nullptr, cellData, pointData, appendedData);
+}
+
+/*!
+ * Same as writeVTKLL but only for the cells [ \a bg, \a end ), as a piece of its own. The arrays of the piece are
+ * produced on the fly from the arrays of \a this : only the renumbering of the nodes of the piece is built, and the
+ * coordinates if 2D.
+ * \param [in] nodeIds - the ascending ids of the nodes of these cells, that are the nodes of the piece. If null, the
+ *              piece has all the nodes of \a this.
+ */
+void
+MEDCouplingUMesh::writeVTKPartLL(
+    std::ostream &ofs,
+    mcIdType bg,
+    mcIdType end,
+    const DataArrayIdType *nodeIds,
+    const std::string &cellData,
+    const std::string &pointData,
+    MEDCouplingVTKAppendedData *appendedData
+) const
+{
+    mcIdType nbOfCells(end - bg);
     if (nbOfCells <= 0)
         throw INTERP_KERNEL::Exception("MEDCouplingUMesh::writeVTK : the unstructured mesh has no cells !");
     ofs << "  <" << getVTKDataSetType() << ">\n";
-    ofs << "    <Piece NumberOfPoints=\"" << getNumberOfNodes() << "\" NumberOfCells=\"" << nbOfCells << "\">\n";
+    ofs << "    <Piece NumberOfPoints=\"" << (nodeIds ? nodeIds->getNumberOfTuples() : getNumberOfNodes())
+        << "\" NumberOfCells=\"" << nbOfCells << "\">\n";
     ofs << "      <PointData>\n" << pointData << std::endl;
     ofs << "      </PointData>\n";
     ofs << "      <CellData>\n" << cellData << std::endl;
     ofs << "      </CellData>\n";
     ofs << "      <Points>\n";
     if (getSpaceDimension() == 3)
-        _coords->writeVTK(ofs, 8, "Points", byteData);
+        _coords->writeVTK(ofs, 8, "Points", appendedData, nodeIds);
     else
     {
-        MCAuto<DataArrayDouble> coo = _coords->changeNbOfComponents(3, 0.);
-        coo->writeVTK(ofs, 8, "Points", byteData);
+        MCAuto<DataArrayDouble> coo;
+        if (nodeIds)
+        {
+            MCAuto<DataArrayDouble> part(_coords->selectByTupleIdSafe(nodeIds->begin(), nodeIds->end()));
+            coo = part->changeNbOfComponents(3, 0.);
+        }
+        else
+            coo = _coords->changeNbOfComponents(3, 0.);
+        coo->writeVTK(ofs, 8, "Points", appendedData);
     }
     ofs << "      </Points>\n";
     ofs << "      <Cells>\n";
-    const mcIdType *cPtr = _nodal_connec->begin();
-    const mcIdType *cIPtr = _nodal_connec_index->begin();
-    MCAuto<DataArrayIdType> faceoffsets = DataArrayIdType::New();
-    faceoffsets->alloc(nbOfCells, 1);
-    MCAuto<DataArrayIdType> types = DataArrayIdType::New();
-    types->alloc(nbOfCells, 1);
-    MCAuto<DataArrayIdType> offsets = DataArrayIdType::New();
-    offsets->alloc(nbOfCells, 1);
-    MCAuto<DataArrayIdType> connectivity = DataArrayIdType::New();
-    connectivity->alloc(_nodal_connec->getNumberOfTuples() - nbOfCells, 1);
-    mcIdType *w1 = faceoffsets->getPointer(), *w2 = types->getPointer(), *w3 = offsets->getPointer(),
-             *w4 = connectivity->getPointer();
-    mcIdType szFaceOffsets = 0, szConn = 0;
-    for (mcIdType i = 0; i < nbOfCells; i++, w1++, w2++, w3++)
-    {
-        *w2 = cPtr[cIPtr[i]];
+    // the arrays of the cells are produced on the fly, cell by cell, from the nodal connectivity
+    const mcIdType *cPtr(_nodal_connec->begin()), *cIPtr(_nodal_connec_index->begin() + bg);
+    std::size_t szConn(0), szFaces(0);
+    std::vector<mcIdType> tmp;
+    for (mcIdType i = 0; i < nbOfCells; i++)
+    {
         if ((INTERP_KERNEL::NormalizedCellType)cPtr[cIPtr[i]] != INTERP_KERNEL::NORM_POLYHED)
         {
-            *w1 = -1;
-            *w3 = szConn + cIPtr[i + 1] - cIPtr[i] - 1;
+            if ((INTERP_KERNEL::NormalizedCellType)cPtr[cIPtr[i]] == INTERP_KERNEL::NORM_HEXA27 &&
+                cIPtr[i + 1] - cIPtr[i] != 28)
+                THROW_IK_EXCEPTION("For HEXA27 cell #" << bg + i << " len mismatches !");
             szConn += cIPtr[i + 1] - cIPtr[i] - 1;
-            if ((INTERP_KERNEL::NormalizedCellType)cPtr[cIPtr[i]] != INTERP_KERNEL::NORM_HEXA27)
-            {
-                w4 = std::copy(cPtr + cIPtr[i] + 1, cPtr + cIPtr[i + 1], w4);
-            }
-            else
-            {
-                if (cIPtr[i + 1] - cIPtr[i] != 28)
-                    THROW_IK_EXCEPTION("For HEXA27 cell #" << i << " len mismatches !");
-                for (unsigned char iH = 0; iH < 27; ++iH)
-                {
-                    w4[iH] = cPtr[cIPtr[i] + 1 + MEDCoupling1GTUMesh::HEXA27_PERM_ARRAY[iH]];
-                }
-                w4 += 27;
-            }
         }
         else
         {
-            mcIdType deltaFaceOffset = cIPtr[i + 1] - cIPtr[i] + 1;
-            *w1 = szFaceOffsets + deltaFaceOffset;
-            szFaceOffsets += deltaFaceOffset;
-            std::set<mcIdType> c(cPtr + cIPtr[i] + 1, cPtr + cIPtr[i + 1]);
-            c.erase(-1);
-            *w3 = szConn + ToIdType(c.size());
-            szConn += ToIdType(c.size());
-            w4 = std::copy(c.begin(), c.end(), w4);
-        }
-    }
-    std::unique_ptr<mcIdType[]> medcoupling2vtkTypeTraducer_mcIdType(new mcIdType[MEDCOUPLING2VTKTYPETRADUCER_LGTH]);
-    for (auto ii = 0; ii < MEDCOUPLING2VTKTYPETRADUCER_LGTH; ++ii)
-        medcoupling2vtkTypeTraducer_mcIdType[ii] =
-            MEDCOUPLING2VTKTYPETRADUCER[ii] != MEDCOUPLING2VTKTYPETRADUCER_NONE ? MEDCOUPLING2VTKTYPETRADUCER[ii] : -1;
-    types->transformWithIndArr(
-        medcoupling2vtkTypeTraducer_mcIdType.get(),
-        medcoupling2vtkTypeTraducer_mcIdType.get() + MEDCOUPLING2VTKTYPETRADUCER_LGTH
+            tmp.clear();
+            AppendVTKConnectivityOfCell(cPtr, cIPtr, i, tmp);
+            szConn += tmp.size();
+            szFaces += cIPtr[i + 1] - cIPtr[i] + 1;
+        }
+    }
+    if (appendedData)
+        appendedData->keepAlive(this);
+    // owned by the functions producing the arrays, that may be called after the return
+    std::shared_ptr<const VTKNodeRenumbering> renumbering;
+    if (nodeIds)
+        renumbering = std::make_shared<const VTKNodeRenumbering>(nodeIds);
+    WriteVTKCellsArray(
+        ofs,
+        "UInt8",
+        "types",
+        nbOfCells,
+        nbOfCells,
+        [cPtr, cIPtr](mcIdType i, std::vector<mcIdType> &ret)
+        {
+            unsigned char vtkType(MEDCOUPLING2VTKTYPETRADUCER[cPtr[cIPtr[i]]]);
+            ret.push_back(vtkType != MEDCOUPLING2VTKTYPETRADUCER_NONE ? vtkType : -1);
+        },
+        appendedData
     );
-    types->writeVTK(ofs, 8, "UInt8", "types", byteData);
     std::string vtkTypeName = Traits<mcIdType>::VTKReprStr;
-    offsets->writeVTK(ofs, 8, vtkTypeName, "offsets", byteData);
-    if (szFaceOffsets != 0)
+    mcIdType offset(0);
+    WriteVTKCellsArray(
+        ofs,
+        vtkTypeName,
+        "offsets",
+        nbOfCells,
+        nbOfCells,
+        [cPtr, cIPtr, offset](mcIdType i, std::vector<mcIdType> &ret) mutable
+        {
+            AppendVTKConnectivityOfCell(cPtr, cIPtr, i, ret);
+            offset += ToIdType(ret.size());
+            ret.assign(1, offset);
+        },
+        appendedData
+    );
+    if (szFaces != 0)
     {  // presence of Polyhedra
-        connectivity->reAlloc(szConn);
-        faceoffsets->writeVTK(ofs, 8, vtkTypeName, "faceoffsets", byteData);
-        MCAuto<DataArrayIdType> faces = DataArrayIdType::New();
-        faces->alloc(szFaceOffsets, 1);
-        w1 = faces->getPointer();
-        for (mcIdType i = 0; i < nbOfCells; i++)
-            if ((INTERP_KERNEL::NormalizedCellType)cPtr[cIPtr[i]] == INTERP_KERNEL::NORM_POLYHED)
+        WriteVTKCellsArray(
+            ofs,
+            vtkTypeName,
+            "faceoffsets",
+            nbOfCells,
+            nbOfCells,
+            [cPtr, cIPtr, offset](mcIdType i, std::vector<mcIdType> &ret) mutable
             {
-                mcIdType nbFaces = ToIdType(std::count(cPtr + cIPtr[i] + 1, cPtr + cIPtr[i + 1], -1)) + 1;
-                *w1++ = nbFaces;
-                const mcIdType *w6 = cPtr + cIPtr[i] + 1, *w5 = 0;
-                for (mcIdType j = 0; j < nbFaces; j++)
+                if ((INTERP_KERNEL::NormalizedCellType)cPtr[cIPtr[i]] != INTERP_KERNEL::NORM_POLYHED)
+                    ret.push_back(-1);
+                else
                 {
-                    w5 = std::find(w6, cPtr + cIPtr[i + 1], -1);
-                    *w1++ = ToIdType(std::distance(w6, w5));
-                    w1 = std::copy(w6, w5, w1);
-                    w6 = w5 + 1;
+                    offset += cIPtr[i + 1] - cIPtr[i] + 1;
+                    ret.push_back(offset);
                 }
-            }
-        faces->writeVTK(ofs, 8, vtkTypeName, "faces", byteData);
+            },
+            appendedData
+        );
+        WriteVTKCellsArray(
+            ofs,
+            vtkTypeName,
+            "faces",
+            nbOfCells,
+            szFaces,
+            [cPtr, cIPtr, renumbering](mcIdType i, std::vector<mcIdType> &ret)
+            {
+                if ((INTERP_KERNEL::NormalizedCellType)cPtr[cIPtr[i]] == INTERP_KERNEL::NORM_POLYHED)
+                    AppendVTKFacesOfPolyhedron(cPtr, cIPtr, i, ret, renumbering.get());
+            },
+            appendedData
+        );
     }
-    connectivity->writeVTK(ofs, 8, vtkTypeName, "connectivity", byteData);
+    WriteVTKCellsArray(
+        ofs,
+        vtkTypeName,
+        "connectivity",
+        nbOfCells,
+        szConn,
+        [cPtr, cIPtr, renumbering](mcIdType i, std::vector<mcIdType> &ret)
+        { AppendVTKConnectivityOfCell(cPtr, cIPtr, i, ret, renumbering.get()); },
+        appendedData
+    );
     ofs << "      </Cells>\n";
     ofs << "    </Piece>\n";
     ofs << "  </" << getVTKDataSetType() << ">\n";
@@ -27,9 +27,13 @@
 #include "CellModel.hxx"
 
 #include <set>
+#include <memory>
 
 namespace MEDCoupling
 {
+class MEDCouplingUMeshTopologyCache;
+template <int SPACEDIM>
+class MEDCouplingUMeshCellsBBTree;
 class MEDCouplingUMeshCellByTypeEntry;
 class MEDCouplingUMeshCellIterator;
 class MEDCoupling1SGTUMesh;
@@ -51,6 +55,9 @@ class MEDCouplingUMesh : public MEDCouplingPointSet
     MEDCOUPLING_EXPORT void updateTime() const;
     MEDCOUPLING_EXPORT std::size_t getHeapMemorySizeWithoutChildren() const;
     MEDCOUPLING_EXPORT std::vector<const BigMemoryObject *> getDirectChildrenWithNull() const;
+    MEDCOUPLING_EXPORT void setTopologyCacheEnabled(bool enabled);
+    MEDCOUPLING_EXPORT bool isTopologyCacheEnabled() const { return (bool)_topology_cache; }
+    MEDCOUPLING_EXPORT void clearTopologyCache() const;
     MEDCouplingMeshType getType() const { return UNSTRUCTURED; }
     MEDCOUPLING_EXPORT bool isEqualIfNotWhy(const MEDCouplingMesh *other, double prec, std::string &reason) const;
     MEDCOUPLING_EXPORT bool isEqualWithoutConsideringStr(const MEDCouplingMesh *other, double prec) const;
@@ -114,7 +121,19 @@ class MEDCouplingUMesh : public MEDCouplingPointSet
     MEDCOUPLING_EXPORT std::string getVTKDataSetType() const;
     MEDCOUPLING_EXPORT std::string getVTKFileExtension() const;
     MEDCOUPLING_EXPORT void writeVTKLL(
-        std::ostream &ofs, const std::string &cellData, const std::string &pointData, DataArrayByte *byteData
+        std::ostream &ofs,
+        const std::string &cellData,
+        const std::string &pointData,
+        MEDCouplingVTKAppendedData *appendedData
+    ) const;
+    MEDCOUPLING_EXPORT void writeVTKPartLL(
+        std::ostream &ofs,
+        mcIdType bg,
+        mcIdType end,
+        const DataArrayIdType *nodeIds,
+        const std::string &cellData,
+        const std::string &pointData,
+        MEDCouplingVTKAppendedData *appendedData
     ) const;
     MEDCOUPLING_EXPORT void reprQuickOverview(std::ostream &stream) const;
     // tools
@@ -165,6 +184,9 @@ class MEDCouplingUMesh : public MEDCouplingPointSet
     ) const;
     MEDCOUPLING_EXPORT bool areCellsIncludedInPolicy7(const MEDCouplingUMesh *other, DataArrayIdType *&arr) const;
     MEDCOUPLING_EXPORT void getReverseNodalConnectivity(DataArrayIdType *revNodal, DataArrayIdType *revNodalIndx) const;
+    MEDCOUPLING_EXPORT void getReverseNodalConnectivity(
+        DataArrayIdType *revNodal, DataArrayIdType *revNodalIndx, bool sorted
+    ) const;
     MEDCOUPLING_EXPORT MCAuto<MEDCouplingUMesh> explodeIntoEdges(
         MCAuto<DataArrayIdType> &desc,
         MCAuto<DataArrayIdType> &descIndex,
@@ -296,6 +318,9 @@ class MEDCouplingUMesh : public MEDCouplingPointSet
         MCAuto<DataArrayIdType> &elts,
         MCAuto<DataArrayIdType> &eltsIndex
     ) const override;
+    MEDCOUPLING_EXPORT DataArrayIdType *getCellContainingPoints(
+        const DataArrayDouble *pts, double eps, const DataArrayIdType *cellIdsGuess = nullptr
+    ) const;
     MEDCOUPLING_EXPORT void getCellsContainingPointsLinearPartOnlyOnNonDynType(
         const double *pos,
         mcIdType nbOfPoints,
@@ -369,6 +394,7 @@ class MEDCouplingUMesh : public MEDCouplingPointSet
         DataArrayIdType *&meshnM1Old2New
     ) const;
     MEDCOUPLING_EXPORT DataArrayIdType *sortCellsInMEDFileFrmt();
+    MEDCOUPLING_EXPORT DataArrayIdType *sortCellsAlongSpaceFillingCurve(SpaceFillingCurve curve = SFC_HILBERT);
     MEDCOUPLING_EXPORT bool checkConsecutiveCellTypes() const;
     MEDCOUPLING_EXPORT bool checkConsecutiveCellTypesForMEDFileFrmt() const;
     MEDCOUPLING_EXPORT bool checkConsecutiveCellTypesAndOrder(
@@ -529,6 +555,10 @@ class MEDCouplingUMesh : public MEDCouplingPointSet
     void checkFullyDefined() const;
     void checkConnectivityFullyDefined() const;
     void reprConnectivityOfThisLL(std::ostringstream &stream) const;
+    void computeReverseNodalConnectivity(DataArrayIdType *revNodal, DataArrayIdType *revNodalIndx, bool sorted) const;
+    DataArrayDouble *computeBoundingBoxForBBTree(double arcDetEps) const;
+    template <int SPACEDIM>
+    std::shared_ptr<const MEDCouplingUMeshCellsBBTree<SPACEDIM> > getCellsBBTree(double eps) const;
     // tools
     DataArrayIdType *simplexizePol0();
     DataArrayIdType *simplexizePol1();
@@ -629,6 +659,15 @@ class MEDCouplingUMesh : public MEDCouplingPointSet
         MCAuto<DataArrayIdType> &eltsIndex,
         std::function<bool(INTERP_KERNEL::NormalizedCellType, int)> sensibilityTo2DQuadraticLinearCellsFunc
     ) const;
+    template <int SPACEDIM>
+    void getCellContainingPointsAlg(
+        const double *coords,
+        const double *pos,
+        mcIdType nbOfPoints,
+        double eps,
+        const mcIdType *guess,
+        mcIdType *res
+    ) const;
     void getCellsContainingPointsZeAlg(
         const double *pos,
         mcIdType nbOfPoints,
@@ -847,6 +886,8 @@ class MEDCouplingUMesh : public MEDCouplingPointSet
     DataArrayIdType *_nodal_connec;
     DataArrayIdType *_nodal_connec_index;
     std::set<INTERP_KERNEL::NormalizedCellType> _types;
+    //! not null only if setTopologyCacheEnabled(true) has been called
+    std::unique_ptr<MEDCouplingUMeshTopologyCache> _topology_cache;
 
    public:
     static double EPS_FOR_POLYH_ORIENTATION;
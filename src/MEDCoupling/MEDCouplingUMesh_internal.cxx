@@ -29,6 +29,8 @@
 #include "PointLocatorAlgos.txx"
 #include "BBTree.txx"
 #include "BBTreeDst.txx"
+#include "InterpKernelThreadPool.hxx"
+#include "InterpKernelSpaceFillingCurve.hxx"
 #include "SplitterTetra.hxx"
 #include "DiameterCalculator.hxx"
 #include "DirectedBoundingBox.hxx"
@@ -41,6 +43,7 @@
 #include "InterpKernelGeo2DEdgeLin.hxx"
 #include "InterpKernelGeo2DEdgeArcCircle.hxx"
 #include "InterpKernelGeo2DQuadraticPolygon.hxx"
+#include "MEDCouplingVTKWriter.hxx"
 #include "MEDCouplingUMesh_internal.hxx"
 
 #include <sstream>
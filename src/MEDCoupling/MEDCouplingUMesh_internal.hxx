@@ -147,8 +147,298 @@ class DummyClsMCUG
     }
     // end
 };
+
+/*!
+ * Topology derived from a MEDCouplingUMesh, kept by the mesh once MEDCouplingUMesh::setTopologyCacheEnabled has been
+ * called. Each lookup is given the time of the mesh (see TimeOf) : as this time takes the coordinates and the
+ * connectivity arrays into account, any modification of the mesh makes all the entries stale and they are dropped.
+ * The cached arrays are owned by the cache, the callers only get copies of them.
+ */
+class MEDCouplingUMeshTopologyCache
+{
+   public:
+    enum Entry
+    {
+        REVERSE_NODAL = 0,
+        DESCENDING = 1,
+        NEIGHBORS = 2
+    };
+
+    static std::size_t TimeOf(const MEDCouplingUMesh *mesh)
+    {
+        mesh->updateTime();
+        return mesh->getTimeOfThis();
+    }
+
+    bool get(std::size_t time, Entry entry, std::vector<MCAuto<DataArrayIdType> > &arrays)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        checkTime(time);
+        std::map<Entry, std::vector<MCAuto<DataArrayIdType> > >::const_iterator it(_arrays.find(entry));
+        if (it == _arrays.end())
+            return false;
+        arrays = (*it).second;
+        return true;
+    }
+
+    void set(std::size_t time, Entry entry, const std::vector<MCAuto<DataArrayIdType> > &arrays)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        checkTime(time);
+        _arrays[entry] = arrays;
+    }
+
+    bool getBoundingBox(std::size_t time, double arcDetEps, MCAuto<DataArrayDouble> &bbox)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        checkTime(time);
+        std::map<double, MCAuto<DataArrayDouble> >::const_iterator it(_bboxes.find(arcDetEps));
+        if (it == _bboxes.end())
+            return false;
+        bbox = (*it).second;
+        return true;
+    }
+
+    void setBoundingBox(std::size_t time, double arcDetEps, const MCAuto<DataArrayDouble> &bbox)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        checkTime(time);
+        _bboxes[arcDetEps] = bbox;
+    }
+
+    //! The trees are stored type-erased, keyed by the space dimension they have been built for and their epsilon.
+    std::shared_ptr<const void> getBBTree(std::size_t time, int spaceDim, double eps)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        checkTime(time);
+        std::map<std::pair<int, double>, std::pair<std::shared_ptr<const void>, std::size_t> >::const_iterator it(
+            _trees.find(std::make_pair(spaceDim, eps))
+        );
+        if (it == _trees.end())
+            return std::shared_ptr<const void>();
+        return (*it).second.first;
+    }
+
+    void setBBTree(std::size_t time, int spaceDim, double eps, std::shared_ptr<const void> tree, std::size_t memSize)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        checkTime(time);
+        _trees[std::make_pair(spaceDim, eps)] = std::make_pair(tree, memSize);
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        clearLocked();
+    }
+
+    std::size_t getHeapMemorySize() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::size_t ret(sizeof(MEDCouplingUMeshTopologyCache));
+        for (std::map<Entry, std::vector<MCAuto<DataArrayIdType> > >::const_iterator it = _arrays.begin();
+             it != _arrays.end();
+             it++)
+            for (std::vector<MCAuto<DataArrayIdType> >::const_iterator it2 = (*it).second.begin();
+                 it2 != (*it).second.end();
+                 it2++)
+                ret += (*it2)->getHeapMemorySize();
+        for (std::map<double, MCAuto<DataArrayDouble> >::const_iterator it = _bboxes.begin(); it != _bboxes.end(); it++)
+            ret += (*it).second->getHeapMemorySize();
+        for (std::map<std::pair<int, double>, std::pair<std::shared_ptr<const void>, std::size_t> >::const_iterator it =
+                 _trees.begin();
+             it != _trees.end();
+             it++)
+            ret += (*it).second.second;
+        return ret;
+    }
+
+   private:
+    void checkTime(std::size_t time)
+    {
+        if (time != _time)
+        {
+            clearLocked();
+            _time = time;
+        }
+    }
+
+    void clearLocked()
+    {
+        _arrays.clear();
+        _bboxes.clear();
+        _trees.clear();
+    }
+
+   private:
+    mutable std::mutex _mutex;
+    std::size_t _time = 0;
+    std::map<Entry, std::vector<MCAuto<DataArrayIdType> > > _arrays;
+    std::map<double, MCAuto<DataArrayDouble> > _bboxes;
+    std::map<std::pair<int, double>, std::pair<std::shared_ptr<const void>, std::size_t> > _trees;
+};
+
+/*!
+ * BBTree on the cells of a MEDCouplingUMesh, together with the bounding boxes it points to.
+ */
+template <int SPACEDIM>
+class MEDCouplingUMeshCellsBBTree
+{
+   public:
+    MEDCouplingUMeshCellsBBTree(const MEDCouplingUMesh *mesh, double eps)
+        : _bbox(mesh->getBoundingBoxForBBTree(eps)), _tree(_bbox->begin(), 0, 0, mesh->getNumberOfCells(), -eps)
+    {
+    }
+
+    const BBTree<SPACEDIM, mcIdType> &getTree() const { return _tree; }
+
+    //! Estimate : each cell id is stored in a leaf, and a leaf holds 7 to 15 cells, hence about nbOfCells/4 nodes.
+    std::size_t getHeapMemorySize() const
+    {
+        std::size_t nbOfCells(_bbox->getNumberOfTuples());
+        return sizeof(MEDCouplingUMeshCellsBBTree) + _bbox->getHeapMemorySize() + nbOfCells * sizeof(mcIdType) +
+               (nbOfCells / 4 + 1) * sizeof(BBTree<SPACEDIM, mcIdType>);
+    }
+
+   private:
+    MCAuto<DataArrayDouble> _bbox;
+    BBTree<SPACEDIM, mcIdType> _tree;
+};
 }  // namespace MEDCoupling
 
+/*!
+ * Returns the BBTree on the cells of \a this used by the point location, from the topology cache if it is enabled.
+ */
+template <int SPACEDIM>
+std::shared_ptr<const MEDCouplingUMeshCellsBBTree<SPACEDIM> >
+MEDCouplingUMesh::getCellsBBTree(double eps) const
+{
+    if (!_topology_cache)
+        return std::make_shared<const MEDCouplingUMeshCellsBBTree<SPACEDIM> >(this, eps);
+    std::size_t time(MEDCouplingUMeshTopologyCache::TimeOf(this));
+    std::shared_ptr<const void> cached(_topology_cache->getBBTree(time, SPACEDIM, eps));
+    if (cached)
+        return std::static_pointer_cast<const MEDCouplingUMeshCellsBBTree<SPACEDIM> >(cached);
+    std::shared_ptr<const MEDCouplingUMeshCellsBBTree<SPACEDIM> > ret(
+        std::make_shared<const MEDCouplingUMeshCellsBBTree<SPACEDIM> >(this, eps)
+    );
+    _topology_cache->setBBTree(time, SPACEDIM, eps, ret, ret->getHeapMemorySize());
+    return ret;
+}
+
+/*!
+ * Returns the number of threads to be used to locate \a nbOfPoints points in \a mesh. The location in 2D polygons, and
+ * in 2D quadratic cells if \a sensibilityTo2DQuadraticLinearCellsFunc says so, relies on Geometric2D whose precision is
+ * a global setting : these meshes are processed in the calling thread only.
+ */
+template <int SPACEDIM, class SENSIBILITYFUNC>
+unsigned int
+NbOfThreadsForPointLocation(
+    const MEDCouplingUMesh *mesh, mcIdType nbOfPoints, SENSIBILITYFUNC sensibilityTo2DQuadraticLinearCellsFunc
+)
+{
+    const mcIdType MIN_NB_OF_POINTS_PER_THREAD = 256;
+    unsigned int ret(INTERP_KERNEL::GetEffectiveNbOfThreads(MEDCouplingGetNbOfThreads()));
+    ret = (unsigned int)std::min((mcIdType)ret, nbOfPoints / MIN_NB_OF_POINTS_PER_THREAD);
+    if (ret < 2)
+        return 1;
+    if (SPACEDIM == 2)
+    {
+        std::set<INTERP_KERNEL::NormalizedCellType> types(mesh->getAllGeoTypes());
+        for (std::set<INTERP_KERNEL::NormalizedCellType>::const_iterator it = types.begin(); it != types.end(); it++)
+        {
+            if (*it == INTERP_KERNEL::NORM_POLYGON ||
+                sensibilityTo2DQuadraticLinearCellsFunc(*it, mesh->getMeshDimension()))
+                return 1;
+        }
+    }
+    return ret;
+}
+
+/*!
+ * Calls \a func(type, bg, end, stride) on the ranges of consecutive cells of same geometric type of \a mesh. If all the
+ * cells of the range have the fixed number of nodes of \a type, \a stride is the distance between their connectivities
+ * (type included), otherwise it is 0. A range has at most MAX_RANGE cells, so that \a func finds their connectivity
+ * in cache. The cells are cut in chunks processed by the threads allowed by MEDCouplingGetNbOfThreads, except if
+ * \a mesh has quadratic cells : Geometric2D, used for some of them, has a global precision setting and these meshes
+ * are processed in the calling thread only.
+ */
+template <class FUNC>
+void
+ForEachRangeOfCellsOfSameType(const MEDCouplingUMesh *mesh, FUNC func)
+{
+    const mcIdType GRAIN = 4096, MAX_RANGE = 256;
+    mcIdType nbOfCells(mesh->getNumberOfCells());
+    const mcIdType *conn(mesh->getNodalConnectivity()->begin());
+    const mcIdType *connI(mesh->getNodalConnectivityIndex()->begin());
+    unsigned int nbOfThreads(INTERP_KERNEL::GetEffectiveNbOfThreads(MEDCouplingGetNbOfThreads()));
+    std::set<INTERP_KERNEL::NormalizedCellType> types(mesh->getAllGeoTypes());
+    for (std::set<INTERP_KERNEL::NormalizedCellType>::const_iterator it = types.begin(); it != types.end(); it++)
+        if (INTERP_KERNEL::CellModel::GetCellModel(*it).isQuadratic())
+            nbOfThreads = 1;
+    INTERP_KERNEL::ParallelForChunks(
+        nbOfThreads,
+        mcIdType(0),
+        nbOfCells,
+        GRAIN,
+        [&](mcIdType bg, mcIdType end, unsigned int)
+        {
+            while (bg < end)
+            {
+                INTERP_KERNEL::NormalizedCellType type((INTERP_KERNEL::NormalizedCellType)conn[connI[bg]]);
+                const INTERP_KERNEL::CellModel &cm(INTERP_KERNEL::CellModel::GetCellModel(type));
+                mcIdType stride(cm.isDynamic() ? 0 : ToIdType(cm.getNumberOfNodes()) + 1);
+                mcIdType rangeEnd(bg), rangeMax(std::min(end, bg + MAX_RANGE));
+                for (; rangeEnd < rangeMax && conn[connI[rangeEnd]] == type; rangeEnd++)
+                    if (connI[rangeEnd + 1] - connI[rangeEnd] != stride)
+                        stride = 0;
+                func(type, bg, rangeEnd, stride);
+                bg = rangeEnd;
+            }
+        }
+    );
+}
+
+/*!
+ * Returns true if the point \a pt is in cell \a cellId of the mesh defined by \a coords, \a conn and \a connI.
+ */
+template <int SPACEDIM, class SENSIBILITYFUNC>
+bool
+IsCellContainingPoint(
+    const double *pt,
+    mcIdType cellId,
+    const double *coords,
+    const mcIdType *conn,
+    const mcIdType *connI,
+    int meshDim,
+    double eps,
+    const SENSIBILITYFUNC &sensibilityTo2DQuadraticLinearCellsFunc
+)
+{
+    mcIdType sz(connI[cellId + 1] - connI[cellId] - 1);
+    INTERP_KERNEL::NormalizedCellType ct((INTERP_KERNEL::NormalizedCellType)conn[connI[cellId]]);
+    // [ABN] : point locator algorithms are not impl. for POLY or QPOLY in spaceDim3
+    if (SPACEDIM != 2 && (ct == INTERP_KERNEL::NORM_POLYGON || sensibilityTo2DQuadraticLinearCellsFunc(ct, meshDim)))
+        throw INTERP_KERNEL::Exception(
+            "MEDCouplingUMesh::getCellsContainingPointsAlg : not implemented yet for POLYGON and QPOLYGON in "
+            "spaceDim 3 !"
+        );
+    // Keep calling simple algorithm when this is desired and simple for speed reasons:
+    if (SPACEDIM == 2 && ct != INTERP_KERNEL::NORM_POLYGON && !sensibilityTo2DQuadraticLinearCellsFunc(ct, meshDim))
+        return INTERP_KERNEL::PointLocatorAlgos<DummyClsMCUG<2> >::isElementContainsPointAlgo2DSimple2(
+            pt, ct, coords, conn + connI[cellId] + 1, sz, eps
+        );
+    return INTERP_KERNEL::PointLocatorAlgos<DummyClsMCUG<SPACEDIM> >::isElementContainsPoint(
+        pt, ct, coords, conn + connI[cellId] + 1, sz, eps
+    );
+}
+
+/*!
+ * Batched location of points. The points are processed along a Morton curve, for the locality of the accesses to the
+ * tree and to the cells, by several threads sharing the same BBTree (see MEDCouplingSetNbOfThreads). Each thread
+ * stores the cells it finds in its own buffer, then the buffers are copied at their place in \a elts once \a eltsIndex
+ * is known. The cells of each point are given in the same order whatever the number of threads.
+ */
 template <int SPACEDIM>
 void
 MEDCouplingUMesh::getCellsContainingPointsAlg(
@@ -167,55 +457,176 @@ MEDCouplingUMesh::getCellsContainingPointsAlg(
     elts = DataArrayIdType::New();
     eltsIndex = DataArrayIdType::New();
     eltsIndex->alloc(nbOfPoints + 1, 1);
-    eltsIndex->setIJ(0, 0, 0);
-    elts->alloc(0, 1);
     mcIdType *eltsIndexPtr(eltsIndex->getPointer());
-    MCAuto<DataArrayDouble> bboxArr(getBoundingBoxForBBTree(eps));
-    const double *bbox(bboxArr->begin());
-    mcIdType nbOfCells = getNumberOfCells();
+    eltsIndexPtr[0] = 0;
     const mcIdType *conn = _nodal_connec->getConstPointer();
     const mcIdType *connI = _nodal_connec_index->getConstPointer();
-    double bb[2 * SPACEDIM];
-    BBTree<SPACEDIM, mcIdType> myTree(&bbox[0], 0, 0, nbOfCells, -eps);
-    for (mcIdType i = 0; i < nbOfPoints; i++)
-    {
-        eltsIndexPtr[i + 1] = eltsIndexPtr[i];
-        for (int j = 0; j < SPACEDIM; j++)
+    std::shared_ptr<const MEDCouplingUMeshCellsBBTree<SPACEDIM> > cellsTree(getCellsBBTree<SPACEDIM>(eps));
+    const BBTree<SPACEDIM, mcIdType> &myTree(cellsTree->getTree());
+    std::vector<mcIdType> order;
+    INTERP_KERNEL::SortAlongMortonCurve<SPACEDIM>(pos, nbOfPoints, order);
+    const unsigned int nbOfParts(
+        NbOfThreadsForPointLocation<SPACEDIM>(this, nbOfPoints, sensibilityTo2DQuadraticLinearCellsFunc)
+    );
+    std::vector<std::vector<mcIdType> > cellsPerPart(nbOfParts);
+    const int meshDim(_mesh_dim);
+    INTERP_KERNEL::ParallelForParts(
+        nbOfParts,
+        mcIdType(0),
+        nbOfPoints,
+        [&](mcIdType bg, mcIdType end, unsigned int partId)
         {
-            bb[2 * j] = pos[SPACEDIM * i + j];
-            bb[2 * j + 1] = pos[SPACEDIM * i + j];
+            std::vector<mcIdType> candidates;
+            std::vector<mcIdType> &cells(cellsPerPart[partId]);
+            double bb[2 * SPACEDIM];
+            for (mcIdType k = bg; k < end; k++)
+            {
+                const double *pt(pos + SPACEDIM * order[k]);
+                for (int j = 0; j < SPACEDIM; j++)
+                {
+                    bb[2 * j] = pt[j];
+                    bb[2 * j + 1] = pt[j];
+                }
+                candidates.clear();
+                myTree.getIntersectingElems(bb, candidates);
+                mcIdType nbOfCellsForPt(0);
+                for (std::vector<mcIdType>::const_iterator iter = candidates.begin(); iter != candidates.end(); iter++)
+                    if (IsCellContainingPoint<SPACEDIM>(
+                            pt, *iter, coords, conn, connI, meshDim, eps, sensibilityTo2DQuadraticLinearCellsFunc
+                        ))
+                    {
+                        cells.push_back(*iter);
+                        nbOfCellsForPt++;
+                    }
+                eltsIndexPtr[order[k] + 1] = nbOfCellsForPt;
+            }
         }
-        std::vector<mcIdType> candidates;
-        myTree.getIntersectingElems(bb, candidates);
-        for (std::vector<mcIdType>::const_iterator iter = candidates.begin(); iter != candidates.end(); iter++)
+    );
+    for (mcIdType i = 0; i < nbOfPoints; i++) eltsIndexPtr[i + 1] += eltsIndexPtr[i];
+    elts->alloc(eltsIndexPtr[nbOfPoints], 1);
+    mcIdType *eltsPtr(elts->getPointer());
+    INTERP_KERNEL::ParallelForParts(
+        nbOfParts,
+        mcIdType(0),
+        nbOfPoints,
+        [&](mcIdType bg, mcIdType end, unsigned int partId)
         {
-            mcIdType sz(connI[(*iter) + 1] - connI[*iter] - 1);
-            INTERP_KERNEL::NormalizedCellType ct((INTERP_KERNEL::NormalizedCellType)conn[connI[*iter]]);
-            bool status(false);
-            // [ABN] : point locator algorithms are not impl. for POLY or QPOLY in spaceDim3
-            if (SPACEDIM != 2 &&
-                (ct == INTERP_KERNEL::NORM_POLYGON || sensibilityTo2DQuadraticLinearCellsFunc(ct, _mesh_dim)))
-                throw INTERP_KERNEL::Exception(
-                    "MEDCouplingUMesh::getCellsContainingPointsAlg : not implemented yet for POLYGON and QPOLYGON in "
-                    "spaceDim 3 !"
-                );
-            // Keep calling simple algorithm when this is desired and simple for speed reasons:
-            if (SPACEDIM == 2 && ct != INTERP_KERNEL::NORM_POLYGON &&
-                !sensibilityTo2DQuadraticLinearCellsFunc(ct, _mesh_dim))
-                status = INTERP_KERNEL::PointLocatorAlgos<DummyClsMCUG<2> >::isElementContainsPointAlgo2DSimple2(
-                    pos + i * SPACEDIM, ct, coords, conn + connI[*iter] + 1, sz, eps
-                );
-            else
-                status = INTERP_KERNEL::PointLocatorAlgos<DummyClsMCUG<SPACEDIM> >::isElementContainsPoint(
-                    pos + i * SPACEDIM, ct, coords, conn + connI[*iter] + 1, sz, eps
-                );
-            if (status)
+            const mcIdType *cells(cellsPerPart[partId].data());
+            for (mcIdType k = bg; k < end; k++)
             {
-                eltsIndexPtr[i + 1]++;
-                elts->pushBackSilent(*iter);
+                mcIdType nbOfCellsForPt(eltsIndexPtr[order[k] + 1] - eltsIndexPtr[order[k]]);
+                std::copy(cells, cells + nbOfCellsForPt, eltsPtr + eltsIndexPtr[order[k]]);
+                cells += nbOfCellsForPt;
             }
         }
+    );
+}
+
+/*!
+ * Implementation of MEDCouplingUMesh::getCellContainingPoints. The tree is only built if some points are not in
+ * their guessed cell.
+ */
+template <int SPACEDIM>
+void
+MEDCouplingUMesh::getCellContainingPointsAlg(
+    const double *coords, const double *pos, mcIdType nbOfPoints, double eps, const mcIdType *guess, mcIdType *res
+) const
+{
+    INTERP_KERNEL::QuadraticPlanarPrecision prec(eps);
+    auto sensibilityTo2DQuadraticLinearCellsFunc(
+        [](INTERP_KERNEL::NormalizedCellType ct, int mdim)
+        { return INTERP_KERNEL::CellModel::GetCellModel(ct).isQuadratic() && mdim == 2; }
+    );
+    mcIdType nbOfCells = getNumberOfCells();
+    const mcIdType *conn = _nodal_connec->getConstPointer();
+    const mcIdType *connI = _nodal_connec_index->getConstPointer();
+    const int meshDim(_mesh_dim);
+    const unsigned int nbOfParts(
+        NbOfThreadsForPointLocation<SPACEDIM>(this, nbOfPoints, sensibilityTo2DQuadraticLinearCellsFunc)
+    );
+    std::vector<mcIdType> notFound;
+    if (guess)
+    {
+        std::vector<char> found(nbOfPoints);
+        INTERP_KERNEL::ParallelForParts(
+            nbOfParts,
+            mcIdType(0),
+            nbOfPoints,
+            [&](mcIdType bg, mcIdType end, unsigned int)
+            {
+                for (mcIdType i = bg; i < end; i++)
+                {
+                    found[i] = guess[i] >= 0 && guess[i] < nbOfCells &&
+                               IsCellContainingPoint<SPACEDIM>(
+                                   pos + SPACEDIM * i,
+                                   guess[i],
+                                   coords,
+                                   conn,
+                                   connI,
+                                   meshDim,
+                                   eps,
+                                   sensibilityTo2DQuadraticLinearCellsFunc
+                               );
+                    res[i] = found[i] ? guess[i] : -1;
+                }
+            }
+        );
+        for (mcIdType i = 0; i < nbOfPoints; i++)
+            if (!found[i])
+                notFound.push_back(i);
+    }
+    else
+    {
+        notFound.resize(nbOfPoints);
+        for (mcIdType i = 0; i < nbOfPoints; i++) notFound[i] = i;
     }
+    if (notFound.empty())
+        return;
+    // points not in their guessed cell : batched location in the tree, along a Morton curve
+    mcIdType nbOfNotFound(ToIdType(notFound.size()));
+    std::vector<double> notFoundPos(SPACEDIM * nbOfNotFound);
+    for (mcIdType i = 0; i < nbOfNotFound; i++)
+    {
+        const double *pt(pos + SPACEDIM * notFound[i]);
+        std::copy(pt, pt + SPACEDIM, notFoundPos.begin() + SPACEDIM * i);
+    }
+    std::vector<mcIdType> order;
+    INTERP_KERNEL::SortAlongMortonCurve<SPACEDIM>(notFoundPos.data(), nbOfNotFound, order);
+    std::shared_ptr<const MEDCouplingUMeshCellsBBTree<SPACEDIM> > cellsTree(getCellsBBTree<SPACEDIM>(eps));
+    const BBTree<SPACEDIM, mcIdType> &myTree(cellsTree->getTree());
+    INTERP_KERNEL::ParallelForParts(
+        NbOfThreadsForPointLocation<SPACEDIM>(this, nbOfNotFound, sensibilityTo2DQuadraticLinearCellsFunc),
+        mcIdType(0),
+        nbOfNotFound,
+        [&](mcIdType bg, mcIdType end, unsigned int)
+        {
+            std::vector<mcIdType> candidates;
+            double bb[2 * SPACEDIM];
+            for (mcIdType k = bg; k < end; k++)
+            {
+                mcIdType i(notFound[order[k]]);
+                const double *pt(pos + SPACEDIM * i);
+                for (int j = 0; j < SPACEDIM; j++)
+                {
+                    bb[2 * j] = pt[j];
+                    bb[2 * j + 1] = pt[j];
+                }
+                candidates.clear();
+                myTree.getIntersectingElems(bb, candidates);
+                // the smallest cell id is returned, as in getCellContainingPoint
+                std::sort(candidates.begin(), candidates.end());
+                res[i] = -1;
+                for (std::vector<mcIdType>::const_iterator iter = candidates.begin(); iter != candidates.end(); iter++)
+                    if (IsCellContainingPoint<SPACEDIM>(
+                            pt, *iter, coords, conn, connI, meshDim, eps, sensibilityTo2DQuadraticLinearCellsFunc
+                        ))
+                    {
+                        res[i] = *iter;
+                        break;
+                    }
+            }
+        }
+    );
 }
 
 /*!
@@ -280,9 +691,93 @@ MEDCouplingUMesh::buildDescendingConnectivityNoFuseGen(
     return ret;
 }
 
+/*!
+ * Hash of a son cell used by MEDCouplingUMesh::buildDescendingConnectivityGen. Two sons are merged if they have the
+ * same number of nodes and the same set of nodes, whatever their type and the order of their nodes (policy 3 of
+ * MEDCouplingUMesh::AreCellsEqual). So the hash only depends on the number of nodes and on the set of nodes, which is
+ * returned sorted in \a sortedNodes.
+ */
+inline std::uint64_t
+HashOfDescendingSon(const mcIdType *sonConn, unsigned nbOfNodes, std::vector<mcIdType> &sortedNodes)
+{
+    sortedNodes.assign(sonConn, sonConn + nbOfNodes);
+    std::sort(sortedNodes.begin(), sortedNodes.end());
+    sortedNodes.erase(std::unique(sortedNodes.begin(), sortedNodes.end()), sortedNodes.end());
+    std::uint64_t ret(nbOfNodes);
+    for (std::vector<mcIdType>::const_iterator it = sortedNodes.begin(); it != sortedNodes.end(); it++)
+    {
+        ret = (ret ^ (std::uint64_t)(*it)) * 0x9E3779B97F4A7C15ULL;
+        ret ^= ret >> 29;
+    }
+    // the high bits select the shard and the low bits the slot in the hash table : both have to be well mixed
+    ret *= 0xD6E8FEB86659FD93ULL;
+    ret ^= ret >> 32;
+    return ret;
+}
+
+/*!
+ * Calls \a func(cellId, sonId, sonConn, nbOfNodesOfSon, typeOfSon) for all the sons of the cells in [ \a bg, \a end ).
+ * \a sonId is the global id of the son, i.e. \a descIndx[ \a cellId ] plus its local id in the cell.
+ */
+template <class SonsGenerator, class FUNC>
+void
+ForEachDescendingSon(
+    const mcIdType *conn, const mcIdType *connI, const mcIdType *descIndx, mcIdType bg, mcIdType end, FUNC func
+)
+{
+    std::vector<mcIdType> son;
+    for (mcIdType cellId = bg; cellId < end; cellId++)
+    {
+        const mcIdType *pos(conn + connI[cellId]);
+        mcIdType lgth(connI[cellId + 1] - connI[cellId] - 1);
+        SonsGenerator sg(INTERP_KERNEL::CellModel::GetCellModel((INTERP_KERNEL::NormalizedCellType)pos[0]));
+        unsigned nbOfSons(sg.getNumberOfSons2(pos + 1, lgth));
+        son.resize(lgth + 1);
+        for (unsigned i = 0; i < nbOfSons; i++)
+        {
+            INTERP_KERNEL::NormalizedCellType typeOfSon;
+            unsigned nbOfNodesSon(sg.fillSonCellNodalConnectivity2(i, pos + 1, lgth, son.data(), typeOfSon));
+            func(cellId, descIndx[cellId] + ToIdType(i), son.data(), nbOfNodesSon, typeOfSon);
+        }
+    }
+}
+
+/*!
+ * Fills \a son with the connectivity of the son having the global id \a sonId and returns its number of nodes.
+ */
+template <class SonsGenerator>
+unsigned
+FillDescendingSon(
+    const mcIdType *conn,
+    const mcIdType *connI,
+    const mcIdType *descIndx,
+    mcIdType nbOfCells,
+    mcIdType sonId,
+    std::vector<mcIdType> &son,
+    INTERP_KERNEL::NormalizedCellType &typeOfSon
+)
+{
+    mcIdType cellId(ToIdType(std::upper_bound(descIndx, descIndx + nbOfCells + 1, sonId) - descIndx) - 1);
+    const mcIdType *pos(conn + connI[cellId]);
+    mcIdType lgth(connI[cellId + 1] - connI[cellId] - 1);
+    SonsGenerator sg(INTERP_KERNEL::CellModel::GetCellModel((INTERP_KERNEL::NormalizedCellType)pos[0]));
+    sg.getNumberOfSons2(pos + 1, lgth);  // some generators prepare the sons of polyhedra here
+    son.resize(lgth + 1);
+    return sg.fillSonCellNodalConnectivity2(
+        int(sonId - descIndx[cellId]), pos + 1, lgth, son.data(), typeOfSon
+    );
+}
+
 /*!
  * \b WARNING this method do the assumption that connectivity lies on the coordinates set.
  * For speed reasons no check of this will be done.
+ *
+ * The sons are merged in a single pass : each son is hashed on its set of nodes and looked up in a hash table. To
+ * process the hash tables in parallel, the sons are dispatched into shards according to their hash, so that equal
+ * sons always fall in the same shard. Only the sons having the same hash are regenerated to be compared, and the
+ * not merged sons are never stored, which keeps the memory peak low on large meshes. The result is the same as a
+ * merge of the sons with FindCommonCellsAlg : the sons are numbered in the order of their first occurrence and this
+ * first occurrence is the reference for the orientation returned by \a nbrer.
  */
 template <class SonsGenerator>
 MEDCouplingUMesh *
@@ -298,101 +793,441 @@ MEDCouplingUMesh::buildDescendingConnectivityGen(
         throw INTERP_KERNEL::Exception(
             "MEDCouplingUMesh::buildDescendingConnectivityGen : present of a null pointer in input !"
         );
-    DataArrayIdType *commonCells(nullptr), *commonCellsI(nullptr);
-    MCAuto<DataArrayIdType> revNodalIndx, revDesc2;
-    MCAuto<MEDCouplingUMesh> ret(buildDescendingConnectivityNoFuseGen<SonsGenerator>(descIndx, revNodalIndx, revDesc2));
-    const mcIdType *revNodalIndxPtr(revNodalIndx->begin());
-    mcIdType nbOfCellsM1 = ret->getNumberOfCells();
-    MCAuto<DataArrayIdType> revNodal = DataArrayIdType::New();
-    revNodal->alloc(revNodalIndx->back(), 1);
-    std::fill(revNodal->getPointer(), revNodal->getPointer() + revNodalIndx->back(), -1);
-    mcIdType *revNodalPtr = revNodal->getPointer();
-    const mcIdType *connM1 = ret->getNodalConnectivity()->getConstPointer();
-    const mcIdType *connIndexM1 = ret->getNodalConnectivityIndex()->getConstPointer();
-    for (mcIdType eltId = 0; eltId < nbOfCellsM1; eltId++)
-    {
-        const mcIdType *strtNdlConnOfCurCell = connM1 + connIndexM1[eltId] + 1;
-        const mcIdType *endNdlConnOfCurCell = connM1 + connIndexM1[eltId + 1];
-        for (const mcIdType *iter = strtNdlConnOfCurCell; iter != endNdlConnOfCurCell; iter++)
-            if (*iter >= 0)  // for polyhedrons
-                *std::find_if(
-                    revNodalPtr + revNodalIndxPtr[*iter],
-                    revNodalPtr + revNodalIndxPtr[*iter + 1],
-                    std::bind(std::equal_to<mcIdType>(), std::placeholders::_1, -1)
-                ) = eltId;
-    }
-    FindCommonCellsAlg(
-        3,
-        0,
-        ret->getNodalConnectivity(),
-        ret->getNodalConnectivityIndex(),
-        revNodal,
-        revNodalIndx,
-        commonCells,
-        commonCellsI
+    checkConnectivityFullyDefined();
+    const mcIdType GRAIN = 1024;
+    unsigned int nbOfThreads(INTERP_KERNEL::GetEffectiveNbOfThreads(MEDCouplingGetNbOfThreads()));
+    mcIdType nbOfCells(getNumberOfCells());
+    const mcIdType *conn(_nodal_connec->begin()), *connI(_nodal_connec_index->begin());
+    // number of sons of each cell
+    descIndx->alloc(nbOfCells + 1, 1);
+    mcIdType *descIndxPtr(descIndx->getPointer());
+    descIndxPtr[0] = 0;
+    INTERP_KERNEL::ParallelForChunks(
+        nbOfThreads,
+        mcIdType(0),
+        nbOfCells,
+        GRAIN,
+        [&](mcIdType bg, mcIdType end, unsigned int)
+        {
+            for (mcIdType cellId = bg; cellId < end; cellId++)
+            {
+                const mcIdType *pos(conn + connI[cellId]);
+                SonsGenerator sg(INTERP_KERNEL::CellModel::GetCellModel((INTERP_KERNEL::NormalizedCellType)pos[0]));
+                descIndxPtr[cellId + 1] = ToIdType(sg.getNumberOfSons2(pos + 1, connI[cellId + 1] - connI[cellId] - 1));
+            }
+        }
     );
-    MCAuto<DataArrayIdType> commonCellsTmp(commonCells), commonCellsITmp(commonCellsI);
-    const mcIdType *commonCellsPtr(commonCells->getConstPointer()), *commonCellsIPtr(commonCellsI->getConstPointer());
-    mcIdType newNbOfCellsM1 = -1;
-    MCAuto<DataArrayIdType> o2nM1 = DataArrayIdType::ConvertIndexArrayToO2N(
-        nbOfCellsM1, commonCells->begin(), commonCellsI->begin(), commonCellsI->end(), newNbOfCellsM1
+    std::partial_sum(descIndxPtr, descIndxPtr + nbOfCells + 1, descIndxPtr);
+    mcIdType nbOfSons(descIndxPtr[nbOfCells]);
+    // hash of each son
+    std::vector<std::uint64_t> hashes(nbOfSons);
+    INTERP_KERNEL::ParallelForChunks(
+        nbOfThreads,
+        mcIdType(0),
+        nbOfCells,
+        GRAIN,
+        [&](mcIdType bg, mcIdType end, unsigned int)
+        {
+            std::vector<mcIdType> sortedNodes;
+            ForEachDescendingSon<SonsGenerator>(
+                conn,
+                connI,
+                descIndxPtr,
+                bg,
+                end,
+                [&](mcIdType,
+                    mcIdType sonId,
+                    const mcIdType *son,
+                    unsigned nbOfNodesSon,
+                    INTERP_KERNEL::NormalizedCellType)
+                { hashes[sonId] = HashOfDescendingSon(son, nbOfNodesSon, sortedNodes); }
+            );
+        }
     );
-    std::vector<bool> isImpacted(nbOfCellsM1, false);
-    for (const mcIdType *work = commonCellsI->begin(); work != commonCellsI->end() - 1; work++)
-        for (mcIdType work2 = work[0]; work2 != work[1]; work2++) isImpacted[commonCellsPtr[work2]] = true;
-    const mcIdType *o2nM1Ptr = o2nM1->getConstPointer();
-    MCAuto<DataArrayIdType> n2oM1 = o2nM1->invertArrayO2N2N2OBis(newNbOfCellsM1);
-    const mcIdType *n2oM1Ptr = n2oM1->getConstPointer();
-    MCAuto<MEDCouplingUMesh> ret2 =
-        static_cast<MEDCouplingUMesh *>(ret->buildPartOfMySelf(n2oM1->begin(), n2oM1->end(), true));
-    ret2->copyTinyInfoFrom(this);
-    desc->alloc(descIndx->back(), 1);
-    mcIdType *descPtr = desc->getPointer();
-    const INTERP_KERNEL::CellModel &cmsDft = INTERP_KERNEL::CellModel::GetCellModel(INTERP_KERNEL::NORM_POINT1);
-    for (mcIdType i = 0; i < nbOfCellsM1; i++, descPtr++)
-    {
-        if (!isImpacted[i])
-            *descPtr = nbrer(o2nM1Ptr[i], 0, cmsDft, false, 0, 0);
-        else
+    // dispatch of the sons into shards, keeping the ascending order of the sons in each shard
+    unsigned int nbOfShardBits(0);
+    if (nbOfThreads > 1)
+        while ((1u << nbOfShardBits) < 4 * nbOfThreads && nbOfShardBits < 10) nbOfShardBits++;
+    mcIdType nbOfShards(mcIdType(1) << nbOfShardBits);
+    std::vector<mcIdType> shardIndx(nbOfShards + 1, 0), sonsOfShards;
+    shardIndx[1] = nbOfSons;
+    if (nbOfShards > 1)
+    {
+        std::vector<mcIdType> offsets(nbOfThreads * nbOfShards, 0);
+        INTERP_KERNEL::ParallelForParts(
+            nbOfThreads,
+            mcIdType(0),
+            nbOfSons,
+            [&](mcIdType bg, mcIdType end, unsigned int partId)
+            {
+                mcIdType *counts(offsets.data() + partId * nbOfShards);
+                for (mcIdType sonId = bg; sonId < end; sonId++) counts[hashes[sonId] >> (64 - nbOfShardBits)]++;
+            }
+        );
+        mcIdType offset(0);
+        for (mcIdType shard = 0; shard < nbOfShards; shard++)
         {
-            if (i != n2oM1Ptr[o2nM1Ptr[i]])
+            for (unsigned int partId = 0; partId < nbOfThreads; partId++)
             {
-                const INTERP_KERNEL::CellModel &cms =
-                    INTERP_KERNEL::CellModel::GetCellModel((INTERP_KERNEL::NormalizedCellType)connM1[connIndexM1[i]]);
-                *descPtr = nbrer(
-                    o2nM1Ptr[i],
-                    connIndexM1[i + 1] - connIndexM1[i] - 1,
-                    cms,
-                    true,
-                    connM1 + connIndexM1[n2oM1Ptr[o2nM1Ptr[i]]] + 1,
-                    connM1 + connIndexM1[i] + 1
-                );
+                mcIdType count(offsets[partId * nbOfShards + shard]);
+                offsets[partId * nbOfShards + shard] = offset;
+                offset += count;
             }
-            else
-                *descPtr = nbrer(o2nM1Ptr[i], 0, cmsDft, false, 0, 0);
+            shardIndx[shard + 1] = offset;
         }
+        sonsOfShards.resize(nbOfSons);
+        INTERP_KERNEL::ParallelForParts(
+            nbOfThreads,
+            mcIdType(0),
+            nbOfSons,
+            [&](mcIdType bg, mcIdType end, unsigned int partId)
+            {
+                mcIdType *positions(offsets.data() + partId * nbOfShards);
+                for (mcIdType sonId = bg; sonId < end; sonId++)
+                    sonsOfShards[positions[hashes[sonId] >> (64 - nbOfShardBits)]++] = sonId;
+            }
+        );
     }
-    revDesc->reserve(newNbOfCellsM1);
-    revDescIndx->alloc(newNbOfCellsM1 + 1, 1);
-    mcIdType *revDescIndxPtr = revDescIndx->getPointer();
-    *revDescIndxPtr++ = 0;
-    const mcIdType *revDesc2Ptr = revDesc2->getConstPointer();
-    for (mcIdType i = 0; i < newNbOfCellsM1; i++, revDescIndxPtr++)
+    // each son is merged with the first son having the same nodes. o2n first stores the id of this first son
+    std::vector<mcIdType> o2n(nbOfSons);
+    INTERP_KERNEL::ParallelForChunks(
+        nbOfThreads,
+        mcIdType(0),
+        nbOfShards,
+        mcIdType(1),
+        [&](mcIdType bg, mcIdType end, unsigned int)
+        {
+            std::vector<mcIdType> table, son, sortedNodes, sortedNodesOther;
+            for (mcIdType shard = bg; shard < end; shard++)
+            {
+                std::size_t tableSize(2);
+                while (tableSize < 2 * std::size_t(shardIndx[shard + 1] - shardIndx[shard])) tableSize *= 2;
+                table.assign(tableSize, -1);
+                for (mcIdType i = shardIndx[shard]; i < shardIndx[shard + 1]; i++)
+                {
+                    mcIdType sonId(nbOfShards > 1 ? sonsOfShards[i] : i);
+                    std::uint64_t hash(hashes[sonId]);
+                    unsigned nbOfNodesSon(0);
+                    o2n[sonId] = sonId;
+                    for (std::size_t slot = hash & (tableSize - 1);; slot = (slot + 1) & (tableSize - 1))
+                    {
+                        mcIdType other(table[slot]);
+                        if (other < 0)
+                        {
+                            table[slot] = sonId;
+                            break;
+                        }
+                        if (hashes[other] != hash)
+                            continue;
+                        INTERP_KERNEL::NormalizedCellType typeOfSon;
+                        if (nbOfNodesSon == 0)
+                        {
+                            nbOfNodesSon = FillDescendingSon<SonsGenerator>(
+                                conn, connI, descIndxPtr, nbOfCells, sonId, son, typeOfSon
+                            );
+                            HashOfDescendingSon(son.data(), nbOfNodesSon, sortedNodes);
+                        }
+                        unsigned nbOfNodesOther(FillDescendingSon<SonsGenerator>(
+                            conn, connI, descIndxPtr, nbOfCells, other, son, typeOfSon
+                        ));
+                        HashOfDescendingSon(son.data(), nbOfNodesOther, sortedNodesOther);
+                        if (nbOfNodesOther == nbOfNodesSon && sortedNodesOther == sortedNodes)
+                        {
+                            o2n[sonId] = other;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    );
+    std::vector<std::uint64_t>().swap(hashes);
+    std::vector<mcIdType>().swap(sonsOfShards);
+    // numbering of the merged sons in the order of their first occurrence
+    std::vector<mcIdType> n2o;
+    for (mcIdType sonId = 0; sonId < nbOfSons; sonId++)
     {
-        mcIdType oldCellIdM1 = n2oM1Ptr[i];
-        if (!isImpacted[oldCellIdM1])
+        if (o2n[sonId] == sonId)
         {
-            revDesc->pushBackSilent(revDesc2Ptr[oldCellIdM1]);
-            revDescIndxPtr[0] = revDescIndxPtr[-1] + 1;
+            o2n[sonId] = ToIdType(n2o.size());
+            n2o.push_back(sonId);
         }
         else
+            o2n[sonId] = o2n[o2n[sonId]];
+    }
+    mcIdType newNbOfCellsM1(ToIdType(n2o.size()));
+    // reverse descending connectivity : the cells sharing a son are sorted by ascending id
+    revDescIndx->alloc(newNbOfCellsM1 + 1, 1);
+    revDescIndx->fillWithZero();
+    mcIdType *revDescIndxPtr(revDescIndx->getPointer());
+    for (mcIdType sonId = 0; sonId < nbOfSons; sonId++) revDescIndxPtr[o2n[sonId] + 1]++;
+    std::partial_sum(revDescIndxPtr, revDescIndxPtr + newNbOfCellsM1 + 1, revDescIndxPtr);
+    revDesc->alloc(nbOfSons, 1);
+    mcIdType *revDescPtr(revDesc->getPointer());
+    for (mcIdType cellId = 0; cellId < nbOfCells; cellId++)
+        for (mcIdType sonId = descIndxPtr[cellId]; sonId < descIndxPtr[cellId + 1]; sonId++)
+            revDescPtr[revDescIndxPtr[o2n[sonId]]++] = cellId;
+    std::copy_backward(revDescIndxPtr, revDescIndxPtr + newNbOfCellsM1, revDescIndxPtr + newNbOfCellsM1 + 1);
+    revDescIndxPtr[0] = 0;
+    // descending connectivity. MEDCouplingFastNbrer ignores the connectivities, no need to regenerate the first
+    // occurrence of the merged sons for it.
+    desc->alloc(nbOfSons, 1);
+    mcIdType *descPtr(desc->getPointer());
+    MCAuto<DataArrayIdType> connM1(DataArrayIdType::New()), connIndexM1(DataArrayIdType::New());
+    connIndexM1->alloc(newNbOfCellsM1 + 1, 1);
+    mcIdType *connIndexM1Ptr(connIndexM1->getPointer());
+    connIndexM1Ptr[0] = 0;
+    const INTERP_KERNEL::CellModel &cmsDft(INTERP_KERNEL::CellModel::GetCellModel(INTERP_KERNEL::NORM_POINT1));
+    bool needFirstOccurrence(nbrer != MEDCouplingFastNbrer);
+    INTERP_KERNEL::ParallelForChunks(
+        nbOfThreads,
+        mcIdType(0),
+        nbOfCells,
+        GRAIN,
+        [&](mcIdType bg, mcIdType end, unsigned int)
+        {
+            std::vector<mcIdType> firstOccurrence;
+            ForEachDescendingSon<SonsGenerator>(
+                conn,
+                connI,
+                descIndxPtr,
+                bg,
+                end,
+                [&](mcIdType,
+                    mcIdType sonId,
+                    const mcIdType *son,
+                    unsigned nbOfNodesSon,
+                    INTERP_KERNEL::NormalizedCellType typeOfSon)
+                {
+                    mcIdType newSonId(o2n[sonId]);
+                    if (n2o[newSonId] == sonId)
+                    {
+                        descPtr[sonId] = nbrer(newSonId, 0, cmsDft, false, 0, 0);
+                        connIndexM1Ptr[newSonId + 1] = ToIdType(nbOfNodesSon) + 1;
+                        return;
+                    }
+                    const mcIdType *firstOccurrenceConn(nullptr);
+                    if (needFirstOccurrence)
+                    {
+                        INTERP_KERNEL::NormalizedCellType typeOfFirstOccurrence;
+                        FillDescendingSon<SonsGenerator>(
+                            conn, connI, descIndxPtr, nbOfCells, n2o[newSonId], firstOccurrence, typeOfFirstOccurrence
+                        );
+                        firstOccurrenceConn = firstOccurrence.data();
+                    }
+                    descPtr[sonId] = nbrer(
+                        newSonId,
+                        ToIdType(nbOfNodesSon),
+                        INTERP_KERNEL::CellModel::GetCellModel(typeOfSon),
+                        true,
+                        firstOccurrenceConn,
+                        son
+                    );
+                }
+            );
+        }
+    );
+    // connectivity of the merged sons, given by their first occurrence
+    std::partial_sum(connIndexM1Ptr, connIndexM1Ptr + newNbOfCellsM1 + 1, connIndexM1Ptr);
+    connM1->alloc(connIndexM1Ptr[newNbOfCellsM1], 1);
+    mcIdType *connM1Ptr(connM1->getPointer());
+    INTERP_KERNEL::ParallelForChunks(
+        nbOfThreads,
+        mcIdType(0),
+        nbOfCells,
+        GRAIN,
+        [&](mcIdType bg, mcIdType end, unsigned int)
+        {
+            ForEachDescendingSon<SonsGenerator>(
+                conn,
+                connI,
+                descIndxPtr,
+                bg,
+                end,
+                [&](mcIdType,
+                    mcIdType sonId,
+                    const mcIdType *son,
+                    unsigned nbOfNodesSon,
+                    INTERP_KERNEL::NormalizedCellType typeOfSon)
+                {
+                    mcIdType newSonId(o2n[sonId]);
+                    if (n2o[newSonId] != sonId)
+                        return;
+                    mcIdType *work(connM1Ptr + connIndexM1Ptr[newSonId]);
+                    *work++ = ToIdType(typeOfSon);
+                    std::copy(son, son + nbOfNodesSon, work);
+                }
+            );
+        }
+    );
+    MCAuto<MEDCouplingUMesh> ret(MEDCouplingUMesh::New(getName(), getMeshDimension() - SonsGenerator::DELTA));
+    ret->setCoords(getCoords());
+    ret->setConnectivity(connM1, connIndexM1, true);
+    ret->copyTinyInfoFrom(this);
+    return ret.retn();
+}
+
+/*!
+ * Numbering of the nodes of a piece of a mesh written in VTK, given by the ascending ids \a nodeIds of these nodes in
+ * the mesh. The old to new array only spans the range of \a nodeIds, that is close to the size of the piece when the
+ * piece is made of consecutive cells.
+ */
+class VTKNodeRenumbering
+{
+   public:
+    VTKNodeRenumbering(const DataArrayIdType *nodeIds) : _first(nodeIds->empty() ? 0 : nodeIds->front())
+    {
+        if (nodeIds->empty())
+            return;
+        _o2n.resize(nodeIds->back() - _first + 1, -1);
+        mcIdType newId(0);
+        for (const mcIdType *it = nodeIds->begin(); it != nodeIds->end(); it++) _o2n[*it - _first] = newId++;
+    }
+    void apply(mcIdType *bg, mcIdType *end) const
+    {
+        for (mcIdType *it = bg; it != end; it++) *it = _o2n[*it - _first];
+    }
+
+   private:
+    mcIdType _first;
+    std::vector<mcIdType> _o2n;
+};
+
+/*!
+ * Appends to \a conn the nodes of the cell \a cellId in the VTK order : the nodes of a HEXA27 are permuted and those
+ * of a polyhedron are the sorted set of the nodes of its faces. The nodes are renumbered by \a renumbering if not null.
+ */
+inline void
+AppendVTKConnectivityOfCell(
+    const mcIdType *conn,
+    const mcIdType *connI,
+    mcIdType cellId,
+    std::vector<mcIdType> &ret,
+    const VTKNodeRenumbering *renumbering = nullptr
+)
+{
+    std::size_t sz(ret.size());
+    const mcIdType *bg(conn + connI[cellId] + 1), *end(conn + connI[cellId + 1]);
+    switch ((INTERP_KERNEL::NormalizedCellType)conn[connI[cellId]])
+    {
+        case INTERP_KERNEL::NORM_POLYHED:
+        {
+            std::set<mcIdType> c(bg, end);
+            c.erase(-1);
+            ret.insert(ret.end(), c.begin(), c.end());
+            break;
+        }
+        case INTERP_KERNEL::NORM_HEXA27:
         {
-            for (mcIdType j = commonCellsIPtr[0]; j < commonCellsIPtr[1]; j++)
-                revDesc->pushBackSilent(revDesc2Ptr[commonCellsPtr[j]]);
-            revDescIndxPtr[0] = revDescIndxPtr[-1] + commonCellsIPtr[1] - commonCellsIPtr[0];
-            commonCellsIPtr++;
+            if (end - bg != 27)
+                THROW_IK_EXCEPTION("For HEXA27 cell #" << cellId << " len mismatches !");
+            for (unsigned char iH = 0; iH < 27; ++iH)
+                ret.push_back(bg[MEDCoupling1GTUMesh::HEXA27_PERM_ARRAY[iH]]);
+            break;
         }
+        default:
+            ret.insert(ret.end(), bg, end);
+    }
+    if (renumbering)
+        renumbering->apply(ret.data() + sz, ret.data() + ret.size());
+}
+
+/*!
+ * Appends to \a ret the VTK description of the faces of the polyhedron \a cellId : its number of faces followed, for
+ * each face, by its number of nodes and its nodes. The nodes are renumbered by \a renumbering if not null.
+ */
+inline void
+AppendVTKFacesOfPolyhedron(
+    const mcIdType *conn,
+    const mcIdType *connI,
+    mcIdType cellId,
+    std::vector<mcIdType> &ret,
+    const VTKNodeRenumbering *renumbering = nullptr
+)
+{
+    const mcIdType *bg(conn + connI[cellId] + 1), *end(conn + connI[cellId + 1]);
+    mcIdType nbOfFaces(ToIdType(std::count(bg, end, -1)) + 1);
+    ret.push_back(nbOfFaces);
+    for (mcIdType i = 0; i < nbOfFaces; i++)
+    {
+        const mcIdType *faceEnd(std::find(bg, end, -1));
+        ret.push_back(ToIdType(std::distance(bg, faceEnd)));
+        std::size_t sz(ret.size());
+        ret.insert(ret.end(), bg, faceEnd);
+        if (renumbering)
+            renumbering->apply(ret.data() + sz, ret.data() + ret.size());
+        bg = faceEnd + 1;
+    }
+}
+
+/*!
+ * Stream of the values of a VTK array of the cells of a mesh, made of the values appended by \a func(cellId, values)
+ * for the consecutive cells. operator() produces the values [ \a bg, \a end ) of the array and has to be called on
+ * consecutive ranges, as MEDCouplingVTKAppendedData does, so that the array is never built as a whole.
+ */
+template <class FUNC>
+class VTKCellsValuesStream
+{
+   public:
+    VTKCellsValuesStream(mcIdType nbOfCells, FUNC func) : _nb_of_cells(nbOfCells), _func(func), _cell(0), _pos(0) {}
+    template <class T>
+    void operator()(std::size_t bg, std::size_t end, T *out)
+    {
+        for (std::size_t nb = end - bg; nb > 0;)
+        {
+            if (_pos == _values.size())
+            {
+                if (_cell == _nb_of_cells)
+                    throw INTERP_KERNEL::Exception("VTKCellsValuesStream : internal error, array too short !");
+                _values.clear();
+                _pos = 0;
+                _func(_cell++, _values);
+                continue;
+            }
+            std::size_t nbToCopy(std::min(nb, _values.size() - _pos));
+            out = std::transform(
+                _values.begin() + _pos, _values.begin() + _pos + nbToCopy, out, [](mcIdType v) { return (T)v; }
+            );
+            _pos += nbToCopy;
+            nb -= nbToCopy;
+        }
+    }
+
+   private:
+    mcIdType _nb_of_cells;
+    FUNC _func;
+    mcIdType _cell;
+    std::size_t _pos;
+    std::vector<mcIdType> _values;
+};
+
+/*!
+ * Writes in \a ofs the array \a name of \a nbOfValues values produced for the \a nbOfCells cells by \a func (see
+ * VTKCellsValuesStream). The values are streamed to \a appendedData if not null, and written in ascii otherwise.
+ */
+template <class FUNC>
+void
+WriteVTKCellsArray(
+    std::ostream &ofs,
+    const std::string &type,
+    const std::string &name,
+    mcIdType nbOfCells,
+    std::size_t nbOfValues,
+    FUNC func,
+    MEDCouplingVTKAppendedData *appendedData
+)
+{
+    VTKCellsValuesStream<FUNC> stream(nbOfCells, func);
+    if (appendedData)
+    {
+        if (type == "UInt8")
+            appendedData->appendDataArray<unsigned char>(ofs, 8, type, name, 1, nbOfValues, stream);
+        else
+            appendedData->appendDataArray<mcIdType>(ofs, 8, type, name, 1, nbOfValues, stream);
+        return;
     }
-    //
-    return ret2.retn();
+    MCAuto<DataArrayIdType> arr(DataArrayIdType::New());
+    arr->alloc(nbOfValues, 1);
+    stream(0, nbOfValues, arr->getPointer());
+    arr->writeVTK(ofs, 8, type, name, nullptr);
 }
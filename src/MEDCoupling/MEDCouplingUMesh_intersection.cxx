@@ -34,9 +34,11 @@
 #include "InterpKernelGeo2DEdgeLin.hxx"
 #include "InterpKernelGeo2DEdgeArcCircle.hxx"
 #include "InterpKernelGeo2DQuadraticPolygon.hxx"
+#include "InterpKernelGeo2DLinearPolygonIntersector.hxx"
 #include "TranslationRotationMatrix.hxx"
 #include "VectorUtils.hxx"
 #include "MEDCouplingSkyLineArray.hxx"
+#include "InterpKernelThreadPool.hxx"
 
 #include <sstream>
 #include <fstream>
@@ -493,6 +495,252 @@ MEDCouplingUMeshBuildQPFromMesh3(
         }
     }
 }
+
+/*!
+ * Returns true if the SEG2 \a edgeId of \a m1Desc is far enough from all the SEG2 \a candidates of \a m2Desc for
+ * QuadraticPolygon::splitAbs to find neither intersection nor merged node : the edge is then left unsplit, without
+ * building its Geometric2D objects. The distance is compared to the precision \a eps, scaled as splitAbs does.
+ * Returns false as soon as one of the edges is quadratic.
+ */
+bool
+IsSegmentApartFromCandidates(
+    const MEDCouplingUMesh *m1Desc,
+    mcIdType edgeId,
+    const MEDCouplingUMesh *m2Desc,
+    const std::vector<mcIdType> &candidates,
+    double eps
+)
+{
+    const double *coo1(m1Desc->getCoords()->begin()), *coo2(m2Desc->getCoords()->begin());
+    const mcIdType *c1(m1Desc->getNodalConnectivity()->begin()), *ci1(m1Desc->getNodalConnectivityIndex()->begin());
+    const mcIdType *c2(m2Desc->getNodalConnectivity()->begin()), *ci2(m2Desc->getNodalConnectivityIndex()->begin());
+    if (c1[ci1[edgeId]] != INTERP_KERNEL::NORM_SEG2)
+        return false;
+    const double *a(coo1 + 2 * c1[ci1[edgeId] + 1]), *b(coo1 + 2 * c1[ci1[edgeId] + 2]);
+    INTERP_KERNEL::Bounds bounds(
+        std::min(a[0], b[0]), std::max(a[0], b[0]), std::min(a[1], b[1]), std::max(a[1], b[1])
+    );
+    for (mcIdType candidate : candidates)
+    {
+        if (c2[ci2[candidate]] != INTERP_KERNEL::NORM_SEG2)
+            return false;
+        const double *c(coo2 + 2 * c2[ci2[candidate] + 1]), *d(coo2 + 2 * c2[ci2[candidate] + 2]);
+        bounds.aggregate(INTERP_KERNEL::Bounds(
+            std::min(c[0], d[0]), std::max(c[0], d[0]), std::min(c[1], d[1]), std::max(c[1], d[1])
+        ));
+    }
+    // splitAbs works on coordinates normalized by the characteristic dimension, the nodes are merged in absolute
+    double tol(10. * eps * std::max(bounds.getCaracteristicDim(), 1.));
+    for (mcIdType candidate : candidates)
+    {
+        const double *c(coo2 + 2 * c2[ci2[candidate] + 1]), *d(coo2 + 2 * c2[ci2[candidate] + 2]);
+        if (INTERP_KERNEL::LinearPolygonIntersector::DistanceBetweenSegments(a, b, c, d) <= tol)
+            return false;
+    }
+    return true;
+}
+
+/*!
+ * Returns true if the point \a pt is inside the linear cell [ \a connBg, \a connEnd ) of \a coords. \a pt is assumed
+ * to be far from the boundary of the cell.
+ */
+bool
+IsPointInLinearCell(const double *pt, const double *coords, const mcIdType *connBg, const mcIdType *connEnd)
+{
+    bool ret(false);
+    for (const mcIdType *it = connBg; it != connEnd; it++)
+    {
+        const double *p0(coords + 2 * (*it)), *p1(coords + 2 * (it + 1 != connEnd ? it[1] : *connBg));
+        if ((p0[1] > pt[1]) != (p1[1] > pt[1]) && pt[0] < p0[0] + (pt[1] - p0[1]) * (p1[0] - p0[0]) / (p1[1] - p0[1]))
+            ret = !ret;
+    }
+    return ret;
+}
+
+/*!
+ * Returns true if the boundary of the linear cell \a cellId of \a m1 is far enough from those of all the linear \a
+ * candidates of \a m2 for QuadraticPolygon::buildPartitionsAbs to find no intersection and no common edge : the
+ * result is then the cell itself, which lies inside the candidate \a containingCell, or outside all of them if \a
+ * containingCell is -1. Returns false if a candidate lies inside the cell, or as soon as one of the cells is quadratic.
+ */
+bool
+IsCellApartFromCandidates(
+    const MEDCouplingUMesh *m1,
+    mcIdType cellId,
+    const MEDCouplingUMesh *m2,
+    const std::vector<mcIdType> &candidates,
+    double eps,
+    mcIdType &containingCell
+)
+{
+    const double *coo1(m1->getCoords()->begin()), *coo2(m2->getCoords()->begin());
+    const mcIdType *c1(m1->getNodalConnectivity()->begin()), *ci1(m1->getNodalConnectivityIndex()->begin());
+    const mcIdType *c2(m2->getNodalConnectivity()->begin()), *ci2(m2->getNodalConnectivityIndex()->begin());
+    const mcIdType *cellBg(c1 + ci1[cellId] + 1), *cellEnd(c1 + ci1[cellId + 1]);
+    if (INTERP_KERNEL::CellModel::GetCellModel((INTERP_KERNEL::NormalizedCellType)c1[ci1[cellId]]).isQuadratic() ||
+        cellBg == cellEnd)
+        return false;
+    INTERP_KERNEL::Bounds bounds;
+    bounds.prepareForAggregation();
+    for (const mcIdType *it = cellBg; it != cellEnd; it++)
+        bounds.aggregate(
+            INTERP_KERNEL::Bounds(coo1[2 * (*it)], coo1[2 * (*it)], coo1[2 * (*it) + 1], coo1[2 * (*it) + 1])
+        );
+    for (mcIdType candidate : candidates)
+    {
+        if (INTERP_KERNEL::CellModel::GetCellModel((INTERP_KERNEL::NormalizedCellType)c2[ci2[candidate]]).isQuadratic())
+            return false;
+        for (const mcIdType *it = c2 + ci2[candidate] + 1; it != c2 + ci2[candidate + 1]; it++)
+            bounds.aggregate(
+                INTERP_KERNEL::Bounds(coo2[2 * (*it)], coo2[2 * (*it)], coo2[2 * (*it) + 1], coo2[2 * (*it) + 1])
+            );
+    }
+    // same scaling of the precision as in IsSegmentApartFromCandidates
+    double tol(10. * eps * std::max(bounds.getCaracteristicDim(), 1.));
+    containingCell = -1;
+    for (mcIdType candidate : candidates)
+    {
+        const mcIdType *candBg(c2 + ci2[candidate] + 1), *candEnd(c2 + ci2[candidate + 1]);
+        if (candBg == candEnd)
+            return false;
+        for (const mcIdType *it = cellBg; it != cellEnd; it++)
+        {
+            const double *a(coo1 + 2 * (*it)), *b(coo1 + 2 * (it + 1 != cellEnd ? it[1] : *cellBg));
+            for (const mcIdType *it2 = candBg; it2 != candEnd; it2++)
+            {
+                const double *c(coo2 + 2 * (*it2)), *d(coo2 + 2 * (it2 + 1 != candEnd ? it2[1] : *candBg));
+                if (INTERP_KERNEL::LinearPolygonIntersector::DistanceBetweenSegments(a, b, c, d) <= tol)
+                    return false;
+            }
+        }
+        if (IsPointInLinearCell(coo2 + 2 * (*candBg), coo1, cellBg, cellEnd))
+            return false;
+        if (IsPointInLinearCell(coo1 + 2 * (*cellBg), coo2, candBg, candEnd))
+        {
+            if (containingCell != -1)
+                return false;
+            containingCell = candidate;
+        }
+    }
+    return true;
+}
+
+/*!
+ * Result of MEDCouplingUMesh::Intersect1DMeshes for the edges [ \a _bg, \a _end ) of \a m1Desc. The new nodes are
+ * numbered from \a offset2 in \a _add_coo, and the contributions to \a colinear2 and \a subDiv2 are kept, by edge of
+ * \a m2Desc, in the order in which a sequential run produces them.
+ */
+class Intersect1DMeshesChunk
+{
+   public:
+    Intersect1DMeshesChunk() : _bg(0), _end(0) {}
+    void appendTo(
+        mcIdType offset2,
+        std::vector<std::vector<mcIdType> > &intersectEdge1,
+        std::vector<std::vector<mcIdType> > &colinear2,
+        std::vector<std::vector<mcIdType> > &subDiv2,
+        std::vector<double> &addCoo,
+        std::map<mcIdType, mcIdType> &mergedNodes
+    ) const;
+
+   public:
+    mcIdType _bg;
+    mcIdType _end;
+    std::vector<double> _add_coo;
+    std::vector<std::pair<mcIdType, std::vector<mcIdType> > > _colinear2;
+    std::vector<std::pair<mcIdType, std::vector<mcIdType> > > _sub_div2;
+    std::map<mcIdType, mcIdType> _merged_nodes;
+};
+
+/*!
+ * Appends \a this to the result of the previous chunks. The new nodes are renumbered after those of \a addCoo and the
+ * nodes splitting the edges of \a m2Desc are deduplicated as Node::fillGlobalInfoAbs2 does : a node already
+ * existing in the input meshes is only added once to an edge.
+ */
+void
+Intersect1DMeshesChunk::appendTo(
+    mcIdType offset2,
+    std::vector<std::vector<mcIdType> > &intersectEdge1,
+    std::vector<std::vector<mcIdType> > &colinear2,
+    std::vector<std::vector<mcIdType> > &subDiv2,
+    std::vector<double> &addCoo,
+    std::map<mcIdType, mcIdType> &mergedNodes
+) const
+{
+    mcIdType shift(ToIdType(addCoo.size()) / 2);
+    if (shift != 0)
+        for (mcIdType i = _bg; i < _end; i++)
+            for (mcIdType &nodeId : intersectEdge1[i])
+                if (nodeId >= offset2)
+                    nodeId += shift;
+    for (const std::pair<mcIdType, std::vector<mcIdType> > &elt : _colinear2)
+        colinear2[elt.first].insert(colinear2[elt.first].end(), elt.second.begin(), elt.second.end());
+    for (const std::pair<mcIdType, std::vector<mcIdType> > &elt : _sub_div2)
+    {
+        std::vector<mcIdType> &subDiv(subDiv2[elt.first]);
+        for (mcIdType nodeId : elt.second)
+        {
+            if (nodeId >= offset2)
+                subDiv.push_back(nodeId + shift);
+            else if (std::find(subDiv.begin(), subDiv.end(), nodeId) == subDiv.end())
+                subDiv.push_back(nodeId);
+        }
+    }
+    for (const std::pair<const mcIdType, mcIdType> &elt : _merged_nodes) mergedNodes[elt.first] = elt.second;
+    addCoo.insert(addCoo.end(), _add_coo.begin(), _add_coo.end());
+}
+
+/*!
+ * Result of MEDCouplingUMesh::BuildIntersecting2DCellsFromEdges for a range of cells of \a m1. The quadratic nodes
+ * are numbered from \a offset3 in \a _add_coords_quadratic and \a _cr_i starts at 0.
+ */
+class BuildIntersecting2DCellsChunk
+{
+   public:
+    BuildIntersecting2DCellsChunk() : _cr_i(1, 0) {}
+    void appendTo(
+        mcIdType offset3,
+        std::vector<double> &addCoordsQuadratic,
+        std::vector<mcIdType> &cr,
+        std::vector<mcIdType> &crI,
+        std::vector<mcIdType> &cNb1,
+        std::vector<mcIdType> &cNb2
+    ) const;
+
+   public:
+    std::vector<double> _add_coords_quadratic;
+    std::vector<mcIdType> _cr;
+    std::vector<mcIdType> _cr_i;
+    std::vector<mcIdType> _c_nb1;
+    std::vector<mcIdType> _c_nb2;
+};
+
+/*!
+ * Appends \a this to the result of the previous chunks, the quadratic nodes being renumbered after those of \a
+ * addCoordsQuadratic.
+ */
+void
+BuildIntersecting2DCellsChunk::appendTo(
+    mcIdType offset3,
+    std::vector<double> &addCoordsQuadratic,
+    std::vector<mcIdType> &cr,
+    std::vector<mcIdType> &crI,
+    std::vector<mcIdType> &cNb1,
+    std::vector<mcIdType> &cNb2
+) const
+{
+    mcIdType shift(ToIdType(addCoordsQuadratic.size()) / 2), crShift(ToIdType(cr.size()));
+    for (std::size_t i = 0; i + 1 < _cr_i.size(); i++)
+    {
+        cr.push_back(_cr[_cr_i[i]]);  // geometric type
+        for (mcIdType j = _cr_i[i] + 1; j < _cr_i[i + 1]; j++)
+            cr.push_back(_cr[j] >= offset3 ? _cr[j] + shift : _cr[j]);
+        crI.push_back(_cr_i[i + 1] + crShift);
+    }
+    cNb1.insert(cNb1.end(), _c_nb1.begin(), _c_nb1.end());
+    cNb2.insert(cNb2.end(), _c_nb2.begin(), _c_nb2.end());
+    addCoordsQuadratic.insert(addCoordsQuadratic.end(), _add_coords_quadratic.begin(), _add_coords_quadratic.end());
+}
 }  // namespace MEDCoupling
 
 /*!
@@ -1749,64 +1997,95 @@ MEDCouplingUMesh::Intersect1DMeshes(
         m2Desc->getCoords()->begin(), 0, 0, m2Desc->getCoords()->getNumberOfTuples(), eps
     );
 
-    std::vector<mcIdType> candidates1(1);
     mcIdType offset1(m1Desc->getNumberOfNodes());
     mcIdType offset2(offset1 + m2Desc->getNumberOfNodes());
-    for (mcIdType i = 0; i < nDescCell1; i++)  // for all edges in the first mesh
-    {
-        std::vector<mcIdType> candidates2;  // edges of mesh2 candidate for intersection
-        myTree.getIntersectingElems(bbox1 + i * 2 * SPACEDIM, candidates2);
-        if (!candidates2.empty())  // candidates2 holds edges from the second mesh potentially intersecting current edge
-                                   // i in mesh1
+    // The edges of m1Desc are cut in chunks processed by the threads allowed by MEDCouplingGetNbOfThreads. A chunk
+    // numbers its new nodes from offset2 and keeps its contributions to the edges of m2Desc in the order of the edges
+    // of m1Desc. The chunks are then merged in order, giving the result of a sequential run whatever the number of
+    // threads.
+    const mcIdType GRAIN = 256;
+    std::vector<Intersect1DMeshesChunk> chunks(std::max(mcIdType(1), (nDescCell1 + GRAIN - 1) / GRAIN));
+    INTERP_KERNEL::ParallelForChunks(
+        INTERP_KERNEL::GetEffectiveNbOfThreads(MEDCouplingGetNbOfThreads()),
+        mcIdType(0),
+        nDescCell1,
+        GRAIN,
+        [&](mcIdType bg, mcIdType end, unsigned int)
         {
-            std::map<INTERP_KERNEL::Node *, mcIdType> map1, map2;
-            std::map<mcIdType, INTERP_KERNEL::Node *> revMap2;
-            // pol2 is not necessarily a closed polygon: just a set of (quadratic) edges (same as candidates2) in the
-            // Geometric DS format
-            INTERP_KERNEL::QuadraticPolygon *pol2 = MEDCouplingUMeshBuildQPFromMesh(m2Desc, candidates2, map2);
-            // Build revMap2
-            for (auto &kv : map2) revMap2[kv.second] = kv.first;
-            candidates1[0] = i;
-            // In the construction of pol1 we might reuse nodes from pol2, that we have identified as to be merged.
-            INTERP_KERNEL::QuadraticPolygon *pol1 =
-                MEDCouplingUMeshBuildQPFromMeshWithTree(m1Desc, candidates1, map1, treeNodes2, revMap2);
-            // This following part is to avoid that some removed nodes (for example due to a merge between pol1 and
-            // pol2) are replaced by a newly created one This trick guarantees that Node * are discriminant (i.e. form a
-            // unique identifier)
-            std::set<INTERP_KERNEL::Node *> nodes;
-            pol1->getAllNodes(nodes);
-            pol2->getAllNodes(nodes);
-            std::size_t szz(nodes.size());
-            std::vector<MCAuto<INTERP_KERNEL::Node> > nodesSafe(szz);
-            std::set<INTERP_KERNEL::Node *>::const_iterator itt(nodes.begin());
-            for (std::size_t iii = 0; iii < szz; iii++, itt++)
+            Intersect1DMeshesChunk &chunk(chunks[bg / GRAIN]);
+            chunk._bg = bg;
+            chunk._end = end;
+            std::vector<mcIdType> candidates1(1);
+            for (mcIdType i = bg; i < end; i++)  // for all edges in the first mesh
             {
-                (*itt)->incrRef();
-                nodesSafe[iii] = *itt;
+                std::vector<mcIdType> candidates2;  // edges of mesh2 candidate for intersection
+                myTree.getIntersectingElems(bbox1 + i * 2 * SPACEDIM, candidates2);
+                // candidates2 holds edges from the second mesh potentially intersecting current edge i in mesh1
+                if (!candidates2.empty() && !IsSegmentApartFromCandidates(m1Desc, i, m2Desc, candidates2, eps))
+                {
+                    std::map<INTERP_KERNEL::Node *, mcIdType> map1, map2;
+                    std::map<mcIdType, INTERP_KERNEL::Node *> revMap2;
+                    // pol2 is not necessarily a closed polygon: just a set of (quadratic) edges (same as candidates2)
+                    // in the Geometric DS format
+                    INTERP_KERNEL::QuadraticPolygon *pol2 = MEDCouplingUMeshBuildQPFromMesh(m2Desc, candidates2, map2);
+                    // Build revMap2
+                    for (auto &kv : map2) revMap2[kv.second] = kv.first;
+                    candidates1[0] = i;
+                    // In the construction of pol1 we might reuse nodes from pol2, that we have identified as to be
+                    // merged.
+                    INTERP_KERNEL::QuadraticPolygon *pol1 =
+                        MEDCouplingUMeshBuildQPFromMeshWithTree(m1Desc, candidates1, map1, treeNodes2, revMap2);
+                    // This following part is to avoid that some removed nodes (for example due to a merge between pol1
+                    // and pol2) are replaced by a newly created one This trick guarantees that Node * are discriminant
+                    // (i.e. form a unique identifier)
+                    std::set<INTERP_KERNEL::Node *> nodes;
+                    pol1->getAllNodes(nodes);
+                    pol2->getAllNodes(nodes);
+                    std::size_t szz(nodes.size());
+                    std::vector<MCAuto<INTERP_KERNEL::Node> > nodesSafe(szz);
+                    std::set<INTERP_KERNEL::Node *>::const_iterator itt(nodes.begin());
+                    for (std::size_t iii = 0; iii < szz; iii++, itt++)
+                    {
+                        (*itt)->incrRef();
+                        nodesSafe[iii] = *itt;
+                    }
+                    // end of protection
+                    // Performs edge cutting. The contributions to the edges of m2Desc are collected per candidate.
+                    std::vector<mcIdType> candidatesIds(candidates2.size());
+                    std::iota(candidatesIds.begin(), candidatesIds.end(), mcIdType(0));
+                    std::vector<std::vector<mcIdType> > colinear(candidates2.size()), subDiv(candidates2.size());
+                    pol1->splitAbs(
+                        *pol2,
+                        map1,
+                        map2,
+                        offset1,
+                        offset2,
+                        candidatesIds,
+                        intersectEdge1[i],
+                        i,
+                        colinear,
+                        subDiv,
+                        chunk._add_coo,
+                        chunk._merged_nodes
+                    );
+                    for (std::size_t j = 0; j < candidates2.size(); j++)
+                    {
+                        if (!colinear[j].empty())
+                            chunk._colinear2.push_back(std::make_pair(candidates2[j], std::move(colinear[j])));
+                        if (!subDiv[j].empty())
+                            chunk._sub_div2.push_back(std::make_pair(candidates2[j], std::move(subDiv[j])));
+                    }
+                    delete pol2;
+                    delete pol1;
+                }
+                else
+                    // Copy the edge (take only the two first points, ie discard quadratic point at this stage)
+                    intersectEdge1[i].insert(intersectEdge1[i].end(), c1 + ci1[i] + 1, c1 + ci1[i] + 3);
             }
-            // end of protection
-            // Performs edge cutting:
-            pol1->splitAbs(
-                *pol2,
-                map1,
-                map2,
-                offset1,
-                offset2,
-                candidates2,
-                intersectEdge1[i],
-                i,
-                colinear2,
-                subDiv2,
-                addCoo,
-                mergedNodes
-            );
-            delete pol2;
-            delete pol1;
         }
-        else
-            // Copy the edge (take only the two first points, ie discard quadratic point at this stage)
-            intersectEdge1[i].insert(intersectEdge1[i].end(), c1 + ci1[i] + 1, c1 + ci1[i] + 3);
-    }
+    );
+    for (const Intersect1DMeshesChunk &chunk : chunks)
+        chunk.appendTo(offset2, intersectEdge1, colinear2, subDiv2, addCoo, mergedNodes);
 }
 
 /*!
@@ -1908,133 +2187,193 @@ MEDCouplingUMesh::BuildIntersecting2DCellsFromEdges(
     BBTree<SPACEDIM, mcIdType> myTree(bbox2, 0, 0, m2->getNumberOfCells(), eps);
     mcIdType ncell1 = m1->getNumberOfCells();
     crI.push_back(0);
-    for (mcIdType i = 0; i < ncell1; i++)
-    {
-        std::vector<mcIdType> candidates2;
-        myTree.getIntersectingElems(bbox1 + i * 2 * SPACEDIM, candidates2);
-        std::map<INTERP_KERNEL::Node *, mcIdType> mapp;
-        std::map<mcIdType, INTERP_KERNEL::Node *> mappRev;
-        INTERP_KERNEL::QuadraticPolygon pol1;
-        INTERP_KERNEL::NormalizedCellType typ = (INTERP_KERNEL::NormalizedCellType)conn1[connI1[i]];
-        const INTERP_KERNEL::CellModel &cm = INTERP_KERNEL::CellModel::GetCellModel(typ);
-        // Populate mapp and mappRev with nodes from the current cell (i) from mesh1 - this also builds the Node*
-        // objects:
-        MEDCouplingUMeshBuildQPFromMesh3(
-            coo1,
-            offset1,
-            coo2,
-            offset2,
-            addCoords,
-            desc1 + descIndx1[i],
-            desc1 + descIndx1[i + 1],
-            intesctEdges1,
-            /* output */ mapp,
-            mappRev
-        );
-        // pol1 is the full cell from mesh1, in QP format, with all the additional intersecting nodes.
-        pol1.buildFromCrudeDataArray(
-            mappRev,
-            cm.isQuadratic(),
-            conn1 + connI1[i] + 1,
-            coo1,
-            desc1 + descIndx1[i],
-            desc1 + descIndx1[i + 1],
-            intesctEdges1
-        );
-        //
-        std::set<INTERP_KERNEL::Edge *>
-            edges1;  // store all edges of pol1 that are NOT consumed by intersect cells. If any after iteration over
-                     // candidates2 -> a part of pol1 should appear in result
-        std::set<INTERP_KERNEL::Edge *>
-            edgesBoundary2;  // store all edges that are on boundary of (pol2 intersect pol1) minus edges on pol1.
-        INTERP_KERNEL::IteratorOnComposedEdge it1(&pol1);
-        for (it1.first(); !it1.finished(); it1.next()) edges1.insert(it1.current()->getPtr());
-        //
-        std::map<mcIdType, std::vector<INTERP_KERNEL::ElementaryEdge *> > edgesIn2ForShare;  // common edges
-        std::vector<INTERP_KERNEL::QuadraticPolygon> pol2s(candidates2.size());
-        mcIdType ii = 0;
-        // Build, for each intersecting cell candidate from mesh2, the corresponding QP.
-        // Again all the additional intersecting nodes are there.
-        for (std::vector<mcIdType>::const_iterator it2 = candidates2.begin(); it2 != candidates2.end(); it2++, ii++)
+    // The cells of m1 are cut in chunks processed by the threads allowed by MEDCouplingGetNbOfThreads, and merged in
+    // order.
+    const mcIdType GRAIN = 64;
+    std::vector<BuildIntersecting2DCellsChunk> chunks(std::max(mcIdType(1), (ncell1 + GRAIN - 1) / GRAIN));
+    INTERP_KERNEL::ParallelForChunks(
+        INTERP_KERNEL::GetEffectiveNbOfThreads(MEDCouplingGetNbOfThreads()),
+        mcIdType(0),
+        ncell1,
+        GRAIN,
+        [&](mcIdType bg, mcIdType end, unsigned int)
         {
-            INTERP_KERNEL::NormalizedCellType typ2 = (INTERP_KERNEL::NormalizedCellType)conn2[connI2[*it2]];
-            const INTERP_KERNEL::CellModel &cm2 = INTERP_KERNEL::CellModel::GetCellModel(typ2);
-            // Complete mapping with elements coming from the current cell it2 in mesh2:
-            MEDCouplingUMeshBuildQPFromMesh3(
-                coo1,
-                offset1,
-                coo2,
-                offset2,
-                addCoords,
-                desc2 + descIndx2[*it2],
-                desc2 + descIndx2[*it2 + 1],
-                intesctEdges2,
-                /* output */ mapp,
-                mappRev
-            );
-            // pol2 is the new QP in the final merged result.
-            pol2s[ii].buildFromCrudeDataArray2(
-                mappRev,
-                cm2.isQuadratic(),
-                conn2 + connI2[*it2] + 1,
-                coo2,
-                desc2 + descIndx2[*it2],
-                desc2 + descIndx2[*it2 + 1],
-                intesctEdges2,
-                pol1,
-                desc1 + descIndx1[i],
-                desc1 + descIndx1[i + 1],
-                intesctEdges1,
-                colinear2,
-                /* output */ edgesIn2ForShare
-            );
-        }
-        // The cleaning below must be done after the full construction of all pol2s to correctly deal with shared edges:
-        for (auto &p : pol2s) p.cleanDegeneratedConsecutiveEdges();
-        edgesIn2ForShare.clear();  // removing temptation to use it further since it might now contain invalid edges.
-        ///
-        ii = 0;
-        // Now rebuild intersected cells from all this:
-        for (std::vector<mcIdType>::const_iterator it2 = candidates2.begin(); it2 != candidates2.end(); it2++, ii++)
-        {
-            INTERP_KERNEL::ComposedEdge::InitLocationsWithOther(pol1, pol2s[ii]);
-            pol2s[ii].updateLocOfEdgeFromCrudeDataArray2(
-                desc2 + descIndx2[*it2],
-                desc2 + descIndx2[*it2 + 1],
-                intesctEdges2,
-                pol1,
-                desc1 + descIndx1[i],
-                desc1 + descIndx1[i + 1],
-                intesctEdges1,
-                colinear2
-            );
-            // MEDCouplingUMeshAssignOnLoc(pol1,pol2,desc1+descIndx1[i],desc1+descIndx1[i+1],intesctEdges1,desc2+descIndx2[*it2],desc2+descIndx2[*it2+1],intesctEdges2,colinear2);
-            pol1.buildPartitionsAbs(
-                pol2s[ii], edges1, edgesBoundary2, mapp, i, *it2, offset3, addCoordsQuadratic, cr, crI, cNb1, cNb2
-            );
-        }
-        // Deals with remaining (non-consumed) edges from m1: these are the edges that were never touched
-        // by m2 but that we still want to keep in the final result.
-        if (!edges1.empty())
-        {
-            try
+            BuildIntersecting2DCellsChunk &chunk(chunks[bg / GRAIN]);
+            for (mcIdType i = bg; i < end; i++)
             {
-                INTERP_KERNEL::QuadraticPolygon::ComputeResidual(
-                    pol1, edges1, edgesBoundary2, mapp, offset3, i, addCoordsQuadratic, cr, crI, cNb1, cNb2
+                std::vector<mcIdType> candidates2;
+                myTree.getIntersectingElems(bbox1 + i * 2 * SPACEDIM, candidates2);
+                mcIdType containingCell;
+                if (IsCellApartFromCandidates(m1, i, m2, candidates2, eps, containingCell))
+                {
+                    // buildPartitionsAbs starts the cell at its second node, ComputeResidual at its first one
+                    const mcIdType *cellBg(conn1 + connI1[i] + 1), *cellEnd(conn1 + connI1[i + 1]);
+                    const mcIdType *start(containingCell != -1 ? cellBg + 1 : cellBg);
+                    chunk._cr.push_back(INTERP_KERNEL::NORM_POLYGON);
+                    chunk._cr.insert(chunk._cr.end(), start, cellEnd);
+                    chunk._cr.insert(chunk._cr.end(), cellBg, start);
+                    chunk._cr_i.push_back(ToIdType(chunk._cr.size()));
+                    chunk._c_nb1.push_back(i);
+                    chunk._c_nb2.push_back(containingCell);
+                    continue;
+                }
+                std::map<INTERP_KERNEL::Node *, mcIdType> mapp;
+                std::map<mcIdType, INTERP_KERNEL::Node *> mappRev;
+                INTERP_KERNEL::QuadraticPolygon pol1;
+                INTERP_KERNEL::NormalizedCellType typ = (INTERP_KERNEL::NormalizedCellType)conn1[connI1[i]];
+                const INTERP_KERNEL::CellModel &cm = INTERP_KERNEL::CellModel::GetCellModel(typ);
+                // Populate mapp and mappRev with nodes from the current cell (i) from mesh1 - this also builds the
+                // Node* objects:
+                MEDCouplingUMeshBuildQPFromMesh3(
+                    coo1,
+                    offset1,
+                    coo2,
+                    offset2,
+                    addCoords,
+                    desc1 + descIndx1[i],
+                    desc1 + descIndx1[i + 1],
+                    intesctEdges1,
+                    /* output */ mapp,
+                    mappRev
                 );
-            }
-            catch (INTERP_KERNEL::Exception &e)
-            {
-                std::ostringstream oss;
-                oss << "Error when computing residual of cell #" << i
-                    << " in source/m1 mesh ! Maybe the neighbours of this cell in mesh are not well connected !\n"
-                    << "The deep reason is the following : " << e.what();
-                throw INTERP_KERNEL::Exception(oss.str());
+                // pol1 is the full cell from mesh1, in QP format, with all the additional intersecting nodes.
+                pol1.buildFromCrudeDataArray(
+                    mappRev,
+                    cm.isQuadratic(),
+                    conn1 + connI1[i] + 1,
+                    coo1,
+                    desc1 + descIndx1[i],
+                    desc1 + descIndx1[i + 1],
+                    intesctEdges1
+                );
+                //
+                // store all edges of pol1 that are NOT consumed by intersect cells. If any after iteration over
+                // candidates2 -> a part of pol1 should appear in result
+                std::set<INTERP_KERNEL::Edge *> edges1;
+                // store all edges that are on boundary of (pol2 intersect pol1) minus edges on pol1.
+                std::set<INTERP_KERNEL::Edge *> edgesBoundary2;
+                INTERP_KERNEL::IteratorOnComposedEdge it1(&pol1);
+                for (it1.first(); !it1.finished(); it1.next()) edges1.insert(it1.current()->getPtr());
+                //
+                std::map<mcIdType, std::vector<INTERP_KERNEL::ElementaryEdge *> > edgesIn2ForShare;  // common edges
+                std::vector<INTERP_KERNEL::QuadraticPolygon> pol2s(candidates2.size());
+                mcIdType ii = 0;
+                // Build, for each intersecting cell candidate from mesh2, the corresponding QP.
+                // Again all the additional intersecting nodes are there.
+                for (std::vector<mcIdType>::const_iterator it2 = candidates2.begin();
+                     it2 != candidates2.end();
+                     it2++, ii++)
+                {
+                    INTERP_KERNEL::NormalizedCellType typ2 = (INTERP_KERNEL::NormalizedCellType)conn2[connI2[*it2]];
+                    const INTERP_KERNEL::CellModel &cm2 = INTERP_KERNEL::CellModel::GetCellModel(typ2);
+                    // Complete mapping with elements coming from the current cell it2 in mesh2:
+                    MEDCouplingUMeshBuildQPFromMesh3(
+                        coo1,
+                        offset1,
+                        coo2,
+                        offset2,
+                        addCoords,
+                        desc2 + descIndx2[*it2],
+                        desc2 + descIndx2[*it2 + 1],
+                        intesctEdges2,
+                        /* output */ mapp,
+                        mappRev
+                    );
+                    // pol2 is the new QP in the final merged result.
+                    pol2s[ii].buildFromCrudeDataArray2(
+                        mappRev,
+                        cm2.isQuadratic(),
+                        conn2 + connI2[*it2] + 1,
+                        coo2,
+                        desc2 + descIndx2[*it2],
+                        desc2 + descIndx2[*it2 + 1],
+                        intesctEdges2,
+                        pol1,
+                        desc1 + descIndx1[i],
+                        desc1 + descIndx1[i + 1],
+                        intesctEdges1,
+                        colinear2,
+                        /* output */ edgesIn2ForShare
+                    );
+                }
+                // The cleaning below must be done after the full construction of all pol2s to correctly deal with
+                // shared edges:
+                for (auto &p : pol2s) p.cleanDegeneratedConsecutiveEdges();
+                edgesIn2ForShare.clear();  // removing temptation to use it further since it might now contain invalid
+                                           // edges.
+                ///
+                ii = 0;
+                // Now rebuild intersected cells from all this:
+                for (std::vector<mcIdType>::const_iterator it2 = candidates2.begin();
+                     it2 != candidates2.end();
+                     it2++, ii++)
+                {
+                    INTERP_KERNEL::ComposedEdge::InitLocationsWithOther(pol1, pol2s[ii]);
+                    pol2s[ii].updateLocOfEdgeFromCrudeDataArray2(
+                        desc2 + descIndx2[*it2],
+                        desc2 + descIndx2[*it2 + 1],
+                        intesctEdges2,
+                        pol1,
+                        desc1 + descIndx1[i],
+                        desc1 + descIndx1[i + 1],
+                        intesctEdges1,
+                        colinear2
+                    );
+                    // MEDCouplingUMeshAssignOnLoc(pol1,pol2,desc1+descIndx1[i],desc1+descIndx1[i+1],intesctEdges1,desc2+descIndx2[*it2],desc2+descIndx2[*it2+1],intesctEdges2,colinear2);
+                    pol1.buildPartitionsAbs(
+                        pol2s[ii],
+                        edges1,
+                        edgesBoundary2,
+                        mapp,
+                        i,
+                        *it2,
+                        offset3,
+                        chunk._add_coords_quadratic,
+                        chunk._cr,
+                        chunk._cr_i,
+                        chunk._c_nb1,
+                        chunk._c_nb2
+                    );
+                }
+                // Deals with remaining (non-consumed) edges from m1: these are the edges that were never touched
+                // by m2 but that we still want to keep in the final result.
+                if (!edges1.empty())
+                {
+                    try
+                    {
+                        INTERP_KERNEL::QuadraticPolygon::ComputeResidual(
+                            pol1,
+                            edges1,
+                            edgesBoundary2,
+                            mapp,
+                            offset3,
+                            i,
+                            chunk._add_coords_quadratic,
+                            chunk._cr,
+                            chunk._cr_i,
+                            chunk._c_nb1,
+                            chunk._c_nb2
+                        );
+                    }
+                    catch (INTERP_KERNEL::Exception &e)
+                    {
+                        std::ostringstream oss;
+                        oss << "Error when computing residual of cell #" << i
+                            << " in source/m1 mesh ! Maybe the neighbours of this cell in mesh are not well "
+                               "connected !\n"
+                            << "The deep reason is the following : " << e.what();
+                        throw INTERP_KERNEL::Exception(oss.str());
+                    }
+                }
+                for (std::map<mcIdType, INTERP_KERNEL::Node *>::const_iterator it = mappRev.begin();
+                     it != mappRev.end();
+                     it++)
+                    (*it).second->decrRef();
             }
         }
-        for (std::map<mcIdType, INTERP_KERNEL::Node *>::const_iterator it = mappRev.begin(); it != mappRev.end(); it++)
-            (*it).second->decrRef();
-    }
+    );
+    for (const BuildIntersecting2DCellsChunk &chunk : chunks)
+        chunk.appendTo(offset3, addCoordsQuadratic, cr, crI, cNb1, cNb2);
 }
 
 void
@@ -2329,6 +2668,8 @@ MEDCouplingUMesh::split2DCellsQuadratic(
  * \b WARNING: the two meshes should be correctly oriented for this method to work properly. Methods
  * changeSpaceDimension() and orientCorrectly2DCells() can be used for this.
  * \b WARNING: the two meshes should be "clean" (no un-merged nodes, no non-conformal cells)
+ * The edges and then the cells of \a m1 are intersected by chunks, using the threads allowed by
+ * MEDCouplingGetNbOfThreads. The result does not depend on their number.
  *  \param [in] m1 - the first input mesh which is a partitioned object. The mesh must be so that each point in the
  * space covered by \a m1 must be covered exactly by one entity, \b no \b more. If it is not the case, some tools are
  * available to heal the mesh (conformize2D, mergeNodes)
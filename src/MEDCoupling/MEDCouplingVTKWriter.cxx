@@ -0,0 +1,592 @@
+// Copyright (C) 2026  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "MEDCouplingVTKWriter.hxx"
+#include "MEDCouplingFieldDouble.hxx"
+#include "MEDCouplingMemArray.hxx"
+#include "MEDCouplingUMesh.hxx"
+#include "InterpKernelException.hxx"
+#include "InterpKernelThreadPool.hxx"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+#ifdef MED_ENABLE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef MED_ENABLE_LZ4
+#include <lz4.h>
+#endif
+
+using namespace MEDCoupling;
+
+namespace
+{
+//! Width reserved in the XML for the offsets of the compressed arrays.
+const std::size_t OFFSET_WIDTH = 20;
+//! Upper bound of the block size, so that the sizes of the blocks fit the APIs of the compressors.
+const std::size_t MAX_BLOCK_SIZE = std::size_t(1) << 30;
+
+std::size_t
+CompressBound(VTKCompression compression, std::size_t sz)
+{
+#if !defined(MED_ENABLE_ZLIB) && !defined(MED_ENABLE_LZ4)
+    (void)sz;
+#endif
+    switch (compression)
+    {
+#ifdef MED_ENABLE_ZLIB
+        case VTK_ZLIB_COMPRESSION:
+            return (std::size_t)compressBound((uLong)sz);
+#endif
+#ifdef MED_ENABLE_LZ4
+        case VTK_LZ4_COMPRESSION:
+            return (std::size_t)LZ4_compressBound((int)sz);
+#endif
+        default:
+            throw INTERP_KERNEL::Exception("MEDCouplingVTKAppendedData : compression not available !");
+    }
+}
+
+std::size_t
+Compress(VTKCompression compression, const char *src, std::size_t sz, char *dst, std::size_t dstCapacity)
+{
+#if !defined(MED_ENABLE_ZLIB) && !defined(MED_ENABLE_LZ4)
+    (void)src;
+    (void)sz;
+    (void)dst;
+    (void)dstCapacity;
+#endif
+    switch (compression)
+    {
+#ifdef MED_ENABLE_ZLIB
+        case VTK_ZLIB_COMPRESSION:
+        {
+            uLongf ret((uLongf)dstCapacity);
+            if (compress2((Bytef *)dst, &ret, (const Bytef *)src, (uLong)sz, Z_BEST_SPEED) != Z_OK)
+                throw INTERP_KERNEL::Exception("MEDCouplingVTKAppendedData : zlib compression failed !");
+            return (std::size_t)ret;
+        }
+#endif
+#ifdef MED_ENABLE_LZ4
+        case VTK_LZ4_COMPRESSION:
+        {
+            int ret(LZ4_compress_default(src, dst, (int)sz, (int)dstCapacity));
+            if (ret <= 0)
+                throw INTERP_KERNEL::Exception("MEDCouplingVTKAppendedData : LZ4 compression failed !");
+            return (std::size_t)ret;
+        }
+#endif
+        default:
+            throw INTERP_KERNEL::Exception("MEDCouplingVTKAppendedData : compression not available !");
+    }
+}
+
+std::string
+FileNameWithoutDirectory(const std::string &fileName)
+{
+    std::size_t pos(fileName.find_last_of("/\\"));
+    return pos == std::string::npos ? fileName : fileName.substr(pos + 1);
+}
+
+//! the ascending ids of the nodes of the cells [ \a bg, \a end ) of \a mesh
+DataArrayIdType *
+FetchedNodeIdsOfCells(const MEDCouplingUMesh *mesh, mcIdType bg, mcIdType end)
+{
+    const mcIdType *conn(mesh->getNodalConnectivity()->begin()), *connI(mesh->getNodalConnectivityIndex()->begin());
+    mcIdType first(std::numeric_limits<mcIdType>::max()), last(-1);
+    for (mcIdType i = bg; i < end; i++)
+        for (const mcIdType *it = conn + connI[i] + 1; it != conn + connI[i + 1]; it++)
+            if (*it >= 0)
+            {
+                first = std::min(first, *it);
+                last = std::max(last, *it);
+            }
+    std::vector<bool> isFetched(last >= first ? last - first + 1 : 0, false);
+    for (mcIdType i = bg; i < end; i++)
+        for (const mcIdType *it = conn + connI[i] + 1; it != conn + connI[i + 1]; it++)
+            if (*it >= 0)
+                isFetched[*it - first] = true;
+    MCAuto<DataArrayIdType> ret(DataArrayIdType::BuildListOfSwitchedOn(isFetched));
+    ret->applyLin(1, first);
+    return ret.retn();
+}
+}  // namespace
+
+/// @cond INTERNAL
+/*!
+ * \param [in] isHeader64 - if true the sizes in the appended data are written on 64 bits (header_type="UInt64"),
+ *             otherwise on 32 bits, which is the default of VTK and the layout of MEDCouplingMesh::writeVTK.
+ * \param [in] compression - the compression of the arrays. It has to be available (see IsCompressionAvailable).
+ * \param [in] blockSize - the number of bytes produced, and possibly compressed, at a time.
+ */
+MEDCouplingVTKAppendedData::MEDCouplingVTKAppendedData(
+    bool isHeader64, VTKCompression compression, std::size_t blockSize
+)
+    : _is_header_64(isHeader64), _compression(compression), _block_size(blockSize), _raw_offset(0)
+{
+    if (!IsCompressionAvailable(compression))
+        throw INTERP_KERNEL::Exception(
+            "MEDCouplingVTKAppendedData : the requested compression is not available in this build !"
+        );
+    if (blockSize == 0 || blockSize > MAX_BLOCK_SIZE)
+        throw INTERP_KERNEL::Exception("MEDCouplingVTKAppendedData : the block size must be in [1, 2^30] !");
+}
+
+/*!
+ * Returns the attributes to add to the VTKFile element of the file for the reader to decode the appended data.
+ */
+std::string
+MEDCouplingVTKAppendedData::getVTKFileAttributes() const
+{
+    std::string ret;
+    if (_is_header_64)
+        ret += " header_type=\"UInt64\"";
+    if (_compression == VTK_ZLIB_COMPRESSION)
+        ret += " compressor=\"vtkZLibDataCompressor\"";
+    else if (_compression == VTK_LZ4_COMPRESSION)
+        ret += " compressor=\"vtkLZ4DataCompressor\"";
+    return ret;
+}
+
+/*!
+ * Keeps a reference on \a obj until \a this is destroyed. To be used for the objects owning the values or read by the
+ * functions given to appendDataArray, when they may be destroyed before write() is called.
+ */
+void
+MEDCouplingVTKAppendedData::keepAlive(const RefCountObjectOnly *obj)
+{
+    if (!obj)
+        return;
+    obj->incrRef();
+    _kept_alive.push_back(MCConstAuto<RefCountObjectOnly>(obj));
+}
+
+/*!
+ * Writes in \a ofs the XML element of an appended DataArray and registers its values, to be written by write().
+ * \param [in] sizeOfValue - the size in bytes of a value in the file.
+ * \param [in] nbOfValues - the number of values (and not of tuples) of the array.
+ * \param [in] values - if not null, the values as they are written in the file. They have to stay valid until write()
+ *             is called (see keepAlive). If null, \a fillFunc produces them.
+ * \param [in] fillFunc - called when \a values is null, on consecutive ranges of values, in order.
+ * \param [in] otherAttributes - attributes of the element written before the format, as ComponentName0="X".
+ */
+void
+MEDCouplingVTKAppendedData::appendDataArray(
+    std::ostream &ofs,
+    mcIdType indent,
+    const std::string &type,
+    const std::string &nameInFile,
+    std::size_t nbOfCompo,
+    std::size_t sizeOfValue,
+    std::size_t nbOfValues,
+    const char *values,
+    const FillFunction &fillFunc,
+    const std::string &otherAttributes
+)
+{
+    std::size_t nbOfBytes(sizeOfValue * nbOfValues);
+    if (!_is_header_64 && nbOfBytes > (std::size_t)std::numeric_limits<std::uint32_t>::max())
+    {
+        std::ostringstream oss;
+        oss << "MEDCouplingVTKAppendedData::appendDataArray : array \"" << nameInFile << "\" has " << nbOfBytes
+            << " bytes which does not fit a 32 bits VTK header ! Use MEDCouplingVTKWriter to write it.";
+        throw INTERP_KERNEL::Exception(oss.str());
+    }
+    std::string idt(indent, ' ');
+    ofs << idt << "<DataArray type=\"" << type << "\" Name=\"" << nameInFile << "\" NumberOfComponents=\"" << nbOfCompo
+        << "\"" << otherAttributes << " format=\"appended\" offset=\"";
+    if (_compression == VTK_NO_COMPRESSION)
+    {
+        ofs << _raw_offset;
+        _raw_offset += (_is_header_64 ? sizeof(std::uint64_t) : sizeof(std::uint32_t)) + nbOfBytes;
+    }
+    else
+        ofs << OffsetPlaceHolder(_arrays.size());
+    ofs << "\">" << std::endl << idt << "</DataArray>\n";
+    Array arr;
+    arr._size_of_value = sizeOfValue;
+    arr._nb_of_values = nbOfValues;
+    arr._values = values;
+    if (!values)
+        arr._fill = fillFunc;
+    _arrays.push_back(arr);
+}
+
+/*!
+ * Writes the file \a fileName made of \a xml, that has to be ended by the closing tag of the data set element, followed
+ * by the appended data of the registered arrays. The file is opened once and the values are streamed to it, by blocks
+ * of the block size given at construction.
+ */
+void
+MEDCouplingVTKAppendedData::write(const std::string &fileName, const std::string &xml) const
+{
+    std::ofstream ofs(fileName.c_str(), std::ios_base::binary);
+    if (!ofs)
+    {
+        std::ostringstream oss;
+        oss << "MEDCouplingVTKAppendedData::write : impossible to open file \"" << fileName << "\" for writing !";
+        throw INTERP_KERNEL::Exception(oss.str());
+    }
+    std::vector<std::size_t> placeHolderPos;
+    if (_compression != VTK_NO_COMPRESSION)
+    {
+        for (std::size_t i = 0; i < _arrays.size(); i++)
+        {  // the arrays are not registered in the order of the XML, point data being generated before the points
+            std::size_t pos(xml.find(OffsetPlaceHolder(i)));
+            if (pos == std::string::npos)
+                throw INTERP_KERNEL::Exception("MEDCouplingVTKAppendedData::write : internal error, missing offset !");
+            placeHolderPos.push_back(pos);
+        }
+    }
+    ofs.write(xml.data(), (std::streamsize)xml.size());
+    ofs << "<AppendedData encoding=\"raw\">\n_";
+    std::streampos start(ofs.tellp());
+    std::vector<std::size_t> offsets;
+    std::vector<char> buffer, cBuffer;
+    for (std::vector<Array>::const_iterator it = _arrays.begin(); it != _arrays.end(); it++)
+    {
+        offsets.push_back((std::size_t)(ofs.tellp() - start));
+        writeArray(ofs, *it, buffer, cBuffer);
+    }
+    ofs << "\n</AppendedData>\n</VTKFile>\n";
+    for (std::size_t i = 0; i < placeHolderPos.size(); i++)
+    {
+        std::ostringstream oss;
+        oss << offsets[i];
+        std::string offset(oss.str());
+        offset.resize(OFFSET_WIDTH, ' ');
+        ofs.seekp((std::streamoff)placeHolderPos[i]);
+        ofs.write(offset.data(), (std::streamsize)offset.size());
+    }
+    ofs.flush();
+    if (!ofs)
+    {
+        std::ostringstream oss;
+        oss << "MEDCouplingVTKAppendedData::write : error while writing file \"" << fileName << "\" !";
+        throw INTERP_KERNEL::Exception(oss.str());
+    }
+}
+
+bool
+MEDCouplingVTKAppendedData::IsCompressionAvailable(VTKCompression compression)
+{
+    switch (compression)
+    {
+        case VTK_NO_COMPRESSION:
+            return true;
+        case VTK_ZLIB_COMPRESSION:
+#ifdef MED_ENABLE_ZLIB
+            return true;
+#else
+            return false;
+#endif
+        case VTK_LZ4_COMPRESSION:
+#ifdef MED_ENABLE_LZ4
+            return true;
+#else
+            return false;
+#endif
+        default:
+            return false;
+    }
+}
+
+/*!
+ * Writes \a arr in \a ofs. Uncompressed, this is its size followed by its bytes. Compressed, this is the VTK header
+ * [nb of blocks, block size, size of the last partial block, compressed size of each block] followed by the
+ * compressed blocks. The header is written once the compressed sizes are known.
+ */
+void
+MEDCouplingVTKAppendedData::writeArray(
+    std::ostream &ofs, const Array &arr, std::vector<char> &buffer, std::vector<char> &cBuffer
+) const
+{
+    std::size_t nbOfBytes(arr._size_of_value * arr._nb_of_values);
+    std::size_t nbOfValuesPerBlock(std::max(_block_size / arr._size_of_value, std::size_t(1)));
+    std::size_t blockSize(nbOfValuesPerBlock * arr._size_of_value);
+    FillFunction fill(arr._fill);  // copy, so that a stateful function restarts at each call of write()
+    auto getBlock = [&](std::size_t bg, std::size_t end) -> const char *
+    {
+        if (arr._values)
+            return arr._values + bg * arr._size_of_value;
+        buffer.resize(std::max(buffer.size(), blockSize));
+        fill(bg, end, buffer.data());
+        return buffer.data();
+    };
+    if (_compression == VTK_NO_COMPRESSION)
+    {
+        writeHeader(ofs, std::vector<std::size_t>(1, nbOfBytes));
+        for (std::size_t bg = 0; bg < arr._nb_of_values; bg += nbOfValuesPerBlock)
+        {
+            std::size_t end(std::min(bg + nbOfValuesPerBlock, arr._nb_of_values));
+            ofs.write(getBlock(bg, end), (std::streamsize)((end - bg) * arr._size_of_value));
+        }
+        return;
+    }
+    std::size_t nbOfBlocks((nbOfBytes + blockSize - 1) / blockSize);
+    std::vector<std::size_t> header(3 + nbOfBlocks, 0);
+    header[0] = nbOfBlocks;
+    header[1] = blockSize;
+    header[2] = nbOfBytes % blockSize;
+    std::streampos headerPos(ofs.tellp());
+    writeHeader(ofs, header);
+    cBuffer.resize(std::max(cBuffer.size(), CompressBound(_compression, blockSize)));
+    for (std::size_t i = 0; i < nbOfBlocks; i++)
+    {
+        std::size_t bg(i * nbOfValuesPerBlock), end(std::min(bg + nbOfValuesPerBlock, arr._nb_of_values));
+        std::size_t sz(Compress(
+            _compression, getBlock(bg, end), (end - bg) * arr._size_of_value, cBuffer.data(), cBuffer.size()
+        ));
+        ofs.write(cBuffer.data(), (std::streamsize)sz);
+        header[3 + i] = sz;
+    }
+    std::streampos endPos(ofs.tellp());
+    ofs.seekp(headerPos);
+    writeHeader(ofs, header);
+    ofs.seekp(endPos);
+}
+
+void
+MEDCouplingVTKAppendedData::writeHeader(std::ostream &ofs, const std::vector<std::size_t> &values) const
+{
+    if (_is_header_64)
+    {
+        std::vector<std::uint64_t> tmp(values.begin(), values.end());
+        ofs.write(reinterpret_cast<const char *>(tmp.data()), (std::streamsize)(tmp.size() * sizeof(std::uint64_t)));
+    }
+    else
+    {
+        std::vector<std::uint32_t> tmp(values.size());
+        std::transform(values.begin(), values.end(), tmp.begin(), [](std::size_t v) { return (std::uint32_t)v; });
+        ofs.write(reinterpret_cast<const char *>(tmp.data()), (std::streamsize)(tmp.size() * sizeof(std::uint32_t)));
+    }
+}
+
+std::string
+MEDCouplingVTKAppendedData::OffsetPlaceHolder(std::size_t arrayId)
+{
+    std::ostringstream oss;
+    oss << "#" << arrayId;
+    std::string ret(oss.str());
+    ret.resize(OFFSET_WIDTH, ' ');
+    return ret;
+}
+/// @endcond
+
+MEDCouplingVTKWriter::MEDCouplingVTKWriter()
+    : _compression(VTK_NO_COMPRESSION), _block_size(MEDCouplingVTKAppendedData::DFT_BLOCK_SIZE), _nb_of_pieces(1)
+{
+}
+
+/*!
+ * Sets the compression of the binary data of the written files. VTK_NO_COMPRESSION by default.
+ * \throw If \a compression is not available in this build (see IsCompressionAvailable).
+ */
+void
+MEDCouplingVTKWriter::setCompression(VTKCompression compression)
+{
+    if (!IsCompressionAvailable(compression))
+        throw INTERP_KERNEL::Exception(
+            "MEDCouplingVTKWriter::setCompression : the requested compression is not available in this build !"
+        );
+    _compression = compression;
+}
+
+/*!
+ * Sets the number of bytes of an array produced, and compressed, at a time. This is the size of the blocks of the
+ * compressed arrays. 1 MiB by default.
+ * \throw If \a blockSize is 0 or greater than 2^30.
+ */
+void
+MEDCouplingVTKWriter::setBlockSize(std::size_t blockSize)
+{
+    if (blockSize == 0 || blockSize > MAX_BLOCK_SIZE)
+        throw INTERP_KERNEL::Exception("MEDCouplingVTKWriter::setBlockSize : the block size must be in [1, 2^30] !");
+    _block_size = blockSize;
+}
+
+/*!
+ * Sets the number of pieces of the unstructured meshes. With more than one piece, the cells are split in
+ * \a nbOfPieces ranges of consecutive cells written in parallel in files "<base>_<i>.vtu", gathered by the file
+ * "<base>.pvtu". 0 means one piece per thread allowed by MEDCouplingGetNbOfThreads. 1 by default.
+ * Structured meshes are always written in a single piece.
+ * \throw If \a nbOfPieces is negative.
+ */
+void
+MEDCouplingVTKWriter::setNumberOfPieces(int nbOfPieces)
+{
+    if (nbOfPieces < 0)
+        throw INTERP_KERNEL::Exception("MEDCouplingVTKWriter::setNumberOfPieces : the number of pieces must be >= 0 !");
+    _nb_of_pieces = nbOfPieces;
+}
+
+/*!
+ * Writes \a mesh without fields.
+ * \return the name of the written file : \a fileName with the extension of \a mesh (see
+ *         MEDCouplingMesh::getVTKFileNameOf), or "<base>.pvtu" if several pieces are written.
+ */
+std::string
+MEDCouplingVTKWriter::writeMesh(const std::string &fileName, const MEDCouplingMesh *mesh) const
+{
+    if (!mesh)
+        throw INTERP_KERNEL::Exception("MEDCouplingVTKWriter::writeMesh : null mesh !");
+    return write(fileName, mesh, std::vector<const MEDCouplingFieldDouble *>());
+}
+
+/*!
+ * Writes the fields \a fs and the mesh they lie on. The constraints on \a fs are the ones of
+ * MEDCouplingFieldDouble::WriteVTK.
+ * \return the name of the written file, see writeMesh. An empty string if \a fs is empty.
+ */
+std::string
+MEDCouplingVTKWriter::writeFields(const std::string &fileName, const std::vector<const MEDCouplingFieldDouble *> &fs)
+    const
+{
+    if (fs.empty())
+        return std::string();
+    return write(fileName, MEDCouplingFieldDouble::CheckFieldsForVTK(fs), fs);
+}
+
+bool
+MEDCouplingVTKWriter::IsCompressionAvailable(VTKCompression compression)
+{
+    return MEDCouplingVTKAppendedData::IsCompressionAvailable(compression);
+}
+
+std::string
+MEDCouplingVTKWriter::write(
+    const std::string &fileName, const MEDCouplingMesh *mesh, const std::vector<const MEDCouplingFieldDouble *> &fs
+) const
+{
+    int nbOfPieces(getEffectiveNumberOfPieces(mesh));
+    if (nbOfPieces == 1)
+    {
+        std::string ret(mesh->getVTKFileNameOf(fileName));
+        MEDCouplingVTKAppendedData appendedData(true, _compression, _block_size);
+        std::ostringstream coss, noss;
+        for (std::vector<const MEDCouplingFieldDouble *>::const_iterator it = fs.begin(); it != fs.end(); it++)
+            (*it)->getArray()->writeVTK(
+                (*it)->getTypeOfField() == ON_CELLS ? coss : noss, 8, (*it)->getName(), &appendedData
+            );
+        mesh->writeVTKAdvanced(ret, coss.str(), noss.str(), &appendedData);
+        return ret;
+    }
+    std::string baseName, ext;
+    MEDCouplingMesh::SplitExtension(fileName, baseName, ext);
+    if (ext != ".pvtu" && ext != ".vtu")
+        baseName = fileName;
+    std::vector<std::string> pieceNames(nbOfPieces);
+    for (int i = 0; i < nbOfPieces; i++)
+    {
+        std::ostringstream oss;
+        oss << baseName << "_" << i << ".vtu";
+        pieceNames[i] = oss.str();
+    }
+    // the pieces are written from the arrays of the whole mesh and of the fields, without building them
+    MCAuto<MEDCouplingUMesh> umesh(mesh->buildUnstructured());
+    umesh->checkConsistencyLight();
+    mcIdType nbOfCells(umesh->getNumberOfCells());
+    auto writePiece = [&](int pieceId)
+    {
+        mcIdType bg((mcIdType)(((long long)nbOfCells * pieceId) / nbOfPieces));
+        mcIdType end((mcIdType)(((long long)nbOfCells * (pieceId + 1)) / nbOfPieces));
+        MCAuto<DataArrayIdType> nodeIds(FetchedNodeIdsOfCells(umesh, bg, end));
+        MEDCouplingVTKAppendedData appendedData(true, _compression, _block_size);
+        std::ostringstream coss, noss;
+        for (std::vector<const MEDCouplingFieldDouble *>::const_iterator it = fs.begin(); it != fs.end(); it++)
+        {
+            const DataArrayDouble *arr((*it)->getArray());
+            if ((*it)->getTypeOfField() == ON_CELLS)
+            {  // view on the values of the piece
+                std::size_t nbOfCompo(arr->getNumberOfComponents());
+                MCAuto<DataArrayDouble> view(DataArrayDouble::New());
+                view->useArray(arr->begin() + bg * nbOfCompo, false, DeallocType::CPP_DEALLOC, end - bg, nbOfCompo);
+                view->copyStringInfoFrom(*arr);
+                appendedData.keepAlive(arr);
+                view->writeVTK(coss, 8, (*it)->getName(), &appendedData);
+            }
+            else
+                arr->writeVTK(noss, 8, (*it)->getName(), &appendedData, nodeIds);
+        }
+        std::ostringstream oss;
+        oss << "<VTKFile type=\"" << umesh->getVTKDataSetType() << "\" version=\"0.1\" byte_order=\""
+            << MEDCouplingByteOrderStr() << "\"" << appendedData.getVTKFileAttributes() << ">\n";
+        umesh->writeVTKPartLL(oss, bg, end, nodeIds, coss.str(), noss.str(), &appendedData);
+        appendedData.write(pieceNames[pieceId], oss.str());
+    };
+    INTERP_KERNEL::ParallelForChunks(
+        INTERP_KERNEL::GetEffectiveNbOfThreads(MEDCouplingGetNbOfThreads()),
+        0,
+        nbOfPieces,
+        1,
+        [&writePiece](int bg, int end, unsigned int)
+        {
+            for (int pieceId = bg; pieceId < end; pieceId++) writePiece(pieceId);
+        }
+    );
+    std::string ret(baseName + ".pvtu");
+    std::ofstream ofs(ret.c_str());
+    if (!ofs)
+    {
+        std::ostringstream oss;
+        oss << "MEDCouplingVTKWriter::write : impossible to open file \"" << ret << "\" for writing !";
+        throw INTERP_KERNEL::Exception(oss.str());
+    }
+    ofs << "<VTKFile type=\"PUnstructuredGrid\" version=\"0.1\" byte_order=\"" << MEDCouplingByteOrderStr()
+        << "\" header_type=\"UInt64\">\n";
+    ofs << "  <PUnstructuredGrid GhostLevel=\"0\">\n";
+    std::ostringstream coss, noss;
+    for (std::vector<const MEDCouplingFieldDouble *>::const_iterator it = fs.begin(); it != fs.end(); it++)
+        ((*it)->getTypeOfField() == ON_CELLS ? coss : noss)
+            << "      <PDataArray type=\"Float32\" Name=\"" << (*it)->getName() << "\" NumberOfComponents=\""
+            << (*it)->getArray()->getNumberOfComponents() << "\"/>\n";
+    ofs << "    <PPointData>\n" << noss.str() << "    </PPointData>\n";
+    ofs << "    <PCellData>\n" << coss.str() << "    </PCellData>\n";
+    ofs << "    <PPoints>\n";
+    ofs << "      <PDataArray type=\"Float32\" NumberOfComponents=\"3\"/>\n";
+    ofs << "    </PPoints>\n";
+    for (int i = 0; i < nbOfPieces; i++)
+        ofs << "    <Piece Source=\"" << FileNameWithoutDirectory(pieceNames[i]) << "\"/>\n";
+    ofs << "  </PUnstructuredGrid>\n";
+    ofs << "</VTKFile>\n";
+    ofs.close();
+    if (!ofs)
+    {
+        std::ostringstream oss;
+        oss << "MEDCouplingVTKWriter::write : error while writing file \"" << ret << "\" !";
+        throw INTERP_KERNEL::Exception(oss.str());
+    }
+    return ret;
+}
+
+int
+MEDCouplingVTKWriter::getEffectiveNumberOfPieces(const MEDCouplingMesh *mesh) const
+{
+    if (_nb_of_pieces == 1 || mesh->getVTKFileExtension() != "vtu")
+        return 1;
+    int ret(_nb_of_pieces);
+    if (ret == 0)
+        ret = (int)INTERP_KERNEL::GetEffectiveNbOfThreads(MEDCouplingGetNbOfThreads());
+    return (int)std::max(std::min((mcIdType)ret, mesh->getNumberOfCells()), mcIdType(1));
+}
@@ -0,0 +1,165 @@
+// Copyright (C) 2026  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#ifndef __MEDCOUPLINGVTKWRITER_HXX__
+#define __MEDCOUPLINGVTKWRITER_HXX__
+
+#include "MEDCoupling.hxx"
+#include "MCType.hxx"
+#include "MCAuto.hxx"
+#include "MEDCouplingRefCountObject.hxx"
+
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace MEDCoupling
+{
+class MEDCouplingMesh;
+class MEDCouplingFieldDouble;
+
+//! The compressions of the binary data of the VTK XML files
+typedef enum
+{
+    VTK_NO_COMPRESSION = 0,
+    VTK_ZLIB_COMPRESSION = 1,
+    VTK_LZ4_COMPRESSION = 2
+} VTKCompression;
+
+/// @cond INTERNAL
+/*!
+ * Appended data section of a VTK XML file. The DataArray elements are registered while the XML part of the file is
+ * generated, and their values are only produced, block by block, when the file is written by write(). So the values
+ * are never gathered in a single buffer : the arrays registered with a pointer on their values are written (or
+ * compressed) straight from it, and the other ones are produced by a function filling a block at a time.
+ *
+ * The offsets of uncompressed arrays are known at registration. Those of compressed arrays are only known once the
+ * data is written : a placeholder of fixed width is put in the XML and overwritten at the end of write(), as does
+ * the VTK library itself.
+ */
+class MEDCouplingVTKAppendedData
+{
+   public:
+    //! Signature of the functions producing the bytes of the values [ \a bg, \a end ) of an array, called in order.
+    typedef std::function<void(std::size_t bg, std::size_t end, char *out)> FillFunction;
+    static const std::size_t DFT_BLOCK_SIZE = 1 << 20;
+
+   public:
+    MEDCOUPLING_EXPORT MEDCouplingVTKAppendedData(
+        bool isHeader64, VTKCompression compression = VTK_NO_COMPRESSION, std::size_t blockSize = DFT_BLOCK_SIZE
+    );
+    MEDCOUPLING_EXPORT std::string getVTKFileAttributes() const;
+    MEDCOUPLING_EXPORT void keepAlive(const RefCountObjectOnly *obj);
+    MEDCOUPLING_EXPORT void appendDataArray(
+        std::ostream &ofs,
+        mcIdType indent,
+        const std::string &type,
+        const std::string &nameInFile,
+        std::size_t nbOfCompo,
+        std::size_t sizeOfValue,
+        std::size_t nbOfValues,
+        const char *values,
+        const FillFunction &fillFunc,
+        const std::string &otherAttributes = std::string()
+    );
+    template <class T, class FUNC>
+    void appendDataArray(
+        std::ostream &ofs,
+        mcIdType indent,
+        const std::string &type,
+        const std::string &nameInFile,
+        std::size_t nbOfCompo,
+        std::size_t nbOfValues,
+        FUNC fillFunc
+    )
+    {
+        FillFunction f([fillFunc](std::size_t bg, std::size_t end, char *out) mutable
+                       { fillFunc(bg, end, reinterpret_cast<T *>(out)); });
+        appendDataArray(ofs, indent, type, nameInFile, nbOfCompo, sizeof(T), nbOfValues, nullptr, f);
+    }
+    MEDCOUPLING_EXPORT void write(const std::string &fileName, const std::string &xml) const;
+    MEDCOUPLING_EXPORT static bool IsCompressionAvailable(VTKCompression compression);
+
+   private:
+    class Array
+    {
+       public:
+        std::size_t _size_of_value;
+        std::size_t _nb_of_values;
+        const char *_values;
+        FillFunction _fill;
+    };
+    void writeArray(std::ostream &ofs, const Array &arr, std::vector<char> &buffer, std::vector<char> &cBuffer) const;
+    void writeHeader(std::ostream &ofs, const std::vector<std::size_t> &values) const;
+    static std::string OffsetPlaceHolder(std::size_t arrayId);
+
+   private:
+    bool _is_header_64;
+    VTKCompression _compression;
+    std::size_t _block_size;
+    std::size_t _raw_offset;
+    std::vector<Array> _arrays;
+    std::vector<MCConstAuto<RefCountObjectOnly> > _kept_alive;
+};
+/// @endcond
+
+/*!
+ * Writer of meshes and fields in the VTK XML formats (.vtu, .vts, .vtr, .vti). Contrary to
+ * MEDCouplingMesh::writeVTK and MEDCouplingFieldDouble::WriteVTK, the binary data can be compressed
+ * (see IsCompressionAvailable) and unstructured meshes can be written in several pieces, written in parallel, and
+ * gathered by a .pvtu file. The data is streamed to the file from the arrays of the mesh and the fields, by blocks of
+ * getBlockSize() bytes.
+ * \code
+ * MEDCouplingVTKWriter writer;
+ * writer.setCompression(VTK_ZLIB_COMPRESSION);
+ * writer.setNumberOfPieces(0);  // one piece per thread allowed by MEDCouplingGetNbOfThreads
+ * std::string fileName(writer.writeFields("result", fields));  // result.pvtu, result_0.vtu, result_1.vtu...
+ * \endcode
+ */
+class MEDCouplingVTKWriter
+{
+   public:
+    MEDCOUPLING_EXPORT MEDCouplingVTKWriter();
+    MEDCOUPLING_EXPORT void setCompression(VTKCompression compression);
+    MEDCOUPLING_EXPORT VTKCompression getCompression() const { return _compression; }
+    MEDCOUPLING_EXPORT void setBlockSize(std::size_t blockSize);
+    MEDCOUPLING_EXPORT std::size_t getBlockSize() const { return _block_size; }
+    MEDCOUPLING_EXPORT void setNumberOfPieces(int nbOfPieces);
+    MEDCOUPLING_EXPORT int getNumberOfPieces() const { return _nb_of_pieces; }
+    MEDCOUPLING_EXPORT std::string writeMesh(const std::string &fileName, const MEDCouplingMesh *mesh) const;
+    MEDCOUPLING_EXPORT std::string writeFields(
+        const std::string &fileName, const std::vector<const MEDCouplingFieldDouble *> &fs
+    ) const;
+    MEDCOUPLING_EXPORT static bool IsCompressionAvailable(VTKCompression compression);
+
+   private:
+    std::string write(
+        const std::string &fileName, const MEDCouplingMesh *mesh, const std::vector<const MEDCouplingFieldDouble *> &fs
+    ) const;
+    int getEffectiveNumberOfPieces(const MEDCouplingMesh *mesh) const;
+
+   private:
+    VTKCompression _compression;
+    std::size_t _block_size;
+    int _nb_of_pieces;
+};
+}  // namespace MEDCoupling
+
+#endif
@@ -4128,3 +4128,53 @@ MEDCouplingBasicsTest5::testSimplexize3()
     //
     m->decrRef();
 }
+
+/*!
+ * Intersect2DMeshes on meshes above the grains of its parallel steps (256 edges for the splitting of the edges, 64
+ * cells for the building of the cells) gives with 4 threads the same result, bit for bit, as with 1 thread.
+ */
+void
+MEDCouplingBasicsTest5::testIntersect2DMeshesThreads1()
+{
+    MCAuto<DataArrayDouble> arr1(DataArrayDouble::New()), arr2(DataArrayDouble::New());
+    arr1->alloc(41, 1);
+    arr1->iota();
+    arr1->applyLin(1. / 40., 0.);
+    arr2->alloc(38, 1);
+    arr2->iota();
+    arr2->applyLin(1.05 / 37., 0.01);
+    MCAuto<MEDCouplingCMesh> c1(MEDCouplingCMesh::New()), c2(MEDCouplingCMesh::New());
+    c1->setCoords(arr1, arr1);
+    c2->setCoords(arr2, arr2);
+    MCAuto<MEDCouplingUMesh> m1(c1->buildUnstructured()), m2(c2->buildUnstructured());
+    const double center[2] = {0., 0.};
+    m2->rotate(center, nullptr, 0.3);
+    MCAuto<MEDCouplingUMesh> q1(m1->buildPartOfMySelfSlice(0, m1->getNumberOfCells(), 3, true));
+    q1->convertLinearCellsToQuadratic(0);
+    MCAuto<MEDCouplingUMesh> q2(m2->buildPartOfMySelfSlice(0, m2->getNumberOfCells(), 5, true));
+    q2->convertLinearCellsToQuadratic(0);
+    const MEDCouplingUMesh *pairs[2][2] = {{m1, m2}, {q1, q2}};
+    for (int i = 0; i < 2; i++)
+    {
+        CPPUNIT_ASSERT(pairs[i][0]->getNumberOfCells() > 64);
+        MCAuto<MEDCouplingUMesh> res[2];
+        MCAuto<DataArrayIdType> cellNb1[2], cellNb2[2];
+        const int nbOfThreads[2] = {1, 4};
+        for (int j = 0; j < 2; j++)
+        {
+            MEDCouplingNbOfThreadsScope scope(nbOfThreads[j]);
+            DataArrayIdType *d1(nullptr), *d2(nullptr);
+            res[j] = MEDCouplingUMesh::Intersect2DMeshes(pairs[i][0], pairs[i][1], 1e-10, d1, d2);
+            cellNb1[j] = d1;
+            cellNb2[j] = d2;
+        }
+        CPPUNIT_ASSERT(res[0]->getNumberOfCells() > pairs[i][0]->getNumberOfCells());
+        CPPUNIT_ASSERT(res[0]->getCoords()->isEqual(*res[1]->getCoords(), 0.));
+        CPPUNIT_ASSERT(res[0]->getNodalConnectivity()->isEqual(*res[1]->getNodalConnectivity()));
+        CPPUNIT_ASSERT(res[0]->getNodalConnectivityIndex()->isEqual(*res[1]->getNodalConnectivityIndex()));
+        CPPUNIT_ASSERT(cellNb1[0]->isEqual(*cellNb1[1]));
+        CPPUNIT_ASSERT(cellNb2[0]->isEqual(*cellNb2[1]));
+        MCAuto<MEDCouplingFieldDouble> area(pairs[i][0]->getMeasureField(true)), area2(res[1]->getMeasureField(true));
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(area->accumulate(0), area2->accumulate(0), 1e-10);
+    }
+}
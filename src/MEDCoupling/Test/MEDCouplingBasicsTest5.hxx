@@ -76,6 +76,7 @@ class MEDCouplingBasicsTest5 : public MEDCouplingBasicsTest
     CPPUNIT_TEST(testDAIBuildSubstractionOptimized1);
     CPPUNIT_TEST(testDAIIsStrictlyMonotonic1);
     CPPUNIT_TEST(testSimplexize3);
+    CPPUNIT_TEST(testIntersect2DMeshesThreads1);
     CPPUNIT_TEST_SUITE_END();
 
    public:
@@ -119,6 +120,7 @@ class MEDCouplingBasicsTest5 : public MEDCouplingBasicsTest
     void testDAIBuildSubstractionOptimized1();
     void testDAIIsStrictlyMonotonic1();
     void testSimplexize3();
+    void testIntersect2DMeshesThreads1();
 };
 }  // namespace MEDCoupling
 
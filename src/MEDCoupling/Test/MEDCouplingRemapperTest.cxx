@@ -20,6 +20,7 @@
 
 #include "MEDCouplingRemapperTest.hxx"
 #include "MEDCouplingUMesh.hxx"
+#include "MEDCouplingCMesh.hxx"
 #include "MEDCouplingMappedExtrudedMesh.hxx"
 #include "MEDCouplingFieldDouble.hxx"
 #include "MEDCouplingFieldTemplate.hxx"
@@ -29,6 +30,9 @@
 #include "MEDCouplingBasicsTest.hxx"
 
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <numeric>
 
 using namespace MEDCoupling;
@@ -1612,6 +1616,101 @@ MEDCouplingRemapperTest::testPartialTransfer1()
     targetMesh->decrRef();
 }
 
+/*!
+ * The finite element options are restored by loadPreparedState, and a file whose size of an array is corrupted is
+ * rejected before allocating the array.
+ */
+void
+MEDCouplingRemapperTest::testPreparedState1()
+{
+    const char fileName[] = "MEDCouplingRemapperTest_PreparedState1.bin";
+    MCAuto<MEDCouplingUMesh> sourceMesh(MEDCouplingBasicsTest::build2DSourceMesh_1());
+    MCAuto<MEDCouplingUMesh> targetMesh(MEDCouplingBasicsTest::build2DTargetMesh_1());
+    MEDCouplingRemapper remapper;
+    remapper.setProjectionOnSurfStatus(!remapper.getProjectionOnSurfStatus());
+    remapper.setMaxDistanceStatus(!remapper.getMaxDistanceStatus());
+    remapper.setProjectionMaxDistance(0.125);
+    CPPUNIT_ASSERT_EQUAL(1, remapper.prepare(sourceMesh, targetMesh, "P0P0"));
+    remapper.savePreparedState(fileName);
+    MEDCouplingRemapper remapper2;
+    remapper2.loadPreparedState(fileName, sourceMesh, targetMesh);
+    CPPUNIT_ASSERT_EQUAL(remapper.getProjectionOnSurfStatus(), remapper2.getProjectionOnSurfStatus());
+    CPPUNIT_ASSERT_EQUAL(remapper.getMaxDistanceStatus(), remapper2.getMaxDistanceStatus());
+    CPPUNIT_ASSERT_EQUAL(0.125, remapper2.getProjectionMaxDistance());
+    CPPUNIT_ASSERT(remapper.getCrudeMatrix() == remapper2.getCrudeMatrix());
+    // size of the name of the source discretization, just after the header, set to 2**40
+    {
+        std::fstream fs(fileName, std::ios::in | std::ios::out | std::ios::binary);
+        const std::uint64_t hugeSize(std::uint64_t(1) << 40);
+        fs.seekp(sizeof("MEDCouplingRemapperPreparedState") + 3 * sizeof(std::uint32_t));
+        fs.write(reinterpret_cast<const char *>(&hugeSize), sizeof(hugeSize));
+    }
+    MEDCouplingRemapper remapper3;
+    CPPUNIT_ASSERT_THROW(remapper3.loadPreparedState(fileName, sourceMesh, targetMesh), INTERP_KERNEL::Exception);
+    std::remove(fileName);
+}
+
+/*!
+ * A triangle whose bounding box covers cartesian cells it does not intersect: the null coefficients must not reach
+ * the matrix, neither on the first prepare nor on a second prepare of the same remapper.
+ */
+void
+MEDCouplingRemapperTest::testPrepareTwiceUC1()
+{
+    const double coordsU[6] = {0., 0., 2., 0., 0., 2.};
+    const double coordsC[4] = {0., 1., 1.5, 2.};
+    const mcIdType conn[3] = {0, 2, 1};
+    MCAuto<MEDCouplingUMesh> umesh(MEDCouplingUMesh::New("tri", 2));
+    MCAuto<DataArrayDouble> array(DataArrayDouble::New());
+    array->alloc(3, 2);
+    std::copy(coordsU, coordsU + 6, array->getPointer());
+    umesh->setCoords(array);
+    umesh->allocateCells(1);
+    umesh->insertNextCell(INTERP_KERNEL::NORM_TRI3, 3, conn);
+    umesh->finishInsertingCells();
+    MCAuto<MEDCouplingCMesh> cmesh(MEDCouplingCMesh::New("cart"));
+    array = DataArrayDouble::New();
+    array->alloc(4, 1);
+    std::copy(coordsC, coordsC + 4, array->getPointer());
+    cmesh->setCoords(array, array);
+    const double valuesExpected[9] = {2., 2., 2., 2., 4.57, 4.57, 2., 4.57, 4.57};
+    MCAuto<MEDCouplingFieldDouble> srcField(MEDCouplingFieldDouble::New(ON_CELLS));
+    srcField->setNature(IntensiveMaximum);
+    srcField->setMesh(umesh);
+    array = DataArrayDouble::New();
+    array->alloc(1, 1);
+    array->setIJ(0, 0, 2.);
+    srcField->setArray(array);
+    // UC
+    MEDCouplingRemapper remapper;
+    remapper.setIntersectionType(INTERP_KERNEL::Triangulation);
+    for (int i = 0; i < 2; i++)
+    {
+        CPPUNIT_ASSERT_EQUAL(1, remapper.prepare(umesh, cmesh, "P0P0"));
+        const std::vector<std::map<mcIdType, double> > &m(remapper.getCrudeMatrix());
+        CPPUNIT_ASSERT_EQUAL(9, (int)m.size());
+        CPPUNIT_ASSERT_EQUAL(5, (int)std::accumulate(
+                                    m.begin(), m.end(), std::size_t(0),
+                                    [](std::size_t s, const std::map<mcIdType, double> &row) { return s + row.size(); }
+                                ));
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(0.375, m[1].at(0), 1e-12);
+        MCAuto<MEDCouplingFieldDouble> trgField(remapper.transferField(srcField, 4.57));
+        for (int j = 0; j < 9; j++)
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesExpected[j], trgField->getIJ(j, 0), 1e-12);
+    }
+    // CU
+    MEDCouplingRemapper remapper2;
+    remapper2.setIntersectionType(INTERP_KERNEL::Triangulation);
+    for (int i = 0; i < 2; i++)
+    {
+        CPPUNIT_ASSERT_EQUAL(1, remapper2.prepare(cmesh, umesh, "P0P0"));
+        const std::vector<std::map<mcIdType, double> > &m(remapper2.getCrudeMatrix());
+        CPPUNIT_ASSERT_EQUAL(1, (int)m.size());
+        CPPUNIT_ASSERT_EQUAL(5, (int)m[0].size());
+        CPPUNIT_ASSERT(m[0].find(4) == m[0].end());
+    }
+}
+
 void
 MEDCouplingRemapperTest::testBugNonRegression1()
 {
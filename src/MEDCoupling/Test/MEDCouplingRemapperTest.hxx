@@ -43,6 +43,8 @@ class MEDCouplingRemapperTest : public CppUnit::TestFixture
     CPPUNIT_TEST(testExtruded2);
     CPPUNIT_TEST(testPrepareEx1);
     CPPUNIT_TEST(testPartialTransfer1);
+    CPPUNIT_TEST(testPreparedState1);
+    CPPUNIT_TEST(testPrepareTwiceUC1);
     CPPUNIT_TEST(testBugNonRegression1);
     CPPUNIT_TEST_SUITE_END();
 
@@ -57,6 +59,8 @@ class MEDCouplingRemapperTest : public CppUnit::TestFixture
     void testExtruded2();
     void testPrepareEx1();
     void testPartialTransfer1();
+    void testPreparedState1();
+    void testPrepareTwiceUC1();
     //
     void testBugNonRegression1();
 
@@ -42,6 +42,9 @@
     INT popBackSilent();
     void pack() const;
     void allocIfNecessary(INT nbOfTuple, INT nbOfCompo);
+    void useMappedFile(const std::string& fileName, std::size_t offsetInBytes, std::size_t nbOfTuple, std::size_t nbOfCompo, bool copyOnWrite=false);
+    bool isMemoryMapped() const;
+    std::size_t getNbOfAllocations() const;
     bool isEqual(const ARRAY& other) const;
     bool isEqualWithoutConsideringStr(const ARRAY& other) const;
     bool isEqualWithoutConsideringStrAndOrder(const ARRAY& other) const;
@@ -10101,5 +10101,581 @@ class MEDCouplingBasicsTest7(unittest.TestCase):
         )
 
 
+    def testUMeshGetCellContainingPoints1(self):
+        """
+        Batched point location : multi-threaded mode of getCellsContainingPoints and getCellContainingPoints with a
+        guess of cell per point.
+        """
+        arr = DataArrayDouble(31)
+        arr.iota()
+        arr /= 30.0
+        m = MEDCouplingCMesh()
+        m.setCoords(arr, arr)
+        m = m.buildUnstructured()
+        m.simplexize(0)
+        pts = DataArrayDouble(2000, 2)
+        pts[:, 0] = DataArrayDouble([(i * 7919 % 2000) / 1900.0 - 0.02 for i in range(2000)])
+        pts[:, 1] = DataArrayDouble([(i * 104729 % 2000) / 1900.0 - 0.02 for i in range(2000)])
+        pts[:10] = m.getCoords()[:10]  # points shared by several cells
+        self.assertEqual(MEDCouplingGetNbOfThreads(), 1)
+        eltsRef, eltsIndexRef = m.getCellsContainingPoints(pts, 1e-12)
+        MEDCouplingSetNbOfThreads(3)
+        try:
+            self.assertEqual(MEDCouplingGetNbOfThreads(), 3)
+            elts, eltsIndex = m.getCellsContainingPoints(pts, 1e-12)
+            self.assertTrue(elts.isEqual(eltsRef))
+            self.assertTrue(eltsIndex.isEqual(eltsIndexRef))
+            # one cell per point : the smallest id
+            res = m.getCellContainingPoints(pts, 1e-12)
+            self.assertEqual(res.getNumberOfTuples(), 2000)
+            for i in range(2000):
+                self.assertEqual(res[i], m.getCellContainingPoint(pts[i], 1e-12))
+                pass
+            # with a guess : the guessed cell is kept if the point is inside, even if it is not the smallest id
+            guess = res.deepCopy()
+            guess[0] = m.getCellsContainingPoint(pts[0], 1e-12)[-1]
+            guess[1] = 100000
+            pts2 = pts.deepCopy()
+            pts2.applyLin(1.0, 0.001)
+            pts2[:2] = pts[:2]
+            res2 = m.getCellContainingPoints(pts2, 1e-12, guess)
+            self.assertEqual(res2[0], guess[0])
+            self.assertEqual(res2[1], res[1])
+            ref2, ref2Index = m.getCellsContainingPoints(pts2, 1e-12)
+            for i in range(2000):
+                cells = ref2[ref2Index[i] : ref2Index[i + 1]].getValues()
+                if not cells:
+                    self.assertEqual(res2[i], -1)
+                else:
+                    self.assertIn(res2[i], cells)
+                    pass
+                pass
+        finally:
+            MEDCouplingSetNbOfThreads(1)
+        self.assertRaises(InterpKernelException, m.getCellContainingPoints, pts, 1e-12, DataArrayInt([0, 1, 2]))
+        self.assertRaises(InterpKernelException, m.getCellContainingPoints, DataArrayDouble(3, 3), 1e-12)
+        pass
+
+    def testDAMappedFile1(self):
+        """Test of DataArray*.useMappedFile : zero-copy read-only or copy-on-write mapping of a binary file."""
+        import tempfile, os, struct
+
+        vals = [float(3 * i + 1) / 7.0 for i in range(30)]
+        ivals = [5 * i - 17 for i in range(12)]
+        with tempfile.TemporaryDirectory() as dir:
+            fileName = os.path.join(dir, "mapped.bin")
+            with open(fileName, "wb") as f:
+                f.write(b"HEADER00")
+                f.write(struct.pack("<%dd" % len(vals), *vals))
+                f.write(struct.pack("<%di" % len(ivals), *ivals))
+                pass
+            # read-only
+            d = DataArrayDouble()
+            d.useMappedFile(fileName, 8, 10, 3)
+            self.assertTrue(d.isMemoryMapped())
+            self.assertEqual(d.getNumberOfTuples(), 10)
+            self.assertEqual(d.getNumberOfComponents(), 3)
+            self.assertTrue(d.isEqual(DataArrayDouble(vals, 10, 3), 0.0))
+            self.assertRaises(InterpKernelException, d.setIJ, 0, 0, 2.0)
+            d2 = d.deepCopy()
+            self.assertTrue(not d2.isMemoryMapped())
+            d2.setIJ(0, 0, 2.0)
+            self.assertEqual(d.getIJ(0, 0), vals[0])
+            i = DataArrayInt32()
+            i.useMappedFile(fileName, 8 + 8 * len(vals), 6, 2)
+            self.assertTrue(i.isEqual(DataArrayInt32(ivals, 6, 2)))
+            # copy on write : the file is left unchanged
+            d3 = DataArrayDouble()
+            d3.useMappedFile(fileName, 8, 30, 1, True)
+            self.assertTrue(d3.isMemoryMapped())
+            d3 *= 2.0
+            self.assertAlmostEqual(d3[4, 0], 2.0 * vals[4], 14)
+            self.assertEqual(d.getIJ(4, 0), vals[4])
+            d4 = DataArrayDouble()
+            d4.useMappedFile(fileName, 8, 30, 1)
+            self.assertTrue(d4.isEqual(DataArrayDouble(vals), 0.0))
+            # reallocation releases the mapping
+            d3.alloc(4, 1)
+            self.assertTrue(not d3.isMemoryMapped())
+            # errors
+            self.assertRaises(InterpKernelException, d4.useMappedFile, fileName, 8, 31, 2)
+            self.assertRaises(InterpKernelException, d4.useMappedFile, fileName, 3, 2, 1)
+            self.assertRaises(InterpKernelException, d4.useMappedFile, os.path.join(dir, "nonexisting.bin"), 0, 1, 1)
+            self.assertTrue(d4.isEqual(DataArrayDouble(vals), 0.0))
+            del d, d4, i
+            pass
+        pass
+
+    def testDAAllocator1(self):
+        """Test of the per array allocation counter and of the thread local pool of buffers."""
+        d = DataArrayDouble()
+        self.assertEqual(d.getNbOfAllocations(), 0)
+        d.alloc(10, 2)
+        self.assertEqual(d.getNbOfAllocations(), 1)
+        d.iota(1.0)
+        d.reAlloc(15)
+        self.assertEqual(d.getNbOfAllocations(), 2)
+        d2 = d.deepCopy()
+        self.assertEqual(d2.getNbOfAllocations(), 1)
+        i = DataArrayInt32()
+        for v in range(1000):
+            i.pushBackSilent(v)
+            pass
+        self.assertTrue(1 < i.getNbOfAllocations() < 100)
+        self.assertTrue(i.isIota(1000))
+        # same results with the pool, even across enabling/disabling it
+        a = DataArrayDouble(100)
+        a.iota()
+        ref = DataArrayDouble.Meld(a, a + 100.0)
+        try:
+            MEDCouplingSetArrayPoolEnabled(True)
+            for it in range(200):
+                b = DataArrayDouble.Meld(a, a + 100.0)
+                c = b.selectByTupleId(list(range(99, -1, -1)))
+                c = c.selectByTupleId(list(range(99, -1, -1)))
+                self.assertTrue(c.isEqual(ref, 0.0))
+                pass
+            kept = c
+            MEDCouplingSetArrayPoolEnabled(False)
+            self.assertTrue(kept.isEqual(ref, 0.0))
+            del a, b, c, kept
+        finally:
+            MEDCouplingSetArrayPoolEnabled(False)
+        pass
+
+    def testDAParallelOps1(self):
+        """Arithmetic and reductions on DataArrayDouble must give the same bits whatever the number of threads."""
+        nbOfTuples = 200001
+        a = DataArrayDouble(nbOfTuples, 3)
+        a[:, 0] = DataArrayDouble([0.001 * (i % 997) - 0.3 for i in range(nbOfTuples)])
+        a[:, 1] = DataArrayDouble([0.002 * (i % 101) - 0.1 for i in range(nbOfTuples)])
+        a[:, 2] = DataArrayDouble([1.0 / (1 + i) for i in range(nbOfTuples)])
+        b = a.deepCopy()
+        b.applyLin(2.0, 0.5)
+        c = a[:, 2]
+
+        def compute():
+            res = [a + b, a * c, a - DataArrayDouble([1.0, 2.0, 3.0], 1, 3), a.magnitude(), DataArrayDouble.Dot(a, b)]
+            d = a.deepCopy()
+            d.applyLin(3.0, -1.0, 1)
+            d += b
+            d /= b
+            res.append(d)
+            res.append(DataArrayDouble.Meld(a, c))
+            return res, [a.norm2(), a.normMax(), a.normMin(), a.accumulate(), a.accumulate(1), c.getAverageValue(),
+                         c.getMinMaxValues(), a.getMinMaxPerComponent()]
+
+        self.assertEqual(MEDCouplingGetNbOfThreads(), 1)
+        arrs1, vals1 = compute()
+        with MEDCouplingNbOfThreadsScope(4) as scope:
+            self.assertEqual(scope.getNbOfThreads(), 4)
+            self.assertEqual(MEDCouplingGetNbOfThreads(), 4)
+            arrs4, vals4 = compute()
+            pass
+        self.assertEqual(MEDCouplingGetNbOfThreads(), 1)
+        try:
+            MEDCouplingSetNbOfThreads(3)
+            arrs3, vals3 = compute()
+        finally:
+            MEDCouplingSetNbOfThreads(1)
+        for arr1, arr4, arr3 in zip(arrs1, arrs4, arrs3):
+            self.assertTrue(arr1.isEqual(arr4, 0.0))
+            self.assertTrue(arr1.isEqual(arr3, 0.0))
+            pass
+        self.assertEqual(vals1, vals4)
+        self.assertEqual(vals1, vals3)
+        self.assertAlmostEqual(vals1[4][2], sum(1.0 / (1 + i) for i in range(nbOfTuples)), 10)
+        self.assertEqual(vals1[6], (1.0 / nbOfTuples, 1.0))
+        self.assertRaises(InterpKernelException, a.getMinMaxValues)
+        pass
+
+    def testDAFindCommonTuplesParallel1(self):
+        """findCommonTuples on the nodes of a mesh assembled from parts having duplicated nodes on their interfaces."""
+        arr = DataArrayDouble(21)
+        arr.iota()
+        arr *= 0.1
+        m = MEDCouplingCMesh()
+        m.setCoords(arr, arr, arr)
+        m = m.buildUnstructured()
+        nbOfCells = m.getNumberOfCells()
+        parts = [m[i : i + 1000] for i in range(0, nbOfCells, 1000)]
+        for part in parts:
+            part.zipCoords()
+            pass
+        merged = MEDCouplingUMesh.MergeUMeshes(parts)
+        coo = merged.getCoords()
+        coo[::7] += DataArrayDouble([1e-9, -1e-9, 0.0], 1, 3)  # not exactly the same positions
+        c1, cI1 = coo.findCommonTuples(1e-8)
+        with MEDCouplingNbOfThreadsScope(4):
+            c4, cI4 = coo.findCommonTuples(1e-8)
+            o2n, areNodesMerged, newNbOfNodes = merged.mergeNodes(1e-8)
+            pass
+        self.assertTrue(c1.isEqual(c4))
+        self.assertTrue(cI1.isEqual(cI4))
+        self.assertTrue(areNodesMerged)
+        self.assertEqual(newNbOfNodes, m.getNumberOfNodes())
+        self.assertEqual(cI1.deltaShiftIndex().getMinValueInArray(), 2)
+        for i in range(len(cI1) - 1):
+            grp = c1[cI1[i] : cI1[i + 1]]
+            self.assertTrue(grp[1:].isStrictlyMonotonic(True))
+            self.assertTrue(grp[0] < grp[1])
+            pass
+        # limitTupleId
+        c, cI = coo.findCommonTuples(1e-8, len(coo) // 2)
+        self.assertTrue(len(cI) > 1)
+        for i in range(len(cI) - 1):
+            self.assertTrue(c[cI[i] + 1 : cI[i + 1]].getMinValueInArray() >= len(coo) // 2)
+            pass
+        # a dense cluster : all the points are coincident
+        d = DataArrayDouble(5000, 2)
+        d[:] = 0.25
+        d[::2, 0] += 1e-10
+        with MEDCouplingNbOfThreadsScope(4):
+            c, cI = d.findCommonTuples(1e-9)
+            pass
+        self.assertTrue(cI.isEqual(DataArrayInt([0, 5000])))
+        self.assertTrue(c.isIota(5000))
+        pass
+
+    def testDAFindCommonTuplesOutlier1(self):
+        """findCommonTuples when a point far from the others gathers all the others in a few cells of the grid."""
+        arr = DataArrayDouble(41)
+        arr.iota()
+        arr *= 0.025
+        m = MEDCouplingCMesh()
+        m.setCoords(arr, arr, arr)
+        coo = m.buildUnstructured().getCoords()
+        nbNodes = len(coo)
+        coo2 = DataArrayDouble.Aggregate([coo, coo[::3], DataArrayDouble([1e6, 1e6, 1e6], 1, 3)])
+        # the groups are made of a node of coo and of its copy
+        first = DataArrayInt.Range(0, nbNodes, 3)
+        cRef = DataArrayInt.Meld(first, DataArrayInt.Range(nbNodes, nbNodes + len(first), 1))
+        cRef.rearrange(1)
+        cIRef = DataArrayInt.Range(0, len(cRef) + 1, 2)
+        for nbThreads in [1, 4]:
+            with MEDCouplingNbOfThreadsScope(nbThreads):
+                c, cI = coo2.findCommonTuples(1e-10)
+                pass
+            self.assertTrue(c.isEqual(cRef))
+            self.assertTrue(cI.isEqual(cIRef))
+            pass
+        pass
+
+    def testUMeshBuildDescendingConnectivityParallel1(self):
+        """buildDescendingConnectivity does not depend on the number of threads and merges the faces shared by cells."""
+        arr = DataArrayDouble(7)
+        arr.iota()
+        m = MEDCouplingCMesh()
+        m.setCoords(arr, arr, arr)
+        m = m.buildUnstructured()
+        m.renumberCells([(7 * i) % 216 for i in range(216)])
+        ref = m.buildDescendingConnectivity()
+        ref2 = m.buildDescendingConnectivity2()
+        with MEDCouplingNbOfThreadsScope(4):
+            res = m.buildDescendingConnectivity()
+            res2 = m.buildDescendingConnectivity2()
+            skin = m.computeSkin()
+            pass
+        self.assertTrue(ref[0].isEqual(res[0], 1e-12))
+        self.assertTrue(ref2[0].isEqual(res2[0], 1e-12))
+        for i in range(1, 5):
+            self.assertTrue(ref[i].isEqual(res[i]))
+            self.assertTrue(ref2[i].isEqual(res2[i]))
+            pass
+        self.assertEqual(res[0].getNumberOfCells(), 3 * 36 * 7)
+        self.assertEqual(skin.getNumberOfCells(), 6 * 36)
+        self.assertTrue(res[2].isEqual(res2[2]))
+        self.assertTrue(res[1].isEqual(res2[1].computeAbs() - 1))
+        self.assertEqual(res[4].deltaShiftIndex().getMaxValueInArray(), 2)
+        self.assertEqual(len(res[3]), 6 * 216)
+        # the faces shared by two cells have opposite orientations in these cells
+        for i, (bg, end) in enumerate(zip(res2[4][:-1], res2[4][1:])):
+            if end - bg == 2:
+                c0, c1 = res2[3][bg], res2[3][bg + 1]
+                self.assertIn(i + 1, res2[1][res2[2][c0] : res2[2][c0 + 1]].getValues())
+                self.assertIn(-(i + 1), res2[1][res2[2][c1] : res2[2][c1 + 1]].getValues())
+                pass
+            pass
+        # polyhedra give the same faces
+        m.convertAllToPoly()
+        with MEDCouplingNbOfThreadsScope(4):
+            res3 = m.buildDescendingConnectivity()
+            pass
+        self.assertEqual(res3[0].getNumberOfCells(), 3 * 36 * 7)
+        for i in range(1, 5):
+            self.assertTrue(res[i].isEqual(res3[i]))
+            pass
+        pass
+
+    def testUMeshReverseNodalConnectivityParallel1(self):
+        """getReverseNodalConnectivity with several threads, sorted or not, on a mesh having a node of high valence."""
+        nbOfCells = 20000
+        m = MEDCouplingUMesh("fan", 2)
+        m.setCoords(DataArrayDouble(nbOfCells + 2, 2))
+        m.getCoords()[:] = 0.0
+        m.allocateCells()
+        for i in range(nbOfCells):
+            m.insertNextCell(NORM_TRI3, [0, i + 1, i + 2])
+            pass
+        m.renumberCells([(7 * i) % nbOfCells for i in range(nbOfCells)])
+        rn1, rni1 = m.getReverseNodalConnectivity()
+        self.assertTrue(rn1[: rni1[1]].isIota(nbOfCells))
+        self.assertTrue(rni1.deltaShiftIndex().isEqual(DataArrayInt([nbOfCells, 1] + (nbOfCells - 1) * [2] + [1])))
+        with MEDCouplingNbOfThreadsScope(4):
+            rn4, rni4 = m.getReverseNodalConnectivity()
+            rn4u, rni4u = m.getReverseNodalConnectivity(False)
+            pass
+        self.assertTrue(rn1.isEqual(rn4))
+        self.assertTrue(rni1.isEqual(rni4))
+        self.assertTrue(rni1.isEqual(rni4u))
+        for i in [0, 1, 2, nbOfCells // 2, nbOfCells + 1]:
+            self.assertEqual(sorted(rn4u[rni4u[i] : rni4u[i + 1]].getValues()), rn1[rni1[i] : rni1[i + 1]].getValues())
+            pass
+        pass
+
+    def testUMeshTopologyCache1(self):
+        """Cached descending and reverse nodal connectivities, neighbors and bounding boxes, dropped on modification."""
+        arr = DataArrayDouble(7)
+        arr.iota()
+        m = MEDCouplingCMesh()
+        m.setCoords(arr, arr, arr)
+        m = m.buildUnstructured()
+        ref = m.deepCopy()
+        self.assertFalse(m.isTopologyCacheEnabled())
+        m.setTopologyCacheEnabled(True)
+        self.assertTrue(m.isTopologyCacheEnabled())
+        mem0 = m.getHeapMemorySize()
+        pts = m.computeCellCenterOfMass()
+        for i in range(3):
+            if i == 2:
+                # modifications in place of the arrays of the mesh drop the cache
+                m.getCoords()[0] = [-0.5, -0.5, -0.5]
+                ref.getCoords()[0] = [-0.5, -0.5, -0.5]
+                m.getNodalConnectivity()[1:3] = [m.getNodalConnectivity()[2], m.getNodalConnectivity()[1]]
+                ref.getNodalConnectivity()[1:3] = [ref.getNodalConnectivity()[2], ref.getNodalConnectivity()[1]]
+                pass
+            res = m.buildDescendingConnectivity()
+            resRef = ref.buildDescendingConnectivity()
+            self.assertTrue(res[0].isEqual(resRef[0], 0.0))
+            for a, b in zip(res[1:], resRef[1:]):
+                self.assertTrue(a.isEqual(b))
+                pass
+            for a, b in zip(m.getReverseNodalConnectivity(), ref.getReverseNodalConnectivity()):
+                self.assertTrue(a.isEqual(b))
+                pass
+            for a, b in zip(m.computeNeighborsOfCells(), ref.computeNeighborsOfCells()):
+                self.assertTrue(a.isEqual(b))
+                pass
+            self.assertTrue(m.getBoundingBoxForBBTree().isEqual(ref.getBoundingBoxForBBTree(), 0.0))
+            self.assertTrue(m.getCellContainingPoints(pts, 1e-12).isEqual(ref.getCellContainingPoints(pts, 1e-12)))
+            self.assertTrue(m.getHeapMemorySize() > mem0)
+            pass
+        # the returned arrays are copies : modifying them does not alter the cache
+        res = m.buildDescendingConnectivity()
+        res[1][:] = -1
+        self.assertTrue(m.buildDescendingConnectivity()[1].isEqual(resRef[1]))
+        m.clearTopologyCache()
+        self.assertEqual(m.getHeapMemorySize(), mem0)
+        self.assertTrue(m.deepCopy().isTopologyCacheEnabled())
+        m.setTopologyCacheEnabled(False)
+        self.assertFalse(m.isTopologyCacheEnabled())
+        pass
+
+    def testUMeshMeasureAndCenterOfMassByType1(self):
+        """getMeasureField and computeCellCenterOfMass on ranges of cells of same type, with several threads."""
+        arr = DataArrayDouble(81)
+        arr.iota()
+        m = MEDCouplingCMesh()
+        m.setCoords(arr, arr)
+        m = m.buildUnstructured()
+        m0 = m[:3200]
+        m0.simplexize(0)
+        m1 = m[3200:]
+        m1.convertToPolyTypes(DataArrayInt.Range(0, 3200, 7))
+        m = MEDCouplingUMesh.MergeUMeshesOnSameCoords(m0, m1)
+        refArea = DataArrayDouble(6400 * [0.5] + 3200 * [1.0])
+        refBary = m.computeIsoBarycenterOfNodesPerCell()
+        for nbOfThreads in [1, 3]:
+            with MEDCouplingNbOfThreadsScope(nbOfThreads):
+                area = m.getMeasureField(True).getArray()
+                bary = m.computeCellCenterOfMass()
+                pass
+            self.assertTrue(area.isEqual(refArea, 1e-12))
+            self.assertTrue(bary.isEqual(refBary, 1e-12))
+            pass
+        # orientation is kept when isAbs is false
+        m0.invertOrientationOfAllCells()
+        self.assertTrue(m0.getMeasureField(False).getArray().isUniform(-0.5, 1e-12))
+        # 3D linear cells, also through MEDCoupling1SGTUMesh
+        arr = DataArrayDouble(7)
+        arr.iota()
+        m = MEDCouplingCMesh()
+        m.setCoords(arr, 2.0 * arr, 0.5 * arr)
+        m = m.buildUnstructured()
+        tet = m.tetrahedrize(PLANAR_FACE_5)[0]
+        for mesh, nbOfCellsPerHexa in [(m, 1), (tet, 5)]:
+            mesh2 = mesh if isinstance(mesh, MEDCouplingUMesh) else mesh.buildUnstructured()
+            vol = mesh.getMeasureField(False).getArray()
+            self.assertAlmostEqual(vol.accumulate()[0], 216.0, 10)
+            self.assertEqual(len(vol), 216 * nbOfCellsPerHexa)
+            bary = mesh.computeCellCenterOfMass()
+            with MEDCouplingNbOfThreadsScope(3):
+                self.assertTrue(mesh2.getMeasureField(False).getArray().isEqual(vol, 1e-12))
+                self.assertTrue(mesh2.computeCellCenterOfMass().isEqual(bary, 1e-12))
+                pass
+            pass
+        self.assertTrue(m.computeCellCenterOfMass().isEqual(m.computeIsoBarycenterOfNodesPerCell(), 1e-12))
+        pass
+
+    def testVTKWriterStreaming1(self):
+        """MEDCouplingVTKWriter : compressed data and several pieces, decoded back from the written files."""
+        import tempfile, os, re, struct, zlib
+        import xml.etree.ElementTree as ET
+
+        def readArray(fileName, name):
+            with open(fileName, "rb") as f:
+                content = f.read()
+            pos = content.index(b"<AppendedData")
+            header = content[:pos].decode()
+            data = content[content.index(b"_", pos) + 1 :]
+            match = re.search(r'<DataArray type="(\w+)" Name="%s"[^>]*offset="(\d+) *"' % name, header)
+            typ, off = match.group(1), int(match.group(2))
+            bo = "<" if 'byte_order="LittleEndian"' in header else ">"
+            hfmt = "Q" if 'header_type="UInt64"' in header else "I"
+            hsz = struct.calcsize(hfmt)
+            if "compressor" in header:
+                nbOfBlocks = struct.unpack(bo + hfmt, data[off : off + hsz])[0]
+                sizes = struct.unpack(bo + (3 + nbOfBlocks) * hfmt, data[off : off + (3 + nbOfBlocks) * hsz])[3:]
+                raw, pos = b"", off + (3 + nbOfBlocks) * hsz
+                for sz in sizes:
+                    raw += zlib.decompress(data[pos : pos + sz])
+                    pos += sz
+                    pass
+                pass
+            else:
+                nbOfBytes = struct.unpack(bo + hfmt, data[off : off + hsz])[0]
+                raw = data[off + hsz : off + hsz + nbOfBytes]
+                pass
+            fmt = {"Float32": "f", "Int32": "i", "Int64": "q", "UInt8": "B"}[typ]
+            return list(struct.unpack(bo + "%d%s" % (len(raw) // struct.calcsize(fmt), fmt), raw))
+
+        def numberOfCells(fileName):
+            with open(fileName, "rb") as f:
+                content = f.read()
+            return int(re.search(rb'NumberOfCells="(\d+)"', content).group(1))
+
+        arr = DataArrayDouble(11)
+        arr.iota()
+        m = MEDCouplingCMesh()
+        m.setCoords(arr, arr)
+        m = m.buildUnstructured()
+        m.convertToPolyTypes(DataArrayInt.Range(0, 100, 3))
+        fc = MEDCouplingFieldDouble(ON_CELLS)
+        fc.setMesh(m)
+        fc.setArray(DataArrayDouble(list(range(100))))
+        fc.setName("fc")
+        fn = MEDCouplingFieldDouble(ON_NODES)
+        fn.setMesh(m)
+        fn.setArray(m.getCoords()[:, 0])
+        fn.setName("fn")
+        refConn = sum([m.getNodeIdsOfCell(i) for i in range(100)], [])
+        refOffsets = m.computeNbOfNodesPerCell()
+        refOffsets.computeOffsetsFull()
+        self.assertTrue(MEDCouplingVTKWriter.IsCompressionAvailable(VTK_NO_COMPRESSION))
+        with tempfile.TemporaryDirectory() as dir:
+            # legacy binary output : UInt32 headers, uncompressed
+            fileName = MEDCouplingFieldDouble.WriteVTK(os.path.join(dir, "legacy"), [fc, fn])
+            self.assertEqual(readArray(fileName, "connectivity"), refConn)
+            self.assertEqual(readArray(fileName, "offsets"), refOffsets[1:].getValues())
+            self.assertEqual(readArray(fileName, "fc"), list(range(100)))
+            writer = MEDCouplingVTKWriter()
+            self.assertEqual(writer.getNumberOfPieces(), 1)
+            if MEDCouplingVTKWriter.IsCompressionAvailable(VTK_ZLIB_COMPRESSION):
+                writer.setCompression(VTK_ZLIB_COMPRESSION)
+                pass
+            writer.setBlockSize(64)  # several blocks per array
+            fileName = writer.writeFields(os.path.join(dir, "single"), [fc, fn])
+            self.assertEqual(os.path.basename(fileName), "single.vtu")
+            self.assertEqual(readArray(fileName, "connectivity"), refConn)
+            self.assertEqual(readArray(fileName, "fc"), list(range(100)))
+            self.assertEqual(readArray(fileName, "fn"), m.getCoords()[:, 0].getValues())
+            self.assertEqual(readArray(fileName, "Points")[:6], [0.0, 0.0, 0.0, 1.0, 0.0, 0.0])
+            # pieces of consecutive cells gathered by a .pvtu file
+            writer.setNumberOfPieces(3)
+            fileName = writer.writeFields(os.path.join(dir, "multi.vtu"), [fc, fn])
+            self.assertEqual(os.path.basename(fileName), "multi.pvtu")
+            root = ET.parse(fileName).getroot()
+            self.assertEqual(root.get("type"), "PUnstructuredGrid")
+            pieces = [os.path.join(dir, p.get("Source")) for p in root.iter("Piece")]
+            self.assertEqual([os.path.basename(p) for p in pieces], ["multi_%d.vtu" % i for i in range(3)])
+            self.assertEqual(sum([numberOfCells(p) for p in pieces]), 100)
+            self.assertEqual(sum([readArray(p, "fc") for p in pieces], []), list(range(100)))
+            for p in pieces:
+                self.assertEqual(len(readArray(p, "fn")), 3 * len(readArray(p, "Points")) // 9)
+                pass
+            # one piece per thread
+            writer.setNumberOfPieces(0)
+            with MEDCouplingNbOfThreadsScope(2):
+                fileName = writer.writeMesh(os.path.join(dir, "mesh"), m)
+                pass
+            self.assertEqual(len(list(ET.parse(fileName).getroot().iter("Piece"))), 2)
+            # structured meshes are written in a single piece
+            cm = MEDCouplingCMesh()
+            cm.setCoords(arr, arr)
+            self.assertEqual(os.path.basename(writer.writeMesh(os.path.join(dir, "cmesh"), cm)), "cmesh.vtr")
+            self.assertRaises(InterpKernelException, writer.setNumberOfPieces, -1)
+            pass
+        pass
+
+    def testSpaceFillingCurveRenumbering1(self):
+        """ Renumbering of the nodes and the cells of a mesh along a space filling curve """
+        arr = DataArrayDouble(8)
+        arr.iota()
+        cm = MEDCouplingCMesh()
+        cm.setCoords(arr, arr)
+        pts = cm.getCoordinatesAndOwner()
+        o2n = MEDCouplingPointSet.ComputeSpaceFillingCurveRenumbering(pts, SFC_MORTON)
+        self.assertEqual(o2n.invertArrayO2N2N2O(64)[:8].getValues(), [0, 8, 1, 9, 16, 24, 17, 25])
+        # two consecutive points along the Hilbert curve are neighbours on the grid
+        o2n = MEDCouplingPointSet.ComputeSpaceFillingCurveRenumbering(pts, SFC_HILBERT)
+        sortedPts = pts[o2n.invertArrayO2N2N2O(64)]
+        self.assertTrue((sortedPts[1:] - sortedPts[:-1]).magnitude().isUniform(1., 1e-12))
+        # shuffled 3D mesh, with more nodes and cells than the grain (16384) of the parallel computation of the keys
+        arr = DataArrayDouble(27)
+        arr.iota()
+        cm.setCoords(arr, arr, arr)
+        m = cm.buildUnstructured()
+        nbCells, nbNodes = m.getNumberOfCells(), m.getNumberOfNodes()
+        self.assertGreater(min(nbCells, nbNodes), 16384)
+        m.renumberCells(DataArrayInt([(7919 * i) % nbCells for i in range(nbCells)]))
+        m.renumberNodes(DataArrayInt([(7919 * i) % nbNodes for i in range(nbNodes)]), nbNodes)
+        vol = m.getMeasureField(True).getArray()
+        ref = None
+        for nbThreads in [1, 3]:
+            with MEDCouplingNbOfThreadsScope(nbThreads):
+                m2 = m.deepCopy()
+                nodesO2N = m2.renumberNodesAlongSpaceFillingCurve()
+                cellsO2N = m2.sortCellsAlongSpaceFillingCurve(SFC_HILBERT)
+                pass
+            m2.checkConsistency()
+            self.assertEqual(sorted(nodesO2N.getValues()), list(range(nbNodes)))
+            self.assertEqual(sorted(cellsO2N.getValues()), list(range(nbCells)))
+            self.assertTrue(m2.getCoords()[nodesO2N].isEqual(m.getCoords(), 0.))
+            self.assertTrue(m2.getMeasureField(True).getArray()[cellsO2N].isEqual(vol, 1e-12))
+            # on average, the nodes of a cell are close in memory
+            conn, connI = m2.getNodalConnectivity(), m2.getNodalConnectivityIndex()
+            spread = 0
+            for i in range(nbCells):
+                nodes = conn[connI[i] + 1 : connI[i + 1]]
+                spread += nodes.getMaxValueInArray() - nodes.getMinValueInArray()
+                pass
+            self.assertLess(spread / nbCells, nbNodes / 10)
+            if ref is None:
+                ref = m2
+            else:
+                self.assertTrue(m2.isEqual(ref, 0.))
+            pass
+        pass
+
 if __name__ == "__main__":
     unittest.main()
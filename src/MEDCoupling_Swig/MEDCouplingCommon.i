@@ -53,6 +53,7 @@
 #include "MEDCouplingMatrix.hxx"
 #include "MEDCouplingPartDefinition.hxx"
 #include "MEDCouplingSkyLineArray.hxx"
+#include "MEDCouplingVTKWriter.hxx"
 #include "MEDCouplingTypemaps.i"
 
 #include "InterpKernelAutoPtr.hxx"
@@ -363,6 +364,8 @@ typedef long mcPyPtrType;
 %newobject MEDCoupling::MEDCouplingPointSet::getBoundingBoxForBBTree;
 %newobject MEDCoupling::MEDCouplingPointSet::computeFetchedNodeIds;
 %newobject MEDCoupling::MEDCouplingPointSet::ComputeNbOfInteractionsWithSrcCells;
+%newobject MEDCoupling::MEDCouplingPointSet::ComputeSpaceFillingCurveRenumbering;
+%newobject MEDCoupling::MEDCouplingPointSet::renumberNodesAlongSpaceFillingCurve;
 %newobject MEDCoupling::MEDCouplingPointSet::computeDiameterField;
 %newobject MEDCoupling::MEDCouplingPointSet::__getitem__;
 %newobject MEDCoupling::MEDCouplingUMesh::New;
@@ -387,6 +390,7 @@ typedef long mcPyPtrType;
 %newobject MEDCoupling::MEDCouplingUMesh::colinearizeKeepingConform2D;
 %newobject MEDCoupling::MEDCouplingUMesh::rearrange2ConsecutiveCellTypes;
 %newobject MEDCoupling::MEDCouplingUMesh::sortCellsInMEDFileFrmt;
+%newobject MEDCoupling::MEDCouplingUMesh::sortCellsAlongSpaceFillingCurve;
 %newobject MEDCoupling::MEDCouplingUMesh::getRenumArrForMEDFileFrmt;
 %newobject MEDCoupling::MEDCouplingUMesh::convertCellArrayPerGeoType;
 %newobject MEDCoupling::MEDCouplingUMesh::getRenumArrForConsecutiveCellTypesSpec;
@@ -414,6 +418,7 @@ typedef long mcPyPtrType;
 %newobject MEDCoupling::MEDCouplingUMesh::computeSkin;
 %newobject MEDCoupling::MEDCouplingUMesh::buildSetInstanceFromThis;
 %newobject MEDCoupling::MEDCouplingUMesh::getCellIdsCrossingPlane;
+%newobject MEDCoupling::MEDCouplingUMesh::getCellContainingPoints;
 %newobject MEDCoupling::MEDCouplingUMesh::convexEnvelop2D;
 %newobject MEDCoupling::MEDCouplingUMesh::ComputeRangesFromTypeDistribution;
 %newobject MEDCoupling::MEDCouplingUMesh::buildUnionOf2DMesh;
@@ -692,6 +697,19 @@ namespace MEDCoupling
       IMAGE_GRID = 12
     } MEDCouplingMeshType;
 
+  typedef enum
+    {
+      VTK_NO_COMPRESSION = 0,
+      VTK_ZLIB_COMPRESSION = 1,
+      VTK_LZ4_COMPRESSION = 2
+    } VTKCompression;
+
+  typedef enum
+    {
+      SFC_MORTON = 0,
+      SFC_HILBERT = 1
+    } SpaceFillingCurve;
+
   class DataArrayInt32;
   class DataArrayInt64;
   class DataArrayDouble;
@@ -1540,6 +1558,8 @@ namespace MEDCoupling
       static DataArrayDouble *MergeNodesArray(const MEDCouplingPointSet *m1, const MEDCouplingPointSet *m2);
       static MEDCouplingPointSet *BuildInstanceFromMeshType(MEDCouplingMeshType type);
       static DataArrayIdType *ComputeNbOfInteractionsWithSrcCells(const MEDCouplingPointSet *srcMesh, const MEDCouplingPointSet *trgMesh, double eps);
+      static DataArrayIdType *ComputeSpaceFillingCurveRenumbering(const DataArrayDouble *pts, SpaceFillingCurve curve);
+      DataArrayIdType *renumberNodesAlongSpaceFillingCurve(SpaceFillingCurve curve=SFC_HILBERT);
       virtual DataArrayIdType *computeFetchedNodeIds() const;
       virtual int getNumberOfNodesInCell(int cellId) const;
       virtual MEDCouplingPointSet *buildBoundaryMesh(bool keepCoords) const;
@@ -2132,6 +2152,9 @@ namespace MEDCoupling
     void computeTypes();
     std::string reprConnectivityOfThis() const;
     MEDCouplingUMesh *buildSetInstanceFromThis(int spaceDim) const;
+    void setTopologyCacheEnabled(bool enabled);
+    bool isTopologyCacheEnabled() const;
+    void clearTopologyCache() const;
     //tools
     DataArrayIdType *conformize2D(double eps);
     DataArrayIdType *conformize3D(double eps);
@@ -2145,6 +2168,7 @@ namespace MEDCoupling
     bool checkConsecutiveCellTypesForMEDFileFrmt() const;
     DataArrayIdType *rearrange2ConsecutiveCellTypes();
     DataArrayIdType *sortCellsInMEDFileFrmt();
+    DataArrayIdType *sortCellsAlongSpaceFillingCurve(SpaceFillingCurve curve=SFC_HILBERT);
     DataArrayIdType *getRenumArrForMEDFileFrmt() const;
     DataArrayIdType *convertCellArrayPerGeoType(const DataArrayIdType *da) const;
     MEDCouplingUMesh *buildDescendingConnectivity(DataArrayIdType *desc, DataArrayIdType *descIndx, DataArrayIdType *revDesc, DataArrayIdType *revDescIndx) const;
@@ -2178,6 +2202,7 @@ namespace MEDCoupling
     DataArrayIdType *buildUnionOf2DMesh() const;
     DataArrayIdType *buildUnionOf3DMesh() const;
     DataArrayIdType *orderConsecutiveCells1D() const;
+    DataArrayIdType *getCellContainingPoints(const DataArrayDouble *pts, double eps, const DataArrayIdType *cellIdsGuess=0) const;
     DataArrayDouble *getBoundingBoxForBBTreeFast() const;
     DataArrayDouble *getBoundingBoxForBBTree2DQuadratic(double arcDetEps=1e-12) const;
     DataArrayDouble *getBoundingBoxForBBTree1DQuadratic(double arcDetEps=1e-12) const;
@@ -2851,6 +2876,17 @@ namespace MEDCoupling
         return ret;
       }
 
+      PyObject *getReverseNodalConnectivity(bool sorted=true) const
+      {
+        MCAuto<DataArrayIdType> d0=DataArrayIdType::New();
+        MCAuto<DataArrayIdType> d1=DataArrayIdType::New();
+        self->getReverseNodalConnectivity(d0,d1,sorted);
+        PyObject *ret=PyTuple_New(2);
+        PyTuple_SetItem(ret,0,SWIG_NewPointerObj(SWIG_as_voidptr(d0.retn()),SWIGTITraits<mcIdType>::TI, SWIG_POINTER_OWN | 0 ));
+        PyTuple_SetItem(ret,1,SWIG_NewPointerObj(SWIG_as_voidptr(d1.retn()),SWIGTITraits<mcIdType>::TI, SWIG_POINTER_OWN | 0 ));
+        return ret;
+      }
+
       PyObject *buildDescendingConnectivity() const
       {
         MCAuto<DataArrayIdType> d0=DataArrayIdType::New();
@@ -5279,6 +5315,29 @@ namespace MEDCoupling
     }
   };
 
+  class MEDCouplingVTKWriter
+  {
+  public:
+    MEDCouplingVTKWriter();
+    void setCompression(VTKCompression compression);
+    VTKCompression getCompression() const;
+    void setBlockSize(std::size_t blockSize);
+    std::size_t getBlockSize() const;
+    void setNumberOfPieces(int nbOfPieces);
+    int getNumberOfPieces() const;
+    std::string writeMesh(const std::string& fileName, const MEDCouplingMesh *mesh) const;
+    static bool IsCompressionAvailable(VTKCompression compression);
+    %extend
+    {
+      std::string writeFields(const std::string& fileName, PyObject *li) const
+      {
+        std::vector<const MEDCouplingFieldDouble *> tmp;
+        convertFromPyObjVectorOfObj<const MEDCoupling::MEDCouplingFieldDouble *>(li,SWIGTYPE_p_MEDCoupling__MEDCouplingFieldDouble,"MEDCouplingFieldDouble",tmp);
+        return self->writeFields(fileName,tmp);
+      }
+    }
+  };
+
   class MEDCouplingMultiFields : public RefCountObject, public TimeLabel
   {
   public:
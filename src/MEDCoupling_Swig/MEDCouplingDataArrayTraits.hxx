@@ -35,9 +35,21 @@
 #endif
 
 #ifdef WITH_NUMPY
+typedef void (*MyDeallocator)(void *, void *);
+
+// destructor of the capsule keeping alive a chunk of memory that numpy can't release itself.
+void
+numarrcapsuledeal(PyObject *capsule)
+{
+    MyDeallocator deall = (MyDeallocator)PyCapsule_GetContext(capsule);
+    deall(PyCapsule_GetPointer(capsule, NULL), NULL);
+}
+
 // specific DataArray deallocator callback. This deallocator is used both in the constructor of DataArray and in the
 // toNumPyArr method. This dellocator uses weakref to determine if the linked numArr is still alive or not. If alive the
 // ownership is given to it. if no more alive the "standard" DataArray deallocator is called.
+// Memory allocated by MEDCouplingArrayAlloc or memory mapped can't be released by numpy : in these cases the numArr
+// keeps it alive through a capsule set as its base.
 void
 numarrdeal(void *pt, void *wron)
 {
@@ -45,18 +57,24 @@ numarrdeal(void *pt, void *wron)
     PyObject *weakRefOnOwner = reinterpret_cast<PyObject *>(wronc[0]);
     PyObject *obj = PyWeakref_GetObject(weakRefOnOwner);
     int64_t *offset = reinterpret_cast<int64_t *>(wronc[2]);
+    MyDeallocator deall = (MyDeallocator)wronc[1];
     if (obj != Py_None)
     {
         Py_XINCREF(obj);
         PyArrayObject *objC = reinterpret_cast<PyArrayObject *>(obj);
-        objC->flags |= MED_NUMPY_OWNDATA;
+        if (deall == MEDCoupling::MEDCouplingArrayFree || deall == MEDCoupling::MEDCouplingUnmapFile)
+        {
+            PyObject *capsule(PyCapsule_New(pt, NULL, numarrcapsuledeal));
+            PyCapsule_SetContext(capsule, (void *)deall);
+            PyArray_SetBaseObject(objC, capsule);  // steals the reference
+        }
+        else
+            objC->flags |= MED_NUMPY_OWNDATA;
         Py_XDECREF(weakRefOnOwner);
         Py_XDECREF(obj);
     }
     else
     {
-        typedef void (*MyDeallocator)(void *, void *);
-        MyDeallocator deall = (MyDeallocator)wronc[1];
         deall(pt, offset);
         Py_XDECREF(weakRefOnOwner);
     }
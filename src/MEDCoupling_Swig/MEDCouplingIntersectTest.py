@@ -12399,6 +12399,70 @@ class MEDCouplingIntersectTest(unittest.TestCase):
         self.assertEqual(set([18]), set(ret.getValues()))
         pass
 
+    def testIntersect2DMeshesParallel1(self):
+        """Intersect2DMeshes and Intersect2DMeshWith1DLine give the same result whatever the number of threads."""
+        arr = DataArrayDouble(41)
+        arr.iota()
+        arr /= 40.0
+        m1 = MEDCouplingCMesh()
+        m1.setCoords(arr, arr)
+        m1 = m1.buildUnstructured()
+        arr2 = DataArrayDouble(38)
+        arr2.iota()
+        arr2 = 0.01 + arr2 * (1.05 / 37.0)
+        m2 = MEDCouplingCMesh()
+        m2.setCoords(arr2, arr2)
+        m2 = m2.buildUnstructured()
+        m2.rotate([0.0, 0.0], 0.3)
+        # some edges of m3 are colinear to edges of m1
+        m3 = MEDCouplingCMesh()
+        m3.setCoords(arr[::2], arr)
+        m3 = m3.buildUnstructured()
+        q1 = m1[::3]
+        q1.convertLinearCellsToQuadratic(0)
+        q2 = m2[::5]
+        q2.convertLinearCellsToQuadratic(0)
+        line = MEDCouplingUMesh("line", 1)
+        lineCoo = DataArrayDouble(41, 2)
+        lineCoo[:, 0] = arr * 1.2 - 0.1
+        lineCoo[:, 1] = 0.5
+        lineCoo[::2, 1] = 0.53
+        line.setCoords(lineCoo)
+        line.allocateCells()
+        for i in range(40):
+            line.insertNextCell(NORM_SEG2, [i, i + 1])
+            pass
+        for mesh1, mesh2 in [(m1, m2), (m1, m3), (q1, q2)]:
+            results = []
+            for nbOfThreads in [1, 3]:
+                with MEDCouplingNbOfThreadsScope(nbOfThreads):
+                    results.append(MEDCouplingUMesh.Intersect2DMeshes(mesh1, mesh2, 1e-10))
+                    pass
+                pass
+            ref, res = results
+            self.assertTrue(ref[0].getCoords().isEqual(res[0].getCoords(), 0.0))
+            self.assertTrue(ref[0].getNodalConnectivity().isEqual(res[0].getNodalConnectivity()))
+            self.assertTrue(ref[0].getNodalConnectivityIndex().isEqual(res[0].getNodalConnectivityIndex()))
+            self.assertTrue(ref[1].isEqual(res[1]))
+            self.assertTrue(ref[2].isEqual(res[2]))
+            area = mesh1.getMeasureField(True).accumulate()[0]
+            self.assertAlmostEqual(res[0].getMeasureField(True).accumulate()[0], area, 10)
+            pass
+        results = []
+        for nbOfThreads in [1, 3]:
+            with MEDCouplingNbOfThreadsScope(nbOfThreads):
+                results.append(MEDCouplingUMesh.Intersect2DMeshWith1DLine(m1, line, 1e-10))
+                pass
+            pass
+        ref, res = results
+        for i in range(2):
+            self.assertTrue(ref[i].getCoords().isEqual(res[i].getCoords(), 0.0))
+            self.assertTrue(ref[i].getNodalConnectivity().isEqual(res[i].getNodalConnectivity()))
+            self.assertTrue(ref[i].getNodalConnectivityIndex().isEqual(res[i].getNodalConnectivityIndex()))
+            self.assertTrue(ref[2 + i].isEqual(res[2 + i]))
+            pass
+        pass
+
 
 if __name__ == "__main__":
     unittest.main()
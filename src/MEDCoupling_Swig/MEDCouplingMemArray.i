@@ -997,6 +997,9 @@ typedef DataArrayInt64 DataArrayIdType;
     double popBackSilent();
     void pack() const;
     void allocIfNecessary(int nbOfTuple, int nbOfCompo);
+    void useMappedFile(const std::string& fileName, std::size_t offsetInBytes, std::size_t nbOfTuple, std::size_t nbOfCompo, bool copyOnWrite=false);
+    bool isMemoryMapped() const;
+    std::size_t getNbOfAllocations() const;
     void fillWithZero();
     void fillWithValue(double val);
     void iota(double init=0.);
@@ -1486,6 +1489,16 @@ typedef DataArrayInt64 DataArrayIdType;
         return ret;
       }
 
+      PyObject *getMinMaxValues() const
+      {
+        double a,b;
+        self->getMinMaxValues(a,b);
+        PyObject *ret=PyTuple_New(2);
+        PyTuple_SetItem(ret,0,PyFloat_FromDouble(a));
+        PyTuple_SetItem(ret,1,PyFloat_FromDouble(b));
+        return ret;
+      }
+
       PyObject *normMaxPerComponent() const
       {
         std::size_t nbOfCompo(self->getNumberOfComponents());
@@ -83,6 +83,30 @@ namespace MEDCoupling
   bool MEDCouplingByteOrder();
   const char *MEDCouplingByteOrderStr();
   bool IsCXX11Compiled();
+  int MEDCouplingGetNbOfThreads();
+  void MEDCouplingSetNbOfThreads(int nbOfThreads);
+  void MEDCouplingSetArrayPoolEnabled(bool enabled);
+
+  class MEDCouplingNbOfThreadsScope
+  {
+  public:
+    MEDCouplingNbOfThreadsScope(int nbOfThreads);
+    ~MEDCouplingNbOfThreadsScope();
+    int getNbOfThreads() const;
+    void release();
+    %extend
+    {
+      MEDCouplingNbOfThreadsScope *__enter__()
+      {
+        return self;
+      }
+
+      void __exit__(PyObject *excType, PyObject *excValue, PyObject *traceback)
+      {
+        self->release();
+      }
+    }
+  };
 
   class BigMemoryObject
   {
@@ -60,6 +60,9 @@ namespace MEDCoupling
       bool setOptionString(const std::string& key, const std::string& value);
       int getInterpolationMatrixPolicy() const;
       void setInterpolationMatrixPolicy(int newInterpMatPol);
+      void savePreparedState(const std::string& fileName) const;
+      void loadPreparedState(const std::string& fileName, const MEDCouplingMesh *srcMesh, const MEDCouplingMesh *targetMesh);
+      void loadPreparedStateEx(const std::string& fileName, const MEDCouplingFieldTemplate *src, const MEDCouplingFieldTemplate *target);
       //
       int nullifiedTinyCoeffInCrudeMatrixAbs(double maxValAbs);
       int nullifiedTinyCoeffInCrudeMatrix(double scaleFactor);
@@ -128,6 +131,18 @@ namespace MEDCoupling
              self->setCrudeMatrix(srcMesh,targetMesh,method,mCpp);
            }
 
+           PyObject *transferFields(PyObject *li, double dftValue)
+           {
+             std::vector<const MEDCouplingFieldDouble *> tmp;
+             convertFromPyObjVectorOfObj<const MEDCoupling::MEDCouplingFieldDouble *>(li,SWIGTYPE_p_MEDCoupling__MEDCouplingFieldDouble,"MEDCouplingFieldDouble",tmp);
+             std::vector<MEDCouplingFieldDouble *> fields(self->transferFields(tmp,dftValue));
+             std::size_t sz=fields.size();
+             PyObject *res=PyList_New(sz);
+             for(std::size_t i=0;i<sz;i++)
+               PyList_SetItem(res,i,SWIG_NewPointerObj(SWIG_as_voidptr(fields[i]),SWIGTYPE_p_MEDCoupling__MEDCouplingFieldDouble, SWIG_POINTER_OWN | 0 ));
+             return res;
+           }
+
            void setCrudeMatrixEx(const MEDCouplingFieldTemplate *src, const MEDCouplingFieldTemplate *target, PyObject *m)
            {
              std::vector<std::map<mcIdType,double> > mCpp;
@@ -3534,6 +3534,219 @@ class MEDCouplingBasicsTest(unittest.TestCase):
         self.checkMatrix(mat, expectedMatrix, 1, 1e-13)
         pass
 
+    def testInterp3DMultiThreaded_0(self):
+        """
+        Thread-parallel mode of 3D interpolation (NbOfThreads option) must give exactly the serial matrix.
+        """
+        arr = DataArrayDouble(7)
+        arr.iota()
+        arr /= 6.0
+        src = MEDCouplingCMesh()
+        src.setCoords(arr, arr, arr)
+        src = src.buildUnstructured()
+        src.simplexize(PLANAR_FACE_5)
+        trg = MEDCouplingCMesh()
+        arr2 = DataArrayDouble(5)
+        arr2.iota()
+        arr2 /= 4.0
+        trg.setCoords(arr2, arr2, arr2)
+        trg = trg.buildUnstructured()
+        trg.rotate([0.5, 0.5, 0.5], [1.0, 2.0, 3.0], 0.3)
+        for meth in ["P0P0", "P1P0", "P0P1"]:
+            rem = MEDCouplingRemapper()
+            self.assertEqual(rem.getNbOfThreads(), 1)
+            rem.prepare(src, trg, meth)
+            matRef = rem.getCrudeMatrix()
+            for nbThreads in [2, 5, 0]:
+                rem = MEDCouplingRemapper()
+                self.assertTrue(rem.setOptionInt("NbOfThreads", nbThreads))
+                self.assertEqual(rem.getNbOfThreads(), nbThreads)
+                rem.prepare(src, trg, meth)
+                mat = rem.getCrudeMatrix()
+                self.assertEqual(mat, matRef)
+                pass
+            pass
+        pass
+
+    def testInterp3DFlatBBTree_0(self):
+        """
+        The flat bounding box tree (UseFlatBBTree option) must give the same 3D matrices as the default BBTree.
+        """
+        arr = DataArrayDouble(7)
+        arr.iota()
+        arr /= 6.0
+        src = MEDCouplingCMesh()
+        src.setCoords(arr, arr, arr)
+        src = src.buildUnstructured()
+        src.simplexize(PLANAR_FACE_5)
+        trg = MEDCouplingCMesh()
+        arr2 = DataArrayDouble(5)
+        arr2.iota()
+        arr2 /= 4.0
+        trg.setCoords(arr2, arr2, arr2)
+        trg = trg.buildUnstructured()
+        trg.rotate([0.5, 0.5, 0.5], [1.0, 2.0, 3.0], 0.3)
+        for meth in ["P0P0", "P1P0", "P0P1"]:
+            rem = MEDCouplingRemapper()
+            self.assertFalse(rem.getUseFlatBBTreeStatus())
+            rem.prepare(src, trg, meth)
+            matRef = rem.getCrudeMatrix()
+            rem = MEDCouplingRemapper()
+            self.assertTrue(rem.setOptionInt("UseFlatBBTree", 1))
+            self.assertTrue(rem.getUseFlatBBTreeStatus())
+            rem.prepare(src, trg, meth)
+            nbCols = src.getNumberOfNodes() if meth.startswith("P1") else src.getNumberOfCells()
+            self.checkMatrix(rem.getCrudeMatrix(), matRef, nbCols, 1e-12)
+            pass
+        pass
+
+    def testMatrixUpdateBetweenTransfers_0(self):
+        """
+        Denominators cached from one transfer to the other must follow the nature of the field and the changes of the
+        matrix.
+        """
+        arr = DataArrayDouble(5)
+        arr.iota()
+        arr /= 4.0
+        src = MEDCouplingCMesh()
+        src.setCoords(arr, arr)
+        src = src.buildUnstructured()
+        arr2 = DataArrayDouble(4)
+        arr2.iota()
+        arr2 = arr2 * 0.3 + 0.05
+        trg = MEDCouplingCMesh()
+        trg.setCoords(arr2, arr2)
+        trg = trg.buildUnstructured()
+        rem = MEDCouplingRemapper()
+        rem.prepare(src, trg, "P0P0")
+        f = MEDCouplingFieldDouble(ON_CELLS)
+        f.setMesh(src)
+        f.setArray(DataArrayDouble(src.getNumberOfCells(), 2))
+        f.getArray()[:] = 1.0
+        for i in range(2):
+            f.setNature(IntensiveMaximum)
+            self.assertTrue(rem.transferField(f, -1.0).getArray().isUniform(1.0, 1e-12))
+            f.setNature(ExtensiveConservation)
+            self.assertAlmostEqual(rem.transferField(f, -1.0).getArray()[:, 0].accumulate()[0], 0.81 * 16, 12)
+            pass
+        # removal of the smallest intersections : each source cell keeps at least one coefficient
+        mat = rem.getCrudeMatrix()
+        self.assertEqual(rem.nullifiedTinyCoeffInCrudeMatrixAbs(0.02 + 1e-12), 20)
+        self.assertEqual(rem.getNumberOfColsOfMatrix(), 16)
+        mat2 = rem.getCrudeMatrix()
+        self.assertEqual(len(mat2), 9)
+        for i in range(9):
+            self.assertEqual(mat2[i], {k: v for k, v in mat[i].items() if v > 0.02 + 1e-12})
+            pass
+        f.setNature(IntensiveMaximum)
+        self.assertTrue(rem.transferField(f, -1.0).getArray().isUniform(1.0, 1e-12))
+        g = rem.reverseTransferField(rem.transferField(f, -1.0), -2.0)
+        self.assertTrue(g.getArray().isUniform(1.0, 1e-12))
+        pass
+
+    def testPreparedStateSaveLoad_0(self):
+        """
+        The prepared state saved in a file is restored by another remapper, which then gives the same results without
+        computing the matrix. A file saved for other meshes is rejected.
+        """
+        import tempfile, os
+
+        def buildMesh(nbOfCells, offset):
+            arr = DataArrayDouble(nbOfCells + 1)
+            arr.iota()
+            arr = arr / nbOfCells + offset
+            m = MEDCouplingCMesh()
+            m.setCoords(arr, arr)
+            m = m.buildUnstructured()
+            m.simplexize(0)
+            return m
+
+        src, trg = buildMesh(7, 0.0), buildMesh(5, 0.03)
+        rem = MEDCouplingRemapper()
+        rem.setIntersectionType(Triangulation)
+        rem.setPrecision(1e-11)
+        rem.prepare(src, trg, "P0P0")
+        f = MEDCouplingFieldDouble(ON_CELLS)
+        f.setMesh(src)
+        f.setArray(DataArrayDouble([sin(0.3 * i) for i in range(src.getNumberOfCells())]))
+        with tempfile.TemporaryDirectory() as dir:
+            fileName = os.path.join(dir, "P0P0.bin")
+            rem.savePreparedState(fileName)
+            # the meshes read again by a restarted run are equal to the original ones
+            rem2 = MEDCouplingRemapper()
+            rem2.loadPreparedState(fileName, buildMesh(7, 0.0), buildMesh(5, 0.03))
+            self.assertEqual(rem2.getIntersectionType(), Triangulation)
+            self.assertEqual(rem2.getPrecision(), 1e-11)
+            self.assertEqual(rem2.getCrudeMatrix(), rem.getCrudeMatrix())
+            for nature in [IntensiveMaximum, ExtensiveMaximum, ExtensiveConservation, IntensiveConservation]:
+                f.setNature(nature)
+                g = rem.transferField(f, -1.0)
+                self.assertTrue(rem2.transferField(f, -1.0).getArray().isEqual(g.getArray(), 0.0))
+                self.assertTrue(rem2.reverseTransferField(g, -1.0).isEqual(rem.reverseTransferField(g, -1.0), 0.0, 0.0))
+                pass
+            # stale file
+            trg2 = buildMesh(5, 0.03)
+            coo = trg2.getCoords()
+            coo[0, 0] = coo[0, 0] + 1e-12
+            self.assertRaises(InterpKernelException, rem2.loadPreparedState, fileName, src, trg2)
+            self.assertRaises(InterpKernelException, rem2.loadPreparedState, fileName, trg, src)
+            ft = MEDCouplingFieldTemplate(ON_NODES)
+            ft.setMesh(src)
+            gt = MEDCouplingFieldTemplate(ON_CELLS)
+            gt.setMesh(trg)
+            self.assertRaises(InterpKernelException, rem2.loadPreparedStateEx, fileName, ft, gt)
+            # the remapper is unchanged by a failed load
+            self.assertEqual(rem2.getCrudeMatrix(), rem.getCrudeMatrix())
+            pass
+        pass
+
+    def testTransferFields_0(self):
+        """
+        transferFields gives the same fields as transferField called on each field, whatever the natures and the
+        numbers of components of the fields.
+        """
+        arr = DataArrayDouble(31)
+        arr.iota()
+        arr /= 30.
+        src = MEDCouplingCMesh()
+        src.setCoords(arr, arr)
+        src = src.buildUnstructured()
+        src.simplexize(0)
+        trg = MEDCouplingCMesh()
+        trg.setCoords(arr[::3] + 0.01, arr[::2] - 0.02)
+        trg = trg.buildUnstructured()
+        rem = MEDCouplingRemapper()
+        rem.prepare(src, trg, "P0P0")
+        natures = [IntensiveMaximum, ExtensiveConservation, IntensiveMaximum, ExtensiveMaximum, IntensiveConservation]
+        fs = []
+        for i in range(15):
+            f = MEDCouplingFieldDouble(ON_CELLS)
+            f.setMesh(src)
+            f.setName("f%d" % i)
+            nbOfCompo = 1 + i % 4
+            vals = [sin(0.7 * j + i) for j in range(src.getNumberOfCells() * nbOfCompo)]
+            f.setArray(DataArrayDouble(vals, src.getNumberOfCells(), nbOfCompo))
+            f.setNature(natures[i % len(natures)])
+            fs.append(f)
+            pass
+        res = rem.transferFields(fs, -3.0)
+        self.assertEqual(len(res), len(fs))
+        for f, g in zip(fs, res):
+            ref = rem.transferField(f, -3.0)
+            self.assertEqual(g.getName(), f.getName())
+            self.assertEqual(g.getNature(), f.getNature())
+            self.assertTrue(g.getMesh().isEqual(trg, 1e-12))
+            self.assertTrue(g.getArray().isEqual(ref.getArray(), 0.0))
+            pass
+        self.assertEqual(rem.transferFields([], -3.0), [])
+        f = MEDCouplingFieldDouble(ON_CELLS)
+        f.setMesh(trg)
+        f.setArray(DataArrayDouble(trg.getNumberOfCells()))
+        f.getArray()[:] = 1.0
+        f.setNature(IntensiveMaximum)
+        self.assertRaises(InterpKernelException, rem.transferFields, [fs[0], f], -3.0)
+        pass
+
     def checkMatrix(self, mat1, mat2, nbCols, eps):
         self.assertEqual(len(mat1), len(mat2))
         for i in range(len(mat1)):
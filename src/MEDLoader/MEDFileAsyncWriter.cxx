@@ -0,0 +1,269 @@
+// Copyright (C) 2007-2026  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "MEDFileAsyncWriter.hxx"
+#include "MEDFileData.hxx"
+#include "MEDCouplingMemArray.hxx"
+
+#include "InterpKernelException.hxx"
+
+#include <hdf5.h>
+
+#include <chrono>
+#include <set>
+
+using namespace MEDCoupling;
+
+static void
+CollectArrays(
+    const BigMemoryObject *obj, std::set<const BigMemoryObject *> &visited,
+    std::vector<std::pair<const DataArray *, std::size_t> > &arrays)
+{
+    if (!obj || !visited.insert(obj).second)
+        return;
+    const DataArray *arr(dynamic_cast<const DataArray *>(obj));
+    if (arr)
+        arrays.push_back(std::pair<const DataArray *, std::size_t>(arr, arr->getTimeOfThis()));
+    std::vector<const BigMemoryObject *> children(obj->getDirectChildrenWithNull());
+    for (std::vector<const BigMemoryObject *>::const_iterator it = children.begin(); it != children.end(); it++)
+        CollectArrays(*it, visited, arrays);
+}
+
+MEDFileAsyncWrite::MEDFileAsyncWrite(MEDFileData *snapshot, const std::string &fileName, int mode, bool shareArrays)
+    : _snapshot(snapshot), _file_name(fileName), _mode(mode), _future(_promise.get_future().share())
+{
+    if (shareArrays)
+    {
+        std::set<const BigMemoryObject *> visited;
+        CollectArrays(snapshot, visited, _shared_arrays);
+    }
+}
+
+std::size_t
+MEDFileAsyncWrite::getHeapMemorySizeWithoutChildren() const
+{
+    return _file_name.capacity() + sizeof(MEDFileAsyncWrite);
+}
+
+std::vector<const BigMemoryObject *>
+MEDFileAsyncWrite::getDirectChildrenWithNull() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<const BigMemoryObject *> ret;
+    ret.push_back((const MEDFileData *)_snapshot);
+    return ret;
+}
+
+bool
+MEDFileAsyncWrite::isDone() const
+{
+    return _future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+/*!
+ * Waits for the end of the write and releases its snapshot.
+ * \throw If the write failed, with the exception raised by the write.
+ * \throw If an array shared with the caller has been modified in place before the end of the write.
+ */
+void
+MEDFileAsyncWrite::wait() const
+{
+    _future.wait();
+    releaseSnapshot();
+    _future.get();
+}
+
+//! The snapshot is kept : it is released by the calling thread.
+void
+MEDFileAsyncWrite::run()
+{
+    try
+    {
+        _snapshot->write(_file_name, _mode);
+        for (std::vector<std::pair<const DataArray *, std::size_t> >::const_iterator it = _shared_arrays.begin();
+             it != _shared_arrays.end();
+             it++)
+            if ((*it).first->getTimeOfThis() != (*it).second)
+                throw INTERP_KERNEL::Exception(
+                    "MEDFileAsyncWrite::run : an array shared with the caller has been modified before the end of the "
+                    "write of \"" +
+                    _file_name + "\" !");
+        _promise.set_value();
+    }
+    catch (...)
+    {
+        _promise.set_exception(std::current_exception());
+    }
+}
+
+void
+MEDFileAsyncWrite::releaseSnapshot() const
+{
+    MCAuto<MEDFileData> snapshot;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::swap(snapshot, _snapshot);
+    }
+}
+
+/*!
+ * \param [in] maxNbOfPendingWrites - the number of writes not finished yet above which write waits for the end of
+ *             the oldest one.
+ */
+MEDFileAsyncWriter *
+MEDFileAsyncWriter::New(int maxNbOfPendingWrites)
+{
+    if (maxNbOfPendingWrites < 1)
+        throw INTERP_KERNEL::Exception("MEDFileAsyncWriter::New : the number of pending writes must be >= 1 !");
+    return new MEDFileAsyncWriter(maxNbOfPendingWrites);
+}
+
+MEDFileAsyncWriter::MEDFileAsyncWriter(int maxNbOfPendingWrites)
+    : _max_nb_of_pending_writes(maxNbOfPendingWrites), _stop(false)
+{
+}
+
+//! the writes pending are finished before the destruction
+MEDFileAsyncWriter::~MEDFileAsyncWriter()
+{
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cond.wait(lock, [this] { return _pending.empty(); });
+        _stop = true;
+    }
+    _cond.notify_all();
+    if (_thread.joinable())
+        _thread.join();
+    releaseFinishedWrites();
+}
+
+std::size_t
+MEDFileAsyncWriter::getHeapMemorySizeWithoutChildren() const
+{
+    return sizeof(MEDFileAsyncWriter);
+}
+
+std::vector<const BigMemoryObject *>
+MEDFileAsyncWriter::getDirectChildrenWithNull() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<const BigMemoryObject *> ret;
+    for (std::deque<MCAuto<MEDFileAsyncWrite> >::const_iterator it = _pending.begin(); it != _pending.end(); it++)
+        ret.push_back((const MEDFileAsyncWrite *)*it);
+    for (std::vector<MCAuto<MEDFileAsyncWrite> >::const_iterator it = _finished.begin(); it != _finished.end(); it++)
+        ret.push_back((const MEDFileAsyncWrite *)*it);
+    return ret;
+}
+
+int
+MEDFileAsyncWriter::getNbOfPendingWrites() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return (int)_pending.size();
+}
+
+/*!
+ * The accesses of MEDLoader to MED file are serialized by MEDFileUtilities::MEDFileAccessMutex, but not the other
+ * users of HDF5 : the writes leave the calling thread only if HDF5 accepts calls from several threads.
+ */
+bool
+MEDFileAsyncWriter::IsAsynchronous()
+{
+    hbool_t threadSafe(0);
+    return H5is_library_threadsafe(&threadSafe) >= 0 && threadSafe;
+}
+
+/*!
+ * Requests the write of a snapshot of \a data into \a fileName, after the writes already requested. If there are
+ * already getMaxNbOfPendingWrites() writes not finished, waits for the end of the oldest one first.
+ * \param [in] mode - the mode of MEDFileWritableStandAlone::write, applied at the time of the write.
+ * \param [in] shareArrays - if true the snapshot shares the arrays of \a data instead of copying them. They must not
+ *             be modified in place until the end of the write, which fails otherwise.
+ * \return MEDFileAsyncWrite * - the handle on the write. The caller is to delete it using decrRef().
+ */
+MEDFileAsyncWrite *
+MEDFileAsyncWriter::write(const MEDFileData *data, const std::string &fileName, int mode, bool shareArrays)
+{
+    if (!data)
+        throw INTERP_KERNEL::Exception("MEDFileAsyncWriter::write : null data !");
+    releaseFinishedWrites();
+    MCAuto<MEDFileData> snapshot(shareArrays ? data->deepCpyStructure() : data->deepCopy());
+    MCAuto<MEDFileAsyncWrite> ret(new MEDFileAsyncWrite(snapshot, fileName, mode, shareArrays));
+    if (!IsAsynchronous())
+    {
+        ret->run();
+        ret->releaseSnapshot();
+        return ret.retn();
+    }
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cond.wait(lock, [this] { return (int)_pending.size() < _max_nb_of_pending_writes; });
+        _pending.push_back(ret);
+        if (!_thread.joinable())
+            _thread = std::thread(&MEDFileAsyncWriter::writeLoop, this);
+    }
+    _cond.notify_all();
+    return ret.retn();
+}
+
+/*!
+ * Waits for the end of all the writes requested and releases their snapshots. The failures are reported by
+ * MEDFileAsyncWrite::wait only.
+ */
+void
+MEDFileAsyncWriter::waitForAll() const
+{
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cond.wait(lock, [this] { return _pending.empty(); });
+    }
+    releaseFinishedWrites();
+}
+
+//! Called by the calling thread only, the writer thread never dropping the last reference to a write.
+void
+MEDFileAsyncWriter::releaseFinishedWrites() const
+{
+    std::vector<MCAuto<MEDFileAsyncWrite> > finished;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        finished.swap(_finished);
+    }
+    for (std::vector<MCAuto<MEDFileAsyncWrite> >::const_iterator it = finished.begin(); it != finished.end(); it++)
+        (*it)->releaseSnapshot();
+}
+
+void
+MEDFileAsyncWriter::writeLoop()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+        _cond.wait(lock, [this] { return _stop || !_pending.empty(); });
+        if (_pending.empty())
+            return;
+        MCAuto<MEDFileAsyncWrite> toBeWritten(_pending.front());
+        lock.unlock();
+        toBeWritten->run();
+        lock.lock();
+        _finished.push_back(toBeWritten);
+        _pending.pop_front();
+        _cond.notify_all();
+    }
+}
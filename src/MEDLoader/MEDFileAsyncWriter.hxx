@@ -0,0 +1,119 @@
+// Copyright (C) 2007-2026  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#ifndef __MEDFILEASYNCWRITER_HXX__
+#define __MEDFILEASYNCWRITER_HXX__
+
+#include "MEDLoaderDefines.hxx"
+
+#include "MCAuto.hxx"
+#include "MEDCouplingRefCountObject.hxx"
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace MEDCoupling
+{
+class DataArray;
+class MEDFileData;
+
+/*!
+ * Handle on a write requested to a MEDFileAsyncWriter.
+ */
+class MEDFileAsyncWrite : public RefCountObject
+{
+   public:
+    MEDLOADER_EXPORT std::string getClassName() const override { return std::string("MEDFileAsyncWrite"); }
+    MEDLOADER_EXPORT std::size_t getHeapMemorySizeWithoutChildren() const;
+    MEDLOADER_EXPORT std::vector<const BigMemoryObject *> getDirectChildrenWithNull() const;
+    MEDLOADER_EXPORT std::string getFileName() const { return _file_name; }
+    MEDLOADER_EXPORT bool isDone() const;
+    MEDLOADER_EXPORT void wait() const;
+
+   private:
+    friend class MEDFileAsyncWriter;
+    MEDFileAsyncWrite(MEDFileData *snapshot, const std::string &fileName, int mode, bool shareArrays);
+    void run();
+    void releaseSnapshot() const;
+
+   private:
+    //! released by the calling thread once written, as its arrays may belong to the caller (numpy arrays for example)
+    mutable MCAuto<MEDFileData> _snapshot;
+    //! the arrays shared with the caller and their time at the request, checked at the end of the write
+    std::vector<std::pair<const DataArray *, std::size_t> > _shared_arrays;
+    std::string _file_name;
+    int _mode;
+    std::promise<void> _promise;
+    std::shared_future<void> _future;
+    mutable std::mutex _mutex;
+};
+
+/*!
+ * Writes MEDFileData instances to files in the background, one after the other in the order of the requests, so that
+ * the caller can go on computing during the writes. The instance written is a snapshot of the one given, taken by
+ * MEDFileData::deepCopy, or by MEDFileData::deepCpyStructure on request to spare the copy of the arrays : the caller
+ * must then replace the arrays instead of modifying them in place until the end of the write, which fails otherwise.
+ * The snapshots are released by the calling thread, in MEDFileAsyncWrite::wait, waitForAll or the next write.
+ *
+ * The MED file library being not thread safe, a write holds MEDFileUtilities::MEDFileAccessMutex, under which MEDLoader
+ * opens all its files : the reads and writes of the caller through MEDLoader wait for the end of the write in progress.
+ * The caller must not call MED file directly, on a file it opened itself, during a write. The writes leave the calling
+ * thread only if the HDF5 library is thread safe too, as other libraries of the process may use it : otherwise a call
+ * to write returns once the file is written.
+ */
+class MEDFileAsyncWriter : public RefCountObject
+{
+   public:
+    MEDLOADER_EXPORT static MEDFileAsyncWriter *New(int maxNbOfPendingWrites = 2);
+    MEDLOADER_EXPORT std::string getClassName() const override { return std::string("MEDFileAsyncWriter"); }
+    MEDLOADER_EXPORT std::size_t getHeapMemorySizeWithoutChildren() const;
+    MEDLOADER_EXPORT std::vector<const BigMemoryObject *> getDirectChildrenWithNull() const;
+    MEDLOADER_EXPORT int getMaxNbOfPendingWrites() const { return _max_nb_of_pending_writes; }
+    MEDLOADER_EXPORT int getNbOfPendingWrites() const;
+    MEDLOADER_EXPORT static bool IsAsynchronous();
+    MEDLOADER_EXPORT MEDFileAsyncWrite *write(const MEDFileData *data, const std::string &fileName, int mode,
+                                              bool shareArrays = false);
+    MEDLOADER_EXPORT void waitForAll() const;
+
+   private:
+    MEDFileAsyncWriter(int maxNbOfPendingWrites);
+    ~MEDFileAsyncWriter();
+    void writeLoop();
+    void releaseFinishedWrites() const;
+
+   private:
+    int _max_nb_of_pending_writes;
+    //! the writes not finished yet, the first one being in progress
+    std::deque<MCAuto<MEDFileAsyncWrite> > _pending;
+    //! the writes finished whose snapshot is still to be released by the calling thread
+    mutable std::vector<MCAuto<MEDFileAsyncWrite> > _finished;
+    mutable std::mutex _mutex;
+    mutable std::condition_variable _cond;
+    std::thread _thread;
+    bool _stop;
+};
+}  // namespace MEDCoupling
+
+#endif
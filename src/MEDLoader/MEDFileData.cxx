@@ -62,6 +62,30 @@ MEDFileData::deepCopy() const
     ret->_fields = fields;
     ret->_meshes = meshes;
     ret->_params = params;
+    ret->_mesh_supports = _mesh_supports;
+    ret->_struct_elems = _struct_elems;
+    ret->_header = _header;
+    return ret.retn();
+}
+
+/*!
+ * Returns a copy of \a this sharing its arrays with \a this, for example to write \a this while it goes on evolving.
+ * Meshes, fields and time steps can be added to or removed from \a this without changing the returned instance, but
+ * the arrays shared must not be modified in place : they have to be replaced by new ones instead.
+ */
+MEDFileData *
+MEDFileData::deepCpyStructure() const
+{
+    MCAuto<MEDFileData> ret(MEDFileData::New());
+    if (_fields.isNotNull())
+        ret->_fields = _fields->deepCpyStructure();
+    if (_meshes.isNotNull())
+        ret->_meshes = _meshes->deepCpyStructure();
+    if (_params.isNotNull())
+        ret->_params = _params->deepCopy();
+    ret->_mesh_supports = _mesh_supports;
+    ret->_struct_elems = _struct_elems;
+    ret->_header = _header;
     return ret.retn();
 }
 
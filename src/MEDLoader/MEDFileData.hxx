@@ -42,6 +42,7 @@ class MEDFileData : public RefCountObject, public MEDFileWritableStandAlone
     MEDLOADER_EXPORT static MEDFileData *New(DataArrayByte *db) { return BuildFromMemoryChunk<MEDFileData>(db); }
     MEDLOADER_EXPORT std::string getClassName() const override { return std::string("MEDFileData"); }
     MEDLOADER_EXPORT MEDFileData *deepCopy() const;
+    MEDLOADER_EXPORT MEDFileData *deepCpyStructure() const;
     MEDLOADER_EXPORT std::size_t getHeapMemorySizeWithoutChildren() const;
     MEDLOADER_EXPORT std::vector<const BigMemoryObject *> getDirectChildrenWithNull() const;
     MEDLOADER_EXPORT MEDFileFields *getFields() const;
@@ -153,6 +153,26 @@ MEDFileFields::shallowCpy() const
     return new MEDFileFields(*this);
 }
 
+/*!
+ * Returns a copy of \a this sharing only the arrays of the time steps of the fields with \a this. Fields, time steps
+ * and profiles can then be added to or removed from \a this without changing the returned instance.
+ */
+MEDFileFields *
+MEDFileFields::deepCpyStructure() const
+{
+    MCAuto<MEDFileFields> ret(shallowCpy());
+    std::size_t i(0);
+    for (std::vector<MCAuto<MEDFileAnyTypeFieldMultiTSWithoutSDA>>::const_iterator it = _fields.begin();
+         it != _fields.end();
+         it++, i++)
+    {
+        if ((const MEDFileAnyTypeFieldMultiTSWithoutSDA *)*it)
+            ret->_fields[i] = (*it)->deepCpyStructure();
+    }
+    ret->deepCpyGlobs(*this);
+    return ret.retn();
+}
+
 /*!
  * This method scans for all fields in \a this which time steps ids are common. Time step are discriminated by the pair
  * of integer (iteration,order) whatever the double time value. If all returned time steps are \b exactly those for all
@@ -318,27 +338,27 @@ try : MEDFileFieldGlobsReal(fid)
             case MED_FLOAT64:
             {
                 _fields[i] =
-                    MEDFileFieldMultiTSWithoutSDA::New(fid, ns, typcha, infos, nbOfStep, dtunit, loadAll, ms, entities);
+                    MEDFileFieldMultiTSWithoutSDA::New(fid, ns, typcha, infos, nbOfStep, dtunit, false, ms, entities);
                 break;
             }
             case MED_INT32:
             {
                 _fields[i] = MEDFileInt32FieldMultiTSWithoutSDA::New(
-                    fid, ns, typcha, infos, nbOfStep, dtunit, loadAll, ms, entities
+                    fid, ns, typcha, infos, nbOfStep, dtunit, false, ms, entities
                 );
                 break;
             }
             case MED_INT64:
             {
                 _fields[i] = MEDFileInt64FieldMultiTSWithoutSDA::New(
-                    fid, ns, typcha, infos, nbOfStep, dtunit, loadAll, ms, entities
+                    fid, ns, typcha, infos, nbOfStep, dtunit, false, ms, entities
                 );
                 break;
             }
             case MED_FLOAT32:
             {
                 _fields[i] = MEDFileFloatFieldMultiTSWithoutSDA::New(
-                    fid, ns, typcha, infos, nbOfStep, dtunit, loadAll, ms, entities
+                    fid, ns, typcha, infos, nbOfStep, dtunit, false, ms, entities
                 );
                 break;
             }
@@ -347,7 +367,7 @@ try : MEDFileFieldGlobsReal(fid)
                 if (sizeof(med_int) == sizeof(int))
                 {
                     _fields[i] = MEDFileInt32FieldMultiTSWithoutSDA::New(
-                        fid, ns, typcha, infos, nbOfStep, dtunit, loadAll, ms, entities
+                        fid, ns, typcha, infos, nbOfStep, dtunit, false, ms, entities
                     );
                     break;
                 }
@@ -363,6 +383,9 @@ try : MEDFileFieldGlobsReal(fid)
         }
         _fields[i]->readDescription(fid, *this);
     }
+    // the structure of all the fields is known before the first array is read
+    if (loadAll)
+        MEDFileAnyTypeFieldMultiTSWithoutSDA::LoadBigArraysOfFields(fid, getFieldsWithoutSDA(), false);
     loadAllGlobals(fid, entities);
 }
 catch (INTERP_KERNEL::Exception &e)
@@ -370,6 +393,16 @@ catch (INTERP_KERNEL::Exception &e)
     throw e;
 }
 
+std::vector<MEDFileAnyTypeFieldMultiTSWithoutSDA *>
+MEDFileFields::getFieldsWithoutSDA()
+{
+    std::vector<MEDFileAnyTypeFieldMultiTSWithoutSDA *> ret;
+    for (std::vector<MCAuto<MEDFileAnyTypeFieldMultiTSWithoutSDA>>::iterator it = _fields.begin(); it != _fields.end();
+         it++)
+        ret.push_back(*it);
+    return ret;
+}
+
 void
 MEDFileFields::writeLL(med_idt fid) const
 {
@@ -404,13 +437,7 @@ MEDFileFields::loadArrays()
     if (getFileName().empty())
         throw INTERP_KERNEL::Exception("MEDFileFields::loadArrays : the structure does not come from a file !");
     MEDFileUtilities::AutoFid fid(OpenMEDFileForRead(getFileName()));
-    for (std::vector<MCAuto<MEDFileAnyTypeFieldMultiTSWithoutSDA>>::iterator it = _fields.begin(); it != _fields.end();
-         it++)
-    {
-        MEDFileAnyTypeFieldMultiTSWithoutSDA *elt(*it);
-        if (elt)
-            elt->loadBigArraysRecursively(fid, *elt);
-    }
+    MEDFileAnyTypeFieldMultiTSWithoutSDA::LoadBigArraysOfFields(fid, getFieldsWithoutSDA(), false);
 }
 
 /*!
@@ -426,14 +453,7 @@ MEDFileFields::loadArraysIfNecessary()
     if (!getFileName().empty())
     {
         MEDFileUtilities::AutoFid fid(OpenMEDFileForRead(getFileName()));
-        for (std::vector<MCAuto<MEDFileAnyTypeFieldMultiTSWithoutSDA>>::iterator it = _fields.begin();
-             it != _fields.end();
-             it++)
-        {
-            MEDFileAnyTypeFieldMultiTSWithoutSDA *elt(*it);
-            if (elt)
-                elt->loadBigArraysRecursivelyIfNecessary(fid, *elt);
-        }
+        MEDFileAnyTypeFieldMultiTSWithoutSDA::LoadBigArraysOfFields(fid, getFieldsWithoutSDA(), true);
     }
 }
 
@@ -541,6 +561,14 @@ MEDFileFields::getLocsReallyUsedMulti() const
     return ret;
 }
 
+std::vector<const DataArrayIdType *>
+MEDFileFields::getPflsOnPartReallyUsed() const
+{
+    MEDFileFieldPflsOnPartCollector collector;
+    accept(collector);
+    return collector.getProfiles();
+}
+
 void
 MEDFileFields::changePflsRefsNamesGen(const std::vector<std::pair<std::vector<std::string>, std::string>> &mapOfModif)
 {
@@ -94,6 +94,7 @@ class MEDFileFields : public RefCountObject, public MEDFileFieldGlobsReal, publi
     MEDLOADER_EXPORT std::vector<const BigMemoryObject *> getDirectChildrenWithNull() const;
     MEDLOADER_EXPORT MEDFileFields *deepCopy() const;
     MEDLOADER_EXPORT MEDFileFields *shallowCpy() const;
+    MEDLOADER_EXPORT MEDFileFields *deepCpyStructure() const;
     MEDLOADER_EXPORT void writeLL(med_idt fid) const;
     MEDLOADER_EXPORT void loadArrays();
     MEDLOADER_EXPORT void loadArraysIfNecessary();
@@ -160,6 +161,7 @@ class MEDFileFields : public RefCountObject, public MEDFileFieldGlobsReal, publi
     MEDLOADER_EXPORT std::vector<std::string> getLocsReallyUsed() const;
     MEDLOADER_EXPORT std::vector<std::string> getPflsReallyUsedMulti() const;
     MEDLOADER_EXPORT std::vector<std::string> getLocsReallyUsedMulti() const;
+    MEDLOADER_EXPORT std::vector<const DataArrayIdType *> getPflsOnPartReallyUsed() const;
     MEDLOADER_EXPORT void changePflsRefsNamesGen(
         const std::vector<std::pair<std::vector<std::string>, std::string> > &mapOfModif
     );
@@ -171,6 +173,7 @@ class MEDFileFields : public RefCountObject, public MEDFileFieldGlobsReal, publi
     ~MEDFileFields() {}
     MEDFileFields();
     MEDFileFields(med_idt fid, bool loadAll, const MEDFileMeshes *ms, const MEDFileEntities *entities);
+    std::vector<MEDFileAnyTypeFieldMultiTSWithoutSDA *> getFieldsWithoutSDA();
 
    private:
     std::vector<MCAuto<MEDFileAnyTypeFieldMultiTSWithoutSDA> > _fields;
@@ -1215,6 +1215,28 @@ MEDFileTemplateFieldMultiTS<T>::LoadSpecificEntities(
     return ret.retn();
 }
 
+/*!
+ * Loads all the time steps of the field \a fieldName on the part of the meshes of \a ms only, for example meshes
+ * loaded by MEDFileUMesh::LoadPartOf or MEDFileUMesh::LoadPartOfFromUserDistrib. Only the values of the entities of
+ * these parts are read, whatever the discretization. The profiles of the file are restricted to these parts too.
+ *  \param [in] ms - the meshes defining the parts. A field lying on a mesh not in \a ms is fully loaded.
+ */
+template <class T>
+typename MLFieldTraits<T>::FMTSType *
+MEDFileTemplateFieldMultiTS<T>::LoadPartOf(
+    const std::string &fileName, const std::string &fieldName, const MEDFileMeshes *ms, bool loadAll
+)
+{
+    if (!ms)
+        throw INTERP_KERNEL::Exception("MEDFileFieldMultiTS::LoadPartOf : null meshes !");
+    MEDFileUtilities::AutoFid fid(OpenMEDFileForRead(fileName));
+    MCAuto<typename MLFieldTraits<T>::FMTSType> ret(
+        new typename MLFieldTraits<T>::FMTSType(fid, fieldName, loadAll, ms, 0)
+    );
+    ret->contentNotNull();  // to check that content type matches with \a this type.
+    return ret.retn();
+}
+
 /*!
  * This is the simplest version to fetch a field for MED structure. One drawback : if \a this is a complex field (multi
  * spatial discretization inside a same field) this method will throw exception and more advance method should be called
@@ -1231,7 +1253,7 @@ template <class T>
 typename Traits<T>::FieldType *
 MEDFileTemplateFieldMultiTS<T>::field(int iteration, int order, const MEDFileMesh *mesh) const
 {
-    const MEDFileAnyTypeField1TSWithoutSDA &myF1TS(contentNotNullBase()->getTimeStepEntry(iteration, order));
+    const MEDFileAnyTypeField1TSWithoutSDA &myF1TS(getTimeStepEntryPagedIn(iteration, order));
     MCAuto<DataArray> arrOut;
     MCAuto<MEDCouplingFieldDouble> ret(myF1TS.fieldOnMesh(this, mesh, arrOut, *contentNotNullBase()));
     MCAuto<typename Traits<T>::FieldType> ret2(MEDFileTemplateField1TS<T>::SetDataArrayInField(ret, arrOut));
@@ -1266,7 +1288,7 @@ MEDFileTemplateFieldMultiTS<T>::getFieldAtLevel(
     TypeOfField type, int iteration, int order, int meshDimRelToMax, int renumPol
 ) const
 {
-    const MEDFileAnyTypeField1TSWithoutSDA &myF1TS(contentNotNullBase()->getTimeStepEntry(iteration, order));
+    const MEDFileAnyTypeField1TSWithoutSDA &myF1TS(getTimeStepEntryPagedIn(iteration, order));
     const typename MLFieldTraits<T>::F1TSWSDAType *myF1TSC(
         dynamic_cast<const typename MLFieldTraits<T>::F1TSWSDAType *>(&myF1TS)
     );
@@ -1306,7 +1328,7 @@ template <class T>
 typename Traits<T>::FieldType *
 MEDFileTemplateFieldMultiTS<T>::getFieldAtTopLevel(TypeOfField type, int iteration, int order, int renumPol) const
 {
-    const MEDFileAnyTypeField1TSWithoutSDA &myF1TS(contentNotNullBase()->getTimeStepEntry(iteration, order));
+    const MEDFileAnyTypeField1TSWithoutSDA &myF1TS(getTimeStepEntryPagedIn(iteration, order));
     const typename MLFieldTraits<T>::F1TSWSDAType *myF1TSC(
         dynamic_cast<const typename MLFieldTraits<T>::F1TSWSDAType *>(&myF1TS)
     );
@@ -1350,7 +1372,7 @@ MEDFileTemplateFieldMultiTS<T>::getFieldOnMeshAtLevel(
     TypeOfField type, int iteration, int order, int meshDimRelToMax, const MEDFileMesh *mesh, int renumPol
 ) const
 {
-    const MEDFileAnyTypeField1TSWithoutSDA &myF1TS(contentNotNullBase()->getTimeStepEntry(iteration, order));
+    const MEDFileAnyTypeField1TSWithoutSDA &myF1TS(getTimeStepEntryPagedIn(iteration, order));
     const typename MLFieldTraits<T>::F1TSWSDAType *myF1TSC(
         dynamic_cast<const typename MLFieldTraits<T>::F1TSWSDAType *>(&myF1TS)
     );
@@ -1392,7 +1414,7 @@ MEDFileTemplateFieldMultiTS<T>::getFieldOnMeshAtLevel(
     TypeOfField type, int iteration, int order, const MEDCouplingMesh *mesh, int renumPol
 ) const
 {
-    const MEDFileAnyTypeField1TSWithoutSDA &myF1TS(contentNotNullBase()->getTimeStepEntry(iteration, order));
+    const MEDFileAnyTypeField1TSWithoutSDA &myF1TS(getTimeStepEntryPagedIn(iteration, order));
     const typename MLFieldTraits<T>::F1TSWSDAType *myF1TSC(
         dynamic_cast<const typename MLFieldTraits<T>::F1TSWSDAType *>(&myF1TS)
     );
@@ -1419,7 +1441,7 @@ MEDFileTemplateFieldMultiTS<T>::getFieldAtLevelOld(
     TypeOfField type, int iteration, int order, const std::string &mname, int meshDimRelToMax, int renumPol
 ) const
 {
-    const MEDFileAnyTypeField1TSWithoutSDA &myF1TS(contentNotNullBase()->getTimeStepEntry(iteration, order));
+    const MEDFileAnyTypeField1TSWithoutSDA &myF1TS(getTimeStepEntryPagedIn(iteration, order));
     const typename MLFieldTraits<T>::F1TSWSDAType *myF1TSC(
         dynamic_cast<const typename MLFieldTraits<T>::F1TSWSDAType *>(&myF1TS)
     );
@@ -1460,7 +1482,7 @@ MEDFileTemplateFieldMultiTS<T>::getFieldWithProfile(
     TypeOfField type, int iteration, int order, int meshDimRelToMax, const MEDFileMesh *mesh, DataArrayIdType *&pfl
 ) const
 {
-    const MEDFileAnyTypeField1TSWithoutSDA &myF1TS(contentNotNullBase()->getTimeStepEntry(iteration, order));
+    const MEDFileAnyTypeField1TSWithoutSDA &myF1TS(getTimeStepEntryPagedIn(iteration, order));
     const typename MLFieldTraits<T>::F1TSWSDAType *myF1TSC(
         dynamic_cast<const typename MLFieldTraits<T>::F1TSWSDAType *>(&myF1TS)
     );
@@ -1609,7 +1631,7 @@ template <class T>
 typename MLFieldTraits<T>::F1TSType *
 MEDFileTemplateFieldMultiTS<T>::getTimeStepAtPos(int pos) const
 {
-    const MEDFileAnyTypeField1TSWithoutSDA *item(contentNotNullBase()->getTimeStepAtPos2(pos));
+    const MEDFileAnyTypeField1TSWithoutSDA *item(getTimeStepAtPosPagedIn(pos));
     if (!item)
     {
         std::ostringstream oss;
@@ -1634,6 +1656,7 @@ template <class T>
 typename Traits<T>::ArrayType *
 MEDFileTemplateFieldMultiTS<T>::getUndergroundDataArray(int iteration, int order) const
 {
+    getTimeStepEntryPagedIn(iteration, order);
     DataArray *ret(contentNotNull()->getUndergroundDataArray(iteration, order));
     if (!ret)
         return NULL;
@@ -1656,6 +1679,7 @@ MEDFileTemplateFieldMultiTS<T>::getUndergroundDataArrayExt(
     std::vector<std::pair<std::pair<INTERP_KERNEL::NormalizedCellType, int>, std::pair<mcIdType, mcIdType> > > &entries
 ) const
 {
+    getTimeStepEntryPagedIn(iteration, order);
     DataArray *ret(contentNotNull()->getUndergroundDataArrayExt(iteration, order, entries));
     if (!ret)
         return NULL;
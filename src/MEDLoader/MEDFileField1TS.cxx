@@ -3027,6 +3027,14 @@ MEDFileAnyTypeField1TS::getLocsReallyUsedMulti() const
     return contentNotNullBase()->getLocsReallyUsedMulti2();
 }
 
+std::vector<const DataArrayIdType *>
+MEDFileAnyTypeField1TS::getPflsOnPartReallyUsed() const
+{
+    MEDFileFieldPflsOnPartCollector collector;
+    contentNotNullBase()->accept(collector);
+    return collector.getProfiles();
+}
+
 void
 MEDFileAnyTypeField1TS::changePflsRefsNamesGen(
     const std::vector<std::pair<std::vector<std::string>, std::string> > &mapOfModif
@@ -651,6 +651,7 @@ class MEDFileAnyTypeField1TS : public RefCountObject, public MEDFileWritableStan
     MEDLOADER_EXPORT std::vector<std::string> getLocsReallyUsed() const;
     MEDLOADER_EXPORT std::vector<std::string> getPflsReallyUsedMulti() const;
     MEDLOADER_EXPORT std::vector<std::string> getLocsReallyUsedMulti() const;
+    MEDLOADER_EXPORT std::vector<const DataArrayIdType *> getPflsOnPartReallyUsed() const;
     MEDLOADER_EXPORT void changePflsRefsNamesGen(
         const std::vector<std::pair<std::vector<std::string>, std::string> > &mapOfModif
     );
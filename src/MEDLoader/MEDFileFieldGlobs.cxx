@@ -37,6 +37,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <map>
 
 using namespace MEDCoupling;
 
@@ -153,9 +154,21 @@ void
 MEDFileFieldGlobs::loadGlobals(med_idt fid, const MEDFileFieldGlobsReal &real)
 {
     std::vector<std::string> profiles = real.getPflsReallyUsed();
+    // the profiles computed at the read of a part of the mesh are not in the file
+    std::vector<const DataArrayIdType *> pflsOnPart(real.getPflsOnPartReallyUsed());
+    std::map<std::string, const DataArrayIdType *> pflsOnPartByName;
+    for (std::vector<const DataArrayIdType *>::const_iterator it = pflsOnPart.begin(); it != pflsOnPart.end(); it++)
+        pflsOnPartByName[(*it)->getName()] = *it;
     std::size_t sz = profiles.size();
     _pfls.resize(sz);
-    for (unsigned int i = 0; i < sz; i++) loadProfileInFile(fid, i, profiles[i].c_str());
+    for (unsigned int i = 0; i < sz; i++)
+    {
+        std::map<std::string, const DataArrayIdType *>::const_iterator it(pflsOnPartByName.find(profiles[i]));
+        if (it != pflsOnPartByName.end())
+            _pfls[i] = (*it).second->deepCopy();
+        else
+            loadProfileInFile(fid, i, profiles[i].c_str());
+    }
     //
     std::vector<std::string> locs = real.getLocsReallyUsed();
     sz = locs.size();
@@ -871,6 +884,12 @@ void
 MEDFileFieldGlobsReal::loadAllGlobals(med_idt fid, const MEDFileEntities *entities)
 {
     contentNotNull()->loadAllGlobals(fid, entities);
+    std::vector<const DataArrayIdType *> pflsOnPart(getPflsOnPartReallyUsed());
+    for (std::vector<const DataArrayIdType *>::const_iterator it = pflsOnPart.begin(); it != pflsOnPart.end(); it++)
+    {
+        MCAuto<DataArrayIdType> pfl((*it)->deepCopy());
+        contentNotNull()->appendProfile(pfl);
+    }
 }
 
 void
@@ -128,6 +128,7 @@ class MEDFileFieldGlobsReal
     MEDLOADER_EXPORT virtual std::vector<std::string> getLocsReallyUsed() const = 0;
     MEDLOADER_EXPORT virtual std::vector<std::string> getPflsReallyUsedMulti() const = 0;
     MEDLOADER_EXPORT virtual std::vector<std::string> getLocsReallyUsedMulti() const = 0;
+    MEDLOADER_EXPORT virtual std::vector<const DataArrayIdType *> getPflsOnPartReallyUsed() const = 0;
     MEDLOADER_EXPORT virtual void changePflsRefsNamesGen(
         const std::vector<std::pair<std::vector<std::string>, std::string> > &mapOfModif
     ) = 0;
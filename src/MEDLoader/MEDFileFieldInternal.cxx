@@ -34,6 +34,11 @@
 
 #include "CellModel.hxx"
 
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
 // From MEDLOader.cxx TU
 extern med_geometry_type typmai[MED_N_CELL_FIXED_GEO];
 extern INTERP_KERNEL::NormalizedCellType typmai2[MED_N_CELL_FIXED_GEO];
@@ -686,8 +691,10 @@ MEDFileFieldPerMeshPerTypePerDisc::getHeapMemorySizeWithoutChildren() const
 std::vector<const BigMemoryObject *>
 MEDFileFieldPerMeshPerTypePerDisc::getDirectChildrenWithNull() const
 {
-    std::vector<const BigMemoryObject *> ret(1);
+    std::vector<const BigMemoryObject *> ret(3);
     ret[0] = (const PartDefinition *)_pd;
+    ret[1] = (const PartDefinition *)_pd_in_pfl;
+    ret[2] = (const DataArrayIdType *)_pfl_on_part;
     return ret;
 }
 
@@ -731,6 +738,8 @@ MEDFileFieldPerMeshPerTypePerDisc::MEDFileFieldPerMeshPerTypePerDisc(const MEDFi
       _loc_id(other._loc_id),
       _profile_it(other._profile_it),
       _pd(other._pd),
+      _pd_in_pfl(other._pd_in_pfl),
+      _pfl_on_part(other._pfl_on_part),
       _tmp_work1(other._tmp_work1)
 {
 }
@@ -841,10 +850,6 @@ MEDFileFieldPerMeshPerTypePerDisc::goReadZeValuesInFile(
     }
     else
     {
-        if (!_profile.empty())
-            throw INTERP_KERNEL::Exception(
-                "MEDFileFieldPerMeshPerTypePerDisc::goReadZeValuesInFile : not implemented !"
-            );
         INTERP_KERNEL::AutoPtr<char> pflname(MEDLoaderBase::buildEmptyString(MED_NAME_SIZE)),
             locname(MEDLoaderBase::buildEmptyString(MED_NAME_SIZE));
         med_int profilesize, nbi;
@@ -864,6 +869,14 @@ MEDFileFieldPerMeshPerTypePerDisc::goReadZeValuesInFile(
         ));
 
         {  // TODO : manage int32 !
+            // with a profile the values are selected by their position in the profile of the file
+            std::string pflInFile(MEDLoaderBase::buildStringFromFortran(pflname, MED_NAME_SIZE));
+            if (!pflInFile.empty())
+                pd = _pd_in_pfl;
+            if (!pd)
+                throw INTERP_KERNEL::Exception(
+                    "MEDFileFieldPerMeshPerTypePerDisc::goReadZeValuesInFile : profile on part not loaded !"
+                );
             pd->checkConsistencyLight();
             MEDFilterEntity filter;
             filter.fill(
@@ -874,7 +887,7 @@ MEDFileFieldPerMeshPerTypePerDisc::goReadZeValuesInFile(
                 MED_ALL_CONSTITUENT,
                 MED_FULL_INTERLACE,
                 MED_COMPACT_STMODE,
-                MED_NO_PROFILE,
+                pflInFile.empty() ? MED_NO_PROFILE : pflInFile.c_str(),
                 pd
             );
             MEDFILESAFECALLERRD0(
@@ -965,15 +978,15 @@ MEDFileFieldPerMeshPerTypePerDisc::loadOnlyStructureOfDataRecursively(
     {
         _nval = zeNVal;
     }
-    else
+    else if (_profile.empty())
     {
-        if (!_profile.empty())
-            throw INTERP_KERNEL::Exception(
-                "MEDFileFieldPerMeshPerTypePerDisc::loadOnlyStructureOfDataRecursively : profiles are not managed yet "
-                "with part of def !"
-            );
         _nval = pd->getNumberOfElems();
     }
+    else
+    {
+        loadProfileOnPart(fid);
+        _nval = _pd_in_pfl->getNumberOfElems();
+    }
     _start = start;
     _end = start + _nval * nbi;
     start = _end;
@@ -989,6 +1002,76 @@ MEDFileFieldPerMeshPerTypePerDisc::loadOnlyStructureOfDataRecursively(
     }
 }
 
+/*!
+ * Returns the name of the profile \a pflName read on a part of the entities of type \a gt : "<pflName>_part_<type>".
+ * When it exceeds MED_NAME_SIZE, \a pflName is cut and followed by a hash of the full name, so that the names of
+ * distinct profiles stay distinct.
+ */
+std::string
+MEDFileFieldPerMeshPerTypePerDisc::BuildNameOfProfileOnPart(
+    const std::string &pflName, INTERP_KERNEL::NormalizedCellType gt
+)
+{
+    std::string suffix("_part");
+    if (gt != INTERP_KERNEL::NORM_ERROR)
+        suffix += std::string("_") + INTERP_KERNEL::CellModel::GetCellModel(gt).getRepr();
+    std::string ret(pflName + suffix);
+    if (ret.size() <= (std::size_t)MED_NAME_SIZE)
+        return ret;
+    std::uint64_t hash(14695981039346656037ULL);  // FNV-1a
+    for (std::string::const_iterator it = ret.begin(); it != ret.end(); it++)
+        hash = (hash ^ (unsigned char)(*it)) * 1099511628211ULL;
+    std::ostringstream oss;
+    oss << "_" << std::hex << std::setw(16) << std::setfill('0') << hash << suffix;
+    std::string tail(oss.str());
+    return pflName.substr(0, MED_NAME_SIZE - tail.size()) + tail;
+}
+
+/*!
+ * Intersects the profile \a _profile of the file with the part \a _pd of the entities of the mesh. The values kept
+ * are those of the entities of the profile belonging to the part, in the order of the profile. \a _profile is then
+ * renamed, its new content relative to the part being stored in \a _pfl_on_part.
+ */
+void
+MEDFileFieldPerMeshPerTypePerDisc::loadProfileOnPart(med_idt fid)
+{
+    MCAuto<DataArrayMedInt> miPfl(DataArrayMedInt::New());
+    miPfl->alloc(MEDprofileSizeByName(fid, _profile.c_str()), 1);
+    MEDFILESAFECALLERRD0(MEDprofileRd, (fid, _profile.c_str(), miPfl->getPointer()));
+    MCAuto<DataArrayIdType> pfl(FromMedIntArray<mcIdType>(miPfl)), partIds(_pd->toDAI());
+    std::map<mcIdType, mcIdType> posInPart;
+    const mcIdType *partPtr(partIds->begin());
+    for (mcIdType i = 0; i < partIds->getNumberOfTuples(); i++) posInPart[partPtr[i]] = i;
+    MCAuto<DataArrayIdType> posInPfl(DataArrayIdType::New()), pflOnPart(DataArrayIdType::New());
+    posInPfl->alloc(0, 1);
+    pflOnPart->alloc(0, 1);
+    const mcIdType *pflPtr(pfl->begin());
+    for (mcIdType i = 0; i < pfl->getNumberOfTuples(); i++)
+    {
+        std::map<mcIdType, mcIdType>::const_iterator it(posInPart.find(pflPtr[i] - 1));
+        if (it == posInPart.end())
+            continue;
+        posInPfl->pushBackSilent(i);
+        pflOnPart->pushBackSilent((*it).second);
+    }
+    _profile = BuildNameOfProfileOnPart(_profile, getGeoType());
+    pflOnPart->setName(_profile);
+    _pd_in_pfl = DataArrayPartDefinition::New(posInPfl);
+    _pfl_on_part = pflOnPart;
+}
+
+void
+MEDFileFieldPflsOnPartCollector::newPerMeshPerTypePerDisc(const MEDFileFieldPerMeshPerTypePerDisc *pmptpd)
+{
+    const DataArrayIdType *pfl(pmptpd->getProfileOnPart());
+    if (!pfl)
+        return;
+    for (std::vector<const DataArrayIdType *>::const_iterator it = _pfls.begin(); it != _pfls.end(); it++)
+        if ((*it)->getName() == pfl->getName())
+            return;
+    _pfls.push_back(pfl);
+}
+
 void
 MEDFileFieldPerMeshPerTypePerDisc::loadBigArray(med_idt fid, const MEDFileFieldNameScope &nasc)
 {
@@ -212,6 +212,7 @@ class MEDFileFieldPerMeshPerTypePerDisc : public RefCountObject, public MEDFileW
     const std::vector<std::string> &getInfo() const;
     std::string getProfile() const;
     void setProfile(const std::string &newPflName);
+    const DataArrayIdType *getProfileOnPart() const { return _pfl_on_part; }
     std::string getLocalization() const;
     void setLocalization(const std::string &newLocName);
     mcIdType getLocId() const { return _loc_id; }
@@ -285,6 +286,8 @@ class MEDFileFieldPerMeshPerTypePerDisc : public RefCountObject, public MEDFileW
     MEDFileFieldPerMeshPerTypePerDisc();
 
    private:
+    static std::string BuildNameOfProfileOnPart(const std::string &pflName, INTERP_KERNEL::NormalizedCellType gt);
+    void loadProfileOnPart(med_idt fid);
     void goReadZeValuesInFile(
         med_idt fid,
         const std::string &fieldName,
@@ -309,6 +312,10 @@ class MEDFileFieldPerMeshPerTypePerDisc : public RefCountObject, public MEDFileW
     mutable mcIdType _loc_id;
     mutable mcIdType _profile_it;
     MCAuto<PartDefinition> _pd;
+    //! only for a profile read on a part of the mesh : the positions in the profile of the file of the values read
+    MCAuto<PartDefinition> _pd_in_pfl;
+    //! only for a profile read on a part of the mesh : the profile _profile relative to the part
+    MCAuto<DataArrayIdType> _pfl_on_part;
 
    public:
     mutable mcIdType _tmp_work1;
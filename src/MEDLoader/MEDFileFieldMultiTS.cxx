@@ -696,11 +696,10 @@ MEDFileAnyTypeFieldMultiTSWithoutSDA::loadStructureOrStructureAndBigArraysRecurs
                     "field type are : FLOAT64, INT32, FLOAT32, INT64 !"
                 );
         }
-        if (loadAll)
-            _time_steps[i]->loadStructureAndBigArraysRecursively(fid, *this, ms, entitiesForSubInstances);
-        else
-            _time_steps[i]->loadOnlyStructureOfDataRecursively(fid, *this, ms, entitiesForSubInstances, &mfcap);
+        _time_steps[i]->loadOnlyStructureOfDataRecursively(fid, *this, ms, entitiesForSubInstances, &mfcap);
     }
+    if (loadAll)
+        LoadBigArraysOfFields(fid, std::vector<MEDFileAnyTypeFieldMultiTSWithoutSDA *>(1, this), false);
 }
 
 void
@@ -787,6 +786,29 @@ MEDFileAnyTypeFieldMultiTSWithoutSDA::loadBigArraysRecursivelyIfNecessary(
     }
 }
 
+/*!
+ * Reads the arrays of all the time steps of \a fields, whose structure has already been loaded, in the order of \a
+ * fields and of their time steps. MED reads the values directly into the arrays of the time steps, so the reads are
+ * the whole work and are done on the calling thread.
+ *
+ * \param [in] onlyIfNecessary if true, only the time steps whose arrays are not allocated yet are read, as
+ * MEDFileAnyTypeFieldMultiTSWithoutSDA::loadBigArraysRecursivelyIfNecessary does.
+ */
+void
+MEDFileAnyTypeFieldMultiTSWithoutSDA::LoadBigArraysOfFields(
+    med_idt fid, const std::vector<MEDFileAnyTypeFieldMultiTSWithoutSDA *> &fields, bool onlyIfNecessary
+)
+{
+    for (MEDFileAnyTypeFieldMultiTSWithoutSDA *field : fields)
+        if (field)
+        {
+            if (onlyIfNecessary)
+                field->loadBigArraysRecursivelyIfNecessary(fid, *field);
+            else
+                field->loadBigArraysRecursively(fid, *field);
+        }
+}
+
 void
 MEDFileAnyTypeFieldMultiTSWithoutSDA::unloadArrays()
 {
@@ -1141,6 +1163,25 @@ MEDFileAnyTypeFieldMultiTSWithoutSDA::deepCopy() const
     return ret.retn();
 }
 
+/*!
+ * Returns a copy of \a this sharing the arrays of the time steps with \a this, but not the time steps themselves. The
+ * shallowCpy of a time step copies its entries per mesh and per type, so that they can be changed in \a this.
+ */
+MEDFileAnyTypeFieldMultiTSWithoutSDA *
+MEDFileAnyTypeFieldMultiTSWithoutSDA::deepCpyStructure() const
+{
+    MCAuto<MEDFileAnyTypeFieldMultiTSWithoutSDA> ret = shallowCpy();
+    std::size_t i = 0;
+    for (std::vector<MCAuto<MEDFileAnyTypeField1TSWithoutSDA> >::const_iterator it = _time_steps.begin();
+         it != _time_steps.end();
+         it++, i++)
+    {
+        if ((const MEDFileAnyTypeField1TSWithoutSDA *)*it)
+            ret->_time_steps[i] = (*it)->shallowCpy();
+    }
+    return ret.retn();
+}
+
 std::vector<MCAuto<MEDFileAnyTypeFieldMultiTSWithoutSDA> >
 MEDFileAnyTypeFieldMultiTSWithoutSDA::splitComponents() const
 {
@@ -1832,6 +1873,14 @@ MEDFileAnyTypeFieldMultiTS::getLocsReallyUsedMulti() const
     return contentNotNullBase()->getLocsReallyUsedMulti2();
 }
 
+std::vector<const DataArrayIdType *>
+MEDFileAnyTypeFieldMultiTS::getPflsOnPartReallyUsed() const
+{
+    MEDFileFieldPflsOnPartCollector collector;
+    contentNotNullBase()->accept(collector);
+    return collector.getProfiles();
+}
+
 void
 MEDFileAnyTypeFieldMultiTS::changePflsRefsNamesGen(
     const std::vector<std::pair<std::vector<std::string>, std::string> > &mapOfModif
@@ -2095,7 +2144,9 @@ MEDFileAnyTypeFieldMultiTS::loadArrays()
             "MEDFileAnyTypeFieldMultiTS::loadArrays : the structure does not come from a file !"
         );
     MEDFileUtilities::AutoFid fid(OpenMEDFileForRead(getFileName()));
-    contentNotNullBase()->loadBigArraysRecursively(fid, *contentNotNullBase());
+    MEDFileAnyTypeFieldMultiTSWithoutSDA::LoadBigArraysOfFields(
+        fid, std::vector<MEDFileAnyTypeFieldMultiTSWithoutSDA *>(1, contentNotNullBase()), false
+    );
 }
 
 /*!
@@ -2111,7 +2162,9 @@ MEDFileAnyTypeFieldMultiTS::loadArraysIfNecessary()
     if (!getFileName().empty())
     {
         MEDFileUtilities::AutoFid fid(OpenMEDFileForRead(getFileName()));
-        contentNotNullBase()->loadBigArraysRecursivelyIfNecessary(fid, *contentNotNullBase());
+        MEDFileAnyTypeFieldMultiTSWithoutSDA::LoadBigArraysOfFields(
+            fid, std::vector<MEDFileAnyTypeFieldMultiTSWithoutSDA *>(1, contentNotNullBase()), true
+        );
     }
 }
 
@@ -2146,6 +2199,76 @@ MEDFileAnyTypeFieldMultiTS::unloadArraysWithoutDataLoss()
         contentNotNullBase()->unloadArrays();
 }
 
+/*!
+ * Switches \a this, which must come from a file, to a paging mode : the arrays of a time step are read at its first
+ * access through MEDFileAnyTypeFieldMultiTS::getTimeStepAtPos, getFieldAtLevel and the other getters of a given time
+ * step. When the arrays in memory exceed \a maxNbOfBytes, the least recently accessed time steps are released, as
+ * MEDFileAnyTypeFieldMultiTS::unloadArraysWithoutDataLoss does. So the memory needed to walk through a long time
+ * series is the one of a window of time steps, whatever the length of the series.
+ *
+ * The arrays already in memory are kept, within the budget. The instances returned by getTimeStepAtPos share the
+ * arrays of \a this : they can be released by a later access to another time step. The MEDCoupling fields returned
+ * by the getters own their values.
+ *
+ * \param [in] maxNbOfBytes - the budget of memory for the arrays of \a this. The time step being accessed is always
+ *              read, even if it exceeds the budget alone.
+ * \param [in] nbOfTimeStepsToReadAhead - the number of time steps following the accessed one that are read ahead,
+ *              during the access, as long as they fit in what remains of the budget.
+ * \throw If \a this does not come from a file.
+ * \sa MEDFileAnyTypeFieldMultiTS::disablePaging
+ */
+void
+MEDFileAnyTypeFieldMultiTS::enablePaging(std::size_t maxNbOfBytes, int nbOfTimeStepsToReadAhead)
+{
+    MCAuto<MEDFileFieldPager> pager(MEDFileFieldPager::New(getFileName(), maxNbOfBytes, nbOfTimeStepsToReadAhead));
+    pager->registerTimeSteps(contentNotNullBase());
+    disablePaging();
+    _pager = pager;
+}
+
+/*!
+ * Leaves the paging mode : the time steps in memory stay in memory, and no time step is read nor released anymore
+ * by the getters.
+ *
+ * \sa MEDFileAnyTypeFieldMultiTS::enablePaging
+ */
+void
+MEDFileAnyTypeFieldMultiTS::disablePaging()
+{
+    _pager.nullify();
+}
+
+bool
+MEDFileAnyTypeFieldMultiTS::isPagingEnabled() const
+{
+    return _pager.isNotNull();
+}
+
+/*!
+ * \return the number of bytes of the arrays of the time steps that the paging holds in memory, 0 if the paging is
+ *          disabled.
+ */
+std::size_t
+MEDFileAnyTypeFieldMultiTS::getNbOfBytesPagedIn() const
+{
+    return _pager.isNotNull() ? _pager->getNbOfBytesPagedIn() : 0;
+}
+
+const MEDFileAnyTypeField1TSWithoutSDA *
+MEDFileAnyTypeFieldMultiTS::getTimeStepAtPosPagedIn(int pos) const
+{
+    const MEDFileAnyTypeField1TSWithoutSDA *ret(contentNotNullBase()->getTimeStepAtPos2(pos));
+    if (_pager.isNotNull())
+        _pager.iAmATrollConstCast()->pageIn(_content.iAmATrollConstCast(), pos);
+    return ret;
+}
+
+const MEDFileAnyTypeField1TSWithoutSDA &
+MEDFileAnyTypeFieldMultiTS::getTimeStepEntryPagedIn(int iteration, int order) const
+{
+    return *getTimeStepAtPosPagedIn(contentNotNullBase()->getTimeStepPos(iteration, order));
+}
+
 std::string
 MEDFileAnyTypeFieldMultiTS::simpleRepr() const
 {
@@ -2249,6 +2372,7 @@ MEDFileAnyTypeFieldMultiTS::deepCopy() const
     MCAuto<MEDFileAnyTypeFieldMultiTS> ret = shallowCpy();
     if ((const MEDFileAnyTypeFieldMultiTSWithoutSDA *)_content)
         ret->_content = _content->deepCopy();
+    ret->_pager.nullify();
     ret->deepCpyGlobs(*this);
     return ret.retn();
 }
@@ -25,6 +25,7 @@
 #include "MEDFileFieldGlobs.hxx"
 #include "MEDLoaderTraits.hxx"
 #include "MEDFileUtilities.hxx"
+#include "MEDFileFieldPager.hxx"
 
 namespace MEDCoupling
 {
@@ -64,6 +65,7 @@ class MEDFileAnyTypeFieldMultiTSWithoutSDA : public RefCountObject, public MEDFi
     MEDLOADER_EXPORT std::size_t getHeapMemorySizeWithoutChildren() const;
     MEDLOADER_EXPORT std::vector<const BigMemoryObject *> getDirectChildrenWithNull() const;
     MEDLOADER_EXPORT virtual MEDFileAnyTypeFieldMultiTSWithoutSDA *deepCopy() const;
+    MEDLOADER_EXPORT MEDFileAnyTypeFieldMultiTSWithoutSDA *deepCpyStructure() const;
     MEDLOADER_EXPORT virtual std::vector<MCAuto<MEDFileAnyTypeFieldMultiTSWithoutSDA> > splitComponents() const;
     MEDLOADER_EXPORT virtual std::vector<MCAuto<MEDFileAnyTypeFieldMultiTSWithoutSDA> > splitDiscretizations() const;
     MEDLOADER_EXPORT virtual std::vector<MCAuto<MEDFileAnyTypeFieldMultiTSWithoutSDA> >
@@ -162,6 +164,9 @@ class MEDFileAnyTypeFieldMultiTSWithoutSDA : public RefCountObject, public MEDFi
     MEDLOADER_EXPORT void loadBigArraysRecursively(med_idt fid, const MEDFileFieldNameScope &nasc);
     MEDLOADER_EXPORT void loadBigArraysRecursivelyIfNecessary(med_idt fid, const MEDFileFieldNameScope &nasc);
     MEDLOADER_EXPORT void unloadArrays();
+    MEDLOADER_EXPORT static void LoadBigArraysOfFields(
+        med_idt fid, const std::vector<MEDFileAnyTypeFieldMultiTSWithoutSDA *> &fields, bool onlyIfNecessary
+    );
 
    public:
     MEDLOADER_EXPORT const MEDFileAnyTypeField1TSWithoutSDA *getTimeStepAtPos2(int pos) const;
@@ -521,6 +526,10 @@ class MEDFileAnyTypeFieldMultiTS : public RefCountObject, public MEDFileWritable
     MEDLOADER_EXPORT void loadArraysIfNecessary();
     MEDLOADER_EXPORT void unloadArrays();
     MEDLOADER_EXPORT void unloadArraysWithoutDataLoss();
+    MEDLOADER_EXPORT void enablePaging(std::size_t maxNbOfBytes, int nbOfTimeStepsToReadAhead = 0);
+    MEDLOADER_EXPORT void disablePaging();
+    MEDLOADER_EXPORT bool isPagingEnabled() const;
+    MEDLOADER_EXPORT std::size_t getNbOfBytesPagedIn() const;
     MEDLOADER_EXPORT void writeLL(med_idt fid) const;
     MEDLOADER_EXPORT std::size_t getHeapMemorySizeWithoutChildren() const;
     MEDLOADER_EXPORT std::vector<const BigMemoryObject *> getDirectChildrenWithNull() const;
@@ -611,6 +620,7 @@ class MEDFileAnyTypeFieldMultiTS : public RefCountObject, public MEDFileWritable
     MEDLOADER_EXPORT std::vector<std::string> getLocsReallyUsed() const;
     MEDLOADER_EXPORT std::vector<std::string> getPflsReallyUsedMulti() const;
     MEDLOADER_EXPORT std::vector<std::string> getLocsReallyUsedMulti() const;
+    MEDLOADER_EXPORT std::vector<const DataArrayIdType *> getPflsOnPartReallyUsed() const;
     MEDLOADER_EXPORT void changePflsRefsNamesGen(
         const std::vector<std::pair<std::vector<std::string>, std::string> > &mapOfModif
     );
@@ -621,6 +631,8 @@ class MEDFileAnyTypeFieldMultiTS : public RefCountObject, public MEDFileWritable
    protected:
     MEDFileAnyTypeFieldMultiTSWithoutSDA *contentNotNullBase();
     const MEDFileAnyTypeFieldMultiTSWithoutSDA *contentNotNullBase() const;
+    const MEDFileAnyTypeField1TSWithoutSDA *getTimeStepAtPosPagedIn(int pos) const;
+    const MEDFileAnyTypeField1TSWithoutSDA &getTimeStepEntryPagedIn(int iteration, int order) const;
 
    private:
     static std::vector<std::vector<MEDFileAnyTypeFieldMultiTS *> > SplitPerCommonSupportNotNodesAlg(
@@ -631,6 +643,8 @@ class MEDFileAnyTypeFieldMultiTS : public RefCountObject, public MEDFileWritable
 
    protected:
     MCAuto<MEDFileAnyTypeFieldMultiTSWithoutSDA> _content;
+    //! shared by the shallow copies since they share _content, null if the paging is disabled
+    MCAuto<MEDFileFieldPager> _pager;
 };
 
 template <class T>
@@ -659,6 +673,9 @@ class MEDFileTemplateFieldMultiTS : public MEDFileAnyTypeFieldMultiTS
         const std::vector<std::pair<TypeOfField, INTERP_KERNEL::NormalizedCellType> > &entities,
         bool loadAll = true
     );
+    MEDLOADER_EXPORT static typename MLFieldTraits<T>::FMTSType *LoadPartOf(
+        const std::string &fileName, const std::string &fieldName, const MEDFileMeshes *ms, bool loadAll = true
+    );
     MEDLOADER_EXPORT typename MLFieldTraits<T>::FMTSType *extractPartImpl(
         const std::map<int, MCAuto<DataArrayIdType> > &extractDef, MEDFileMesh *mm
     ) const;
@@ -0,0 +1,210 @@
+// Copyright (C) 2007-2026  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "MEDFileFieldPager.hxx"
+#include "MEDFileField.hxx"
+#include "MEDFileUtilities.hxx"
+
+#include <iterator>
+
+using namespace MEDCoupling;
+
+MEDFileFieldPager *
+MEDFileFieldPager::New(const std::string &fileName, std::size_t maxNbOfBytes, int nbOfTimeStepsToReadAhead)
+{
+    if (fileName.empty())
+        throw INTERP_KERNEL::Exception("MEDFileFieldPager::New : the field does not come from a file !");
+    if (nbOfTimeStepsToReadAhead < 0)
+        throw INTERP_KERNEL::Exception("MEDFileFieldPager::New : the number of time steps to read ahead must be >= 0 !");
+    return new MEDFileFieldPager(fileName, maxNbOfBytes, nbOfTimeStepsToReadAhead);
+}
+
+MEDFileFieldPager::MEDFileFieldPager(
+    const std::string &fileName, std::size_t maxNbOfBytes, int nbOfTimeStepsToReadAhead
+)
+    : _file_name(fileName),
+      _max_nb_of_bytes(maxNbOfBytes),
+      _nb_of_ts_to_read_ahead(nbOfTimeStepsToReadAhead),
+      _nb_of_bytes(0)
+{
+}
+
+std::size_t
+MEDFileFieldPager::getNbOfBytesPagedIn() const
+{
+    std::size_t ret(0);
+    for (const auto &it : _lru)
+    {
+        const DataArray *arr(it.first->getUndergroundDataArray());
+        if (arr && arr->isAllocated())
+            ret += it.second;
+    }
+    return ret;
+}
+
+/*!
+ * Takes into account the time steps of \a content already in memory, the first ones being the most recently used,
+ * and releases the last ones if they exceed the budget.
+ */
+void
+MEDFileFieldPager::registerTimeSteps(MEDFileAnyTypeFieldMultiTSWithoutSDA *content)
+{
+    int nbOfTS(content->getNumberOfTS());
+    for (int pos = 0; pos < nbOfTS; pos++)
+    {
+        const MEDFileAnyTypeField1TSWithoutSDA *ts(
+            const_cast<const MEDFileAnyTypeFieldMultiTSWithoutSDA *>(content)->getTimeStepAtPos2(pos)
+        );
+        DataArray *arr(ts->getUndergroundDataArray());
+        if (arr && arr->isAllocated() && findTimeStep(ts) == _lru.end())
+        {
+            std::size_t sz(arr->getHeapMemorySizeWithoutChildren());
+            _lru.emplace_back(MCAuto<MEDFileAnyTypeField1TSWithoutSDA>::TakeRef(content->getTimeStepAtPos2(pos)), sz);
+            _nb_of_bytes += sz;
+        }
+    }
+    releaseUntilItFits(0);
+}
+
+/*!
+ * Makes sure that the arrays of the time step at \a pos of \a content are in memory, reading them if necessary after
+ * having released the least recently used time steps, then reads the following time steps that fit in the budget.
+ * These ones are ranked just behind the accessed one, in their order, so that they are released after it.
+ */
+void
+MEDFileFieldPager::pageIn(MEDFileAnyTypeFieldMultiTSWithoutSDA *content, int pos)
+{
+    forgetReleasedTimeSteps();
+    std::list<std::pair<MCAuto<MEDFileAnyTypeField1TSWithoutSDA>, std::size_t> >::iterator where(_lru.begin());
+    pageInTimeStep(content, pos, true, where);
+    int nbOfTS(content->getNumberOfTS());
+    for (int i = pos + 1; i <= pos + _nb_of_ts_to_read_ahead && i < nbOfTS; i++)
+        if (!pageInTimeStep(content, i, false, where))
+            break;
+}
+
+std::list<std::pair<MCAuto<MEDFileAnyTypeField1TSWithoutSDA>, std::size_t> >::iterator
+MEDFileFieldPager::findTimeStep(const MEDFileAnyTypeField1TSWithoutSDA *ts)
+{
+    std::list<std::pair<MCAuto<MEDFileAnyTypeField1TSWithoutSDA>, std::size_t> >::iterator it(_lru.begin());
+    for (; it != _lru.end(); it++)
+        if ((const MEDFileAnyTypeField1TSWithoutSDA *)(*it).first == ts)
+            break;
+    return it;
+}
+
+/*!
+ * \param [in] canRelease - if true, the time step is the accessed one : it becomes the most recently used one. If
+ *              false, the time step is read only if it fits in what remains of the budget, and is not moved if it is
+ *              already in memory.
+ * \param [in,out] where - the position before which the time step is put if it is read, updated to the position
+ *              following it. Not used as input if \a canRelease.
+ * \return true if the arrays of the time step are in memory at the end of the call.
+ */
+bool
+MEDFileFieldPager::pageInTimeStep(
+    MEDFileAnyTypeFieldMultiTSWithoutSDA *content,
+    int pos,
+    bool canRelease,
+    std::list<std::pair<MCAuto<MEDFileAnyTypeField1TSWithoutSDA>, std::size_t> >::iterator &where
+)
+{
+    MEDFileAnyTypeField1TSWithoutSDA *ts(content->getTimeStepAtPos2(pos));
+    std::list<std::pair<MCAuto<MEDFileAnyTypeField1TSWithoutSDA>, std::size_t> >::iterator it(findTimeStep(ts));
+    DataArray *arr(ts->getUndergroundDataArray());
+    bool inMemory(arr && arr->isAllocated());
+    if (it != _lru.end())
+    {
+        if (inMemory)
+        {
+            if (canRelease)
+            {
+                _lru.splice(_lru.begin(), _lru, it);
+                where = std::next(_lru.begin());
+            }
+            return true;
+        }
+        // released by the user since the last access
+        if (it == where)
+            where++;
+        _nb_of_bytes -= (*it).second;
+        _lru.erase(it);
+    }
+    if (!inMemory)
+    {
+        ts->allocIfNecessaryTheArrayToReceiveDataFromFile();
+        arr = ts->getUndergroundDataArray();
+    }
+    std::size_t sz(arr->getHeapMemorySizeWithoutChildren());
+    if (canRelease)
+    {
+        releaseUntilItFits(sz);
+        where = _lru.begin();
+    }
+    else if (!inMemory && _nb_of_bytes + sz > _max_nb_of_bytes)
+    {
+        ts->unloadArrays();
+        return false;
+    }
+    if (!inMemory)
+    {
+        try
+        {
+            MEDFileUtilities::AutoFid fid(OpenMEDFileForRead(_file_name));
+            ts->loadBigArraysRecursively(fid, *content);
+        }
+        catch (INTERP_KERNEL::Exception &e)
+        {
+            ts->unloadArrays();
+            throw e;
+        }
+    }
+    _lru.emplace(where, MCAuto<MEDFileAnyTypeField1TSWithoutSDA>::TakeRef(ts), sz);
+    _nb_of_bytes += sz;
+    return true;
+}
+
+//! the time steps released by MEDFileAnyTypeFieldMultiTS::unloadArrays for example no longer count in the budget
+void
+MEDFileFieldPager::forgetReleasedTimeSteps()
+{
+    for (std::list<std::pair<MCAuto<MEDFileAnyTypeField1TSWithoutSDA>, std::size_t> >::iterator it = _lru.begin();
+         it != _lru.end();)
+    {
+        const DataArray *arr((*it).first->getUndergroundDataArray());
+        if (arr && arr->isAllocated())
+            it++;
+        else
+        {
+            _nb_of_bytes -= (*it).second;
+            it = _lru.erase(it);
+        }
+    }
+}
+
+void
+MEDFileFieldPager::releaseUntilItFits(std::size_t nbOfBytes)
+{
+    while (!_lru.empty() && _nb_of_bytes + nbOfBytes > _max_nb_of_bytes)
+    {
+        _lru.back().first->unloadArrays();
+        _nb_of_bytes -= _lru.back().second;
+        _lru.pop_back();
+    }
+}
@@ -0,0 +1,83 @@
+// Copyright (C) 2007-2026  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#ifndef __MEDFILEFIELDPAGER_HXX__
+#define __MEDFILEFIELDPAGER_HXX__
+
+#include "MEDLoaderDefines.hxx"
+
+#include "MCAuto.hxx"
+#include "MEDCouplingRefCountObject.hxx"
+
+#include <list>
+#include <string>
+
+namespace MEDCoupling
+{
+class MEDFileAnyTypeField1TSWithoutSDA;
+class MEDFileAnyTypeFieldMultiTSWithoutSDA;
+
+/*!
+ * Reads on demand the arrays of the time steps of a field coming from a file, and releases the least recently used
+ * ones when the arrays in memory exceed a byte budget. The file is used as the database, as in
+ * MEDFileAnyTypeFieldMultiTS::unloadArraysWithoutDataLoss : a released time step is read again at its next access,
+ * so modifications of its values are lost.
+ *
+ * The \a nbOfTimeStepsToReadAhead time steps following an accessed one are read during the same access, as long as
+ * they fit in what remains of the budget : reading ahead never releases a time step. They are ranked just behind the
+ * accessed one in the least recently used order. All the reads are done on the calling thread, as for the other
+ * accesses to the time steps of the field, so that the paging adds no concurrency to MEDLoader. The read ahead thus
+ * lengthens the access that triggers it, and only saves the openings of the file of the next accesses.
+ */
+class MEDFileFieldPager : public RefCountObjectOnly
+{
+   public:
+    static MEDFileFieldPager *New(const std::string &fileName, std::size_t maxNbOfBytes, int nbOfTimeStepsToReadAhead);
+    std::size_t getMaxNbOfBytes() const { return _max_nb_of_bytes; }
+    int getNbOfTimeStepsToReadAhead() const { return _nb_of_ts_to_read_ahead; }
+    std::size_t getNbOfBytesPagedIn() const;
+    void registerTimeSteps(MEDFileAnyTypeFieldMultiTSWithoutSDA *content);
+    void pageIn(MEDFileAnyTypeFieldMultiTSWithoutSDA *content, int pos);
+
+   private:
+    MEDFileFieldPager(const std::string &fileName, std::size_t maxNbOfBytes, int nbOfTimeStepsToReadAhead);
+    ~MEDFileFieldPager() {}
+    std::list<std::pair<MCAuto<MEDFileAnyTypeField1TSWithoutSDA>, std::size_t> >::iterator findTimeStep(
+        const MEDFileAnyTypeField1TSWithoutSDA *ts
+    );
+    bool pageInTimeStep(
+        MEDFileAnyTypeFieldMultiTSWithoutSDA *content,
+        int pos,
+        bool canRelease,
+        std::list<std::pair<MCAuto<MEDFileAnyTypeField1TSWithoutSDA>, std::size_t> >::iterator &where
+    );
+    void forgetReleasedTimeSteps();
+    void releaseUntilItFits(std::size_t nbOfBytes);
+
+   private:
+    std::string _file_name;
+    std::size_t _max_nb_of_bytes;
+    int _nb_of_ts_to_read_ahead;
+    //! the time steps in memory, the most recently used first, with the size of their array
+    std::list<std::pair<MCAuto<MEDFileAnyTypeField1TSWithoutSDA>, std::size_t> > _lru;
+    std::size_t _nb_of_bytes;
+};
+}  // namespace MEDCoupling
+
+#endif
@@ -50,6 +50,27 @@ class MEDFileFieldVisitor
     virtual void newPerMeshPerTypePerDisc(const MEDFileFieldPerMeshPerTypePerDisc *pmptpd) = 0;
     virtual ~MEDFileFieldVisitor() {}
 };
+
+/// @cond INTERNAL
+//! gathers, without duplicates, the profiles computed at the read of a part of the mesh
+class MEDFileFieldPflsOnPartCollector : public MEDFileFieldVisitor
+{
+   public:
+    void newFieldEntry(const MEDFileAnyTypeFieldMultiTSWithoutSDA *field) override {}
+    void endFieldEntry(const MEDFileAnyTypeFieldMultiTSWithoutSDA *field) override {}
+    void newTimeStepEntry(const MEDFileAnyTypeField1TSWithoutSDA *ts) override {}
+    void endTimeStepEntry(const MEDFileAnyTypeField1TSWithoutSDA *ts) override {}
+    void newMeshEntry(const MEDFileFieldPerMesh *fpm) override {}
+    void endMeshEntry(const MEDFileFieldPerMesh *fpm) override {}
+    void newPerMeshPerTypeEntry(const MEDFileFieldPerMeshPerTypeCommon *pmpt) override {}
+    void endPerMeshPerTypeEntry(const MEDFileFieldPerMeshPerTypeCommon *pmpt) override {}
+    void newPerMeshPerTypePerDisc(const MEDFileFieldPerMeshPerTypePerDisc *pmptpd) override;
+    const std::vector<const DataArrayIdType *> &getProfiles() const { return _pfls; }
+
+   private:
+    std::vector<const DataArrayIdType *> _pfls;
+};
+/// @endcond INTERNAL
 }  // namespace MEDCoupling
 
 #endif
@@ -120,7 +120,7 @@ MEDFileJointCorrespondence::write(
 ) const
 {
     med_access_mode medmod = MEDFileUtilities::TraduceWriteMode(mode);
-    MEDFileUtilities::AutoFid fid = MEDfileOpen(fileName.c_str(), medmod);
+    MEDFileUtilities::AutoFid fid(MEDFileUtilities::OpenMEDFile(fileName, medmod));
 
     std::ostringstream oss;
     oss << "MEDFileJointCorrespondence : error on attempt to write in file : \"" << fileName << "\"";
@@ -292,7 +292,7 @@ MEDFileJointOneStep *
 MEDFileJointOneStep::New(const std::string &fileName, const std::string &mName, const std::string &jointName, int num)
 {
     MEDFileUtilities::CheckFileForRead(fileName);
-    MEDFileUtilities::AutoFid fid = MEDfileOpen(fileName.c_str(), MED_ACC_RDONLY);
+    MEDFileUtilities::AutoFid fid(MEDFileUtilities::OpenMEDFile(fileName, MED_ACC_RDONLY));
     return new MEDFileJointOneStep(fid, mName, jointName, num);
 }
 
@@ -373,7 +373,7 @@ MEDFileJointOneStep::write(
 ) const
 {
     med_access_mode medmod = MEDFileUtilities::TraduceWriteMode(mode);
-    MEDFileUtilities::AutoFid fid = MEDfileOpen(fileName.c_str(), medmod);
+    MEDFileUtilities::AutoFid fid(MEDFileUtilities::OpenMEDFile(fileName, medmod));
     std::ostringstream oss;
     oss << "MEDFileJointOneStep : error on attempt to write in file : \"" << fileName << "\"";
     MEDFileUtilities::CheckMEDCode((int)fid, fid, oss.str());
@@ -545,7 +545,7 @@ MEDFileJoint *
 MEDFileJoint::New(const std::string &fileName, const std::string &mName, int curJoint)
 {
     MEDFileUtilities::CheckFileForRead(fileName);
-    MEDFileUtilities::AutoFid fid = MEDfileOpen(fileName.c_str(), MED_ACC_RDONLY);
+    MEDFileUtilities::AutoFid fid(MEDFileUtilities::OpenMEDFile(fileName, MED_ACC_RDONLY));
     return new MEDFileJoint(fid, mName, curJoint);
 }
 
@@ -764,7 +764,7 @@ MEDFileJoints *
 MEDFileJoints::New(const std::string &fileName, const std::string &meshName)
 {
     MEDFileUtilities::CheckFileForRead(fileName);
-    MEDFileUtilities::AutoFid fid = MEDfileOpen(fileName.c_str(), MED_ACC_RDONLY);
+    MEDFileUtilities::AutoFid fid(MEDFileUtilities::OpenMEDFile(fileName, MED_ACC_RDONLY));
     return new MEDFileJoints(fid, meshName);
 }
 
@@ -2831,7 +2831,7 @@ MEDFileUMesh::LoadConnectivityOnlyPartOf(
 )
 {
     MEDFileUtilities::CheckFileForRead(fileName);
-    MEDFileUtilities::AutoFid fid(MEDfileOpen(fileName.c_str(), MED_ACC_RDONLY));
+    MEDFileUtilities::AutoFid fid(MEDFileUtilities::OpenMEDFile(fileName, MED_ACC_RDONLY));
     return MEDFileUMesh::LoadConnectivityOnlyPartOf(fid, mName, types, slicPerTyp, dt, it, mrs);
 }
 
@@ -2868,7 +2868,7 @@ MEDFileUMesh::LoadPartOf(
 )
 {
     MEDFileUtilities::CheckFileForRead(fileName);
-    MEDFileUtilities::AutoFid fid(MEDfileOpen(fileName.c_str(), MED_ACC_RDONLY));
+    MEDFileUtilities::AutoFid fid(MEDFileUtilities::OpenMEDFile(fileName, MED_ACC_RDONLY));
     return MEDFileUMesh::LoadPartOf(fid, mName, types, slicPerTyp, dt, it, mrs);
 }
 
@@ -3030,6 +3030,20 @@ MEDFileUMesh::shallowCpy() const
     return ret.retn();
 }
 
+/*!
+ * Returns a copy of \a this sharing its arrays with \a this. Unlike shallowCpy, the levels are not shared : the arrays
+ * of the levels of \a this can be replaced without changing the copy.
+ */
+MEDFileUMesh *
+MEDFileUMesh::deepCpyStructure() const
+{
+    MCAuto<MEDFileUMesh> ret(shallowCpy());
+    for (std::vector<MCAuto<MEDFileUMeshSplitL1>>::iterator it = ret->_ms.begin(); it != ret->_ms.end(); it++)
+        if ((const MEDFileUMeshSplitL1 *)(*it))
+            *it = (*it)->shallowCpyUsingCoords(ret->_coords);
+    return ret.retn();
+}
+
 MEDFileMesh *
 MEDFileUMesh::createNewEmpty() const
 {
@@ -3497,6 +3511,16 @@ MEDFileMesh::loadEquivalences(med_idt fid)
         _equiv = MEDFileEquivalences::Load(fid, nbOfEq, this);
 }
 
+/*!
+ * Returns a copy of \a this sharing its arrays with \a this. The arrays of \a this are to be replaced, and not
+ * modified, as long as the copy is in use.
+ */
+MEDFileMesh *
+MEDFileMesh::deepCpyStructure() const
+{
+    return shallowCpy();
+}
+
 void
 MEDFileMesh::deepCpyEquivalences(const MEDFileMesh &other)
 {
@@ -8933,6 +8957,21 @@ MEDFileMeshMultiTS::deepCopy() const
     return ret.retn();
 }
 
+//! the arrays of the meshes of the time steps are shared
+MEDFileMeshMultiTS *
+MEDFileMeshMultiTS::deepCpyStructure() const
+{
+    MCAuto<MEDFileMeshMultiTS> ret(MEDFileMeshMultiTS::New());
+    std::vector<MCAuto<MEDFileMesh>> meshOneTs(_mesh_one_ts.size());
+    std::size_t i(0);
+    for (std::vector<MCAuto<MEDFileMesh>>::const_iterator it = _mesh_one_ts.begin(); it != _mesh_one_ts.end();
+         it++, i++)
+        if ((const MEDFileMesh *)*it)
+            meshOneTs[i] = (*it)->deepCpyStructure();
+    ret->_mesh_one_ts = meshOneTs;
+    return ret.retn();
+}
+
 std::size_t
 MEDFileMeshMultiTS::getHeapMemorySizeWithoutChildren() const
 {
@@ -9320,6 +9359,20 @@ MEDFileMeshes::deepCopy() const
     return ret.retn();
 }
 
+//! the meshes are shallow copied : meshes can be added to or removed from \a this without changing the result
+MEDFileMeshes *
+MEDFileMeshes::deepCpyStructure() const
+{
+    std::vector<MCAuto<MEDFileMeshMultiTS>> meshes(_meshes.size());
+    std::size_t i = 0;
+    for (std::vector<MCAuto<MEDFileMeshMultiTS>>::const_iterator it = _meshes.begin(); it != _meshes.end(); it++, i++)
+        if ((const MEDFileMeshMultiTS *)*it)
+            meshes[i] = (*it)->deepCpyStructure();
+    MCAuto<MEDFileMeshes> ret(MEDFileMeshes::New());
+    ret->_meshes = meshes;
+    return ret.retn();
+}
+
 std::size_t
 MEDFileMeshes::getHeapMemorySizeWithoutChildren() const
 {
@@ -67,6 +67,7 @@ class MEDFileMesh : public RefCountObject, public MEDFileWritableStandAlone
     MEDLOADER_EXPORT virtual MEDFileMesh *createNewEmpty() const = 0;
     MEDLOADER_EXPORT virtual MEDFileMesh *deepCopy() const = 0;
     MEDLOADER_EXPORT virtual MEDFileMesh *shallowCpy() const = 0;
+    MEDLOADER_EXPORT virtual MEDFileMesh *deepCpyStructure() const;
     MEDLOADER_EXPORT virtual bool isEqual(const MEDFileMesh *other, double eps, std::string &what) const;
     MEDLOADER_EXPORT virtual void clearNonDiscrAttributes() const;
     MEDLOADER_EXPORT virtual void setName(const std::string &name);
@@ -413,6 +414,7 @@ class MEDFileUMesh : public MEDFileMesh
     MEDLOADER_EXPORT MEDFileMesh *createNewEmpty() const;
     MEDLOADER_EXPORT MEDFileUMesh *deepCopy() const;
     MEDLOADER_EXPORT MEDFileUMesh *shallowCpy() const;
+    MEDLOADER_EXPORT MEDFileUMesh *deepCpyStructure() const;
     MEDLOADER_EXPORT bool isEqual(const MEDFileMesh *other, double eps, std::string &what) const;
     MEDLOADER_EXPORT void checkConsistency() const;
     MEDLOADER_EXPORT void checkSMESHConsistency() const;
@@ -852,6 +854,7 @@ class MEDFileMeshMultiTS : public RefCountObject, public MEDFileWritableStandAlo
     MEDLOADER_EXPORT static MEDFileMeshMultiTS *New(const std::string &fileName, const std::string &mName);
     MEDLOADER_EXPORT std::string getClassName() const override { return std::string("MEDFileMeshMultiTS"); }
     MEDLOADER_EXPORT MEDFileMeshMultiTS *deepCopy() const;
+    MEDLOADER_EXPORT MEDFileMeshMultiTS *deepCpyStructure() const;
     MEDLOADER_EXPORT std::size_t getHeapMemorySizeWithoutChildren() const;
     MEDLOADER_EXPORT std::vector<const BigMemoryObject *> getDirectChildrenWithNull() const;
     MEDLOADER_EXPORT std::string getName() const;
@@ -888,6 +891,7 @@ class MEDFileMeshes : public RefCountObject, public MEDFileWritableStandAlone
     MEDLOADER_EXPORT static MEDFileMeshes *New(const std::string &fileName);
     MEDLOADER_EXPORT std::string getClassName() const override { return std::string("MEDFileMeshes"); }
     MEDLOADER_EXPORT MEDFileMeshes *deepCopy() const;
+    MEDLOADER_EXPORT MEDFileMeshes *deepCpyStructure() const;
     MEDLOADER_EXPORT std::size_t getHeapMemorySizeWithoutChildren() const;
     MEDLOADER_EXPORT std::vector<const BigMemoryObject *> getDirectChildrenWithNull() const;
     MEDLOADER_EXPORT std::string simpleRepr() const;
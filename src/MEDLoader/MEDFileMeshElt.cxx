@@ -32,12 +32,46 @@
 #include "MEDFilterEntity.hxx"
 
 #include <iostream>
+#include <iterator>
 
 // From MEDLOader.cxx TU
 extern med_geometry_type typmai3[INTERP_KERNEL::NORM_MAXTYPE];
 
 using namespace MEDCoupling;
 
+namespace
+{
+/*!
+ * Gives where the 1-based ids of type med_int of a connectivity have to be read from the file to end up in \a arr.
+ * It is the storage of \a arr itself if med_int and mcIdType have the same width, to avoid a copy of the array.
+ */
+class MEDFileConnectivityReader
+{
+   public:
+    MEDFileConnectivityReader(DataArrayIdType *arr) : _arr(arr)
+    {
+        if (sizeof(med_int) != sizeof(mcIdType))
+            _tmp = new med_int[arr->getNbOfElems()];
+    }
+    med_int *getPointer()
+    {
+        return _tmp.isNotNull() ? (med_int *)_tmp : reinterpret_cast<med_int *>(_arr->getPointer());
+    }
+    //! converts the ids read into 0-based ones, in the same pass as the change of width if any
+    void toZeroBased()
+    {
+        const med_int *src(getPointer());
+        mcIdType *pt(_arr->getPointer());
+        std::size_t nbOfElems(_arr->getNbOfElems());
+        for (std::size_t i = 0; i < nbOfElems; i++) pt[i] = (mcIdType)src[i] - 1;
+    }
+
+   private:
+    DataArrayIdType *_arr;
+    INTERP_KERNEL::AutoPtr<med_int> _tmp;
+};
+}  // namespace
+
 MEDFileUMeshPerTypeCommon *
 MEDFileUMeshPerTypeCommon::New()
 {
@@ -353,17 +387,16 @@ MEDFileUMeshPerType::loadFromStaticType(
 {
     _m = MEDCoupling1SGTUMesh::New(mName, type);
     MEDCoupling1SGTUMesh *mc(dynamic_cast<MEDCoupling1SGTUMesh *>((MEDCoupling1GTUMesh *)_m));
-    MCAuto<DataArrayMedInt> conn(DataArrayMedInt::New());
+    MCAuto<DataArrayIdType> conn(DataArrayIdType::New());
     mcIdType nbOfNodesPerCell(mc->getNumberOfNodesPerCell());
     conn->alloc(nbOfNodesPerCell * curNbOfElem, 1);
+    MEDFileConnectivityReader connReader(conn);
     MEDFILESAFECALLERRD0(
         MEDmeshElementConnectivityRd,
-        (fid, mName, dt, it, entity, geoElt, MED_NODAL, MED_FULL_INTERLACE, conn->getPointer())
-    );
-    std::transform(
-        conn->begin(), conn->end(), conn->getPointer(), std::bind(std::plus<med_int>(), std::placeholders::_1, -1)
+        (fid, mName, dt, it, entity, geoElt, MED_NODAL, MED_FULL_INTERLACE, connReader.getPointer())
     );
-    mc->setNodalConnectivity(FromMedIntArray<mcIdType>(conn));
+    connReader.toZeroBased();
+    mc->setNodalConnectivity(conn);
     loadCommonPart(fid, mName, dt, it, curNbOfElem, geoElt, entity, mrs);
 }
 
@@ -383,12 +416,13 @@ MEDFileUMeshPerType::loadPartStaticType(
 {
     _m = MEDCoupling1SGTUMesh::New(mName, type);
     MEDCoupling1SGTUMesh *mc(dynamic_cast<MEDCoupling1SGTUMesh *>((MEDCoupling1GTUMesh *)_m));
-    MCAuto<DataArrayMedInt> conn(DataArrayMedInt::New());
+    MCAuto<DataArrayIdType> conn(DataArrayIdType::New());
     mcIdType nbOfNodesPerCell(mc->getNumberOfNodesPerCell());
     if (!_pd)
         throw INTERP_KERNEL::Exception("MEDFileUMeshPerType::loadPartStaticType : no part definition !");
     mcIdType nbOfEltsToLoad(_pd->getNumberOfElems());
     conn->alloc(nbOfNodesPerCell * nbOfEltsToLoad, 1);
+    MEDFileConnectivityReader connReader(conn);
     {
         MEDFilterEntity filter;
         filter.fill(
@@ -404,13 +438,11 @@ MEDFileUMeshPerType::loadPartStaticType(
         );
         MEDFILESAFECALLERRD0(
             MEDmeshElementConnectivityAdvancedRd,
-            (fid, mName, dt, it, entity, geoElt, MED_NODAL, filter.getPtr(), conn->getPointer())
+            (fid, mName, dt, it, entity, geoElt, MED_NODAL, filter.getPtr(), connReader.getPointer())
         );
     }
-    std::transform(
-        conn->begin(), conn->end(), conn->getPointer(), std::bind(std::plus<med_int>(), std::placeholders::_1, -1)
-    );
-    mc->setNodalConnectivity(FromMedIntArray<mcIdType>(conn));
+    connReader.toZeroBased();
+    mc->setNodalConnectivity(conn);
     loadPartOfCellCommonPart(fid, mName, dt, it, mdim, curNbOfElem, geoElt, entity, mrs);
 }
 
@@ -536,19 +568,17 @@ MEDFileUMeshPerType::loadPolyg(
         mName, geoElt == MED_POLYGON ? INTERP_KERNEL::NORM_POLYGON : INTERP_KERNEL::NORM_QPOLYG
     );
     MCAuto<MEDCoupling1DGTUMesh> mc(DynamicCast<MEDCoupling1GTUMesh, MEDCoupling1DGTUMesh>(_m));
-    MCAuto<DataArrayMedInt> conn(DataArrayMedInt::New()), connI(DataArrayMedInt::New());
+    MCAuto<DataArrayIdType> conn(DataArrayIdType::New()), connI(DataArrayIdType::New());
     conn->alloc(arraySize, 1);
     connI->alloc(curNbOfElem + 1, 1);
+    MEDFileConnectivityReader connReader(conn), connIReader(connI);
     MEDFILESAFECALLERRD0(
-        MEDmeshPolygon2Rd, (fid, mName, dt, it, MED_CELL, geoElt, MED_NODAL, connI->getPointer(), conn->getPointer())
-    );
-    std::transform(
-        conn->begin(), conn->end(), conn->getPointer(), std::bind(std::plus<med_int>(), std::placeholders::_1, -1)
+        MEDmeshPolygon2Rd,
+        (fid, mName, dt, it, MED_CELL, geoElt, MED_NODAL, connIReader.getPointer(), connReader.getPointer())
     );
-    std::transform(
-        connI->begin(), connI->end(), connI->getPointer(), std::bind(std::plus<med_int>(), std::placeholders::_1, -1)
-    );
-    mc->setNodalConnectivity(FromMedIntArray<mcIdType>(conn), FromMedIntArray<mcIdType>(connI));
+    connReader.toZeroBased();
+    connIReader.toZeroBased();
+    mc->setNodalConnectivity(conn, connI);
     loadCommonPart(fid, mName, dt, it, curNbOfElem, geoElt, entity, mrs);
 }
 
@@ -577,40 +607,38 @@ MEDFileUMeshPerType::loadPolyh(
     );
     _m = MEDCoupling1DGTUMesh::New(mName, INTERP_KERNEL::NORM_POLYHED);
     MCAuto<MEDCoupling1DGTUMesh> mc(DynamicCastSafe<MEDCoupling1GTUMesh, MEDCoupling1DGTUMesh>(_m));
-    INTERP_KERNEL::AutoPtr<med_int> index = new med_int[curNbOfElem + 1];
-    INTERP_KERNEL::AutoPtr<med_int> indexFace = new med_int[indexFaceLgth];
-    INTERP_KERNEL::AutoPtr<med_int> locConn = new med_int[connFaceLgth];
-    MEDFILESAFECALLERRD0(MEDmeshPolyhedronRd, (fid, mName, dt, it, MED_CELL, MED_NODAL, index, indexFace, locConn));
+    // the final connectivity holds the nodes of the faces separated by -1 between the faces of a same cell
+    mcIdType nbOfSeparators(indexFaceLgth - 1 - curNbOfElem), arraySize(connFaceLgth + nbOfSeparators);
     MCAuto<DataArrayIdType> conn(DataArrayIdType::New()), connI(DataArrayIdType::New());
-    mcIdType arraySize = connFaceLgth;
-    for (mcIdType i = 0; i < curNbOfElem; i++) arraySize += index[i + 1] - index[i] - 1;
-    conn = DataArrayIdType::New();
     conn->alloc(arraySize, 1);
-    mcIdType *wFinalConn = conn->getPointer();
     connI->alloc(curNbOfElem + 1, 1);
-    mcIdType *finalIndex(connI->getPointer());
-    finalIndex[0] = 0;
+    mcIdType *finalConn(conn->getPointer()), *finalIndex(connI->getPointer());
+    // if the widths match, the cell index is read in the final index and the nodes of the faces at the end of the final
+    // connectivity. Both are then overwritten, from the beginning, never beyond what has been consumed.
+    INTERP_KERNEL::AutoPtr<med_int> indexFace(new med_int[indexFaceLgth]), indexTmp, locConnTmp;
+    med_int *index(reinterpret_cast<med_int *>(finalIndex));
+    med_int *locConn(reinterpret_cast<med_int *>(finalConn + nbOfSeparators));
+    if (sizeof(med_int) != sizeof(mcIdType))
+    {
+        indexTmp = new med_int[curNbOfElem + 1];
+        locConnTmp = new med_int[connFaceLgth];
+        index = indexTmp;
+        locConn = locConnTmp;
+    }
+    MEDFILESAFECALLERRD0(MEDmeshPolyhedronRd, (fid, mName, dt, it, MED_CELL, MED_NODAL, index, indexFace, locConn));
+    mcIdType *wFinalConn(finalConn);
     for (mcIdType i = 0; i < curNbOfElem; i++)
     {
-        finalIndex[i + 1] =
-            finalIndex[i] + index[i + 1] - index[i] - 1 + indexFace[index[i + 1] - 1] - indexFace[index[i] - 1];
-        wFinalConn = std::transform(
-            locConn + indexFace[index[i] - 1] - 1,
-            locConn + indexFace[index[i]] - 1,
-            wFinalConn,
-            std::bind(std::plus<mcIdType>(), std::placeholders::_1, -1)
-        );
-        for (mcIdType j = index[i]; j < index[i + 1] - 1; j++)
+        med_int startFace(index[i] - 1), endFace(index[i + 1] - 1);
+        finalIndex[i] = std::distance(finalConn, wFinalConn);
+        for (med_int j = startFace; j < endFace; j++)
         {
-            *wFinalConn++ = -1;
-            wFinalConn = std::transform(
-                locConn + indexFace[j] - 1,
-                locConn + indexFace[j + 1] - 1,
-                wFinalConn,
-                std::bind(std::plus<mcIdType>(), std::placeholders::_1, -1)
-            );
+            if (j != startFace)
+                *wFinalConn++ = -1;
+            for (med_int k = indexFace[j] - 1; k < indexFace[j + 1] - 1; k++) *wFinalConn++ = (mcIdType)locConn[k] - 1;
         }
     }
+    finalIndex[curNbOfElem] = std::distance(finalConn, wFinalConn);
     mc->setNodalConnectivity(conn, connI);
     loadCommonPart(fid, mName, dt, it, curNbOfElem, MED_POLYHEDRON, entity, mrs);
 }
@@ -280,7 +280,7 @@ MEDFileParameterDouble1TS::MEDFileParameterDouble1TS(
 )
 {
     MEDFileUtilities::CheckFileForRead(fileName);
-    MEDFileUtilities::AutoFid fid = MEDfileOpen(fileName.c_str(), MED_ACC_RDONLY);
+    MEDFileUtilities::AutoFid fid(MEDFileUtilities::OpenMEDFile(fileName, MED_ACC_RDONLY));
     med_int nbPar = MEDnParameter(fid);
     std::ostringstream oss;
     oss << "MEDFileParameterDouble1TS : no double param name \"" << paramName
@@ -315,7 +315,7 @@ MEDFileParameterDouble1TS::MEDFileParameterDouble1TS(
 MEDFileParameterDouble1TS::MEDFileParameterDouble1TS(const std::string &fileName, const std::string &paramName)
 {
     MEDFileUtilities::CheckFileForRead(fileName);
-    MEDFileUtilities::AutoFid fid = MEDfileOpen(fileName.c_str(), MED_ACC_RDONLY);
+    MEDFileUtilities::AutoFid fid(MEDFileUtilities::OpenMEDFile(fileName, MED_ACC_RDONLY));
     med_int nbPar = MEDnParameter(fid);
     std::ostringstream oss;
     oss << "MEDFileParameterDouble1TS : no double param name \"" << paramName
@@ -359,7 +359,7 @@ MEDFileParameterDouble1TS::MEDFileParameterDouble1TS(const std::string &fileName
 MEDFileParameterDouble1TS::MEDFileParameterDouble1TS(const std::string &fileName)
 {
     MEDFileUtilities::CheckFileForRead(fileName);
-    MEDFileUtilities::AutoFid fid = MEDfileOpen(fileName.c_str(), MED_ACC_RDONLY);
+    MEDFileUtilities::AutoFid fid(MEDFileUtilities::OpenMEDFile(fileName, MED_ACC_RDONLY));
     med_int nbPar = MEDnParameter(fid);
     if (nbPar < 1)
     {
@@ -447,7 +447,7 @@ void
 MEDFileParameterDouble1TS::write(const std::string &fileName, int mode) const
 {
     med_access_mode medmod = MEDFileUtilities::TraduceWriteMode(mode);
-    MEDFileUtilities::AutoFid fid = MEDfileOpen(fileName.c_str(), medmod);
+    MEDFileUtilities::AutoFid fid(MEDFileUtilities::OpenMEDFile(fileName, medmod));
     MEDFileParameterTinyInfo::writeLLHeader(fid, MED_FLOAT64);
     MEDFileParameterDouble1TSWTI::writeAdvanced(fid, _name, *this);
 }
@@ -649,7 +649,7 @@ void
 MEDFileParameterMultiTS::write(const std::string &fileName, int mode) const
 {
     med_access_mode medmod = MEDFileUtilities::TraduceWriteMode(mode);
-    MEDFileUtilities::AutoFid fid = MEDfileOpen(fileName.c_str(), medmod);
+    MEDFileUtilities::AutoFid fid(MEDFileUtilities::OpenMEDFile(fileName, medmod));
     writeAdvanced(fid, *this);
 }
 
@@ -92,7 +92,7 @@ MEDFileUtilities::CheckFileForRead(const std::string &fileName)
             throw INTERP_KERNEL::Exception(oss.str().c_str());
         }
     }
-    AutoFid fid = MEDfileOpen(fileName.c_str(), MED_ACC_RDONLY);
+    AutoFid fid(OpenMEDFile(fileName, MED_ACC_RDONLY));
     if (fid < 0)
     {
         oss << " has been detected as unreadable by MED file : impossible to read anything !";
@@ -108,9 +108,45 @@ MEDFileUtilities::CheckFileForRead(const std::string &fileName)
     }
 }
 
+/*!
+ * The MED file library is not thread safe : all the files of MEDLoader are opened and closed under this mutex, so that
+ * the accesses to MED file of several threads, like the one of MEDFileAsyncWriter, are serialized.
+ */
+std::recursive_mutex &
+MEDFileUtilities::MEDFileAccessMutex()
+{
+    static std::recursive_mutex mutex;
+    return mutex;
+}
+
 MEDFileUtilities::AutoFid::AutoFid(med_idt fid) : _fid(fid) {}
 
-MEDFileUtilities::AutoFid::~AutoFid() { MEDfileClose(_fid); }
+//! \a lock is a lock on MEDFileAccessMutex taken before the opening of \a fid
+MEDFileUtilities::AutoFid::AutoFid(med_idt fid, std::unique_lock<std::recursive_mutex> &&lock)
+    : _fid(fid), _lock(std::move(lock))
+{
+}
+
+MEDFileUtilities::AutoFid::AutoFid(AutoFid &&other) : _fid(other._fid), _lock(std::move(other._lock))
+{
+    other._fid = -1;
+}
+
+MEDFileUtilities::AutoFid::~AutoFid()
+{
+    if (_fid >= 0)
+        MEDfileClose(_fid);
+}
+
+/*!
+ * Opens \a fileName with MEDfileOpen under MEDFileAccessMutex, which is held until the returned instance is destroyed.
+ */
+MEDFileUtilities::AutoFid
+MEDFileUtilities::OpenMEDFile(const std::string &fileName, med_access_mode mode)
+{
+    std::unique_lock<std::recursive_mutex> lock(MEDFileAccessMutex());
+    return AutoFid(MEDfileOpen(fileName.c_str(), mode), std::move(lock));
+}
 
 MEDCoupling::MEDFileWritable::MEDFileWritable() : _too_long_str(0), _zipconn_pol(2) {}
 
@@ -165,7 +201,7 @@ MEDFileUtilities::AutoFid
 MEDCoupling::OpenMEDFileForRead(const std::string &fileName)
 {
     MEDFileUtilities::CheckFileForRead(fileName);
-    return MEDFileUtilities::AutoFid(MEDfileOpen(fileName.c_str(), MED_ACC_RDONLY));
+    return MEDFileUtilities::OpenMEDFile(fileName, MED_ACC_RDONLY);
 }
 
 /*!
@@ -182,7 +218,7 @@ void
 MEDCoupling::MEDFileWritableStandAlone::write(const std::string &fileName, int mode) const
 {
     med_access_mode medmod(MEDFileUtilities::TraduceWriteMode(mode));
-    MEDFileUtilities::AutoFid fid(MEDfileOpen(fileName.c_str(), medmod));
+    MEDFileUtilities::AutoFid fid(MEDFileUtilities::OpenMEDFile(fileName, medmod));
     std::ostringstream oss;
     oss << "MEDFileWritableStandAlone : error on attempt to write in file : \"" << fileName << "\"";
     MEDFileUtilities::CheckMEDCode((int)fid, fid, oss.str());
@@ -218,7 +254,8 @@ MEDCoupling::MEDFileWritableStandAlone::writeXX(const std::string &fileName, int
 {
 #if (MED_NUM_MAJEUR > 4 || (MED_NUM_MAJEUR == 4 && MED_NUM_MINEUR >= 1))
     med_access_mode medmod(MEDFileUtilities::TraduceWriteMode(mode));
-    MEDFileUtilities::AutoFid fid(MEDfileVersionOpen(fileName.c_str(), medmod, maj, min, rel));
+    std::unique_lock<std::recursive_mutex> lock(MEDFileUtilities::MEDFileAccessMutex());
+    MEDFileUtilities::AutoFid fid(MEDfileVersionOpen(fileName.c_str(), medmod, maj, min, rel), std::move(lock));
     writeLL(fid);
 #else
     std::ostringstream oss;
@@ -238,7 +275,10 @@ MEDCoupling::MEDFileWritableStandAlone::serialize() const
     std::string dftFileName(GenerateUniqueDftFileNameInMem());
     {  // very important to let this braces ! The AutoFid destructor must be called, to have a "clean"
        // memfile.app_image_ptr pointer embedded in the returned object.
-        MEDFileUtilities::AutoFid fid(MEDmemFileOpen(dftFileName.c_str(), &memfile, MED_FALSE, MED_ACC_CREAT));
+        std::unique_lock<std::recursive_mutex> lock(MEDFileUtilities::MEDFileAccessMutex());
+        MEDFileUtilities::AutoFid fid(
+            MEDmemFileOpen(dftFileName.c_str(), &memfile, MED_FALSE, MED_ACC_CREAT), std::move(lock)
+        );
         writeLL(fid);
     }
     //
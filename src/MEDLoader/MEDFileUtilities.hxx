@@ -29,6 +29,9 @@
 
 #include "med.h"
 
+#include <mutex>
+#include <string>
+
 namespace MEDCoupling
 {
 class MEDFileWritable;
@@ -57,16 +60,26 @@ WrapperOf_MEDfieldQuantityKindRd(
     med_idt fid, const std::string &fieldName, MEDCoupling::MCAuto<MEDCoupling::QuantityKindAbstract> &qk
 );
 
+MEDLOADER_EXPORT std::recursive_mutex &
+MEDFileAccessMutex();
+
 class MEDLOADER_EXPORT AutoFid
 {
    public:
     AutoFid(med_idt fid);
+    AutoFid(med_idt fid, std::unique_lock<std::recursive_mutex> &&lock);
+    AutoFid(AutoFid &&other);
     operator med_idt() const { return _fid; }
     ~AutoFid();
 
    private:
     med_idt _fid;
+    //! when owned, the lock on MEDFileAccessMutex taken before the opening of the file, released after its closing
+    std::unique_lock<std::recursive_mutex> _lock;
 };
+
+MEDLOADER_EXPORT AutoFid
+OpenMEDFile(const std::string &fileName, med_access_mode mode);
 }  // namespace MEDFileUtilities
 
 namespace MEDCoupling
@@ -34,7 +34,10 @@ MEDCoupling::MEDFileWritableStandAlone::BuildFromMemoryChunk(MEDCoupling::DataAr
     memfile.app_image_ptr = db->getPointer();
     memfile.app_image_size = db->getNbOfElems();
     std::string dftFileName(MEDCoupling::MEDFileWritableStandAlone::GenerateUniqueDftFileNameInMem());
-    MEDFileUtilities::AutoFid fid(MEDmemFileOpen(dftFileName.c_str(), &memfile, MED_FALSE, MED_ACC_RDWR));
+    std::unique_lock<std::recursive_mutex> lock(MEDFileUtilities::MEDFileAccessMutex());
+    MEDFileUtilities::AutoFid fid(
+        MEDmemFileOpen(dftFileName.c_str(), &memfile, MED_FALSE, MED_ACC_RDWR), std::move(lock)
+    );
     return T::New(fid);
 }
 
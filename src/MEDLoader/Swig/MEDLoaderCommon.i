@@ -34,6 +34,7 @@
 #include "MEDFileField.hxx"
 #include "MEDFileParameter.hxx"
 #include "MEDFileData.hxx"
+#include "MEDFileAsyncWriter.hxx"
 #include "MEDFileEquivalence.hxx"
 #include "MEDFileEntities.hxx"
 #include "MEDFileMeshReadSelector.hxx"
@@ -180,6 +181,7 @@ using namespace MEDCoupling;
 %newobject MEDCoupling::MEDFileAnyTypeFieldMultiTS::getQuantityKind;
 %newobject MEDCoupling::MEDFileFieldMultiTS::New;
 %newobject MEDCoupling::MEDFileFieldMultiTS::LoadSpecificEntities;
+%newobject MEDCoupling::MEDFileFieldMultiTS::LoadPartOf;
 %newobject MEDCoupling::MEDFileFieldMultiTS::field;
 %newobject MEDCoupling::MEDFileFieldMultiTS::getFieldAtLevel;
 %newobject MEDCoupling::MEDFileFieldMultiTS::getFieldAtTopLevel;
@@ -192,6 +194,7 @@ using namespace MEDCoupling;
 %newobject MEDCoupling::MEDFileInt32FieldMultiTS::New;
 %newobject MEDCoupling::MEDFileInt32FieldMultiTS::field;
 %newobject MEDCoupling::MEDFileInt32FieldMultiTS::LoadSpecificEntities;
+%newobject MEDCoupling::MEDFileInt32FieldMultiTS::LoadPartOf;
 %newobject MEDCoupling::MEDFileInt32FieldMultiTS::getUndergroundDataArray;
 %newobject MEDCoupling::MEDFileInt32FieldMultiTS::convertToDouble;
 %newobject MEDCoupling::MEDFileInt32FieldMultiTS::getFieldAtLevel;
@@ -202,6 +205,7 @@ using namespace MEDCoupling;
 %newobject MEDCoupling::MEDFileInt64FieldMultiTS::New;
 %newobject MEDCoupling::MEDFileInt64FieldMultiTS::field;
 %newobject MEDCoupling::MEDFileInt64FieldMultiTS::LoadSpecificEntities;
+%newobject MEDCoupling::MEDFileInt64FieldMultiTS::LoadPartOf;
 %newobject MEDCoupling::MEDFileInt64FieldMultiTS::getUndergroundDataArray;
 %newobject MEDCoupling::MEDFileInt64FieldMultiTS::convertToDouble;
 %newobject MEDCoupling::MEDFileInt64FieldMultiTS::getFieldAtLevel;
@@ -212,6 +216,7 @@ using namespace MEDCoupling;
 %newobject MEDCoupling::MEDFileFloatFieldMultiTS::New;
 %newobject MEDCoupling::MEDFileFloatFieldMultiTS::field;
 %newobject MEDCoupling::MEDFileFloatFieldMultiTS::LoadSpecificEntities;
+%newobject MEDCoupling::MEDFileFloatFieldMultiTS::LoadPartOf;
 %newobject MEDCoupling::MEDFileFloatFieldMultiTS::getUndergroundDataArray;
 %newobject MEDCoupling::MEDFileFloatFieldMultiTS::convertToDouble;
 %newobject MEDCoupling::MEDFileFloatFieldMultiTS::getFieldAtLevel;
@@ -269,6 +274,9 @@ using namespace MEDCoupling;
 %newobject MEDCoupling::MEDFileData::getFields;
 %newobject MEDCoupling::MEDFileData::getParams;
 %newobject MEDCoupling::MEDFileData::Aggregate;
+%newobject MEDCoupling::MEDFileData::deepCpyStructure;
+%newobject MEDCoupling::MEDFileAsyncWriter::New;
+%newobject MEDCoupling::MEDFileAsyncWriter::write;
 
 %newobject MEDCoupling::MEDFileEntities::BuildFrom;
 
@@ -364,6 +372,8 @@ using namespace MEDCoupling;
 %feature("unref") MEDFileEquivalenceCell "$this->decrRef();"
 %feature("unref") MEDFileEquivalenceNode "$this->decrRef();"
 %feature("unref") MEDFileData "$this->decrRef();"
+%feature("unref") MEDFileAsyncWrite "$this->decrRef();"
+%feature("unref") MEDFileAsyncWriter "$this->decrRef();"
 %feature("unref") SauvReader "$this->decrRef();"
 %feature("unref") SauvWriter "$this->decrRef();"
 %feature("unref") MEDFileFastCellSupportComparator "$this->decrRef();"
@@ -2772,6 +2782,10 @@ namespace MEDCoupling
     void loadArraysIfNecessary();
     void unloadArrays();
     void unloadArraysWithoutDataLoss();
+    void enablePaging(std::size_t maxNbOfBytes, int nbOfTimeStepsToReadAhead=0);
+    void disablePaging();
+    bool isPagingEnabled() const;
+    std::size_t getNbOfBytesPagedIn() const;
     //
     virtual MEDFileAnyTypeField1TS *getTimeStepAtPos(int pos) const;
     MEDFileAnyTypeField1TS *getTimeStep(int iteration, int order) const;
@@ -3190,6 +3204,11 @@ namespace MEDCoupling
            return MEDFileFieldMultiTS::LoadSpecificEntities(fileName,fieldName,entitiesCpp,loadAll);
          }
 
+         static MEDFileFieldMultiTS *LoadPartOf(const std::string& fileName, const std::string& fieldName, const MEDFileMeshes *ms, bool loadAll=true)
+         {
+           return MEDFileFieldMultiTS::LoadPartOf(fileName,fieldName,ms,loadAll);
+         }
+
          std::string __str__() const
          {
            return self->simpleRepr();
@@ -3340,6 +3359,11 @@ namespace MEDCoupling
         return MEDFileInt32FieldMultiTS::LoadSpecificEntities(fileName,fieldName,entitiesCpp,loadAll);
       }
 
+      static MEDFileInt32FieldMultiTS *LoadPartOf(const std::string& fileName, const std::string& fieldName, const MEDFileMeshes *ms, bool loadAll=true)
+      {
+        return MEDFileInt32FieldMultiTS::LoadPartOf(fileName,fieldName,ms,loadAll);
+      }
+
       std::string __str__() const
       {
         return self->simpleRepr();
@@ -3411,6 +3435,11 @@ namespace MEDCoupling
         return MEDFileInt64FieldMultiTS::LoadSpecificEntities(fileName,fieldName,entitiesCpp,loadAll);
       }
 
+      static MEDFileInt64FieldMultiTS *LoadPartOf(const std::string& fileName, const std::string& fieldName, const MEDFileMeshes *ms, bool loadAll=true)
+      {
+        return MEDFileInt64FieldMultiTS::LoadPartOf(fileName,fieldName,ms,loadAll);
+      }
+
       std::string __str__() const
       {
         return self->simpleRepr();
@@ -3482,6 +3511,11 @@ namespace MEDCoupling
         return MEDFileFloatFieldMultiTS::LoadSpecificEntities(fileName,fieldName,entitiesCpp,loadAll);
       }
 
+      static MEDFileFloatFieldMultiTS *LoadPartOf(const std::string& fileName, const std::string& fieldName, const MEDFileMeshes *ms, bool loadAll=true)
+      {
+        return MEDFileFloatFieldMultiTS::LoadPartOf(fileName,fieldName,ms,loadAll);
+      }
+
       std::string __str__() const
       {
         return self->simpleRepr();
@@ -4148,6 +4182,7 @@ namespace MEDCoupling
     static MEDFileData *New(const std::string& fileName);
     static MEDFileData *New();
     MEDFileData *deepCopy() const;
+    MEDFileData *deepCpyStructure() const;
     void setFields(MEDFileFields *fields);
     void setMeshes(MEDFileMeshes *meshes);
     void setParams(MEDFileParameters *params);
@@ -4223,6 +4258,34 @@ namespace MEDCoupling
        }
   };
 
+  class MEDFileAsyncWrite : public RefCountObject
+  {
+  public:
+    std::string getFileName() const;
+    bool isDone() const;
+    void wait() const;
+  private:
+    MEDFileAsyncWrite();
+  };
+
+  class MEDFileAsyncWriter : public RefCountObject
+  {
+  public:
+    static MEDFileAsyncWriter *New(int maxNbOfPendingWrites=2);
+    int getMaxNbOfPendingWrites() const;
+    int getNbOfPendingWrites() const;
+    static bool IsAsynchronous();
+    MEDFileAsyncWrite *write(const MEDFileData *data, const std::string& fileName, int mode, bool shareArrays=false);
+    void waitForAll() const;
+    %extend
+       {
+         MEDFileAsyncWriter(int maxNbOfPendingWrites=2)
+         {
+           return MEDFileAsyncWriter::New(maxNbOfPendingWrites);
+         }
+       }
+  };
+
   class SauvReader : public RefCountObject
   {
   public:
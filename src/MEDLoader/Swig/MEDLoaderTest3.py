@@ -20191,6 +20191,362 @@ class MEDLoaderTest3(unittest.TestCase):
                 == set(mmr.getFamiliesIdsOnGroup(grp))
             )
 
+    @WriteInTmpDir
+    def testFieldsLoadArrays0(self):
+        """The arrays of all the fields and time steps are read with the same values, either at construction or by
+        loadArrays / loadArraysIfNecessary on a lazy instance."""
+        fname = "Pyfile123.med"
+        m = MEDCouplingCMesh()
+        arr = DataArrayDouble(11)
+        arr.iota()
+        m.setCoords(arr, arr)
+        m = m.buildUnstructured()
+        m.setName("mesh")
+        mm = MEDFileUMesh()
+        mm[0] = m
+        mm.write(fname, 2)
+        nbOfCells = m.getNumberOfCells()
+        for i in range(3):
+            fmts = MEDFileFieldMultiTS()
+            fmtsInt = MEDFileIntFieldMultiTS()
+            for j in range(4):
+                f = MEDCouplingFieldDouble(ON_CELLS)
+                f.setMesh(m)
+                f.setName("Field%d" % i)
+                f.setTime(float(j), j, 0)
+                vals = DataArrayDouble(nbOfCells, i + 1)
+                vals.iota(float(100 * i + 10 * j))
+                f.setArray(vals)
+                fmts.appendFieldNoProfileSBT(f)
+                fi = MEDCouplingFieldInt(ON_NODES)
+                fi.setMesh(m)
+                fi.setName("FieldInt%d" % i)
+                fi.setTime(float(j), j, 0)
+                valsInt = DataArrayInt32(m.getNumberOfNodes())
+                valsInt.iota(1000 * i + 100 * j)
+                fi.setArray(valsInt)
+                fmtsInt.appendFieldNoProfileSBT(fi)
+                pass
+            fmts.write(fname, 0)
+            fmtsInt.write(fname, 0)
+            pass
+        ref = MEDFileFields(fname)
+        self.assertEqual(len(ref), 6)
+        for fs in [MEDFileFields(fname), MEDFileData(fname).getFields()]:
+            self.assertEqual(len(fs), 6)
+            for i in range(6):
+                self.assertEqual(fs[i].getName(), ref[i].getName())
+                self.assertEqual(len(fs[i]), 4)
+                for j in range(4):
+                    self.assertTrue(fs[i][j].getUndergroundDataArray().isEqual(ref[i][j].getUndergroundDataArray()))
+                    pass
+                pass
+            pass
+        fs = MEDFileFields(fname, False)
+        fs.loadArrays()
+        for i in range(6):
+            for j in range(4):
+                self.assertTrue(fs[i][j].getUndergroundDataArray().isEqual(ref[i][j].getUndergroundDataArray()))
+                pass
+            pass
+        # only the unloaded time steps are read again
+        fs[1][2].unloadArrays()
+        fs[4][0].unloadArrays()
+        kept = fs[0][0].getUndergroundDataArray()
+        kept[0] = kept[0] - 1
+        fs.loadArraysIfNecessary()
+        self.assertEqual(fs[0][0].getUndergroundDataArray()[0], ref[0][0].getUndergroundDataArray()[0] - 1)
+        self.assertTrue(fs[1][2].getUndergroundDataArray().isEqual(ref[1][2].getUndergroundDataArray()))
+        self.assertTrue(fs[4][0].getUndergroundDataArray().isEqual(ref[4][0].getUndergroundDataArray()))
+        fmts = MEDFileAnyTypeFieldMultiTS.New(fname, ref[2].getName(), False)
+        fmts.loadArrays()
+        for j in range(4):
+            self.assertTrue(fmts[j].getUndergroundDataArray().isEqual(ref[2][j].getUndergroundDataArray()))
+            pass
+        pass
+
+    @WriteInTmpDir
+    def testFieldMultiTSPaging0(self):
+        """With the paging enabled, the time steps of a MEDFileFieldMultiTS are read at their first access and the least
+        recently used ones are released to stay within the budget of memory."""
+        fname = "Pyfile124.med"
+        m = MEDCouplingCMesh()
+        arr = DataArrayDouble(21)
+        arr.iota()
+        m.setCoords(arr, arr)
+        m = m.buildUnstructured()
+        m.setName("mesh")
+        mm = MEDFileUMesh()
+        mm[0] = m
+        mm.write(fname, 2)
+        nbOfCells = m.getNumberOfCells()
+        fmts = MEDFileFieldMultiTS()
+        for j in range(10):
+            f = MEDCouplingFieldDouble(ON_CELLS)
+            f.setMesh(m)
+            f.setName("Field")
+            f.setTime(float(j), j, 0)
+            vals = DataArrayDouble(nbOfCells, 2)
+            vals.iota(float(1000 * j))
+            f.setArray(vals)
+            fmts.appendFieldNoProfileSBT(f)
+            pass
+        fmts.write(fname, 0)
+        ref = MEDFileFieldMultiTS(fname, "Field")
+        nbOfBytesPerTS = ref[0].getUndergroundDataArray().getHeapMemorySizeWithoutChildren()
+        #
+        fmts = MEDFileFieldMultiTS(fname, "Field", False)
+        self.assertFalse(fmts.isPagingEnabled())
+        fmts.enablePaging(3 * nbOfBytesPerTS)
+        self.assertTrue(fmts.isPagingEnabled())
+        self.assertEqual(fmts.getNbOfBytesPagedIn(), 0)
+        for j in [0, 1, 2, 0, 3, 4, 0, 9]:
+            f = fmts.getFieldAtLevel(ON_CELLS, j, 0, 0)
+            self.assertTrue(f.getArray().isEqual(ref.getFieldAtLevel(ON_CELLS, j, 0, 0).getArray(), 1e-14))
+            self.assertTrue(fmts.getNbOfBytesPagedIn() <= 3 * nbOfBytesPerTS)
+            pass
+        # 0 is the most recently used with 9 and 4, 1, 2 and 3 have been released
+        fmts.disablePaging()
+        inMemory = [fmts[j].getUndergroundDataArray().isAllocated() for j in range(10)]
+        self.assertEqual(inMemory, [True, False, False, False, True] + 4 * [False] + [True])
+        # the fields returned own their values
+        fmts.enablePaging(3 * nbOfBytesPerTS)
+        self.assertEqual(fmts.getNbOfBytesPagedIn(), 3 * nbOfBytesPerTS)
+        f = fmts.getFieldAtLevel(ON_CELLS, 5, 0, 0)
+        for j in range(6, 9):
+            fmts.getFieldAtLevel(ON_CELLS, j, 0, 0)
+            pass
+        self.assertTrue(f.getArray().isEqual(ref.getFieldAtLevel(ON_CELLS, 5, 0, 0).getArray(), 1e-14))
+        # reads ahead within the budget
+        fmts.enablePaging(4 * nbOfBytesPerTS, 2)
+        self.assertTrue(fmts.getNbOfBytesPagedIn() <= 4 * nbOfBytesPerTS)
+        fmts.unloadArrays()
+        fmts.getTimeStepAtPos(0)
+        fmts.disablePaging()
+        inMemory = [fmts[j].getUndergroundDataArray().isAllocated() for j in range(10)]
+        self.assertEqual(inMemory, 3 * [True] + 7 * [False])
+        for j in range(3):
+            self.assertTrue(fmts[j].getUndergroundDataArray().isEqual(ref[j].getUndergroundDataArray(), 1e-14))
+            pass
+        self.assertEqual(fmts.getNbOfBytesPagedIn(), 0)
+        # the time steps read ahead are ranked behind the accessed one, and so released before it
+        fmts.enablePaging(3 * nbOfBytesPerTS, 2)
+        fmts.unloadArrays()
+        fmts.getTimeStepAtPos(0)
+        fmts.getTimeStepAtPos(5)
+        fmts.disablePaging()
+        inMemory = [fmts[j].getUndergroundDataArray().isAllocated() for j in range(10)]
+        self.assertEqual(inMemory, 2 * [True] + 3 * [False] + [True] + 4 * [False])
+        # a field built from scratch can't be paged
+        self.assertRaises(InterpKernelException, MEDFileFieldMultiTS().enablePaging, nbOfBytesPerTS)
+        pass
+
+    @WriteInTmpDir
+    def testFieldMultiTSLoadPartOfWithProfile0(self):
+        """Reads the time steps of a field with a profile on a part of the mesh only."""
+        fileName = "Pyfile125.med"
+        meshName = "Mesh"
+        arrX = DataArrayDouble(5)
+        arrX.iota()
+        arrY = DataArrayDouble(3)
+        arrY.iota()
+        m = MEDCouplingCMesh()
+        m.setCoords(arrX, arrY)
+        m = m.buildUnstructured()
+        m.setName(meshName)
+        mm = MEDFileUMesh()
+        mm[0] = m
+        mm.write(fileName, 2)
+        pfl = DataArrayInt([1, 2, 5, 6])
+        pfl.setName("pfl")
+        fmts = MEDFileFieldMultiTS()
+        for i in range(2):
+            f = MEDCouplingFieldDouble(ON_CELLS, ONE_TIME)
+            f.setName("Field")
+            f.setTime(float(i), i, 0)
+            f.setArray(DataArrayDouble([10.0 * i + 1, 10.0 * i + 2, 10.0 * i + 5, 10.0 * i + 6]))
+            f1ts = MEDFileField1TS()
+            f1ts.setFieldProfile(f, mm, 0, pfl)
+            fmts.pushBackTimeStep(f1ts)
+        fmts.write(fileName, 0)
+        # a profile on nodes
+        pflNodes = DataArrayInt([0, 1, 4, 7, 12, 14])
+        pflNodes.setName("pflNodes")
+        f = MEDCouplingFieldDouble(ON_NODES, ONE_TIME)
+        f.setName("FieldNodes")
+        f.setTime(0.0, 0, 0)
+        f.setArray(DataArrayDouble([100.0 + elt for elt in pflNodes.getValues()]))
+        f1ts = MEDFileField1TS()
+        f1ts.setFieldProfile(f, mm, 0, pflNodes)
+        f1ts.write(fileName, 0)
+        # two profiles whose names are as long as possible, the names of their parts must be cut but stay distinct
+        longPflNames = [63 * "p" + "A", 63 * "p" + "B"]
+        for longPflName in longPflNames:
+            pflLong = pfl.deepCopy()
+            pflLong.setName(longPflName)
+            f = MEDCouplingFieldDouble(ON_CELLS, ONE_TIME)
+            f.setName("Field" + longPflName[-1])
+            f.setTime(0.0, 0, 0)
+            f.setArray(DataArrayDouble([1.0, 2.0, 5.0, 6.0]))
+            f1ts = MEDFileField1TS()
+            f1ts.setFieldProfile(f, mm, 0, pflLong)
+            f1ts.write(fileName, 0)
+            pass
+        # only the cells 2 and 5 of the profile are in the part [2,6)
+        ms = MEDFileMeshes()
+        ms.pushMesh(MEDFileUMesh.LoadPartOf(fileName, meshName, [NORM_QUAD4], [2, 6, 1]))
+        fmts = MEDFileFieldMultiTS.LoadPartOf(fileName, "Field", ms)
+        self.assertEqual(len(fmts), 2)
+        self.assertEqual(fmts.getPfls(), ("pfl_part_QUAD4",))
+        self.assertEqual(fmts.getProfile("pfl_part_QUAD4").getValues(), [0, 3])
+        for i in range(2):
+            self.assertTrue(
+                fmts[i].getUndergroundDataArray().isEqual(DataArrayDouble([10.0 * i + 2, 10.0 * i + 5]), 1e-12)
+            )
+        # the same with the fields read all together
+        fs = MEDFileFields.LoadPartOf(fileName, True, ms)
+        self.assertEqual(fs["Field"].getProfile("pfl_part_QUAD4").getValues(), [0, 3])
+        self.assertTrue(fs["Field"][1].getUndergroundDataArray().isEqual(DataArrayDouble([12.0, 15.0]), 1e-12))
+        # the nodes of the part are the slice [2,13), it holds the nodes 4, 7 and 12 of the profile
+        fmts = MEDFileFieldMultiTS.LoadPartOf(fileName, "FieldNodes", ms)
+        self.assertEqual(fmts.getPfls(), ("pflNodes_part",))
+        self.assertEqual(fmts.getProfile("pflNodes_part").getValues(), [2, 5, 10])
+        self.assertTrue(fmts[0].getUndergroundDataArray().isEqual(DataArrayDouble([104.0, 107.0, 112.0]), 1e-12))
+        # the names of the parts of the long profiles
+        partNames = []
+        for longPflName in longPflNames:
+            fmts = MEDFileFieldMultiTS.LoadPartOf(fileName, "Field" + longPflName[-1], ms)
+            self.assertEqual(len(fmts.getPfls()), 1)
+            partName = fmts.getPfls()[0]
+            self.assertLessEqual(len(partName), 64)
+            self.assertTrue(partName.startswith(16 * "p"))
+            self.assertTrue(partName.endswith("_part_QUAD4"))
+            self.assertEqual(fmts.getProfile(partName).getValues(), [0, 3])
+            self.assertTrue(fmts[0].getUndergroundDataArray().isEqual(DataArrayDouble([2.0, 5.0]), 1e-12))
+            partNames.append(partName)
+            pass
+        self.assertNotEqual(partNames[0], partNames[1])
+        pass
+
+    @WriteInTmpDir
+    def testMEDFileDataAsyncWrite0(self):
+        """Writes of a MEDFileData in the background while it goes on evolving."""
+        fname0 = "Pyfile126.med"
+        fname1 = "Pyfile127.med"
+        arr = DataArrayDouble(11)
+        arr.iota()
+        m = MEDCouplingCMesh()
+        m.setCoords(arr, arr)
+        m = m.buildUnstructured()
+        m.setName("Mesh")
+        mm = MEDFileUMesh()
+        mm[0] = m
+        ms = MEDFileMeshes()
+        ms.pushMesh(mm)
+        f = MEDCouplingFieldDouble(ON_CELLS, ONE_TIME)
+        f.setMesh(m)
+        f.setName("Field")
+        fmts = MEDFileFieldMultiTS()
+        for i in range(2):
+            f.setTime(float(i), i, 0)
+            farr = DataArrayDouble(100)
+            farr.fillWithValue(float(i))
+            f.setArray(farr)
+            f1ts = MEDFileField1TS()
+            f1ts.setFieldNoProfileSBT(f)
+            fmts.pushBackTimeStep(f1ts)
+            if i == 0:
+                fs = MEDFileFields()
+                fs.pushField(fmts)
+                data = MEDFileData()
+                data.setMeshes(ms)
+                data.setFields(fs)
+                writer = MEDFileAsyncWriter(1)
+                self.assertEqual(writer.getMaxNbOfPendingWrites(), 1)
+                h0 = writer.write(data, fname0, 2)
+                # the level of the mesh is not shared with the snapshot of the first request
+                mm.setRenumFieldArr(0, DataArrayInt.Range(1, 101, 1))
+            else:
+                h1 = writer.write(data, fname1, 2)
+            pass
+        # the time step added after the first request is not in the first file
+        h0.wait()
+        self.assertTrue(h0.isDone())
+        self.assertEqual(h0.getFileName(), fname0)
+        writer.waitForAll()
+        self.assertEqual(writer.getNbOfPendingWrites(), 0)
+        self.assertTrue(h1.isDone())
+        h1.wait()
+        self.assertEqual(len(MEDFileFieldMultiTS(fname0, "Field")), 1)
+        fmtsRead = MEDFileFieldMultiTS(fname1, "Field")
+        self.assertEqual(len(fmtsRead), 2)
+        self.assertTrue(fmtsRead[1].getUndergroundDataArray().isEqual(farr, 1e-14))
+        self.assertEqual(MEDFileMesh.New(fname1)[0].getNumberOfCells(), 100)
+        self.assertTrue(MEDFileMesh.New(fname0).getNumberFieldAtLevel(0) is None)
+        self.assertTrue(MEDFileMesh.New(fname1).getNumberFieldAtLevel(0).isEqual(DataArrayInt.Range(1, 101, 1)))
+        # a failure of the write is raised by wait
+        h2 = writer.write(data, "NotExistingDirectory/Pyfile128.med", 2)
+        self.assertRaises(InterpKernelException, h2.wait)
+        self.assertRaises(InterpKernelException, MEDFileAsyncWriter, 0)
+        pass
+
+    @WriteInTmpDir
+    def testMEDFileDataAsyncWrite1(self):
+        """The arrays written in the background are copied unless shared."""
+        fname = "Pyfile129.med"
+        arr = DataArrayDouble(11)
+        arr.iota()
+        m = MEDCouplingCMesh()
+        m.setCoords(arr, arr)
+        m = m.buildUnstructured()
+        m.setName("Mesh")
+        mm = MEDFileUMesh()
+        mm[0] = m
+        ms = MEDFileMeshes()
+        ms.pushMesh(mm)
+        data = MEDFileData()
+        data.setMeshes(ms)
+        writer = MEDFileAsyncWriter(1)
+        coords = mm.getCoords()
+        refCoords = coords.deepCopy()
+        # modifying the arrays in place after the request does not change the file
+        h0 = writer.write(data, fname, 2)
+        coords[:] = 7.0
+        h0.wait()
+        self.assertTrue(MEDFileMesh.New(fname).getCoords().isEqual(refCoords, 1e-14))
+        # shared arrays left untouched until the end of the write
+        h1 = writer.write(data, fname, 2, True)
+        h1.wait()
+        self.assertTrue(MEDFileMesh.New(fname).getCoords().isEqual(coords, 1e-14))
+        pass
+
+    @unittest.skipUnless(MEDCouplingHasNumPyBindings(), "requires numpy")
+    @WriteInTmpDir
+    def testMEDFileDataAsyncWrite2(self):
+        """The numpy arrays shared with a write in the background are released by the calling thread."""
+        from numpy import arange, float64
+
+        fname = "Pyfile130.med"
+        writer = MEDFileAsyncWriter(1)
+        for i in range(3):
+            coords = DataArrayDouble(arange(8 + 2 * i, dtype=float64))
+            coords.rearrange(2)
+            mm = MEDFileUMesh()
+            mm.setCoords(coords)
+            mm.setName("Mesh")
+            ms = MEDFileMeshes()
+            ms.pushMesh(mm)
+            data = MEDFileData()
+            data.setMeshes(ms)
+            h = writer.write(data, fname, 2, True)
+            # the snapshot is left as the last owner of the numpy array
+            del data, ms, mm, coords
+            pass
+        writer.waitForAll()
+        h.wait()
+        self.assertTrue(MEDFileMesh.New(fname).getCoords().isEqual(DataArrayDouble(list(range(12)), 6, 2), 1e-14))
+        pass
+
     pass
 
 
@@ -63,6 +63,7 @@ class DECOptions
     TimeInterpolationMethod _timeInterpolationMethod;
     AllToAllMethod _allToAllMethod;
     bool _forcedRenormalization;
+    bool _nonBlockingMeshExchange;
 
    public:
     DECOptions()
@@ -70,7 +71,8 @@ class DECOptions
           _asynchronous(false),
           _timeInterpolationMethod(WithoutTimeInterp),
           _allToAllMethod(Native),
-          _forcedRenormalization(false)
+          _forcedRenormalization(false),
+          _nonBlockingMeshExchange(false)
     {
     }
 
@@ -81,6 +83,7 @@ class DECOptions
         _asynchronous = deco._asynchronous;
         _forcedRenormalization = deco._forcedRenormalization;
         _allToAllMethod = deco._allToAllMethod;
+        _nonBlockingMeshExchange = deco._nonBlockingMeshExchange;
     }
 
     /*!
@@ -131,6 +134,17 @@ class DECOptions
      * Set the broadcast method for synchronisation processes. Default to Native.
      */
     void setAllToAllMethod(AllToAllMethod sp) { _allToAllMethod = sp; }
+
+    /*!
+     * \sa setNonBlockingMeshExchange()
+     */
+    bool getNonBlockingMeshExchange() const { return _nonBlockingMeshExchange; }
+    /*!
+     * If true, the synchronization posts at once the exchanges of mesh parts with all the distant procs, and each
+     * distant mesh part is intersected as soon as it is received. Otherwise the distant procs are processed one after
+     * the other. The interpolation matrix is the same in both modes. Default is false.
+     */
+    void setNonBlockingMeshExchange(bool nbme) { _nonBlockingMeshExchange = nbme; }
 };
 }  // namespace MEDCoupling
 
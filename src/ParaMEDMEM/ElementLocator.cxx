@@ -33,6 +33,7 @@
 #include <map>
 #include <set>
 #include <limits>
+#include <memory>
 
 using namespace std;
 
@@ -56,6 +57,7 @@ ElementLocator::ElementLocator(
 
 ElementLocator::~ElementLocator()
 {
+    _clearMeshExchanges();
     delete _union_group;
     delete[] _domain_bounding_boxes;
 }
@@ -88,6 +90,22 @@ ElementLocator::exchangeMesh(int idistantrank, MEDCouplingPointSet *&distant_mes
     if (find(_distant_proc_ids.begin(), _distant_proc_ids.end(), rank) == _distant_proc_ids.end())
         return;
 
+    DataArrayIdType *distant_ids_send;
+    MEDCouplingPointSet *send_mesh = _buildMeshToSend(rank, distant_ids_send);
+    _exchangeMesh(send_mesh, distant_mesh, idistantrank, distant_ids_send, distant_ids);
+    distant_ids_send->decrRef();
+
+    if (send_mesh)
+        send_mesh->decrRef();
+}
+
+/*!
+ * Builds the part of the local mesh that may intersect the domain of the proc \a rank (in union numbering).
+ * \param distant_ids_send on return, the ids in the local mesh of the cells of the returned mesh
+ */
+MEDCouplingPointSet *
+ElementLocator::_buildMeshToSend(int rank, DataArrayIdType *&distant_ids_send)
+{
     MCAuto<DataArrayIdType> elems;
 #ifdef USE_DIRECTED_BB
     INTERP_KERNEL::DirectedBoundingBox dbb;
@@ -99,15 +117,9 @@ ElementLocator::exchangeMesh(int idistantrank, MEDCouplingPointSet *&distant_mes
     elems = _local_cell_mesh->getCellsInBoundingBox(distant_bb, getBoundingBoxAdjustment());
 #endif
 
-    DataArrayIdType *distant_ids_send;
-    MEDCouplingPointSet *send_mesh = (MEDCouplingPointSet *)_local_para_field.getField()->buildSubMeshData(
+    return (MEDCouplingPointSet *)_local_para_field.getField()->buildSubMeshData(
         elems->begin(), elems->end(), distant_ids_send
     );
-    _exchangeMesh(send_mesh, distant_mesh, idistantrank, distant_ids_send, distant_ids);
-    distant_ids_send->decrRef();
-
-    if (send_mesh)
-        send_mesh->decrRef();
 }
 
 void
@@ -140,6 +152,277 @@ ElementLocator::exchangeMethod(const std::string &sourceMeth, int idistantrank,
     delete[] recv_buffer;
 }
 
+/*!
+ * State of the nonblocking exchange of mesh parts with one distant proc. All the buffers live until the end of the
+ * exchanges, since MPI may still be reading the local ones.
+ */
+struct ElementLocator::MeshExchange
+{
+    //! Kinds of messages exchanged with a distant proc, also used as tag offsets
+    enum
+    {
+        TINY_INFO = 0,
+        INTS = 1,
+        DOUBLES = 2,
+        IDS = 3,
+        METHOD = 4,
+        SEND = 5
+    };
+    int _idistantrank;
+    int _rank_in_union;
+    vector<mcIdType> _tiny_info_local;
+    vector<mcIdType> _tiny_info_distant;
+    MCAuto<DataArrayIdType> _v1_local;
+    MCAuto<DataArrayDouble> _v2_local;
+    MCAuto<DataArrayIdType> _distant_ids_send;
+    MCAuto<DataArrayIdType> _v1_distant;
+    MCAuto<DataArrayDouble> _v2_distant;
+    MCAuto<MEDCouplingPointSet> _distant_mesh;
+    std::unique_ptr<mcIdType[]> _distant_ids_recv;
+    vector<string> _tiny_info_distant_s;
+    char _local_method[4];
+    char _distant_method[5];
+    int _nb_of_pending_recvs;
+};
+
+/*!
+ * Nonblocking counterpart of exchangeMesh and exchangeMethod for all the distant procs at once : the sizes, the mesh
+ * parts, the cell ids and the methods are sent to every distant proc whose domain may intersect the local one, and the
+ * corresponding receives are posted. The distant meshes are then retrieved, in their order of arrival, by calling
+ * waitForAnyMesh until it returns false. This method must be called on both sides, in place of the calls to
+ * exchangeMesh and exchangeMethod.
+ *
+ * \param sourceMeth the local method sent to the distant procs, as in exchangeMethod
+ * \return the number of exchanges. Exchange ids returned by waitForAnyMesh are in [0, returned value ) and follow the
+ * order of the distant ranks.
+ */
+std::size_t
+ElementLocator::postMeshExchanges(const std::string &sourceMeth)
+{
+    _clearMeshExchanges();
+    CommInterface comm_interface = _union_group->getCommInterface();
+    for (int idistantrank = 0; idistantrank < _distant_group.size(); idistantrank++)
+    {
+        int rank = _union_group->translateRank(&_distant_group, idistantrank);
+        if (find(_distant_proc_ids.begin(), _distant_proc_ids.end(), rank) == _distant_proc_ids.end())
+            continue;
+        std::size_t exchangeId(_mesh_exchanges.size());
+        MeshExchange *xch(new MeshExchange);
+        _mesh_exchanges.push_back(xch);
+        xch->_idistantrank = idistantrank;
+        xch->_rank_in_union = rank;
+        xch->_nb_of_pending_recvs = 2;
+        std::fill(xch->_local_method, xch->_local_method + 4, '\0');
+        std::fill(xch->_distant_method, xch->_distant_method + 5, '\0');
+        sourceMeth.copy(xch->_local_method, 4);
+        // serialization of the part of the local mesh that the distant proc needs
+        DataArrayIdType *distant_ids_send(0);
+        MCAuto<MEDCouplingPointSet> send_mesh(_buildMeshToSend(rank, distant_ids_send));
+        xch->_distant_ids_send = distant_ids_send;
+        vector<double> tinyInfoLocalD;
+        vector<string> tinyInfoLocalS;
+        send_mesh->getTinySerializationInformation(tinyInfoLocalD, xch->_tiny_info_local, tinyInfoLocalS);
+        xch->_tiny_info_local.push_back(distant_ids_send->getNumberOfTuples());
+        xch->_tiny_info_distant.resize(xch->_tiny_info_local.size(), 0);
+        DataArrayIdType *v1Local(0);
+        DataArrayDouble *v2Local(0);
+        send_mesh->serialize(v1Local, v2Local);
+        xch->_v1_local = v1Local;
+        xch->_v2_local = v2Local;
+        //
+        const int tag(START_TAG_NONBLOCKING_MESH_XCH);
+        MPI_Request req;
+        comm_interface.Irecv(
+            &xch->_tiny_info_distant[0],
+            (int)xch->_tiny_info_distant.size(),
+            MPI_ID_TYPE,
+            rank,
+            tag + MeshExchange::TINY_INFO,
+            *_comm,
+            &req
+        );
+        _mesh_exchange_requests.push_back(req);
+        _mesh_exchange_request_roles.push_back(make_pair(exchangeId, (int)MeshExchange::TINY_INFO));
+        comm_interface.Irecv(xch->_distant_method, 4, MPI_CHAR, rank, tag + MeshExchange::METHOD, *_comm, &req);
+        _mesh_exchange_requests.push_back(req);
+        _mesh_exchange_request_roles.push_back(make_pair(exchangeId, (int)MeshExchange::METHOD));
+        comm_interface.Isend(
+            &xch->_tiny_info_local[0],
+            (int)xch->_tiny_info_local.size(),
+            MPI_ID_TYPE,
+            rank,
+            tag + MeshExchange::TINY_INFO,
+            *_comm,
+            &req
+        );
+        _mesh_exchange_requests.push_back(req);
+        _mesh_exchange_request_roles.push_back(make_pair(exchangeId, (int)MeshExchange::SEND));
+        comm_interface.Isend(
+            v1Local ? v1Local->getPointer() : 0,
+            v1Local ? (int)v1Local->getNbOfElems() : 0,
+            MPI_ID_TYPE,
+            rank,
+            tag + MeshExchange::INTS,
+            *_comm,
+            &req
+        );
+        _mesh_exchange_requests.push_back(req);
+        _mesh_exchange_request_roles.push_back(make_pair(exchangeId, (int)MeshExchange::SEND));
+        comm_interface.Isend(
+            v2Local ? v2Local->getPointer() : 0,
+            v2Local ? (int)v2Local->getNbOfElems() : 0,
+            MPI_DOUBLE,
+            rank,
+            tag + MeshExchange::DOUBLES,
+            *_comm,
+            &req
+        );
+        _mesh_exchange_requests.push_back(req);
+        _mesh_exchange_request_roles.push_back(make_pair(exchangeId, (int)MeshExchange::SEND));
+        comm_interface.Isend(
+            distant_ids_send->getPointer(),
+            (int)distant_ids_send->getNbOfElems(),
+            MPI_ID_TYPE,
+            rank,
+            tag + MeshExchange::IDS,
+            *_comm,
+            &req
+        );
+        _mesh_exchange_requests.push_back(req);
+        _mesh_exchange_request_roles.push_back(make_pair(exchangeId, (int)MeshExchange::SEND));
+        comm_interface.Isend(xch->_local_method, 4, MPI_CHAR, rank, tag + MeshExchange::METHOD, *_comm, &req);
+        _mesh_exchange_requests.push_back(req);
+        _mesh_exchange_request_roles.push_back(make_pair(exchangeId, (int)MeshExchange::SEND));
+    }
+    return _mesh_exchanges.size();
+}
+
+/*!
+ * Waits for the next distant mesh fully received after a call to postMeshExchanges. The ownership of \a distant_mesh
+ * and \a distant_ids is given to the caller, as in exchangeMesh.
+ *
+ * \param exchangeId on return, the id of the exchange in [0, postMeshExchanges() )
+ * \param idistantrank on return, the proc id of the sender in distant group
+ * \param targetMeth on return, the method of the sender, as in exchangeMethod
+ * \return false if all the distant meshes have been returned and all the local ones have been sent.
+ */
+bool
+ElementLocator::waitForAnyMesh(
+    std::size_t &exchangeId, int &idistantrank, MEDCouplingPointSet *&distant_mesh, mcIdType *&distant_ids,
+    std::string &targetMeth
+)
+{
+    CommInterface comm_interface = _union_group->getCommInterface();
+    for (;;)
+    {
+        int index(MPI_UNDEFINED);
+        MPI_Status status;
+        if (!_mesh_exchange_requests.empty())
+            comm_interface.waitany((int)_mesh_exchange_requests.size(), &_mesh_exchange_requests[0], &index, &status);
+        if (index == MPI_UNDEFINED)
+        {
+            _clearMeshExchanges();
+            return false;
+        }
+        std::size_t xchId(_mesh_exchange_request_roles[index].first);
+        int role(_mesh_exchange_request_roles[index].second);
+        if (role == MeshExchange::SEND)
+            continue;
+        if (role == MeshExchange::TINY_INFO)
+            _postMeshDataRecvs(xchId);
+        MeshExchange *xch(_mesh_exchanges[xchId]);
+        if (--xch->_nb_of_pending_recvs > 0)
+            continue;
+        vector<double> tinyInfoDistantD(1);  // not used for the moment
+        xch->_distant_mesh->unserialization(
+            tinyInfoDistantD, xch->_tiny_info_distant, xch->_v1_distant, xch->_v2_distant, xch->_tiny_info_distant_s
+        );
+        xch->_v1_distant = 0;
+        xch->_v2_distant = 0;
+        exchangeId = xchId;
+        idistantrank = xch->_idistantrank;
+        distant_mesh = xch->_distant_mesh.retn();
+        distant_ids = xch->_distant_ids_recv.release();
+        targetMeth = xch->_distant_method;
+        return true;
+    }
+}
+
+/*!
+ * Once the sizes sent by a distant proc are known, allocates the distant mesh and posts the receives of its data.
+ */
+void
+ElementLocator::_postMeshDataRecvs(std::size_t exchangeId)
+{
+    CommInterface comm_interface = _union_group->getCommInterface();
+    MeshExchange *xch(_mesh_exchanges[exchangeId]);
+    const int tag(START_TAG_NONBLOCKING_MESH_XCH);
+    xch->_distant_mesh =
+        MEDCouplingPointSet::BuildInstanceFromMeshType((MEDCouplingMeshType)xch->_tiny_info_distant[0]);
+    xch->_v1_distant = DataArrayIdType::New();
+    xch->_v2_distant = DataArrayDouble::New();
+    xch->_distant_mesh->resizeForUnserialization(
+        xch->_tiny_info_distant, xch->_v1_distant, xch->_v2_distant, xch->_tiny_info_distant_s
+    );
+    xch->_distant_ids_recv.reset(new mcIdType[xch->_tiny_info_distant.back()]);
+    MPI_Request req;
+    comm_interface.Irecv(
+        xch->_v1_distant->isAllocated() ? xch->_v1_distant->getPointer() : 0,
+        xch->_v1_distant->isAllocated() ? (int)xch->_v1_distant->getNbOfElems() : 0,
+        MPI_ID_TYPE,
+        xch->_rank_in_union,
+        tag + MeshExchange::INTS,
+        *_comm,
+        &req
+    );
+    _mesh_exchange_requests.push_back(req);
+    _mesh_exchange_request_roles.push_back(make_pair(exchangeId, (int)MeshExchange::INTS));
+    comm_interface.Irecv(
+        xch->_v2_distant->isAllocated() ? xch->_v2_distant->getPointer() : 0,
+        xch->_v2_distant->isAllocated() ? (int)xch->_v2_distant->getNbOfElems() : 0,
+        MPI_DOUBLE,
+        xch->_rank_in_union,
+        tag + MeshExchange::DOUBLES,
+        *_comm,
+        &req
+    );
+    _mesh_exchange_requests.push_back(req);
+    _mesh_exchange_request_roles.push_back(make_pair(exchangeId, (int)MeshExchange::DOUBLES));
+    comm_interface.Irecv(
+        xch->_distant_ids_recv.get(),
+        (int)xch->_tiny_info_distant.back(),
+        MPI_ID_TYPE,
+        xch->_rank_in_union,
+        tag + MeshExchange::IDS,
+        *_comm,
+        &req
+    );
+    _mesh_exchange_requests.push_back(req);
+    _mesh_exchange_request_roles.push_back(make_pair(exchangeId, (int)MeshExchange::IDS));
+    xch->_nb_of_pending_recvs += 3;
+}
+
+/*!
+ * Releases the state of the nonblocking exchanges. The requests still pending, if the exchanges have been interrupted
+ * by an exception, are cancelled first since they refer to the released buffers.
+ */
+void
+ElementLocator::_clearMeshExchanges()
+{
+    CommInterface comm_interface = _union_group->getCommInterface();
+    for (vector<MPI_Request>::iterator it = _mesh_exchange_requests.begin(); it != _mesh_exchange_requests.end(); it++)
+        if (*it != MPI_REQUEST_NULL)
+        {
+            MPI_Status status;
+            comm_interface.cancel(&(*it));
+            comm_interface.wait(&(*it), &status);
+        }
+    for (vector<MeshExchange *>::iterator it = _mesh_exchanges.begin(); it != _mesh_exchanges.end(); it++) delete *it;
+    _mesh_exchanges.clear();
+    _mesh_exchange_requests.clear();
+    _mesh_exchange_request_roles.clear();
+}
+
 /*!
  Compute bounding boxes
 */
@@ -27,6 +27,7 @@
 #include <mpi.h>
 #include <vector>
 #include <set>
+#include <string>
 
 namespace MEDCoupling
 {
@@ -49,6 +50,14 @@ class ElementLocator : public INTERP_KERNEL::InterpolationOptions
     virtual ~ElementLocator();
     void exchangeMesh(int idistantrank, MEDCouplingPointSet *&target_mesh, mcIdType *&distant_ids);
     void exchangeMethod(const std::string &sourceMeth, int idistantrank, std::string &targetMeth);
+    std::size_t postMeshExchanges(const std::string &sourceMeth);
+    bool waitForAnyMesh(
+        std::size_t &exchangeId,
+        int &idistantrank,
+        MEDCouplingPointSet *&distant_mesh,
+        mcIdType *&distant_ids,
+        std::string &targetMeth
+    );
     const std::vector<int> &getDistantProcIds() const { return _distant_proc_ids; }
     const MPI_Comm *getCommunicator() const;
     NatureOfField getLocalNature() const;
@@ -84,8 +93,12 @@ class ElementLocator : public INTERP_KERNEL::InterpolationOptions
     void sendAddElementsToWorkingSideL();
 
    private:
+    struct MeshExchange;
     void _computeBoundingBoxes();
     bool _intersectsBoundingBox(int irank);
+    MEDCouplingPointSet *_buildMeshToSend(int rank, DataArrayIdType *&distant_ids_send);
+    void _postMeshDataRecvs(std::size_t exchangeId);
+    void _clearMeshExchanges();
     void _exchangeMesh(
         MEDCouplingPointSet *local_mesh,
         MEDCouplingPointSet *&distant_mesh,
@@ -108,6 +121,10 @@ class ElementLocator : public INTERP_KERNEL::InterpolationOptions
     ProcessorGroup *_union_group;
     std::vector<int> _distant_proc_ids;
     const MPI_Comm *_comm;
+    // Attributes only used by the nonblocking exchange of meshes
+    std::vector<MeshExchange *> _mesh_exchanges;
+    std::vector<MPI_Request> _mesh_exchange_requests;
+    std::vector<std::pair<std::size_t, int> > _mesh_exchange_request_roles;
     // Attributes only used by lazy side
     std::vector<double> _values_added;
     std::vector<std::vector<mcIdType> > _ids_per_working_proc;
@@ -117,6 +134,9 @@ class ElementLocator : public INTERP_KERNEL::InterpolationOptions
    public:
     static const int CUMULATIVE_POLICY = 3;
     static const int NO_POST_TREATMENT_POLICY = 7;
+
+   private:
+    static const int START_TAG_NONBLOCKING_MESH_XCH = 1134;
 };
 
 }  // namespace MEDCoupling
@@ -29,9 +29,34 @@
 #include "InterpolationMatrix.hxx"
 #include "InterpKernelDEC.hxx"
 #include "ElementLocator.hxx"
+#include "MEDCouplingFieldDouble.hxx"
+
+#include <memory>
 
 namespace MEDCoupling
 {
+namespace
+{
+/*!
+ * Intersections with a distant mesh received in nonblocking mode, waiting for their turn to be added to the matrix.
+ */
+struct PendingContribution
+{
+    PendingContribution() : _is_computed(false), _distant_proc_in_union(-1) {}
+    void release()
+    {
+        std::vector<std::map<mcIdType, double> >().swap(_surfaces);
+        _target_surf = 0;
+        _distant_ids.reset();
+    }
+    bool _is_computed;
+    int _distant_proc_in_union;
+    std::unique_ptr<mcIdType[]> _distant_ids;
+    std::vector<std::map<mcIdType, double> > _surfaces;
+    MCAuto<MEDCouplingFieldDouble> _target_surf;
+};
+}  // namespace
+
 InterpKernelDEC::InterpKernelDEC() : DisjointDEC(), _interpolation_matrix(0) {}
 
 /*!
@@ -142,27 +167,61 @@ InterpKernelDEC::synchronize()
         MEDCouplingPointSet *distant_mesh = 0;
         mcIdType *distant_ids = 0;
         std::string distantMeth;
-        for (int i = 0; i < _target_group->size(); i++)
+        if (getNonBlockingMeshExchange())
         {
-            //        int idistant_proc = (i+_source_group->myRank())%_target_group->size();
-            int idistant_proc = i;
-
-            // gathers pieces of the target meshes that can intersect the local mesh
-            locator.exchangeMesh(idistant_proc, distant_mesh, distant_ids);
-            if (distant_mesh != 0)
+            // the intersections are computed as soon as the distant meshes arrive, but they are added to the matrix in
+            // the order of the distant procs, so that the matrix is the same as in blocking mode.
+            std::vector<PendingContribution> contributions(locator.postMeshExchanges(_method));
+            std::size_t exchangeId, nextToAdd(0);
+            int idistant_proc;
+            while (locator.waitForAnyMesh(exchangeId, idistant_proc, distant_mesh, distant_ids, distantMeth))
             {
-                locator.exchangeMethod(_method, idistant_proc, distantMeth);
-                // adds the contribution of the distant mesh on the local one
-                int idistant_proc_in_union = _union_group->translateRank(_target_group, idistant_proc);
-                // std::cout <<"add contribution from proc "<<idistant_proc_in_union<<" to proc
-                // "<<_union_group->myRank()<<std::endl;
-                _interpolation_matrix->addContribution(
-                    *distant_mesh, idistant_proc_in_union, distant_ids, _method, distantMeth
+                MCAuto<MEDCouplingPointSet> distantMeshSafe(distant_mesh);
+                PendingContribution &contrib(contributions[exchangeId]);
+                contrib._distant_proc_in_union = _union_group->translateRank(_target_group, idistant_proc);
+                contrib._distant_ids.reset(distant_ids);
+                MEDCouplingFieldDouble *targetSurf(0);
+                _interpolation_matrix->computeContribution(
+                    *distant_mesh, _method, distantMeth, contrib._surfaces, targetSurf
                 );
-                distant_mesh->decrRef();
-                delete[] distant_ids;
-                distant_mesh = 0;
-                distant_ids = 0;
+                contrib._target_surf = targetSurf;
+                contrib._is_computed = true;
+                for (; nextToAdd < contributions.size() && contributions[nextToAdd]._is_computed; nextToAdd++)
+                {
+                    PendingContribution &toAdd(contributions[nextToAdd]);
+                    _interpolation_matrix->addComputedContribution(
+                        toAdd._distant_proc_in_union, toAdd._distant_ids.get(), toAdd._surfaces, toAdd._target_surf
+                    );
+                    toAdd.release();
+                }
+            }
+            distant_mesh = 0;
+            distant_ids = 0;
+        }
+        else
+        {
+            for (int i = 0; i < _target_group->size(); i++)
+            {
+                //        int idistant_proc = (i+_source_group->myRank())%_target_group->size();
+                int idistant_proc = i;
+
+                // gathers pieces of the target meshes that can intersect the local mesh
+                locator.exchangeMesh(idistant_proc, distant_mesh, distant_ids);
+                if (distant_mesh != 0)
+                {
+                    locator.exchangeMethod(_method, idistant_proc, distantMeth);
+                    // adds the contribution of the distant mesh on the local one
+                    int idistant_proc_in_union = _union_group->translateRank(_target_group, idistant_proc);
+                    // std::cout <<"add contribution from proc "<<idistant_proc_in_union<<" to proc
+                    // "<<_union_group->myRank()<<std::endl;
+                    _interpolation_matrix->addContribution(
+                        *distant_mesh, idistant_proc_in_union, distant_ids, _method, distantMeth
+                    );
+                    distant_mesh->decrRef();
+                    delete[] distant_ids;
+                    distant_mesh = 0;
+                    distant_ids = 0;
+                }
             }
         }
         _interpolation_matrix->finishContributionW(locator);
@@ -175,21 +234,39 @@ InterpKernelDEC::synchronize()
         locator.copyOptions(*this);
         MEDCouplingPointSet *distant_mesh = 0;
         mcIdType *distant_ids = 0;
-        for (int i = 0; i < _source_group->size(); i++)
+        if (getNonBlockingMeshExchange())
         {
-            //        int idistant_proc = (i+_target_group->myRank())%_source_group->size();
-            int idistant_proc = i;
-            // gathers pieces of the target meshes that can intersect the local mesh
-            locator.exchangeMesh(idistant_proc, distant_mesh, distant_ids);
-            // std::cout << " Data sent from "<<_union_group->myRank()<<" to source proc "<< idistant_proc<<std::endl;
-            if (distant_mesh != 0)
+            locator.postMeshExchanges(_method);
+            std::size_t exchangeId;
+            int idistant_proc;
+            std::string distantMeth;
+            while (locator.waitForAnyMesh(exchangeId, idistant_proc, distant_mesh, distant_ids, distantMeth))
             {
-                std::string distantMeth;
-                locator.exchangeMethod(_method, idistant_proc, distantMeth);
                 distant_mesh->decrRef();
                 delete[] distant_ids;
-                distant_mesh = 0;
-                distant_ids = 0;
+            }
+            distant_mesh = 0;
+            distant_ids = 0;
+        }
+        else
+        {
+            for (int i = 0; i < _source_group->size(); i++)
+            {
+                //        int idistant_proc = (i+_target_group->myRank())%_source_group->size();
+                int idistant_proc = i;
+                // gathers pieces of the target meshes that can intersect the local mesh
+                locator.exchangeMesh(idistant_proc, distant_mesh, distant_ids);
+                // std::cout << " Data sent from "<<_union_group->myRank()<<" to source proc "<<
+                // idistant_proc<<std::endl;
+                if (distant_mesh != 0)
+                {
+                    std::string distantMeth;
+                    locator.exchangeMethod(_method, idistant_proc, distantMeth);
+                    distant_mesh->decrRef();
+                    delete[] distant_ids;
+                    distant_mesh = 0;
+                    distant_ids = 0;
+                }
             }
         }
         _interpolation_matrix->finishContributionL(locator);
@@ -100,11 +100,37 @@ InterpolationMatrix::addContribution(
     const std::string &srcMeth,
     const std::string &targetMeth
 )
+{
+    vector<map<mcIdType, double> > surfaces;
+    MEDCouplingFieldDouble *target_triangle_surf = 0;
+    computeContribution(distant_support, srcMeth, targetMeth, surfaces, target_triangle_surf);
+    fillDSFromVM(iproc_distant, distant_elems, surfaces, target_triangle_surf);
+
+    if (target_triangle_surf)
+        target_triangle_surf->decrRef();
+}
+
+/*!
+   First half of addContribution : computes the intersections between the local mesh and \a distant_support, without
+   modifying the matrix. This allows the intersections with several distant meshes to be computed in any order, and
+   added later on in a given order with addComputedContribution.
+   param surfaces on return, the intersection volumes
+   param target_surf on return, the measure field of \a distant_support if the method needs it, or 0. The caller
+   has to release it.
+ */
+void
+InterpolationMatrix::computeContribution(
+    MEDCouplingPointSet &distant_support,
+    const std::string &srcMeth,
+    const std::string &targetMeth,
+    std::vector<std::map<mcIdType, double> > &surfaces,
+    MEDCouplingFieldDouble *&target_surf
+)
 {
     std::string interpMethod(targetMeth);
     interpMethod += srcMeth;
     // creating the interpolator structure
-    vector<map<mcIdType, double> > surfaces;
+    surfaces.clear();
     // computation of the intersection volumes between source and target elements
     MEDCouplingUMesh *distant_supportC = dynamic_cast<MEDCouplingUMesh *>(&distant_support);
     MEDCouplingUMesh *source_supportC = dynamic_cast<MEDCouplingUMesh *>(_source_support);
@@ -250,13 +276,23 @@ InterpolationMatrix::addContribution(
     }
     bool needTargetSurf = isSurfaceComputationNeeded(targetMeth);
 
-    MEDCouplingFieldDouble *target_triangle_surf = 0;
+    target_surf = 0;
     if (needTargetSurf)
-        target_triangle_surf = distant_support.getMeasureField(getMeasureAbsStatus());
-    fillDSFromVM(iproc_distant, distant_elems, surfaces, target_triangle_surf);
+        target_surf = distant_support.getMeasureField(getMeasureAbsStatus());
+}
 
-    if (needTargetSurf)
-        target_triangle_surf->decrRef();
+/*!
+   Second half of addContribution : adds to the matrix the intersections computed by computeContribution.
+ */
+void
+InterpolationMatrix::addComputedContribution(
+    int iproc_distant,
+    const mcIdType *distant_elems,
+    const std::vector<std::map<mcIdType, double> > &surfaces,
+    MEDCouplingFieldDouble *target_surf
+)
+{
+    fillDSFromVM(iproc_distant, distant_elems, surfaces, target_surf);
 }
 
 void
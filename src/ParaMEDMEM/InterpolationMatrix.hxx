@@ -56,6 +56,19 @@ class InterpolationMatrix : public INTERP_KERNEL::InterpolationOptions, public D
         const std::string &srcMeth,
         const std::string &targetMeth
     );
+    void computeContribution(
+        MEDCouplingPointSet &distant_support,
+        const std::string &srcMeth,
+        const std::string &targetMeth,
+        std::vector<std::map<mcIdType, double> > &surfaces,
+        MEDCouplingFieldDouble *&target_surf
+    );
+    void addComputedContribution(
+        int iproc_distant,
+        const mcIdType *distant_elems,
+        const std::vector<std::map<mcIdType, double> > &surfaces,
+        MEDCouplingFieldDouble *target_surf
+    );
     void finishContributionW(ElementLocator &elementLocator);
     void finishContributionL(ElementLocator &elementLocator);
     MCAuto<DataArrayIdType> retrieveNonFetchedIdsTarget(mcIdType nbTuples) const;
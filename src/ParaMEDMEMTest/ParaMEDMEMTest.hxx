@@ -44,6 +44,7 @@ class ParaMEDMEMTest : public CppUnit::TestFixture
     CPPUNIT_TEST(testInterpKernelDEC_3D);                      // 3 procs
     CPPUNIT_TEST(testInterpKernelDECNonOverlapp_2D_P0P0);      // 5 procs
     CPPUNIT_TEST(testInterpKernelDECNonOverlapp_2D_P0P1P1P0);  // 5 procs
+    CPPUNIT_TEST(testInterpKernelDECNonBlockingMeshExchange);  // 5 procs
     CPPUNIT_TEST(testInterpKernelDEC2DM1D_P0P0);               // 3 procs
     CPPUNIT_TEST(testInterpKernelDECPartialProcs);             // 3 procs
     CPPUNIT_TEST(testInterpKernelDEC3DSurfEmptyBBox);          // 3 procs
@@ -113,6 +114,7 @@ class ParaMEDMEMTest : public CppUnit::TestFixture
     void testInterpKernelDEC_3D();
     void testInterpKernelDECNonOverlapp_2D_P0P0();
     void testInterpKernelDECNonOverlapp_2D_P0P1P1P0();
+    void testInterpKernelDECNonBlockingMeshExchange();
     void testInterpKernelDEC2DM1D_P0P0();
     void testInterpKernelDECPartialProcs();
     void testInterpKernelDEC3DSurfEmptyBBox();
@@ -1448,6 +1448,136 @@ ParaMEDMEMTest::testInterpKernelDECNonOverlapp_2D_P0P0()
     MPI_Barrier(MPI_COMM_WORLD);
 }
 
+/*!
+ * Same configuration as testInterpKernelDECNonOverlapp_2D_P0P0 but the meshes are exchanged with nonblocking
+ * communications. Results must be identical to the blocking exchange, in both directions.
+ */
+void
+ParaMEDMEMTest::testInterpKernelDECNonBlockingMeshExchange()
+{
+    //
+    const double sourceCoordsAll[2][8] = {
+        {0.4, 0.5, 0.4, 1.5, 1.6, 1.5, 1.6, 0.5}, {0.3, -0.5, 1.6, -0.5, 1.6, -1.5, 0.3, -1.5}
+    };
+    const double targetCoordsAll[3][16] = {
+        {0.7, 1.45, 0.7, 1.65, 0.9, 1.65, 0.9, 1.45, 1.1, 1.4, 1.1, 1.6, 1.3, 1.6, 1.3, 1.4},
+        {0.7, -0.6, 0.7, 0.7, 0.9, 0.7, 0.9, -0.6, 1.1, -0.7, 1.1, 0.6, 1.3, 0.6, 1.3, -0.7},
+        {0.7, -1.55, 0.7, -1.35, 0.9, -1.35, 0.9, -1.55, 1.1, -1.65, 1.1, -1.45, 1.3, -1.45, 1.3, -1.65}
+    };
+    mcIdType conn4All[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    double targetResults[3][2] = {{34., 34.}, {38.333333333333336, 42.666666666666664}, {47., 47.}};
+    //
+    int size;
+    int rank;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    //
+    if (size != 5)
+        return;
+    int nproc_source = 2;
+    set<int> procs_source;
+    set<int> procs_target;
+
+    for (int i = 0; i < nproc_source; i++) procs_source.insert(i);
+    for (int i = nproc_source; i < size; i++) procs_target.insert(i);
+    //
+    MEDCoupling::MEDCouplingUMesh *mesh = 0;
+    MEDCoupling::ParaMESH *paramesh = 0;
+    MEDCoupling::ParaFIELD *parafield = 0;
+    //
+    MEDCoupling::CommInterface interface;
+    //
+    ProcessorGroup *target_group = new MEDCoupling::MPIProcessorGroup(interface, procs_target);
+    ProcessorGroup *source_group = new MEDCoupling::MPIProcessorGroup(interface, procs_source);
+    //
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (source_group->containsMyRank())
+    {
+        mesh = MEDCouplingUMesh::New("sourcemesh2D", 2);
+        mesh->allocateCells(1);
+        mesh->insertNextCell(INTERP_KERNEL::NORM_QUAD4, 4, conn4All);
+        mesh->finishInsertingCells();
+        DataArrayDouble *myCoords = DataArrayDouble::New();
+        myCoords->alloc(4, 2);
+        const double *sourceCoords = sourceCoordsAll[rank];
+        std::copy(sourceCoords, sourceCoords + 8, myCoords->getPointer());
+        mesh->setCoords(myCoords);
+        myCoords->decrRef();
+        paramesh = new ParaMESH(mesh, *source_group, "source mesh");
+        MEDCoupling::ComponentTopology comptopo;
+        parafield = new ParaFIELD(ON_CELLS, NO_TIME, paramesh, comptopo);
+        double *value = parafield->getField()->getArray()->getPointer();
+        value[0] = 34 + 13 * ((double)rank);
+    }
+    else
+    {
+        mesh = MEDCouplingUMesh::New("targetmesh2D", 2);
+        mesh->allocateCells(2);
+        mesh->insertNextCell(INTERP_KERNEL::NORM_QUAD4, 4, conn4All);
+        mesh->insertNextCell(INTERP_KERNEL::NORM_QUAD4, 4, conn4All + 4);
+        mesh->finishInsertingCells();
+        DataArrayDouble *myCoords = DataArrayDouble::New();
+        myCoords->alloc(8, 2);
+        const double *targetCoords = targetCoordsAll[rank - nproc_source];
+        std::copy(targetCoords, targetCoords + 16, myCoords->getPointer());
+        mesh->setCoords(myCoords);
+        myCoords->decrRef();
+        paramesh = new ParaMESH(mesh, *target_group, "target mesh");
+        MEDCoupling::ComponentTopology comptopo;
+        parafield = new ParaFIELD(ON_CELLS, NO_TIME, paramesh, comptopo);
+    }
+    // test 1 - Conservative volumic
+    MEDCoupling::InterpKernelDEC dec(*source_group, *target_group);
+    dec.setNonBlockingMeshExchange(true);
+    CPPUNIT_ASSERT(dec.getNonBlockingMeshExchange());
+    parafield->getField()->setNature(IntensiveMaximum);
+    dec.setMethod("P0");
+    dec.attachLocalField(parafield);
+    dec.synchronize();
+    dec.setForcedRenormalization(false);
+    if (source_group->containsMyRank())
+        dec.sendData();
+    else
+    {
+        dec.recvData();
+        const double *res = parafield->getField()->getArray()->getConstPointer();
+        const double *expected = targetResults[rank - nproc_source];
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[0], res[0], 1e-13);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[1], res[1], 1e-13);
+    }
+    // test 2 - Conservative volumic reversed
+    MEDCoupling::InterpKernelDEC dec2(*source_group, *target_group);
+    dec2.setNonBlockingMeshExchange(true);
+    dec2.setMethod("P0");
+    dec2.attachLocalField(parafield);
+    dec2.synchronize();
+    dec2.setForcedRenormalization(false);
+    if (source_group->containsMyRank())
+    {
+        dec2.recvData();
+        const double *res = parafield->getField()->getArray()->getConstPointer();
+        CPPUNIT_ASSERT_EQUAL(1, (int)parafield->getField()->getNumberOfTuples());
+        const double expected[] = {37.8518518518519, 43.5333333333333};
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[rank], res[0], 1e-13);
+    }
+    else
+    {
+        double *res = parafield->getField()->getArray()->getPointer();
+        const double *toSet = targetResults[rank - nproc_source];
+        res[0] = toSet[0];
+        res[1] = toSet[1];
+        dec2.sendData();
+    }
+    //
+    delete parafield;
+    mesh->decrRef();
+    delete paramesh;
+    delete target_group;
+    delete source_group;
+    //
+    MPI_Barrier(MPI_COMM_WORLD);
+}
+
 void
 ParaMEDMEMTest::testInterpKernelDECNonOverlapp_2D_P0P1P1P0()
 {